@@ -0,0 +1,125 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocalution_bench_matrix.hpp"
+#include "rocalution_bench_routines.hpp"
+#include "rocalution_bench_utility.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <rocalution/rocalution.hpp>
+
+using namespace rocalution;
+
+template <typename T>
+bool run_benchmarks(const bench_arguments& arg, std::vector<bench_result>* results)
+{
+    LocalMatrix<T> A;
+
+    if(bench_matrix(arg, &A) == false)
+    {
+        return false;
+    }
+
+    A.Info();
+
+    const std::string& r = arg.routine;
+
+    if(bench_selected(r, "dot") || bench_selected(r, "norm") || bench_selected(r, "addscale")
+       || bench_selected(r, "scaleadd2"))
+    {
+        bench_blas1(arg, A, results);
+    }
+
+    if(bench_selected(r, "spmv") == true)
+    {
+        bench_spmv(arg, A, results);
+    }
+
+    if(bench_selected(r, "convert") == true)
+    {
+        bench_convert(arg, A, results);
+    }
+
+    if(bench_selected(r, "spgemm") == true)
+    {
+        bench_spgemm(arg, A, results);
+    }
+
+    if(bench_selected(r, "ilu0") || bench_selected(r, "lusolve") || bench_selected(r, "ic0")
+       || bench_selected(r, "llsolve"))
+    {
+        bench_ilu(arg, A, results);
+    }
+
+    if(bench_selected(r, "amg-setup") || bench_selected(r, "amg-cycle"))
+    {
+        bench_amg(arg, A, results);
+    }
+
+    if(bench_selected(r, "krylov") == true)
+    {
+        bench_krylov(arg, A, results);
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    bench_arguments arg;
+
+    if(bench_parse_arguments(argc, argv, &arg) == false)
+    {
+        return EXIT_FAILURE;
+    }
+
+    // Initialize rocALUTION
+    init_rocalution();
+
+    if(arg.omp_threads > 0)
+    {
+        set_omp_threads_rocalution(arg.omp_threads);
+    }
+
+    // Print rocALUTION info
+    info_rocalution();
+
+    std::vector<bench_result> results;
+
+    bool status = (arg.precision == 's') ? run_benchmarks<float>(arg, &results)
+                                         : run_benchmarks<double>(arg, &results);
+
+    if(status == true)
+    {
+        bench_print(arg, results);
+        status = bench_write(arg, results);
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return (status == true) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
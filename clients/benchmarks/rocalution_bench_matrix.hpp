@@ -0,0 +1,239 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCALUTION_BENCH_MATRIX_HPP
+#define ROCALUTION_BENCH_MATRIX_HPP
+
+#include "rocalution_bench_utility.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <rocalution/rocalution.hpp>
+
+/* ============================================================================================ */
+/*! \brief  Generate a 5 (2D) or 7 (3D) point stencil matrix on a structured grid. The
+ *          couplings in x, y and z direction are -cx, -cy and -cz, zero couplings are skipped.
+ */
+template <typename T>
+void bench_gen_stencil(int                         nx,
+                       int                         ny,
+                       int                         nz,
+                       double                      cx,
+                       double                      cy,
+                       double                      cz,
+                       rocalution::LocalMatrix<T>* A)
+{
+    int64_t n       = static_cast<int64_t>(nx) * ny * nz;
+    int64_t nnz_max = n * 7;
+
+    rocalution::PtrType* row_offset = NULL;
+    int*                 col        = NULL;
+    T*                   val        = NULL;
+
+    rocalution::allocate_host(n + 1, &row_offset);
+    rocalution::allocate_host(nnz_max, &col);
+    rocalution::allocate_host(nnz_max, &val);
+
+    T diag = static_cast<T>(2.0 * (cx + cy + cz));
+
+    int64_t nnz   = 0;
+    row_offset[0] = 0;
+
+    for(int iz = 0; iz < nz; ++iz)
+    {
+        for(int iy = 0; iy < ny; ++iy)
+        {
+            for(int ix = 0; ix < nx; ++ix)
+            {
+                int row = (iz * ny + iy) * nx + ix;
+
+                // Columns in ascending order
+                if(iz > 0 && cz != 0.0)
+                {
+                    col[nnz]   = row - nx * ny;
+                    val[nnz++] = static_cast<T>(-cz);
+                }
+
+                if(iy > 0 && cy != 0.0)
+                {
+                    col[nnz]   = row - nx;
+                    val[nnz++] = static_cast<T>(-cy);
+                }
+
+                if(ix > 0 && cx != 0.0)
+                {
+                    col[nnz]   = row - 1;
+                    val[nnz++] = static_cast<T>(-cx);
+                }
+
+                col[nnz]   = row;
+                val[nnz++] = diag;
+
+                if(ix < nx - 1 && cx != 0.0)
+                {
+                    col[nnz]   = row + 1;
+                    val[nnz++] = static_cast<T>(-cx);
+                }
+
+                if(iy < ny - 1 && cy != 0.0)
+                {
+                    col[nnz]   = row + nx;
+                    val[nnz++] = static_cast<T>(-cy);
+                }
+
+                if(iz < nz - 1 && cz != 0.0)
+                {
+                    col[nnz]   = row + nx * ny;
+                    val[nnz++] = static_cast<T>(-cz);
+                }
+
+                row_offset[row + 1] = nnz;
+            }
+        }
+    }
+
+    A->SetDataPtrCSR(&row_offset, &col, &val, "A", nnz, n, n);
+}
+
+/* ============================================================================================ */
+/*! \brief  Generate a random, diagonally dominant matrix, where the number of entries per row
+ *          follows a power-law distribution with exponent 2.5, sampling at least 2
+ *          off-diagonal entries per row.
+ */
+template <typename T>
+void bench_gen_powerlaw(int n, rocalution::LocalMatrix<T>* A)
+{
+    std::mt19937                           rng(12345);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::uniform_int_distribution<int>     column(0, n - 1);
+
+    std::vector<rocalution::PtrType> row_offset(n + 1);
+    std::vector<int>                 col;
+    std::vector<T>                   val;
+
+    std::vector<int> row_col;
+
+    row_offset[0] = 0;
+
+    for(int i = 0; i < n; ++i)
+    {
+        // Inverse transform sampling of the number of off-diagonal entries
+        double deg = 2.0 * std::pow(1.0 - uniform(rng), -1.0 / 1.5);
+        int    k   = static_cast<int>(std::min(deg, static_cast<double>(n - 1)));
+
+        row_col.resize(k + 1);
+        row_col[0] = i;
+
+        for(int j = 1; j <= k; ++j)
+        {
+            row_col[j] = column(rng);
+        }
+
+        std::sort(row_col.begin(), row_col.end());
+        row_col.erase(std::unique(row_col.begin(), row_col.end()), row_col.end());
+
+        // Off-diagonal entries in (-1, 0], diagonal entry dominates the row
+        size_t diag = 0;
+        double sum  = 0.0;
+
+        for(size_t j = 0; j < row_col.size(); ++j)
+        {
+            col.push_back(row_col[j]);
+
+            if(row_col[j] == i)
+            {
+                diag = val.size();
+                val.push_back(static_cast<T>(0));
+            }
+            else
+            {
+                double v = -uniform(rng);
+
+                sum += -v;
+                val.push_back(static_cast<T>(v));
+            }
+        }
+
+        val[diag]         = static_cast<T>(sum + 1.0);
+        row_offset[i + 1] = col.size();
+    }
+
+    int64_t nnz = col.size();
+
+    rocalution::PtrType* csr_row_ptr = NULL;
+    int*                 csr_col     = NULL;
+    T*                   csr_val     = NULL;
+
+    rocalution::allocate_host(n + 1, &csr_row_ptr);
+    rocalution::allocate_host(nnz, &csr_col);
+    rocalution::allocate_host(nnz, &csr_val);
+
+    std::copy(row_offset.begin(), row_offset.end(), csr_row_ptr);
+    std::copy(col.begin(), col.end(), csr_col);
+    std::copy(val.begin(), val.end(), csr_val);
+
+    A->SetDataPtrCSR(&csr_row_ptr, &csr_col, &csr_val, "A", nnz, n, n);
+}
+
+/* ============================================================================================ */
+/*! \brief  Generate or read the benchmark matrix in CSR format */
+template <typename T>
+bool bench_matrix(const bench_arguments& arg, rocalution::LocalMatrix<T>* A)
+{
+    const std::string& name = arg.matrix;
+
+    if(name == "laplacian2d")
+    {
+        bench_gen_stencil(arg.size, arg.size, 1, 1.0, 1.0, 0.0, A);
+    }
+    else if(name == "laplacian3d")
+    {
+        bench_gen_stencil(arg.size, arg.size, arg.size, 1.0, 1.0, 1.0, A);
+    }
+    else if(name == "anisotropic2d")
+    {
+        bench_gen_stencil(arg.size, arg.size, 1, arg.epsilon, 1.0, 0.0, A);
+    }
+    else if(name == "powerlaw")
+    {
+        bench_gen_powerlaw(arg.size * arg.size, A);
+    }
+    else if(name.size() > 4 && name.compare(name.size() - 4, 4, ".mtx") == 0)
+    {
+        A->ReadFileMTX(name);
+    }
+    else
+    {
+        std::cerr << "Unknown matrix " << name << std::endl;
+        return false;
+    }
+
+    return A->GetNnz() > 0;
+}
+
+#endif // ROCALUTION_BENCH_MATRIX_HPP
@@ -0,0 +1,903 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCALUTION_BENCH_ROUTINES_HPP
+#define ROCALUTION_BENCH_ROUTINES_HPP
+
+#include "rocalution_bench_utility.hpp"
+
+#include <cctype>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <rocalution/rocalution.hpp>
+
+using namespace rocalution;
+
+#define BENCH_FORMATS "csr,mcsr,bcsr,coo,dia,ell,hyb,sell"
+#define BENCH_SOLVERS "cg,bicgstab,gmres,fgmres"
+#define BENCH_PRECONDS "none,jacobi,ilu,ic,saamg"
+#define BENCH_AMGS "sa,ua,rs,pairwise"
+
+/* ============================================================================================ */
+/*! \brief  Matrix format from its name, returns false for unknown formats */
+inline bool bench_format(const std::string& name, unsigned int* format)
+{
+    for(unsigned int i = 0; i < 9; ++i)
+    {
+        std::string fmt = _matrix_format_names[i];
+
+        for(size_t j = 0; j < fmt.size(); ++j)
+        {
+            fmt[j] = static_cast<char>(tolower(fmt[j]));
+        }
+
+        if(fmt == name)
+        {
+            *format = i;
+            return true;
+        }
+    }
+
+    std::cerr << "Unknown matrix format " << name << std::endl;
+
+    return false;
+}
+
+/* ============================================================================================ */
+/*! \brief  Block dimension to pass to LocalMatrix::ConvertTo(), only BCSR accepts blocks > 1 */
+inline int bench_blockdim(unsigned int format, int blockdim)
+{
+    return (format == BCSR) ? blockdim : 1;
+}
+
+/* ============================================================================================ */
+/*! \brief  Result entry with the matrix sizes filled in */
+template <typename T>
+bench_result bench_init_result(const std::string&    routine,
+                               const std::string&    variant,
+                               const LocalMatrix<T>& A)
+{
+    bench_result res;
+
+    res.routine = routine;
+    res.variant = variant;
+    res.m       = A.GetM();
+    res.n       = A.GetN();
+    res.nnz     = A.GetNnz();
+
+    return res;
+}
+
+/* ============================================================================================ */
+/*  Vector BLAS 1                                                                               */
+/* ============================================================================================ */
+template <typename T>
+class bench_blas1_kernel : public bench_kernel
+{
+public:
+    bench_blas1_kernel(const std::string& op, LocalVector<T>* x, LocalVector<T>* y)
+        : op_(op)
+        , x_(x)
+        , y_(y)
+    {
+    }
+
+    virtual void Run(void)
+    {
+        if(this->op_ == "dot")
+        {
+            this->x_->Dot(*this->y_);
+        }
+        else if(this->op_ == "norm")
+        {
+            this->x_->Norm();
+        }
+        else if(this->op_ == "addscale")
+        {
+            this->y_->AddScale(*this->x_, static_cast<T>(1e-3));
+        }
+        else
+        {
+            this->y_->ScaleAdd2(static_cast<T>(0.5), *this->x_, static_cast<T>(0.25), *this->x_,
+                                static_cast<T>(0.25));
+        }
+    }
+
+private:
+    std::string     op_;
+    LocalVector<T>* x_;
+    LocalVector<T>* y_;
+};
+
+template <typename T>
+void bench_blas1(const bench_arguments&     arg,
+                 const LocalMatrix<T>&      A,
+                 std::vector<bench_result>* results)
+{
+    const char* ops[4] = {"dot", "norm", "addscale", "scaleadd2"};
+
+    // Bytes and flops per entry
+    const double nbytes[4] = {2.0, 1.0, 3.0, 4.0};
+    const double nflops[4] = {2.0, 2.0, 2.0, 5.0};
+
+    LocalVector<T> x;
+    LocalVector<T> y;
+
+    x.Allocate("x", A.GetM());
+    y.Allocate("y", A.GetM());
+
+    x.SetRandomUniform(1234ULL, static_cast<T>(-1), static_cast<T>(1));
+    y.SetRandomUniform(4321ULL, static_cast<T>(-1), static_cast<T>(1));
+
+    if(arg.use_acc == true)
+    {
+        x.MoveToAccelerator();
+        y.MoveToAccelerator();
+    }
+
+    for(int i = 0; i < 4; ++i)
+    {
+        if(bench_selected(arg.routine, ops[i]) == false)
+        {
+            continue;
+        }
+
+        bench_result          res = bench_init_result(ops[i], "", A);
+        bench_blas1_kernel<T> kernel(ops[i], &x, &y);
+
+        res.nnz   = 0;
+        res.bytes = nbytes[i] * A.GetM() * sizeof(T);
+        res.flops = nflops[i] * A.GetM();
+
+        bench_time(arg, kernel, &res);
+        results->push_back(res);
+    }
+}
+
+/* ============================================================================================ */
+/*  SpMV per format                                                                             */
+/* ============================================================================================ */
+template <typename T>
+class bench_spmv_kernel : public bench_kernel
+{
+public:
+    bench_spmv_kernel(const LocalMatrix<T>* A, const LocalVector<T>* x, LocalVector<T>* y)
+        : A_(A)
+        , x_(x)
+        , y_(y)
+    {
+    }
+
+    virtual void Run(void)
+    {
+        this->A_->Apply(*this->x_, this->y_);
+    }
+
+private:
+    const LocalMatrix<T>* A_;
+    const LocalVector<T>* x_;
+    LocalVector<T>*       y_;
+};
+
+template <typename T>
+void bench_spmv(const bench_arguments&     arg,
+                const LocalMatrix<T>&      A,
+                std::vector<bench_result>* results)
+{
+    std::vector<std::string> formats = bench_split(arg.format, BENCH_FORMATS);
+
+    LocalVector<T> x;
+    LocalVector<T> y;
+
+    x.Allocate("x", A.GetN());
+    y.Allocate("y", A.GetM());
+
+    x.SetRandomUniform(1234ULL, static_cast<T>(-1), static_cast<T>(1));
+
+    if(arg.use_acc == true)
+    {
+        x.MoveToAccelerator();
+        y.MoveToAccelerator();
+    }
+
+    for(size_t i = 0; i < formats.size(); ++i)
+    {
+        unsigned int format;
+
+        if(bench_format(formats[i], &format) == false)
+        {
+            continue;
+        }
+
+        LocalMatrix<T> B;
+
+        B.CopyFrom(A);
+        B.ConvertTo(format, bench_blockdim(format, arg.blockdim));
+
+        // The conversion falls back to CSR, if the matrix is not suited for the format
+        if(B.GetFormat() != format)
+        {
+            std::cerr << "Skipping SpMV in " << formats[i] << " format, conversion failed"
+                      << std::endl;
+            continue;
+        }
+
+        if(arg.use_acc == true)
+        {
+            B.MoveToAccelerator();
+        }
+
+        bench_result         res = bench_init_result("spmv", formats[i], A);
+        bench_spmv_kernel<T> kernel(&B, &x, &y);
+
+        // Stored entries, including padding, determine the traffic, the useful entries the flops
+        res.bytes
+            = bench_spmv_bytes(format, B.GetM(), B.GetN(), B.GetNnz(), arg.blockdim, sizeof(T));
+        res.flops = 2.0 * A.GetNnz();
+
+        bench_time(arg, kernel, &res);
+        results->push_back(res);
+    }
+}
+
+/* ============================================================================================ */
+/*  Format conversions                                                                          */
+/* ============================================================================================ */
+template <typename T>
+class bench_convert_kernel : public bench_kernel
+{
+public:
+    bench_convert_kernel(const LocalMatrix<T>* A,
+                         LocalMatrix<T>*       B,
+                         unsigned int          from,
+                         unsigned int          to,
+                         int                   blockdim)
+        : A_(A)
+        , B_(B)
+        , from_(from)
+        , to_(to)
+        , blockdim_(blockdim)
+    {
+    }
+
+    virtual void Setup(void)
+    {
+        this->B_->CloneFrom(*this->A_);
+        this->B_->ConvertTo(this->from_, bench_blockdim(this->from_, this->blockdim_));
+    }
+
+    virtual void Run(void)
+    {
+        this->B_->ConvertTo(this->to_, bench_blockdim(this->to_, this->blockdim_));
+    }
+
+private:
+    const LocalMatrix<T>* A_;
+    LocalMatrix<T>*       B_;
+    unsigned int          from_;
+    unsigned int          to_;
+    int                   blockdim_;
+};
+
+template <typename T>
+void bench_convert(const bench_arguments&     arg,
+                   const LocalMatrix<T>&      A,
+                   std::vector<bench_result>* results)
+{
+    std::vector<std::string> formats = bench_split(arg.format, BENCH_FORMATS);
+
+    for(size_t i = 0; i < formats.size(); ++i)
+    {
+        unsigned int format;
+
+        if(bench_format(formats[i], &format) == false || format == CSR)
+        {
+            continue;
+        }
+
+        LocalMatrix<T> B;
+
+        B.CloneFrom(A);
+
+        if(arg.use_acc == true)
+        {
+            B.MoveToAccelerator();
+        }
+
+        B.ConvertTo(format, bench_blockdim(format, arg.blockdim));
+
+        if(B.GetFormat() != format)
+        {
+            std::cerr << "Skipping conversion to " << formats[i] << " format, conversion failed"
+                      << std::endl;
+            continue;
+        }
+
+        double csr_bytes = bench_csr_bytes(A.GetM(), A.GetNnz(), sizeof(T));
+        double fmt_bytes = bench_spmv_bytes(format, B.GetM(), B.GetN(), B.GetNnz(), arg.blockdim,
+                                            sizeof(T))
+                           - (B.GetM() + B.GetN()) * sizeof(T);
+
+        // Both directions, CSR to format and format to CSR
+        for(int dir = 0; dir < 2; ++dir)
+        {
+            unsigned int from = (dir == 0) ? static_cast<unsigned int>(CSR) : format;
+            unsigned int to   = (dir == 0) ? format : static_cast<unsigned int>(CSR);
+
+            std::string variant = (dir == 0) ? "csr-" + formats[i] : formats[i] + "-csr";
+
+            LocalMatrix<T>          C;
+            bench_result            res = bench_init_result("convert", variant, A);
+            bench_convert_kernel<T> kernel(&B, &C, from, to, arg.blockdim);
+
+            // Read the source and write the destination format
+            res.bytes = csr_bytes + fmt_bytes;
+
+            bench_time(arg, kernel, &res);
+            results->push_back(res);
+        }
+    }
+}
+
+/* ============================================================================================ */
+/*  SpGEMM                                                                                      */
+/* ============================================================================================ */
+template <typename T>
+class bench_spgemm_kernel : public bench_kernel
+{
+public:
+    bench_spgemm_kernel(const LocalMatrix<T>* A, LocalMatrix<T>* C)
+        : A_(A)
+        , C_(C)
+    {
+    }
+
+    virtual void Setup(void)
+    {
+        this->C_->Clear();
+    }
+
+    virtual void Run(void)
+    {
+        this->C_->MatrixMult(*this->A_, *this->A_);
+    }
+
+private:
+    const LocalMatrix<T>* A_;
+    LocalMatrix<T>*       C_;
+};
+
+// Number of multiplications of the product A * A
+template <typename T>
+double bench_spgemm_products(const LocalMatrix<T>& A)
+{
+    LocalMatrix<T> tmp;
+
+    tmp.CopyFrom(A);
+    tmp.MoveToHost();
+    tmp.ConvertToCSR();
+
+    PtrType* row_offset = NULL;
+    int*     col        = NULL;
+    T*       val        = NULL;
+
+    tmp.LeaveDataPtrCSR(&row_offset, &col, &val);
+
+    double products = 0.0;
+
+    for(int i = 0; i < A.GetM(); ++i)
+    {
+        for(PtrType j = row_offset[i]; j < row_offset[i + 1]; ++j)
+        {
+            products += static_cast<double>(row_offset[col[j] + 1] - row_offset[col[j]]);
+        }
+    }
+
+    free_host(&row_offset);
+    free_host(&col);
+    free_host(&val);
+
+    return products;
+}
+
+template <typename T>
+void bench_spgemm(const bench_arguments&     arg,
+                  const LocalMatrix<T>&      A,
+                  std::vector<bench_result>* results)
+{
+    LocalMatrix<T> B;
+    LocalMatrix<T> C;
+
+    B.CloneFrom(A);
+
+    if(arg.use_acc == true)
+    {
+        B.MoveToAccelerator();
+        C.MoveToAccelerator();
+    }
+
+    bench_result           res = bench_init_result("spgemm", "A*A", A);
+    bench_spgemm_kernel<T> kernel(&B, &C);
+
+    bench_time(arg, kernel, &res);
+
+    // Read A twice and write C
+    res.bytes = 2.0 * bench_csr_bytes(A.GetM(), A.GetNnz(), sizeof(T))
+                + bench_csr_bytes(C.GetM(), C.GetNnz(), sizeof(T));
+    res.flops = 2.0 * bench_spgemm_products(A);
+
+    results->push_back(res);
+}
+
+/* ============================================================================================ */
+/*  Triangular solves and incomplete factorizations                                             */
+/* ============================================================================================ */
+template <typename T>
+class bench_trsv_kernel : public bench_kernel
+{
+public:
+    bench_trsv_kernel(const LocalMatrix<T>* F,
+                      const LocalVector<T>* inv_diag,
+                      const LocalVector<T>* x,
+                      LocalVector<T>*       y)
+        : F_(F)
+        , inv_diag_(inv_diag)
+        , x_(x)
+        , y_(y)
+    {
+    }
+
+    virtual void Run(void)
+    {
+        if(this->inv_diag_ == NULL)
+        {
+            this->F_->LUSolve(*this->x_, this->y_);
+        }
+        else
+        {
+            this->F_->LLSolve(*this->x_, *this->inv_diag_, this->y_);
+        }
+    }
+
+private:
+    const LocalMatrix<T>* F_;
+    const LocalVector<T>* inv_diag_;
+    const LocalVector<T>* x_;
+    LocalVector<T>*       y_;
+};
+
+template <typename T>
+class bench_factorize_kernel : public bench_kernel
+{
+public:
+    bench_factorize_kernel(const LocalMatrix<T>* A, LocalMatrix<T>* F, LocalVector<T>* inv_diag)
+        : A_(A)
+        , F_(F)
+        , inv_diag_(inv_diag)
+    {
+    }
+
+    virtual void Setup(void)
+    {
+        if(this->inv_diag_ == NULL)
+        {
+            this->F_->CopyFrom(*this->A_);
+        }
+        else
+        {
+            this->A_->ExtractL(this->F_, true);
+        }
+    }
+
+    virtual void Run(void)
+    {
+        if(this->inv_diag_ == NULL)
+        {
+            this->F_->ILU0Factorize();
+        }
+        else
+        {
+            this->F_->ICFactorize(this->inv_diag_);
+        }
+    }
+
+private:
+    const LocalMatrix<T>* A_;
+    LocalMatrix<T>*       F_;
+    LocalVector<T>*       inv_diag_;
+};
+
+template <typename T>
+void bench_ilu(const bench_arguments&     arg,
+               const LocalMatrix<T>&      A,
+               std::vector<bench_result>* results)
+{
+    // Routine names of the factorization and the solve of ILU(0) and IC(0)
+    const char* fact[2]  = {"ilu0", "ic0"};
+    const char* solve[2] = {"lusolve", "llsolve"};
+
+    LocalMatrix<T> B;
+    LocalVector<T> x;
+    LocalVector<T> y;
+
+    B.CloneFrom(A);
+
+    x.Allocate("x", A.GetM());
+    y.Allocate("y", A.GetM());
+
+    x.SetRandomUniform(1234ULL, static_cast<T>(-1), static_cast<T>(1));
+
+    if(arg.use_acc == true)
+    {
+        B.MoveToAccelerator();
+        x.MoveToAccelerator();
+        y.MoveToAccelerator();
+    }
+
+    for(int ic = 0; ic < 2; ++ic)
+    {
+        if(bench_selected(arg.routine, fact[ic]) == false
+           && bench_selected(arg.routine, solve[ic]) == false)
+        {
+            continue;
+        }
+
+        LocalMatrix<T> F;
+        LocalVector<T> inv_diag;
+
+        F.CloneBackend(B);
+        inv_diag.CloneBackend(B);
+
+        LocalVector<T>*           d = (ic == 0) ? NULL : &inv_diag;
+        bench_factorize_kernel<T> factorize(&B, &F, d);
+
+        if(bench_selected(arg.routine, fact[ic]) == true)
+        {
+            bench_result res = bench_init_result(fact[ic], "", A);
+
+            bench_time(arg, factorize, &res);
+            results->push_back(res);
+        }
+
+        if(bench_selected(arg.routine, solve[ic]) == true)
+        {
+            factorize.Setup();
+            factorize.Run();
+
+            if(ic == 0)
+            {
+                F.LUAnalyse();
+            }
+            else
+            {
+                F.LLAnalyse();
+            }
+
+            bench_result         res = bench_init_result(solve[ic], "", A);
+            bench_trsv_kernel<T> kernel(&F, d, &x, &y);
+
+            // LU reads the factors once, LL reads L for the forward and the backward sweep
+            res.nnz   = F.GetNnz();
+            res.bytes = (ic + 1) * bench_csr_bytes(F.GetM(), F.GetNnz(), sizeof(T))
+                        + 2.0 * (ic + 1) * A.GetM() * sizeof(T);
+            res.flops = 2.0 * (ic + 1) * F.GetNnz();
+
+            bench_time(arg, kernel, &res);
+            results->push_back(res);
+        }
+    }
+}
+
+/* ============================================================================================ */
+/*  AMG setup and cycle                                                                         */
+/* ============================================================================================ */
+template <typename T>
+BaseAMG<LocalMatrix<T>, LocalVector<T>, T>* bench_amg_create(const std::string& name)
+{
+    if(name == "sa")
+    {
+        return new SAAMG<LocalMatrix<T>, LocalVector<T>, T>;
+    }
+    else if(name == "ua")
+    {
+        return new UAAMG<LocalMatrix<T>, LocalVector<T>, T>;
+    }
+    else if(name == "rs")
+    {
+        return new RugeStuebenAMG<LocalMatrix<T>, LocalVector<T>, T>;
+    }
+    else if(name == "pairwise")
+    {
+        return new PairwiseAMG<LocalMatrix<T>, LocalVector<T>, T>;
+    }
+
+    std::cerr << "Unknown AMG " << name << std::endl;
+
+    return NULL;
+}
+
+template <typename T>
+class bench_amg_kernel : public bench_kernel
+{
+public:
+    bench_amg_kernel(BaseAMG<LocalMatrix<T>, LocalVector<T>, T>* amg,
+                     const LocalVector<T>*                       b,
+                     LocalVector<T>*                             x)
+        : amg_(amg)
+        , b_(b)
+        , x_(x)
+    {
+    }
+
+    virtual void Setup(void)
+    {
+        if(this->x_ != NULL)
+        {
+            this->x_->Zeros();
+        }
+    }
+
+    virtual void Run(void)
+    {
+        if(this->x_ == NULL)
+        {
+            this->amg_->Build();
+        }
+        else
+        {
+            this->amg_->Solve(*this->b_, this->x_);
+        }
+    }
+
+private:
+    BaseAMG<LocalMatrix<T>, LocalVector<T>, T>* amg_;
+    const LocalVector<T>*                       b_;
+    LocalVector<T>*                             x_;
+};
+
+template <typename T>
+void bench_amg(const bench_arguments&     arg,
+               const LocalMatrix<T>&      A,
+               std::vector<bench_result>* results)
+{
+    std::vector<std::string> amgs = bench_split(arg.amg, BENCH_AMGS);
+
+    LocalMatrix<T> B;
+    LocalVector<T> b;
+    LocalVector<T> x;
+
+    B.CloneFrom(A);
+
+    b.Allocate("b", A.GetM());
+    x.Allocate("x", A.GetN());
+
+    b.Ones();
+
+    if(arg.use_acc == true)
+    {
+        B.MoveToAccelerator();
+        b.MoveToAccelerator();
+        x.MoveToAccelerator();
+    }
+
+    for(size_t i = 0; i < amgs.size(); ++i)
+    {
+        BaseAMG<LocalMatrix<T>, LocalVector<T>, T>* amg = bench_amg_create<T>(amgs[i]);
+
+        if(amg == NULL)
+        {
+            continue;
+        }
+
+        amg->SetOperator(B);
+        amg->Verbose(0);
+
+        if(bench_selected(arg.routine, "amg-setup") == true)
+        {
+            bench_result        res = bench_init_result("amg-setup", amgs[i], A);
+            bench_amg_kernel<T> kernel(amg, NULL, NULL);
+
+            bench_time(arg, kernel, &res);
+            results->push_back(res);
+        }
+
+        if(bench_selected(arg.routine, "amg-cycle") == true)
+        {
+            // A single cycle with zero initial guess, including the residual norms
+            amg->Build();
+            amg->InitMaxIter(1);
+
+            bench_result        res = bench_init_result("amg-cycle", amgs[i], A);
+            bench_amg_kernel<T> kernel(amg, &b, &x);
+
+            bench_time(arg, kernel, &res);
+            results->push_back(res);
+        }
+
+        delete amg;
+    }
+}
+
+/* ============================================================================================ */
+/*  Krylov solves                                                                               */
+/* ============================================================================================ */
+template <typename T>
+IterativeLinearSolver<LocalMatrix<T>, LocalVector<T>, T>*
+    bench_solver_create(const std::string& name)
+{
+    if(name == "cg")
+    {
+        return new CG<LocalMatrix<T>, LocalVector<T>, T>;
+    }
+    else if(name == "bicgstab")
+    {
+        return new BiCGStab<LocalMatrix<T>, LocalVector<T>, T>;
+    }
+    else if(name == "gmres")
+    {
+        return new GMRES<LocalMatrix<T>, LocalVector<T>, T>;
+    }
+    else if(name == "fgmres")
+    {
+        return new FGMRES<LocalMatrix<T>, LocalVector<T>, T>;
+    }
+
+    std::cerr << "Unknown solver " << name << std::endl;
+
+    return NULL;
+}
+
+template <typename T>
+Solver<LocalMatrix<T>, LocalVector<T>, T>* bench_precond_create(const std::string& name)
+{
+    if(name == "jacobi")
+    {
+        return new Jacobi<LocalMatrix<T>, LocalVector<T>, T>;
+    }
+    else if(name == "ilu")
+    {
+        return new ILU<LocalMatrix<T>, LocalVector<T>, T>;
+    }
+    else if(name == "ic")
+    {
+        return new IC<LocalMatrix<T>, LocalVector<T>, T>;
+    }
+    else if(name == "saamg")
+    {
+        SAAMG<LocalMatrix<T>, LocalVector<T>, T>* amg
+            = new SAAMG<LocalMatrix<T>, LocalVector<T>, T>;
+
+        amg->Verbose(0);
+
+        return amg;
+    }
+    else if(name != "none")
+    {
+        std::cerr << "Unknown preconditioner " << name << std::endl;
+    }
+
+    return NULL;
+}
+
+template <typename T>
+class bench_solve_kernel : public bench_kernel
+{
+public:
+    bench_solve_kernel(IterativeLinearSolver<LocalMatrix<T>, LocalVector<T>, T>* ls,
+                       const LocalVector<T>*                                     b,
+                       LocalVector<T>*                                           x)
+        : ls_(ls)
+        , b_(b)
+        , x_(x)
+    {
+    }
+
+    virtual void Setup(void)
+    {
+        this->x_->Zeros();
+    }
+
+    virtual void Run(void)
+    {
+        this->ls_->Solve(*this->b_, this->x_);
+    }
+
+private:
+    IterativeLinearSolver<LocalMatrix<T>, LocalVector<T>, T>* ls_;
+    const LocalVector<T>*                                     b_;
+    LocalVector<T>*                                           x_;
+};
+
+template <typename T>
+void bench_krylov(const bench_arguments&     arg,
+                  const LocalMatrix<T>&      A,
+                  std::vector<bench_result>* results)
+{
+    std::vector<std::string> solvers  = bench_split(arg.solver, BENCH_SOLVERS);
+    std::vector<std::string> preconds = bench_split(arg.precond, BENCH_PRECONDS);
+
+    LocalMatrix<T> B;
+    LocalVector<T> b;
+    LocalVector<T> x;
+
+    B.CloneFrom(A);
+
+    b.Allocate("b", A.GetM());
+    x.Allocate("x", A.GetN());
+
+    b.Ones();
+
+    if(arg.use_acc == true)
+    {
+        B.MoveToAccelerator();
+        b.MoveToAccelerator();
+        x.MoveToAccelerator();
+    }
+
+    for(size_t i = 0; i < solvers.size(); ++i)
+    {
+        for(size_t j = 0; j < preconds.size(); ++j)
+        {
+            IterativeLinearSolver<LocalMatrix<T>, LocalVector<T>, T>* ls
+                = bench_solver_create<T>(solvers[i]);
+
+            if(ls == NULL)
+            {
+                continue;
+            }
+
+            Solver<LocalMatrix<T>, LocalVector<T>, T>* p = bench_precond_create<T>(preconds[j]);
+
+            ls->SetOperator(B);
+
+            if(p != NULL)
+            {
+                ls->SetPreconditioner(*p);
+            }
+
+            ls->Init(0.0, arg.tol, 1e8, arg.maxiter);
+            ls->Verbose(0);
+            ls->Build();
+
+            std::string           variant = solvers[i] + "+" + preconds[j];
+            bench_result          res     = bench_init_result("krylov", variant, A);
+            bench_solve_kernel<T> kernel(ls, &b, &x);
+
+            bench_time(arg, kernel, &res);
+
+            res.iter = ls->GetIterationCount();
+
+            results->push_back(res);
+
+            ls->Clear();
+
+            delete ls;
+            delete p;
+        }
+    }
+}
+
+#endif // ROCALUTION_BENCH_ROUTINES_HPP
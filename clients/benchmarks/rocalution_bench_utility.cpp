@@ -0,0 +1,437 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocalution_bench_utility.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+using namespace rocalution;
+
+static void bench_usage(const char* name)
+{
+    std::cout
+        << "Usage: " << name << " [options]\n"
+        << "\n"
+        << "  --routine <list>     routines to run, comma separated (default all)\n"
+        << "                       dot, norm, addscale, scaleadd2, spmv, convert, spgemm,\n"
+        << "                       lusolve, llsolve, ilu0, ic0, amg-setup, amg-cycle, krylov\n"
+        << "  --matrix <name>      laplacian2d, laplacian3d, anisotropic2d, powerlaw or a .mtx\n"
+        << "                       file (default laplacian2d)\n"
+        << "  --size <n>           grid points per dimension, the power-law matrix has size^2\n"
+        << "                       rows (default 1000)\n"
+        << "  --epsilon <e>        coupling in x direction of the anisotropic problem (default "
+           "1e-3)\n"
+        << "  --format <list>      csr, mcsr, bcsr, coo, dia, ell, hyb, sell (default all)\n"
+        << "  --blockdim <n>       block dimension of BCSR (default 2)\n"
+        << "  --precision <s|d>    single or double precision (default d)\n"
+        << "  --warmup <n>         untimed calls before measuring (default 2)\n"
+        << "  --iters <n>          timed calls (default 10)\n"
+        << "  --threads <n>        number of OpenMP threads (default all)\n"
+        << "  --host               run on the host, even if an accelerator is available\n"
+        << "  --solver <list>      cg, bicgstab, gmres, fgmres (default all)\n"
+        << "  --precond <list>     none, jacobi, ilu, ic, saamg (default none,jacobi,ilu,saamg)\n"
+        << "  --amg <list>         sa, ua, rs, pairwise (default all)\n"
+        << "  --tol <t>            relative tolerance of the solvers (default 1e-8)\n"
+        << "  --maxiter <n>        maximum number of solver iterations (default 1000)\n"
+        << "  --output <file>      write results as JSON, or as CSV if the file ends in .csv\n"
+        << std::endl;
+}
+
+bool bench_parse_arguments(int argc, char* argv[], bench_arguments* arg)
+{
+    for(int i = 1; i < argc; ++i)
+    {
+        std::string opt = argv[i];
+
+        if(opt == "--help" || opt == "-h")
+        {
+            bench_usage(argv[0]);
+            return false;
+        }
+
+        if(opt == "--host")
+        {
+            arg->use_acc = false;
+            continue;
+        }
+
+        // All other options expect a value
+        if(i + 1 >= argc)
+        {
+            std::cerr << "Missing value for option " << opt << std::endl;
+            bench_usage(argv[0]);
+            return false;
+        }
+
+        const char* val = argv[++i];
+
+        if(opt == "--routine")
+        {
+            arg->routine = val;
+        }
+        else if(opt == "--matrix")
+        {
+            arg->matrix = val;
+        }
+        else if(opt == "--size")
+        {
+            arg->size = atoi(val);
+        }
+        else if(opt == "--epsilon")
+        {
+            arg->epsilon = atof(val);
+        }
+        else if(opt == "--format")
+        {
+            arg->format = val;
+        }
+        else if(opt == "--blockdim")
+        {
+            arg->blockdim = atoi(val);
+        }
+        else if(opt == "--precision")
+        {
+            arg->precision = val[0];
+        }
+        else if(opt == "--warmup")
+        {
+            arg->warmup = atoi(val);
+        }
+        else if(opt == "--iters")
+        {
+            arg->iters = atoi(val);
+        }
+        else if(opt == "--threads")
+        {
+            arg->omp_threads = atoi(val);
+        }
+        else if(opt == "--solver")
+        {
+            arg->solver = val;
+        }
+        else if(opt == "--precond")
+        {
+            arg->precond = val;
+        }
+        else if(opt == "--amg")
+        {
+            arg->amg = val;
+        }
+        else if(opt == "--tol")
+        {
+            arg->tol = atof(val);
+        }
+        else if(opt == "--maxiter")
+        {
+            arg->maxiter = atoi(val);
+        }
+        else if(opt == "--output")
+        {
+            arg->output = val;
+        }
+        else
+        {
+            std::cerr << "Unknown option " << opt << std::endl;
+            bench_usage(argv[0]);
+            return false;
+        }
+    }
+
+    if(arg->precision != 's' && arg->precision != 'd')
+    {
+        std::cerr << "Invalid precision " << arg->precision << std::endl;
+        return false;
+    }
+
+    if(arg->size <= 0 || arg->iters <= 0 || arg->warmup < 0 || arg->blockdim <= 0)
+    {
+        std::cerr << "Invalid size, blockdim or number of repetitions" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+std::vector<std::string> bench_split(const std::string& list, const std::string& all)
+{
+    std::vector<std::string> items;
+    std::stringstream        ss(list == "all" ? all : list);
+    std::string              item;
+
+    while(std::getline(ss, item, ','))
+    {
+        if(item.empty() == false)
+        {
+            items.push_back(item);
+        }
+    }
+
+    return items;
+}
+
+bool bench_selected(const std::string& list, const std::string& name)
+{
+    if(list == "all")
+    {
+        return true;
+    }
+
+    std::vector<std::string> items = bench_split(list, "");
+
+    return std::find(items.begin(), items.end(), name) != items.end();
+}
+
+void bench_time(const bench_arguments& arg, bench_kernel& kernel, bench_result* result)
+{
+    // Warm up
+    for(int i = 0; i < arg.warmup; ++i)
+    {
+        kernel.Setup();
+        kernel.Run();
+    }
+
+    // Time each call separately, such that Setup() can be excluded
+    std::vector<double> times(arg.iters);
+
+    for(int i = 0; i < arg.iters; ++i)
+    {
+        kernel.Setup();
+
+        _rocalution_sync();
+        double tick = rocalution_time();
+
+        kernel.Run();
+
+        _rocalution_sync();
+        times[i] = rocalution_time() - tick;
+    }
+
+    std::sort(times.begin(), times.end());
+
+    double sum = 0.0;
+    for(int i = 0; i < arg.iters; ++i)
+    {
+        sum += times[i];
+    }
+
+    int half = arg.iters / 2;
+
+    result->min_us    = times[0];
+    result->median_us = (arg.iters % 2 == 1) ? times[half] : 0.5 * (times[half - 1] + times[half]);
+    result->mean_us   = sum / arg.iters;
+}
+
+double bench_csr_bytes(int64_t nrow, int64_t nnz, size_t value_size)
+{
+    return static_cast<double>(nnz * (value_size + sizeof(int)) + (nrow + 1) * sizeof(PtrType));
+}
+
+double bench_spmv_bytes(unsigned int format,
+                        int64_t      nrow,
+                        int64_t      ncol,
+                        int64_t      nnz,
+                        int          blockdim,
+                        size_t       value_size)
+{
+    // Read x once and write y
+    double bytes = static_cast<double>((nrow + ncol) * value_size);
+
+    // Stored entries, nnz includes the padding of DIA, ELL and SELL and the full blocks of BCSR.
+    // This is the same model the library profiler uses, such that both report the same
+    // bandwidth.
+    switch(format)
+    {
+    case DENSE:
+        return bytes + static_cast<double>(nrow * ncol * value_size);
+    case CSR:
+        return bytes + bench_csr_bytes(nrow, nnz, value_size);
+    case MCSR:
+        return bytes
+               + static_cast<double>(nnz * (value_size + sizeof(int)) + (nrow + 1) * sizeof(int));
+    case BCSR:
+        blockdim = (blockdim > 0) ? blockdim : 1;
+        return bytes
+               + static_cast<double>(nnz * value_size + nnz / (blockdim * blockdim) * sizeof(int)
+                                     + (nrow / blockdim + 1) * sizeof(int));
+    case COO:
+        return bytes + static_cast<double>(nnz * (value_size + 2 * sizeof(int)));
+    case DIA:
+        return bytes + static_cast<double>(nnz * value_size);
+    default:
+        return bytes + static_cast<double>(nnz * (value_size + sizeof(int)));
+    }
+}
+
+// Effective bandwidth and throughput, computed from the median time
+static double bench_gbs(const bench_result& res)
+{
+    return (res.bytes > 0.0 && res.median_us > 0.0) ? res.bytes / res.median_us / 1e3 : 0.0;
+}
+
+static double bench_gflops(const bench_result& res)
+{
+    return (res.flops > 0.0 && res.median_us > 0.0) ? res.flops / res.median_us / 1e3 : 0.0;
+}
+
+// Table entry of a metric, "-" if it has not been measured
+static std::string bench_column(double value)
+{
+    if(value <= 0.0)
+    {
+        return "-";
+    }
+
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(2) << value;
+
+    return ss.str();
+}
+
+static std::string bench_escape(const std::string& str)
+{
+    std::string esc;
+
+    for(size_t i = 0; i < str.size(); ++i)
+    {
+        if(str[i] == '"' || str[i] == '\\')
+        {
+            esc += '\\';
+        }
+
+        esc += str[i];
+    }
+
+    return esc;
+}
+
+void bench_print(const bench_arguments& arg, const std::vector<bench_result>& results)
+{
+    std::cout << std::endl
+              << "matrix " << arg.matrix << ", precision " << arg.precision << ", warmup "
+              << arg.warmup << ", iters " << arg.iters << std::endl
+              << std::endl;
+
+    std::cout << std::left << std::setw(12) << "routine" << std::setw(24) << "variant"
+              << std::right << std::setw(12) << "m" << std::setw(14) << "nnz" << std::setw(14)
+              << "median [us]" << std::setw(14) << "min [us]" << std::setw(10) << "GB/s"
+              << std::setw(10) << "GFLOP/s" << std::setw(8) << "iter" << std::endl;
+
+    for(size_t i = 0; i < results.size(); ++i)
+    {
+        const bench_result& res = results[i];
+
+        std::cout << std::left << std::setw(12) << res.routine << std::setw(24) << res.variant
+                  << std::right << std::setw(12) << res.m << std::setw(14) << res.nnz
+                  << std::fixed << std::setprecision(2) << std::setw(14) << res.median_us
+                  << std::setw(14) << res.min_us << std::setw(10) << bench_column(bench_gbs(res))
+                  << std::setw(10) << bench_column(bench_gflops(res)) << std::setw(8) << res.iter
+                  << std::defaultfloat << std::endl;
+    }
+
+    std::cout << std::endl;
+}
+
+static void bench_write_csv(std::ofstream&                   out,
+                            const bench_arguments&           arg,
+                            const std::vector<bench_result>& results)
+{
+    out << "matrix,precision,routine,variant,m,n,nnz,warmup,iters,min_us,median_us,mean_us,"
+           "bytes,flops,gbs,gflops,iter\n";
+
+    for(size_t i = 0; i < results.size(); ++i)
+    {
+        const bench_result& res = results[i];
+
+        out << arg.matrix << "," << arg.precision << "," << res.routine << "," << res.variant
+            << "," << res.m << "," << res.n << "," << res.nnz << "," << arg.warmup << ","
+            << arg.iters << "," << res.min_us << "," << res.median_us << "," << res.mean_us
+            << "," << res.bytes << "," << res.flops << "," << bench_gbs(res) << ","
+            << bench_gflops(res) << "," << res.iter << "\n";
+    }
+}
+
+static void bench_write_json(std::ofstream&                   out,
+                             const bench_arguments&           arg,
+                             const std::vector<bench_result>& results)
+{
+    out << "{\n";
+    out << "  \"matrix\": \"" << bench_escape(arg.matrix) << "\",\n";
+    out << "  \"precision\": \"" << arg.precision << "\",\n";
+    out << "  \"warmup\": " << arg.warmup << ",\n";
+    out << "  \"iters\": " << arg.iters << ",\n";
+    out << "  \"results\": [";
+
+    for(size_t i = 0; i < results.size(); ++i)
+    {
+        const bench_result& res = results[i];
+
+        out << (i == 0 ? "\n" : ",\n");
+        out << "    {\"routine\": \"" << res.routine << "\", \"variant\": \""
+            << bench_escape(res.variant) << "\", \"m\": " << res.m << ", \"n\": " << res.n
+            << ", \"nnz\": " << res.nnz << ", \"min_us\": " << res.min_us
+            << ", \"median_us\": " << res.median_us << ", \"mean_us\": " << res.mean_us
+            << ", \"bytes\": " << res.bytes << ", \"flops\": " << res.flops
+            << ", \"gbs\": " << bench_gbs(res) << ", \"gflops\": " << bench_gflops(res)
+            << ", \"iter\": " << res.iter << "}";
+    }
+
+    out << "\n  ]\n}\n";
+}
+
+bool bench_write(const bench_arguments& arg, const std::vector<bench_result>& results)
+{
+    if(arg.output.empty() == true)
+    {
+        return true;
+    }
+
+    std::ofstream out(arg.output.c_str());
+
+    if(out.is_open() == false)
+    {
+        std::cerr << "Cannot open output file " << arg.output << std::endl;
+        return false;
+    }
+
+    out << std::setprecision(10);
+
+    size_t len = arg.output.size();
+
+    if(len > 4 && arg.output.compare(len - 4, 4, ".csv") == 0)
+    {
+        bench_write_csv(out, arg, results);
+    }
+    else
+    {
+        bench_write_json(out, arg, results);
+    }
+
+    return true;
+}
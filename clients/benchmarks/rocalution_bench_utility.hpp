@@ -0,0 +1,134 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCALUTION_BENCH_UTILITY_HPP
+#define ROCALUTION_BENCH_UTILITY_HPP
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include <rocalution/rocalution.hpp>
+
+/* ============================================================================================ */
+/*! \brief  Benchmark options, parsed from the command line */
+struct bench_arguments
+{
+    // Routines to run, comma separated, or "all"
+    std::string routine = "all";
+
+    // Input matrix - laplacian2d, laplacian3d, anisotropic2d, powerlaw or a .mtx file
+    std::string matrix  = "laplacian2d";
+    int         size    = 1000;
+    double      epsilon = 1e-3;
+
+    // Matrix formats for SpMV and conversions, comma separated, or "all"
+    std::string format   = "all";
+    int         blockdim = 2;
+
+    // Precision - s (float) or d (double)
+    char precision = 'd';
+
+    // Repetitions
+    int warmup = 2;
+    int iters  = 10;
+
+    // Backend
+    int omp_threads = 0;
+    int use_acc     = true;
+
+    // Solvers, preconditioners and AMG variants, comma separated, or "all"
+    std::string solver  = "cg,bicgstab,gmres,fgmres";
+    std::string precond = "none,jacobi,ilu,saamg";
+    std::string amg     = "sa,ua,rs,pairwise";
+    double      tol     = 1e-8;
+    int         maxiter = 1000;
+
+    // Output file - .csv writes comma separated values, anything else JSON
+    std::string output = "";
+};
+
+/* ============================================================================================ */
+/*! \brief  Result of a single benchmark */
+struct bench_result
+{
+    std::string routine;
+    std::string variant;
+
+    int64_t m   = 0;
+    int64_t n   = 0;
+    int64_t nnz = 0;
+
+    // Times in microseconds
+    double min_us    = 0.0;
+    double median_us = 0.0;
+    double mean_us   = 0.0;
+
+    // Bytes moved and floating point operations per call, zero if not measured
+    double bytes = 0.0;
+    double flops = 0.0;
+
+    // Iterations of the solver, zero if not applicable
+    int iter = 0;
+};
+
+/* ============================================================================================ */
+/*! \brief  Benchmark kernel. Setup() is called before each call of Run() and is not timed */
+class bench_kernel
+{
+public:
+    virtual ~bench_kernel() {}
+
+    virtual void Setup(void) {}
+    virtual void Run(void) = 0;
+};
+
+// Parse the command line, returns false if the benchmark should not run
+bool bench_parse_arguments(int argc, char* argv[], bench_arguments* arg);
+
+// Split a comma separated list, "all" is replaced by the given default list
+std::vector<std::string> bench_split(const std::string& list, const std::string& all);
+
+// Check, whether name is contained in a comma separated list or the list is "all"
+bool bench_selected(const std::string& list, const std::string& name);
+
+// Run warm up and timed repetitions of a kernel and store the timings in the result
+void bench_time(const bench_arguments& arg, bench_kernel& kernel, bench_result* result);
+
+// Bytes of a CSR matrix
+double bench_csr_bytes(int64_t nrow, int64_t nnz, size_t value_size);
+
+// Bytes moved by a matrix vector product with a matrix of the given format
+double bench_spmv_bytes(unsigned int format,
+                        int64_t      nrow,
+                        int64_t      ncol,
+                        int64_t      nnz,
+                        int          blockdim,
+                        size_t       value_size);
+
+// Print results and write them to the output file
+void bench_print(const bench_arguments& arg, const std::vector<bench_result>& results);
+bool bench_write(const bench_arguments& arg, const std::vector<bench_result>& results);
+
+#endif // ROCALUTION_BENCH_UTILITY_HPP
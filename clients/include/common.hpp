@@ -21,6 +21,8 @@
  *
  * ************************************************************************ */
 
+#pragma once
+
 #include <cstring>
 #include <mpi.h>
 #include <rocalution/rocalution.hpp>
@@ -41,7 +43,7 @@ void distribute_matrix(const MPI_Comm*          comm,
 
     size_t global_nrow = lmat->GetM();
 
-    int*       global_row_offset = NULL;
+    PtrType*   global_row_offset = NULL;
     int*       global_col        = NULL;
     ValueType* global_val        = NULL;
 
@@ -215,7 +217,7 @@ void distribute_matrix(const MPI_Comm*          comm,
         }
     }
     // Wait to finish communication
-    MPI_Waitall(n - 1, &(mpi_req[0]), MPI_STATUSES_IGNORE);
+    MPI_Waitall(n, mpi_req.data(), MPI_STATUSES_IGNORE);
 
     n = 0;
     // Array to hold boundary offset for each interface
@@ -271,7 +273,7 @@ void distribute_matrix(const MPI_Comm*          comm,
     }
 
     // Wait to finish communication
-    MPI_Waitall(n - 1, &(mpi_req[0]), MPI_STATUSES_IGNORE);
+    MPI_Waitall(n, mpi_req.data(), MPI_STATUSES_IGNORE);
 
     // Total boundary size
     int nnz_boundary = 0;
@@ -323,11 +325,11 @@ void distribute_matrix(const MPI_Comm*          comm,
     memset(ghost_col, 0, sizeof(int) * ghost_nnz);
     memset(ghost_val, 0, sizeof(ValueType) * ghost_nnz);
 
-    int*       row_offset = new int[local_nrow + 1];
+    PtrType*   row_offset = new PtrType[local_nrow + 1];
     int*       col        = new int[interior_nnz];
     ValueType* val        = new ValueType[interior_nnz];
 
-    memset(row_offset, 0, sizeof(int) * (local_nrow + 1));
+    memset(row_offset, 0, sizeof(PtrType) * (local_nrow + 1));
     memset(col, 0, sizeof(int) * interior_nnz);
     memset(val, 0, sizeof(ValueType) * interior_nnz);
 
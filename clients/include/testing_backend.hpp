@@ -98,4 +98,82 @@ void testing_backend(Arguments argus)
     stop_rocalution();
 }
 
+static int backend_user_allocations = 0;
+
+static void* backend_user_allocate(size_t size)
+{
+    ++backend_user_allocations;
+    return malloc(size);
+}
+
+static void backend_user_deallocate(void* ptr)
+{
+    --backend_user_allocations;
+    free(ptr);
+}
+
+void testing_backend_host_allocator(void)
+{
+    int size = 100000;
+
+    // Initialize rocalution platform
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Buffer from the default allocator, released after switching the allocator
+    double* vdefault = NULL;
+    allocate_host(size, &vdefault);
+
+    // Aligned and first touched buffers
+    set_host_allocator_rocalution(HostAllocatorAligned, 128);
+
+    double* valigned = NULL;
+    allocate_host(size, &valigned);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(valigned) % 128, 0);
+
+    for(int i = 0; i < size; ++i)
+    {
+        ASSERT_EQ(valigned[i], 0.0);
+    }
+
+    // Pooled buffers are recycled
+    set_host_allocator_rocalution(HostAllocatorPool);
+
+    double* vpool = NULL;
+    allocate_host(size, &vpool);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(vpool) % 64, 0);
+
+    double* vrecycled = vpool;
+    free_host(&vpool);
+    allocate_host(size - 1, &vpool);
+    ASSERT_EQ(vpool, vrecycled);
+
+    // Vectors work on top of the pool
+    LocalVector<double> x;
+    x.Allocate("x", size);
+    x.Ones();
+    ASSERT_EQ(x.Asum(), static_cast<double>(size));
+    x.Clear();
+
+    // User defined allocator
+    set_host_allocator_rocalution(backend_user_allocate, backend_user_deallocate);
+
+    int* vuser = NULL;
+    allocate_host(size, &vuser);
+    ASSERT_EQ(backend_user_allocations, 1);
+
+    // Release all buffers with the default allocator active
+    set_host_allocator_rocalution(HostAllocatorDefault);
+
+    free_host(&vuser);
+    ASSERT_EQ(backend_user_allocations, 0);
+
+    free_host(&vpool);
+    free_host(&valigned);
+    free_host(&vdefault);
+
+    // Stop rocalution platform
+    stop_rocalution();
+}
+
 #endif // TESTING_BACKEND_HPP
@@ -59,9 +59,9 @@ bool testing_cg(Arguments argus)
     LocalVector<T> e;
 
     // Generate A
-    int* csr_ptr = NULL;
-    int* csr_col = NULL;
-    T*   csr_val = NULL;
+    PtrType* csr_ptr = NULL;
+    int*     csr_col = NULL;
+    T*       csr_val = NULL;
 
     int nrow = gen_2d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
     int nnz  = csr_ptr[nrow];
@@ -118,16 +118,40 @@ bool testing_cg(Arguments argus)
         p = new TNS<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "Jacobi")
         p = new Jacobi<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "L1Jacobi")
+        p = new L1Jacobi<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "GS")
         p = new GS<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "SGS")
         p = new SGS<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "HybridSGS")
+    {
+        HybridSGS<LocalMatrix<T>, LocalVector<T>, T>* hsgs
+            = new HybridSGS<LocalMatrix<T>, LocalVector<T>, T>;
+        hsgs->SetNumberOfBlocks(4);
+
+        p = hsgs;
+    }
     else if(precond == "ILU")
         p = new ILU<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "ILUT")
         p = new ILUT<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "IC")
         p = new IC<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "ItILU")
+    {
+        ILU<LocalMatrix<T>, LocalVector<T>, T>* ilu = new ILU<LocalMatrix<T>, LocalVector<T>, T>;
+        ilu->SetIterative(5);
+
+        p = ilu;
+    }
+    else if(precond == "ItIC")
+    {
+        IC<LocalMatrix<T>, LocalVector<T>, T>* ic = new IC<LocalMatrix<T>, LocalVector<T>, T>;
+        ic->SetIterative(5);
+
+        p = ic;
+    }
     else if(precond == "MCGS")
         p = new MultiColoredGS<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "MCSGS")
@@ -59,9 +59,9 @@ bool testing_cr(Arguments argus)
     LocalVector<T> e;
 
     // Generate A
-    int* csr_ptr = NULL;
-    int* csr_col = NULL;
-    T*   csr_val = NULL;
+    PtrType* csr_ptr = NULL;
+    int*     csr_col = NULL;
+    T*       csr_val = NULL;
 
     int nrow = gen_2d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
     int nnz  = csr_ptr[nrow];
@@ -128,6 +128,20 @@ bool testing_cr(Arguments argus)
         p = new ILUT<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "IC")
         p = new IC<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "ItILU")
+    {
+        ILU<LocalMatrix<T>, LocalVector<T>, T>* ilu = new ILU<LocalMatrix<T>, LocalVector<T>, T>;
+        ilu->SetIterative(5);
+
+        p = ilu;
+    }
+    else if(precond == "ItIC")
+    {
+        IC<LocalMatrix<T>, LocalVector<T>, T>* ic = new IC<LocalMatrix<T>, LocalVector<T>, T>;
+        ic->SetIterative(5);
+
+        p = ic;
+    }
     else if(precond == "MCGS")
         p = new MultiColoredGS<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "MCSGS")
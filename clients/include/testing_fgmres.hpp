@@ -34,10 +34,11 @@ using namespace rocalution;
 template <typename T>
 bool testing_fgmres(Arguments argus)
 {
-    int          ndim    = argus.size;
-    int          basis   = argus.index;
-    std::string  precond = argus.precond;
-    unsigned int format  = argus.format;
+    int          ndim              = argus.size;
+    int          basis             = argus.index;
+    std::string  precond           = argus.precond;
+    unsigned int format            = argus.format;
+    std::string  orthogonalization = argus.orthogonalization;
 
     // Initialize rocALUTION platform
     set_device_rocalution(device);
@@ -50,9 +51,9 @@ bool testing_fgmres(Arguments argus)
     LocalVector<T> e;
 
     // Generate A
-    int* csr_ptr = NULL;
-    int* csr_col = NULL;
-    T*   csr_val = NULL;
+    PtrType* csr_ptr = NULL;
+    int*     csr_col = NULL;
+    T*       csr_val = NULL;
 
     int nrow = gen_2d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
     int nnz  = csr_ptr[nrow];
@@ -111,6 +112,14 @@ bool testing_fgmres(Arguments argus)
         p = new Jacobi<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "GS")
         p = new GS<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "HybridGS")
+    {
+        HybridGS<LocalMatrix<T>, LocalVector<T>, T>* hgs
+            = new HybridGS<LocalMatrix<T>, LocalVector<T>, T>;
+        hgs->SetNumberOfBlocks(4);
+
+        p = hgs;
+    }
     else if(precond == "SGS")
         p = new SGS<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "ILU")
@@ -139,6 +148,8 @@ bool testing_fgmres(Arguments argus)
 
     ls.Init(1e-6, 0.0, 1e+8, 10000);
     ls.SetBasisSize(basis);
+    ls.SetOrthogonalization(orthogonalization == "CGS2" ? Orthogonalization_CGS2
+                                                        : Orthogonalization_MGS);
 
     ls.Build();
 
@@ -25,6 +25,7 @@
 #ifndef TESTING_GLOBAL_MATRIX_HPP
 #define TESTING_GLOBAL_MATRIX_HPP
 
+#include "common.hpp"
 #include "utility.hpp"
 
 #include <gtest/gtest.h>
@@ -44,53 +45,56 @@ void testing_global_matrix_bad_args(void)
     GlobalMatrix<T> mat;
     GlobalVector<T> vec;
 
-    int* idata = nullptr;
-    T*   data  = nullptr;
+    PtrType* pdata = nullptr;
+    int*     idata = nullptr;
+    T*       data  = nullptr;
 
+    allocate_host(safe_size, &pdata);
     allocate_host(safe_size, &idata);
     allocate_host(safe_size, &data);
 
     // SetDataPtrCSR
     {
-        int* null_int  = nullptr;
-        T*   null_data = nullptr;
+        PtrType* null_ptr  = nullptr;
+        int*     null_int  = nullptr;
+        T*       null_data = nullptr;
         ASSERT_DEATH(mat.SetDataPtrCSR(
-                         nullptr, &idata, &data, &idata, &idata, &data, "", safe_size, safe_size),
+                         nullptr, &idata, &data, &pdata, &idata, &data, "", safe_size, safe_size),
                      ".*Assertion.*local_row_offset != (NULL|__null)*");
         ASSERT_DEATH(mat.SetDataPtrCSR(
-                         &idata, nullptr, &data, &idata, &idata, &data, "", safe_size, safe_size),
+                         &pdata, nullptr, &data, &pdata, &idata, &data, "", safe_size, safe_size),
                      ".*Assertion.*local_col != (NULL|__null)*");
         ASSERT_DEATH(mat.SetDataPtrCSR(
-                         &idata, &idata, nullptr, &idata, &idata, &data, "", safe_size, safe_size),
+                         &pdata, &idata, nullptr, &pdata, &idata, &data, "", safe_size, safe_size),
                      ".*Assertion.*local_val != (NULL|__null)*");
         ASSERT_DEATH(mat.SetDataPtrCSR(
-                         &idata, &idata, &data, nullptr, &idata, &data, "", safe_size, safe_size),
+                         &pdata, &idata, &data, nullptr, &idata, &data, "", safe_size, safe_size),
                      ".*Assertion.*ghost_row_offset != (NULL|__null)*");
         ASSERT_DEATH(mat.SetDataPtrCSR(
-                         &idata, &idata, &data, &idata, nullptr, &data, "", safe_size, safe_size),
+                         &pdata, &idata, &data, &pdata, nullptr, &data, "", safe_size, safe_size),
                      ".*Assertion.*ghost_col != (NULL|__null)*");
         ASSERT_DEATH(mat.SetDataPtrCSR(
-                         &idata, &idata, &data, &idata, &idata, nullptr, "", safe_size, safe_size),
+                         &pdata, &idata, &data, &pdata, &idata, nullptr, "", safe_size, safe_size),
                      ".*Assertion.*ghost_val != (NULL|__null)*");
         ASSERT_DEATH(mat.SetDataPtrCSR(
-                         &null_int, &idata, &data, &idata, &idata, &data, "", safe_size, safe_size),
+                         &null_ptr, &idata, &data, &pdata, &idata, &data, "", safe_size, safe_size),
                      ".*Assertion.*local_row_offset != (NULL|__null)*");
         ASSERT_DEATH(mat.SetDataPtrCSR(
-                         &idata, &null_int, &data, &idata, &idata, &data, "", safe_size, safe_size),
+                         &pdata, &null_int, &data, &pdata, &idata, &data, "", safe_size, safe_size),
                      ".*Assertion.*local_col != (NULL|__null)*");
         ASSERT_DEATH(
             mat.SetDataPtrCSR(
-                &idata, &idata, &null_data, &idata, &idata, &data, "", safe_size, safe_size),
+                &pdata, &idata, &null_data, &pdata, &idata, &data, "", safe_size, safe_size),
             ".*Assertion.*local_val != (NULL|__null)*");
         ASSERT_DEATH(mat.SetDataPtrCSR(
-                         &idata, &idata, &data, &null_int, &idata, &data, "", safe_size, safe_size),
+                         &pdata, &idata, &data, &null_ptr, &idata, &data, "", safe_size, safe_size),
                      ".*Assertion.*ghost_row_offset != (NULL|__null)*");
         ASSERT_DEATH(mat.SetDataPtrCSR(
-                         &idata, &idata, &data, &idata, &null_int, &data, "", safe_size, safe_size),
+                         &pdata, &idata, &data, &pdata, &null_int, &data, "", safe_size, safe_size),
                      ".*Assertion.*ghost_col != (NULL|__null)*");
         ASSERT_DEATH(
             mat.SetDataPtrCSR(
-                &idata, &idata, &data, &idata, &idata, &null_data, "", safe_size, safe_size),
+                &pdata, &idata, &data, &pdata, &idata, &null_data, "", safe_size, safe_size),
             ".*Assertion.*ghost_val != (NULL|__null)*");
     }
 
@@ -140,37 +144,39 @@ void testing_global_matrix_bad_args(void)
 
     // SetLocalDataPtrCSR
     {
-        int* null_int  = nullptr;
-        T*   null_data = nullptr;
+        PtrType* null_ptr  = nullptr;
+        int*     null_int  = nullptr;
+        T*       null_data = nullptr;
         ASSERT_DEATH(mat.SetLocalDataPtrCSR(nullptr, &idata, &data, "", safe_size),
                      ".*Assertion.*row_offset != (NULL|__null)*");
-        ASSERT_DEATH(mat.SetLocalDataPtrCSR(&idata, nullptr, &data, "", safe_size),
+        ASSERT_DEATH(mat.SetLocalDataPtrCSR(&pdata, nullptr, &data, "", safe_size),
                      ".*Assertion.*col != (NULL|__null)*");
-        ASSERT_DEATH(mat.SetLocalDataPtrCSR(&idata, &idata, nullptr, "", safe_size),
+        ASSERT_DEATH(mat.SetLocalDataPtrCSR(&pdata, &idata, nullptr, "", safe_size),
                      ".*Assertion.*val != (NULL|__null)*");
-        ASSERT_DEATH(mat.SetLocalDataPtrCSR(&null_int, &idata, &data, "", safe_size),
+        ASSERT_DEATH(mat.SetLocalDataPtrCSR(&null_ptr, &idata, &data, "", safe_size),
                      ".*Assertion.*row_offset != (NULL|__null)*");
-        ASSERT_DEATH(mat.SetLocalDataPtrCSR(&idata, &null_int, &data, "", safe_size),
+        ASSERT_DEATH(mat.SetLocalDataPtrCSR(&pdata, &null_int, &data, "", safe_size),
                      ".*Assertion.*col != (NULL|__null)*");
-        ASSERT_DEATH(mat.SetLocalDataPtrCSR(&idata, &idata, &null_data, "", safe_size),
+        ASSERT_DEATH(mat.SetLocalDataPtrCSR(&pdata, &idata, &null_data, "", safe_size),
                      ".*Assertion.*val != (NULL|__null)*");
     }
 
     // SetGhostDataPtrCSR
     {
-        int* null_int  = nullptr;
-        T*   null_data = nullptr;
+        PtrType* null_ptr  = nullptr;
+        int*     null_int  = nullptr;
+        T*       null_data = nullptr;
         ASSERT_DEATH(mat.SetGhostDataPtrCSR(nullptr, &idata, &data, "", safe_size),
                      ".*Assertion.*row_offset != (NULL|__null)*");
-        ASSERT_DEATH(mat.SetGhostDataPtrCSR(&idata, nullptr, &data, "", safe_size),
+        ASSERT_DEATH(mat.SetGhostDataPtrCSR(&pdata, nullptr, &data, "", safe_size),
                      ".*Assertion.*col != (NULL|__null)*");
-        ASSERT_DEATH(mat.SetGhostDataPtrCSR(&idata, &idata, nullptr, "", safe_size),
+        ASSERT_DEATH(mat.SetGhostDataPtrCSR(&pdata, &idata, nullptr, "", safe_size),
                      ".*Assertion.*val != (NULL|__null)*");
-        ASSERT_DEATH(mat.SetGhostDataPtrCSR(&null_int, &idata, &data, "", safe_size),
+        ASSERT_DEATH(mat.SetGhostDataPtrCSR(&null_ptr, &idata, &data, "", safe_size),
                      ".*Assertion.*row_offset != (NULL|__null)*");
-        ASSERT_DEATH(mat.SetGhostDataPtrCSR(&idata, &null_int, &data, "", safe_size),
+        ASSERT_DEATH(mat.SetGhostDataPtrCSR(&pdata, &null_int, &data, "", safe_size),
                      ".*Assertion.*col != (NULL|__null)*");
-        ASSERT_DEATH(mat.SetGhostDataPtrCSR(&idata, &idata, &null_data, "", safe_size),
+        ASSERT_DEATH(mat.SetGhostDataPtrCSR(&pdata, &idata, &null_data, "", safe_size),
                      ".*Assertion.*val != (NULL|__null)*");
     }
 
@@ -212,25 +218,26 @@ void testing_global_matrix_bad_args(void)
 
     // LeaveDataPtrCSR
     {
-        int* null_int  = nullptr;
-        T*   null_data = nullptr;
+        PtrType* null_ptr  = nullptr;
+        int*     null_int  = nullptr;
+        T*       null_data = nullptr;
         ASSERT_DEATH(
-            mat.LeaveDataPtrCSR(&idata, &null_int, &null_data, &null_int, &null_int, &null_data),
+            mat.LeaveDataPtrCSR(&pdata, &null_int, &null_data, &null_ptr, &null_int, &null_data),
             ".*Assertion.*local_row_offset == (NULL|__null)*");
         ASSERT_DEATH(
-            mat.LeaveDataPtrCSR(&null_int, &idata, &null_data, &null_int, &null_int, &null_data),
+            mat.LeaveDataPtrCSR(&null_ptr, &idata, &null_data, &null_ptr, &null_int, &null_data),
             ".*Assertion.*local_col == (NULL|__null)*");
         ASSERT_DEATH(
-            mat.LeaveDataPtrCSR(&null_int, &null_int, &data, &null_int, &null_int, &null_data),
+            mat.LeaveDataPtrCSR(&null_ptr, &null_int, &data, &null_ptr, &null_int, &null_data),
             ".*Assertion.*local_val == (NULL|__null)*");
         ASSERT_DEATH(
-            mat.LeaveDataPtrCSR(&null_int, &null_int, &null_data, &idata, &null_int, &null_data),
+            mat.LeaveDataPtrCSR(&null_ptr, &null_int, &null_data, &pdata, &null_int, &null_data),
             ".*Assertion.*ghost_row_offset == (NULL|__null)*");
         ASSERT_DEATH(
-            mat.LeaveDataPtrCSR(&null_int, &null_int, &null_data, &null_int, &idata, &null_data),
+            mat.LeaveDataPtrCSR(&null_ptr, &null_int, &null_data, &null_ptr, &idata, &null_data),
             ".*Assertion.*ghost_col == (NULL|__null)*");
         ASSERT_DEATH(
-            mat.LeaveDataPtrCSR(&null_int, &null_int, &null_data, &null_int, &null_int, &data),
+            mat.LeaveDataPtrCSR(&null_ptr, &null_int, &null_data, &null_ptr, &null_int, &data),
             ".*Assertion.*ghost_val == (NULL|__null)*");
     }
 
@@ -260,25 +267,27 @@ void testing_global_matrix_bad_args(void)
 
     // LeaveLocalDataPtrCSR
     {
-        int* null_int  = nullptr;
-        T*   null_data = nullptr;
-        ASSERT_DEATH(mat.LeaveLocalDataPtrCSR(&idata, &null_int, &null_data),
+        PtrType* null_ptr  = nullptr;
+        int*     null_int  = nullptr;
+        T*       null_data = nullptr;
+        ASSERT_DEATH(mat.LeaveLocalDataPtrCSR(&pdata, &null_int, &null_data),
                      ".*Assertion.*row_offset == (NULL|__null)*");
-        ASSERT_DEATH(mat.LeaveLocalDataPtrCSR(&null_int, &idata, &null_data),
+        ASSERT_DEATH(mat.LeaveLocalDataPtrCSR(&null_ptr, &idata, &null_data),
                      ".*Assertion.*col == (NULL|__null)*");
-        ASSERT_DEATH(mat.LeaveLocalDataPtrCSR(&null_int, &null_int, &data),
+        ASSERT_DEATH(mat.LeaveLocalDataPtrCSR(&null_ptr, &null_int, &data),
                      ".*Assertion.*val == (NULL|__null)*");
     }
 
     // LeaveGhostDataPtrCSR
     {
-        int* null_int  = nullptr;
-        T*   null_data = nullptr;
-        ASSERT_DEATH(mat.LeaveGhostDataPtrCSR(&idata, &null_int, &null_data),
+        PtrType* null_ptr  = nullptr;
+        int*     null_int  = nullptr;
+        T*       null_data = nullptr;
+        ASSERT_DEATH(mat.LeaveGhostDataPtrCSR(&pdata, &null_int, &null_data),
                      ".*Assertion.*row_offset == (NULL|__null)*");
-        ASSERT_DEATH(mat.LeaveGhostDataPtrCSR(&null_int, &idata, &null_data),
+        ASSERT_DEATH(mat.LeaveGhostDataPtrCSR(&null_ptr, &idata, &null_data),
                      ".*Assertion.*col == (NULL|__null)*");
-        ASSERT_DEATH(mat.LeaveGhostDataPtrCSR(&null_int, &null_int, &data),
+        ASSERT_DEATH(mat.LeaveGhostDataPtrCSR(&null_ptr, &null_int, &data),
                      ".*Assertion.*val == (NULL|__null)*");
     }
 
@@ -368,6 +377,7 @@ void testing_global_matrix_bad_args(void)
                      ".*Assertion.*rG != (NULL|__null)*");
     }
 
+    free_host(&pdata);
     free_host(&idata);
     free_host(&data);
 
@@ -375,4 +385,313 @@ void testing_global_matrix_bad_args(void)
     stop_rocalution();
 }
 
+template <typename T>
+bool testing_global_matrix_apply(Arguments argus)
+{
+    int         size        = argus.size;
+    int         nthreads    = argus.omp_nthreads;
+    std::string matrix_type = argus.matrix_type;
+
+    MPI_Comm comm = MPI_COMM_WORLD;
+
+    int rank;
+    int num_procs;
+
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &num_procs);
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution(rank);
+
+    // Use the threads also for the small blocks of the overlapped Apply()
+    set_omp_threads_rocalution(nthreads);
+    set_omp_threshold_rocalution(0);
+
+    // Generate A
+    PtrType* csr_ptr = NULL;
+    int*     csr_col = NULL;
+    T*       csr_val = NULL;
+
+    int nrow = 0;
+    if(matrix_type == "Laplacian2D")
+    {
+        nrow = gen_2d_laplacian(size, &csr_ptr, &csr_col, &csr_val);
+    }
+    else if(matrix_type == "Random")
+    {
+        nrow = gen_random(size * size, size * size, 9, &csr_ptr, &csr_col, &csr_val);
+    }
+    else
+    {
+        return false;
+    }
+
+    int nnz = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // The distribution requires a symmetric sparsity pattern
+    if(matrix_type == "Random")
+    {
+        LocalMatrix<T> At;
+        A.Transpose(&At);
+        A.MatrixAdd(At, static_cast<T>(1), static_cast<T>(1), true);
+    }
+
+    // Reference product of the whole matrix
+    LocalVector<T> x;
+    LocalVector<T> y;
+
+    x.Allocate("x", nrow);
+    y.Allocate("y", nrow);
+
+    x.SetRandomUniform(12345ULL, static_cast<T>(-1), static_cast<T>(1));
+
+    A.Apply(x, &y);
+
+    std::vector<T> xv(nrow);
+    std::vector<T> yv(nrow);
+
+    x.CopyToData(xv.data());
+    y.CopyToData(yv.data());
+
+    // Distribute A by row blocks
+    ParallelManager pm;
+    GlobalMatrix<T> gA;
+
+    distribute_matrix(&comm, &A, &gA, &pm);
+
+    int local_nrow = gA.GetLocalM();
+    int offset     = 0;
+
+    MPI_Exscan(&local_nrow, &offset, 1, MPI_INT, MPI_SUM, comm);
+
+    if(rank == 0)
+    {
+        offset = 0;
+    }
+
+    bool success = true;
+
+    // With more than one process, the ghost part has to be applied
+    if(num_procs > 1)
+    {
+        success &= (gA.GetGhostNnz() > 0);
+    }
+
+    GlobalVector<T> gx(pm);
+    GlobalVector<T> gy(pm);
+
+    gx.Allocate("x", nrow);
+    gy.Allocate("y", nrow);
+
+    gx.GetInterior().CopyFromData(xv.data() + offset);
+
+    gA.Apply(gx, &gy);
+
+    LocalVector<T> z;
+    z.Allocate("z", local_nrow);
+    z.CopyFromData(yv.data() + offset);
+
+    T ref_norm = z.Norm();
+
+    z.ScaleAdd(static_cast<T>(-1), gy.GetInterior());
+    success &= (z.Norm() <= 1e-4 * ref_norm);
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_global_matrix_apply_add(Arguments argus)
+{
+    int          size   = argus.size;
+    unsigned int format = argus.format;
+    T            scalar = static_cast<T>(argus.alpha);
+
+    MPI_Comm comm = MPI_COMM_WORLD;
+
+    int rank;
+    int num_procs;
+
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &num_procs);
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution(rank);
+
+    // Generate A
+    PtrType* csr_ptr = NULL;
+    int*     csr_col = NULL;
+    T*       csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(size, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // Distribute A by row blocks, CSR takes the overlapped path, the other formats apply
+    // the interior and the ghost part one after the other
+    ParallelManager pm;
+    GlobalMatrix<T> gA;
+
+    distribute_matrix(&comm, &A, &gA, &pm);
+
+    gA.ConvertTo(format);
+
+    GlobalVector<T> x(pm);
+    GlobalVector<T> y(pm);
+    GlobalVector<T> z(pm);
+    GlobalVector<T> Ax(pm);
+
+    x.Allocate("x", nrow);
+    y.Allocate("y", nrow);
+    z.Allocate("z", nrow);
+    Ax.Allocate("Ax", nrow);
+
+    x.SetRandomUniform(12345ULL, static_cast<T>(-1), static_cast<T>(1));
+    y.SetRandomUniform(67890ULL, static_cast<T>(-1), static_cast<T>(1));
+
+    // Reference y + scalar * A * x by Apply() and AddScale()
+    z.CopyFrom(y);
+
+    gA.Apply(x, &Ax);
+    z.AddScale(Ax, scalar);
+
+    gA.ApplyAdd(x, scalar, &y);
+
+    bool success = true;
+
+    // With more than one process, the ghost part has to be applied
+    if(num_procs > 1)
+    {
+        success &= (gA.GetGhostNnz() > 0);
+    }
+
+    T ref_norm = z.Norm();
+
+    y.ScaleAdd(static_cast<T>(-1), z);
+    success &= (y.Norm() <= 1e-4 * ref_norm);
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_global_matrix_amg(Arguments argus)
+{
+    int         size     = argus.size;
+    std::string precond  = argus.precond;
+    int         coarsest = argus.index;
+
+    MPI_Comm comm = MPI_COMM_WORLD;
+
+    int rank;
+
+    MPI_Comm_rank(comm, &rank);
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution(rank);
+
+    // Generate A
+    PtrType* csr_ptr = NULL;
+    int*     csr_col = NULL;
+    T*       csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(size, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // Distribute A by row blocks
+    ParallelManager pm;
+    GlobalMatrix<T> gA;
+
+    distribute_matrix(&comm, &A, &gA, &pm);
+
+    GlobalVector<T> x(pm);
+    GlobalVector<T> b(pm);
+    GlobalVector<T> e(pm);
+
+    x.Allocate("x", nrow);
+    b.Allocate("b", nrow);
+    e.Allocate("e", nrow);
+
+    // b = A * 1
+    e.Ones();
+    gA.Apply(e, &b);
+    x.Zeros();
+
+    CG<GlobalMatrix<T>, GlobalVector<T>, T> ls;
+
+    RugeStuebenAMG<GlobalMatrix<T>, GlobalVector<T>, T> rs;
+    SAAMG<GlobalMatrix<T>, GlobalVector<T>, T>          sa;
+    UAAMG<GlobalMatrix<T>, GlobalVector<T>, T>          ua;
+
+    // Small coarsest levels leave processes without any coarse rows
+    if(precond == "RS")
+    {
+        rs.SetCoarseningStrategy(PMIS);
+        rs.SetInterpolationType(ExtPI);
+        rs.SetCoarsestLevel(coarsest);
+        rs.Verbose(0);
+        ls.SetPreconditioner(rs);
+    }
+    else if(precond == "SA")
+    {
+        sa.SetCoarsestLevel(coarsest);
+        sa.Verbose(0);
+        ls.SetPreconditioner(sa);
+    }
+    else if(precond == "UA")
+    {
+        ua.SetCoarsestLevel(coarsest);
+        ua.Verbose(0);
+        ls.SetPreconditioner(ua);
+    }
+    else
+    {
+        return false;
+    }
+
+    ls.SetOperator(gA);
+    ls.Verbose(0);
+    ls.Build();
+
+    ls.Init(0.0, (sizeof(T) == sizeof(float)) ? 1e-5 : 1e-8, 1e+8, 500);
+    ls.Solve(b, &x);
+
+    // The solution is the vector of ones
+    T ref_norm = e.Norm();
+
+    x.ScaleAdd(static_cast<T>(-1), e);
+
+    bool success = (ls.GetSolverStatus() == 2);
+    success &= (x.Norm() <= ((sizeof(T) == sizeof(float)) ? 1e-2 : 1e-5) * ref_norm);
+
+    // Interpolating across process boundaries keeps the iteration count independent of the
+    // number of processes
+    if(precond == "RS")
+    {
+        success &= (ls.GetIterationCount() <= 20);
+    }
+
+    ls.Clear();
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
 #endif // TESTING_GLOBAL_MATRIX_HPP
@@ -28,7 +28,9 @@
 #include "utility.hpp"
 
 #include <gtest/gtest.h>
+#include <mpi.h>
 #include <rocalution/rocalution.hpp>
+#include <vector>
 
 using namespace rocalution;
 
@@ -63,4 +65,107 @@ void testing_global_vector_bad_args(void)
     stop_rocalution();
 }
 
+template <typename T>
+bool testing_global_vector_restriction(Arguments argus)
+{
+    int size = argus.size;
+
+    MPI_Comm comm = MPI_COMM_WORLD;
+
+    int rank;
+    int num_procs;
+
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &num_procs);
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution(rank);
+
+    // Each process owns a different number of fine points, which are aggregated in pairs.
+    // Every fifth fine point is not aggregated.
+    int fine_size   = size + rank;
+    int coarse_size = (fine_size + 1) / 2;
+
+    int fine_global   = 0;
+    int coarse_global = 0;
+
+    MPI_Allreduce(&fine_size, &fine_global, 1, MPI_INT, MPI_SUM, comm);
+    MPI_Allreduce(&coarse_size, &coarse_global, 1, MPI_INT, MPI_SUM, comm);
+
+    ParallelManager pm_fine;
+    ParallelManager pm_coarse;
+
+    pm_fine.SetMPICommunicator(&comm);
+    pm_fine.SetGlobalSize(fine_global);
+    pm_fine.SetLocalSize(fine_size);
+
+    pm_coarse.SetMPICommunicator(&comm);
+    pm_coarse.SetGlobalSize(coarse_global);
+    pm_coarse.SetLocalSize(coarse_size);
+
+    std::vector<int> mapv(fine_size);
+
+    for(int i = 0; i < fine_size; ++i)
+    {
+        mapv[i] = (i % 5 == 4) ? -1 : i / 2;
+    }
+
+    LocalVector<int> map;
+    map.Allocate("map", fine_size);
+    map.CopyFromData(mapv.data());
+
+    GlobalVector<T> fine(pm_fine);
+    GlobalVector<T> coarse(pm_coarse);
+    GlobalVector<T> prolongated(pm_fine);
+
+    fine.Allocate("fine", fine_global);
+    coarse.Allocate("coarse", coarse_global);
+    prolongated.Allocate("prolongated", fine_global);
+
+    fine.SetRandomUniform(12345ULL + rank, static_cast<T>(-1), static_cast<T>(1));
+
+    // Round trip through the coarse points
+    coarse.Restriction(fine, map);
+    prolongated.Prolongation(coarse, map);
+
+    // Reference
+    std::vector<T> finev(fine_size);
+    std::vector<T> coarsev(coarse_size);
+    std::vector<T> prolongatedv(fine_size);
+
+    fine.GetInterior().CopyToData(finev.data());
+    coarse.GetInterior().CopyToData(coarsev.data());
+    prolongated.GetInterior().CopyToData(prolongatedv.data());
+
+    std::vector<T> coarse_ref(coarse_size, static_cast<T>(0));
+
+    for(int i = 0; i < fine_size; ++i)
+    {
+        if(mapv[i] != -1)
+        {
+            coarse_ref[mapv[i]] += finev[i];
+        }
+    }
+
+    bool success = true;
+
+    for(int i = 0; i < coarse_size; ++i)
+    {
+        success &= (std::abs(coarsev[i] - coarse_ref[i]) <= 1e-5);
+    }
+
+    for(int i = 0; i < fine_size; ++i)
+    {
+        T ref = (mapv[i] != -1) ? coarse_ref[mapv[i]] : static_cast<T>(0);
+
+        success &= (std::abs(prolongatedv[i] - ref) <= 1e-5);
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
 #endif // TESTING_GLOBAL_VECTOR_HPP
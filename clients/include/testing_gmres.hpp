@@ -34,11 +34,12 @@ using namespace rocalution;
 template <typename T>
 bool testing_gmres(Arguments argus, bool expectConvergence = true)
 {
-    int          ndim    = argus.size;
-    int          basis   = argus.index;
-    std::string  matrix  = argus.matrix;
-    std::string  precond = argus.precond;
-    unsigned int format  = argus.format;
+    int          ndim              = argus.size;
+    int          basis             = argus.index;
+    std::string  matrix            = argus.matrix;
+    std::string  precond           = argus.precond;
+    unsigned int format            = argus.format;
+    std::string  orthogonalization = argus.orthogonalization;
 
     // Initialize rocALUTION platform
     set_device_rocalution(device);
@@ -51,9 +52,9 @@ bool testing_gmres(Arguments argus, bool expectConvergence = true)
     LocalVector<T> e;
 
     // Generate A
-    int* csr_ptr = NULL;
-    int* csr_col = NULL;
-    T*   csr_val = NULL;
+    PtrType* csr_ptr = NULL;
+    int*     csr_col = NULL;
+    T*       csr_val = NULL;
 
     int nrow = 0;
     if(matrix == "laplacian")
@@ -147,6 +148,8 @@ bool testing_gmres(Arguments argus, bool expectConvergence = true)
 
     ls.Init(1e-6, 0.0, 1e+8, 10000);
     ls.SetBasisSize(basis);
+    ls.SetOrthogonalization(orthogonalization == "CGS2" ? Orthogonalization_CGS2
+                                                        : Orthogonalization_MGS);
 
     ls.Build();
 
@@ -0,0 +1,125 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_L1JACOBI_HPP
+#define TESTING_L1JACOBI_HPP
+
+#include "utility.hpp"
+
+#include <cmath>
+#include <rocalution/rocalution.hpp>
+#include <vector>
+
+using namespace rocalution;
+
+template <typename T>
+bool testing_l1jacobi(Arguments argus)
+{
+    int         ndim        = argus.size;
+    std::string matrix_type = argus.matrix_type;
+
+    // Initialize rocALUTION platform
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // rocALUTION structures
+    LocalMatrix<T> A;
+    LocalVector<T> b;
+    LocalVector<T> x;
+    LocalVector<T> y;
+
+    // Generate A
+    PtrType* csr_ptr = NULL;
+    int*     csr_col = NULL;
+    T*       csr_val = NULL;
+
+    int nrow = 0;
+    if(matrix_type == "Laplacian2D")
+    {
+        nrow = gen_2d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
+    }
+    else if(matrix_type == "Laplacian3D")
+    {
+        nrow = gen_3d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
+    }
+    else
+    {
+        return false;
+    }
+    int nnz = csr_ptr[nrow];
+
+    // Without damping, l1-Jacobi scales with the inverse absolute row sums
+    std::vector<T> hb(nrow);
+    std::vector<T> hy(nrow);
+
+    for(int i = 0; i < nrow; ++i)
+    {
+        T rowsum = static_cast<T>(0);
+
+        for(PtrType j = csr_ptr[i]; j < csr_ptr[i + 1]; ++j)
+        {
+            rowsum += std::abs(csr_val[j]);
+        }
+
+        hb[i] = static_cast<T>(1) + static_cast<T>(i % 7);
+        hy[i] = hb[i] / rowsum;
+    }
+
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // Allocate b, x and y
+    b.Allocate("b", A.GetM());
+    x.Allocate("x", A.GetN());
+    y.Allocate("y", A.GetN());
+
+    b.CopyFromData(hb.data());
+    y.CopyFromData(hy.data());
+
+    // Move data to accelerator
+    A.MoveToAccelerator();
+    b.MoveToAccelerator();
+    x.MoveToAccelerator();
+    y.MoveToAccelerator();
+
+    L1Jacobi<LocalMatrix<T>, LocalVector<T>, T> l1jacobi;
+
+    l1jacobi.SetOperator(A);
+    l1jacobi.Build();
+    l1jacobi.Solve(b, &x);
+
+    x.ScaleAdd(-1.0, y);
+
+    bool success = (x.Norm() <= 1e-5 * y.Norm());
+
+    // Clean up
+    l1jacobi.Clear();
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+#endif // TESTING_L1JACOBI_HPP
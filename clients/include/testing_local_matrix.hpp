@@ -27,8 +27,10 @@
 
 #include "utility.hpp"
 
+#include <fstream>
 #include <gtest/gtest.h>
 #include <rocalution/rocalution.hpp>
+#include <sstream>
 
 using namespace rocalution;
 
@@ -47,17 +49,21 @@ void testing_local_matrix_bad_args(void)
     LocalVector<int> int1;
 
     // null pointers
-    int* null_int  = nullptr;
-    T*   null_data = nullptr;
+    PtrType* null_ptr  = nullptr;
+    int*     null_int  = nullptr;
+    T*       null_data = nullptr;
 
     // Valid pointers
-    int* vint  = nullptr;
-    T*   vdata = nullptr;
+    PtrType* vptr  = nullptr;
+    int*     vint  = nullptr;
+    T*       vdata = nullptr;
 
+    allocate_host(safe_size, &vptr);
     allocate_host(safe_size, &vint);
     allocate_host(safe_size, &vdata);
 
-    // ExtractSubMatrix, ExtractSubMatrices, Extract(Inverse)Diagonal, ExtractL/U
+    // ExtractSubMatrix, ExtractSubMatrices, Extract(Inverse)Diagonal, ExtractL/U,
+    // ExtractL1BlockDiagonal
     {
         LocalMatrix<T>*   mat_null  = nullptr;
         LocalMatrix<T>**  mat_null2 = nullptr;
@@ -80,6 +86,10 @@ void testing_local_matrix_bad_args(void)
                      ".*Assertion.*vec_inv_diag != (NULL|__null)*");
         ASSERT_DEATH(mat1.ExtractL(mat_null, true), ".*Assertion.*L != (NULL|__null)*");
         ASSERT_DEATH(mat1.ExtractU(mat_null, true), ".*Assertion.*U != (NULL|__null)*");
+        ASSERT_DEATH(mat1.ExtractL1BlockDiagonal(0, pmat[0][0]),
+                     ".*Assertion.*block_size > 0*");
+        ASSERT_DEATH(mat1.ExtractL1BlockDiagonal(1, mat_null),
+                     ".*Assertion.*mat != (NULL|__null)*");
         delete pmat[0][0];
         delete[] pmat[0];
         delete[] pmat;
@@ -125,14 +135,14 @@ void testing_local_matrix_bad_args(void)
     // CopyFrom functions
     {
         ASSERT_DEATH(mat1.UpdateValuesCSR(null_data), ".*Assertion.*val != (NULL|__null)*");
-        ASSERT_DEATH(mat1.CopyFromCSR(null_int, vint, vdata),
+        ASSERT_DEATH(mat1.CopyFromCSR(null_ptr, vint, vdata),
                      ".*Assertion.*row_offsets != (NULL|__null)*");
-        ASSERT_DEATH(mat1.CopyFromCSR(vint, null_int, vdata), ".*Assertion.*col != (NULL|__null)*");
-        ASSERT_DEATH(mat1.CopyFromCSR(vint, vint, null_data), ".*Assertion.*val != (NULL|__null)*");
-        ASSERT_DEATH(mat1.CopyToCSR(null_int, vint, vdata),
+        ASSERT_DEATH(mat1.CopyFromCSR(vptr, null_int, vdata), ".*Assertion.*col != (NULL|__null)*");
+        ASSERT_DEATH(mat1.CopyFromCSR(vptr, vint, null_data), ".*Assertion.*val != (NULL|__null)*");
+        ASSERT_DEATH(mat1.CopyToCSR(null_ptr, vint, vdata),
                      ".*Assertion.*row_offsets != (NULL|__null)*");
-        ASSERT_DEATH(mat1.CopyToCSR(vint, null_int, vdata), ".*Assertion.*col != (NULL|__null)*");
-        ASSERT_DEATH(mat1.CopyToCSR(vint, vint, null_data), ".*Assertion.*val != (NULL|__null)*");
+        ASSERT_DEATH(mat1.CopyToCSR(vptr, null_int, vdata), ".*Assertion.*col != (NULL|__null)*");
+        ASSERT_DEATH(mat1.CopyToCSR(vptr, vint, null_data), ".*Assertion.*val != (NULL|__null)*");
         ASSERT_DEATH(mat1.CopyFromCOO(null_int, vint, vdata), ".*Assertion.*row != (NULL|__null)*");
         ASSERT_DEATH(mat1.CopyFromCOO(vint, null_int, vdata), ".*Assertion.*col != (NULL|__null)*");
         ASSERT_DEATH(mat1.CopyFromCOO(vint, vint, null_data), ".*Assertion.*val != (NULL|__null)*");
@@ -140,13 +150,13 @@ void testing_local_matrix_bad_args(void)
         ASSERT_DEATH(mat1.CopyToCOO(vint, null_int, vdata), ".*Assertion.*col != (NULL|__null)*");
         ASSERT_DEATH(mat1.CopyToCOO(vint, vint, null_data), ".*Assertion.*val != (NULL|__null)*");
         ASSERT_DEATH(
-            mat1.CopyFromHostCSR(null_int, vint, vdata, "", safe_size, safe_size, safe_size),
+            mat1.CopyFromHostCSR(null_ptr, vint, vdata, "", safe_size, safe_size, safe_size),
             ".*Assertion.*row_offset != (NULL|__null)*");
         ASSERT_DEATH(
-            mat1.CopyFromHostCSR(vint, null_int, vdata, "", safe_size, safe_size, safe_size),
+            mat1.CopyFromHostCSR(vptr, null_int, vdata, "", safe_size, safe_size, safe_size),
             ".*Assertion.*col != (NULL|__null)*");
         ASSERT_DEATH(
-            mat1.CopyFromHostCSR(vint, vint, null_data, "", safe_size, safe_size, safe_size),
+            mat1.CopyFromHostCSR(vptr, vint, null_data, "", safe_size, safe_size, safe_size),
             ".*Assertion.*val != (NULL|__null)*");
     }
 
@@ -157,11 +167,15 @@ void testing_local_matrix_bad_args(void)
                      ".*Assertion.*pro != (NULL|__null)*");
     }
 
-    // Apply(Add)
+    // Apply(Add), ApplyTranspose, Residual, JacobiSweep
     {
         LocalVector<T>* null_vec = nullptr;
         ASSERT_DEATH(mat1.Apply(vec1, null_vec), ".*Assertion.*out != (NULL|__null)*");
         ASSERT_DEATH(mat1.ApplyAdd(vec1, 1.0, null_vec), ".*Assertion.*out != (NULL|__null)*");
+        ASSERT_DEATH(mat1.ApplyTranspose(vec1, null_vec), ".*Assertion.*out != (NULL|__null)*");
+        ASSERT_DEATH(mat1.Residual(vec1, vec1, null_vec), ".*Assertion.*res != (NULL|__null)*");
+        ASSERT_DEATH(mat1.JacobiSweep(vec1, vec1, 1.0, vec1, null_vec),
+                     ".*Assertion.*out != (NULL|__null)*");
     }
 
     // Row/Column manipulation
@@ -237,21 +251,21 @@ void testing_local_matrix_bad_args(void)
         ASSERT_DEATH(mat1.SetDataPtrCOO(&vint, &vint, nullptr, "", safe_size, safe_size, safe_size),
                      ".*Assertion.*val != (NULL|__null)*");
         ASSERT_DEATH(
-            mat1.SetDataPtrCSR(&null_int, &vint, &vdata, "", safe_size, safe_size, safe_size),
+            mat1.SetDataPtrCSR(&null_ptr, &vint, &vdata, "", safe_size, safe_size, safe_size),
             ".*Assertion.*row_offset != (NULL|__null)*");
         ASSERT_DEATH(
-            mat1.SetDataPtrCSR(&vint, &null_int, &vdata, "", safe_size, safe_size, safe_size),
+            mat1.SetDataPtrCSR(&vptr, &null_int, &vdata, "", safe_size, safe_size, safe_size),
             ".*Assertion.*col != (NULL|__null)*");
         ASSERT_DEATH(
-            mat1.SetDataPtrCSR(&vint, &vint, &null_data, "", safe_size, safe_size, safe_size),
+            mat1.SetDataPtrCSR(&vptr, &vint, &null_data, "", safe_size, safe_size, safe_size),
             ".*Assertion.*val != (NULL|__null)*");
         ASSERT_DEATH(
             mat1.SetDataPtrCSR(nullptr, &vint, &vdata, "", safe_size, safe_size, safe_size),
             ".*Assertion.*row_offset != (NULL|__null)*");
         ASSERT_DEATH(
-            mat1.SetDataPtrCSR(&vint, nullptr, &vdata, "", safe_size, safe_size, safe_size),
+            mat1.SetDataPtrCSR(&vptr, nullptr, &vdata, "", safe_size, safe_size, safe_size),
             ".*Assertion.*col != (NULL|__null)*");
-        ASSERT_DEATH(mat1.SetDataPtrCSR(&vint, &vint, nullptr, "", safe_size, safe_size, safe_size),
+        ASSERT_DEATH(mat1.SetDataPtrCSR(&vptr, &vint, nullptr, "", safe_size, safe_size, safe_size),
                      ".*Assertion.*val != (NULL|__null)*");
         ASSERT_DEATH(
             mat1.SetDataPtrMCSR(&null_int, &vint, &vdata, "", safe_size, safe_size, safe_size),
@@ -310,11 +324,11 @@ void testing_local_matrix_bad_args(void)
                      ".*Assertion.*col == (NULL|__null)*");
         ASSERT_DEATH(mat1.LeaveDataPtrCOO(&null_int, &null_int, &vdata),
                      ".*Assertion.*val == (NULL|__null)*");
-        ASSERT_DEATH(mat1.LeaveDataPtrCSR(&vint, &null_int, &null_data),
+        ASSERT_DEATH(mat1.LeaveDataPtrCSR(&vptr, &null_int, &null_data),
                      ".*Assertion.*row_offset == (NULL|__null)*");
-        ASSERT_DEATH(mat1.LeaveDataPtrCSR(&null_int, &vint, &null_data),
+        ASSERT_DEATH(mat1.LeaveDataPtrCSR(&null_ptr, &vint, &null_data),
                      ".*Assertion.*col == (NULL|__null)*");
-        ASSERT_DEATH(mat1.LeaveDataPtrCSR(&null_int, &null_int, &vdata),
+        ASSERT_DEATH(mat1.LeaveDataPtrCSR(&null_ptr, &null_int, &vdata),
                      ".*Assertion.*val == (NULL|__null)*");
         ASSERT_DEATH(mat1.LeaveDataPtrMCSR(&vint, &null_int, &null_data),
                      ".*Assertion.*row_offset == (NULL|__null)*");
@@ -333,6 +347,7 @@ void testing_local_matrix_bad_args(void)
         ASSERT_DEATH(mat1.LeaveDataPtrDENSE(&vdata), ".*Assertion.*val == (NULL|__null)*");
     }
 
+    free_host(&vptr);
     free_host(&vint);
     free_host(&vdata);
 
@@ -352,9 +367,9 @@ bool testing_local_matrix_conversions(Arguments argus)
     init_rocalution();
 
     // Generate A
-    int* csr_ptr = NULL;
-    int* csr_col = NULL;
-    T*   csr_val = NULL;
+    PtrType* csr_ptr = NULL;
+    int*     csr_col = NULL;
+    T*       csr_val = NULL;
 
     int nrow = 0;
     int ncol = 0;
@@ -380,6 +395,43 @@ bool testing_local_matrix_conversions(Arguments argus)
 
     int nnz = csr_ptr[nrow];
 
+    std::string mtx_name      = "testing_local_matrix_" + matrix_type + std::to_string(size);
+    std::string mtx_general   = mtx_name + ".mtx";
+    std::string mtx_symmetric = mtx_name + "_sym.mtx";
+
+    // Store the lower triangle of symmetric matrices in symmetric Matrix Market format
+    bool symmetric = (matrix_type == "Laplacian2D");
+
+    if(symmetric)
+    {
+        int lower_nnz = 0;
+        for(int i = 0; i < nrow; ++i)
+        {
+            for(PtrType j = csr_ptr[i]; j < csr_ptr[i + 1]; ++j)
+            {
+                lower_nnz += (csr_col[j] <= i);
+            }
+        }
+
+        FILE* file = fopen(mtx_symmetric.c_str(), "w");
+        fprintf(file, "%%%%MatrixMarket matrix coordinate real symmetric\n");
+        fprintf(file, "%d %d %d\n", nrow, ncol, lower_nnz);
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            for(PtrType j = csr_ptr[i]; j < csr_ptr[i + 1]; ++j)
+            {
+                // More than 19 significant digits, which exceed a 64 bit mantissa
+                if(csr_col[j] <= i)
+                {
+                    fprintf(file, "%d %d %0.20lf\n", i + 1, csr_col[j] + 1, (double)csr_val[j]);
+                }
+            }
+        }
+
+        fclose(file);
+    }
+
     LocalMatrix<T> A;
     A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, ncol);
 
@@ -389,6 +441,146 @@ bool testing_local_matrix_conversions(Arguments argus)
 
     bool success = true;
 
+    // Check Matrix Market round trip into CSR and COO (random matrices may hold column
+    // indices out of range)
+    if(matrix_type != "Random")
+    {
+        LocalVector<T> x;
+        LocalVector<T> y;
+        LocalVector<T> z;
+
+        x.Allocate("x", ncol);
+        y.Allocate("y", nrow);
+        z.Allocate("z", nrow);
+
+        x.SetRandomUniform(12345ULL, static_cast<T>(-1), static_cast<T>(1));
+        A.Apply(x, &y);
+
+        A.WriteFileMTX(mtx_general);
+
+        LocalMatrix<T> B;
+        B.ReadFileMTX(mtx_general);
+        success &= B.Check();
+        success &= (B.GetNnz() == A.GetNnz());
+        B.Apply(x, &z);
+        z.ScaleAdd(static_cast<T>(-1), y);
+        success &= (z.Norm() <= 1e-4 * y.Norm());
+
+        LocalMatrix<T> C;
+        C.ConvertToCOO();
+        C.ReadFileMTX(mtx_general);
+        success &= C.Check();
+        success &= (C.GetNnz() == A.GetNnz());
+        C.Apply(x, &z);
+        z.ScaleAdd(static_cast<T>(-1), y);
+        success &= (z.Norm() <= 1e-4 * y.Norm());
+
+        if(symmetric)
+        {
+            B.ReadFileMTX(mtx_symmetric);
+            success &= B.Check();
+            success &= (B.GetNnz() == A.GetNnz());
+            B.Apply(x, &z);
+            z.ScaleAdd(static_cast<T>(-1), y);
+            success &= (z.Norm() <= 1e-4 * y.Norm());
+
+            C.ReadFileMTX(mtx_symmetric);
+            success &= C.Check();
+            success &= (C.GetNnz() == A.GetNnz());
+            C.Apply(x, &z);
+            z.ScaleAdd(static_cast<T>(-1), y);
+            success &= (z.Norm() <= 1e-4 * y.Norm());
+
+            std::remove(mtx_symmetric.c_str());
+        }
+
+        std::remove(mtx_general.c_str());
+
+        // Check binary CSR round trip in both layouts
+        std::string csr_stream = mtx_name + ".csr";
+        std::string csr_mapped = mtx_name + "_mapped.csr";
+
+        A.WriteFileCSR(csr_stream);
+        A.WriteFileCSR(csr_mapped, CSRFileMapped);
+
+        B.ReadFileCSR(csr_stream);
+        success &= B.Check();
+        success &= (B.GetNnz() == A.GetNnz());
+        B.Apply(x, &z);
+        z.ScaleAdd(static_cast<T>(-1), y);
+        success &= (z.Norm() <= 1e-4 * y.Norm());
+
+        B.ReadFileCSR(csr_mapped);
+        success &= B.Check();
+        success &= (B.GetNnz() == A.GetNnz());
+        B.Apply(x, &z);
+        z.ScaleAdd(static_cast<T>(-1), y);
+        success &= (z.Norm() <= 1e-4 * y.Norm());
+
+        // Modifying the mapped matrix must not change the file
+        B.Scale(static_cast<T>(2));
+        C.ReadFileCSR(csr_mapped);
+        C.Apply(x, &z);
+        z.ScaleAdd(static_cast<T>(-1), y);
+        success &= (z.Norm() <= 1e-4 * y.Norm());
+
+        // Read the mapped file in the other precision
+        typedef typename std::conditional<std::is_same<T, float>::value, double, float>::type O;
+
+        std::vector<T> hx(ncol);
+        std::vector<T> hy(nrow);
+        x.CopyToData(hx.data());
+        y.CopyToData(hy.data());
+
+        std::vector<O> ox(hx.begin(), hx.end());
+        std::vector<O> oy(hy.begin(), hy.end());
+
+        LocalVector<O> xo;
+        LocalVector<O> yo;
+        LocalVector<O> zo;
+
+        xo.Allocate("x", ncol);
+        yo.Allocate("y", nrow);
+        zo.Allocate("z", nrow);
+
+        xo.CopyFromData(ox.data());
+        yo.CopyFromData(oy.data());
+
+        LocalMatrix<O> D;
+        D.ReadFileCSR(csr_mapped);
+        success &= D.Check();
+        success &= (D.GetNnz() == A.GetNnz());
+        D.Apply(xo, &zo);
+        zo.ScaleAdd(static_cast<O>(-1), yo);
+        success &= (zo.Norm() <= 1e-4 * yo.Norm());
+
+        std::remove(csr_stream.c_str());
+        std::remove(csr_mapped.c_str());
+
+        // Check numeric triple product in the structure of A * A * A
+        LocalMatrix<T> AA;
+        LocalMatrix<T> AAA;
+        AA.MatrixMult(A, A);
+        AAA.MatrixMult(AA, A);
+        AAA.Apply(x, &y);
+
+        // Check fused triple product
+        C.TripleMatrixMult(A, A, A);
+        success &= C.Check();
+        success &= (C.GetNnz() == AAA.GetNnz());
+        C.Apply(x, &z);
+        z.ScaleAdd(static_cast<T>(-1), y);
+        success &= (z.Norm() <= 1e-4 * y.Norm());
+
+        B.CloneFrom(A);
+        B.Scale(static_cast<T>(2));
+        AAA.NumericTripleMatrixMult(B, B, B);
+        success &= AAA.Check();
+        AAA.Apply(x, &z);
+        z.ScaleAdd(static_cast<T>(-0.125), y);
+        success &= (z.Norm() <= 1e-4 * y.Norm());
+    }
+
     // Check host conversions
     A.ConvertToCOO();
     success &= A.Check();
@@ -398,6 +590,8 @@ bool testing_local_matrix_conversions(Arguments argus)
     success &= A.Check();
     A.ConvertToHYB();
     success &= A.Check();
+    A.ConvertToSELL();
+    success &= A.Check();
     A.ConvertToDENSE();
     success &= A.Check();
     A.ConvertToMCSR();
@@ -418,6 +612,8 @@ bool testing_local_matrix_conversions(Arguments argus)
     success &= A.Check();
     A.ConvertToHYB();
     success &= A.Check();
+    A.ConvertToSELL();
+    success &= A.Check();
     A.ConvertToDENSE();
     success &= A.Check();
     A.ConvertToMCSR();
@@ -433,6 +629,422 @@ bool testing_local_matrix_conversions(Arguments argus)
     return success;
 }
 
+template <typename T>
+bool testing_local_matrix_jacobi_sweep(Arguments argus)
+{
+    int         size        = argus.size;
+    std::string matrix_type = argus.matrix_type;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Generate A
+    PtrType* csr_ptr = NULL;
+    int*     csr_col = NULL;
+    T*       csr_val = NULL;
+
+    int nrow = 0;
+    if(matrix_type == "Laplacian2D")
+    {
+        nrow = gen_2d_laplacian(size, &csr_ptr, &csr_col, &csr_val);
+    }
+    else if(matrix_type == "PermutedIdentity")
+    {
+        nrow = gen_permuted_identity(size, &csr_ptr, &csr_col, &csr_val);
+    }
+    else
+    {
+        return false;
+    }
+
+    int nnz = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    LocalVector<T> d;
+    LocalVector<T> b;
+    LocalVector<T> x;
+    LocalVector<T> y;
+    LocalVector<T> z;
+
+    d.Allocate("d", nrow);
+    b.Allocate("b", nrow);
+    x.Allocate("x", nrow);
+    y.Allocate("y", nrow);
+    z.Allocate("z", nrow);
+
+    d.SetRandomUniform(12345ULL, static_cast<T>(0.5), static_cast<T>(1));
+    b.SetRandomUniform(67890ULL, static_cast<T>(-1), static_cast<T>(1));
+    x.SetRandomUniform(24680ULL, static_cast<T>(-1), static_cast<T>(1));
+
+    T omega = static_cast<T>(2) / static_cast<T>(3);
+
+    bool success = true;
+
+    // Check fused kernels on host and accelerator, in CSR and in a format without these
+    // kernels
+    for(int pass = 0; pass < 4; ++pass)
+    {
+        if(pass == 2)
+        {
+            A.MoveToAccelerator();
+            d.MoveToAccelerator();
+            b.MoveToAccelerator();
+            x.MoveToAccelerator();
+            y.MoveToAccelerator();
+            z.MoveToAccelerator();
+        }
+
+        if(pass % 2 == 0)
+        {
+            A.ConvertToCSR();
+        }
+        else
+        {
+            A.ConvertToELL();
+        }
+
+        // Reference residual y = b - Ax
+        A.Apply(x, &y);
+        y.ScaleAdd(static_cast<T>(-1), b);
+
+        A.Residual(b, x, &z);
+        z.ScaleAdd(static_cast<T>(-1), y);
+        success &= (z.Norm() <= 1e-4 * y.Norm());
+
+        // Reference sweep y = x + omega * d * (b - Ax)
+        y.PointWiseMult(d);
+        y.ScaleAdd(omega, x);
+
+        A.JacobiSweep(d, b, omega, x, &z);
+        z.ScaleAdd(static_cast<T>(-1), y);
+        success &= (z.Norm() <= 1e-4 * y.Norm());
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_matrix_apply_transpose(Arguments argus)
+{
+    int size     = argus.size;
+    int nthreads = argus.omp_nthreads;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Split also small matrices into the private buffers of several threads
+    set_omp_threads_rocalution(nthreads);
+    set_omp_threshold_rocalution(0);
+
+    bool success = true;
+
+    // Tall and wide matrices, such that the row and column ranges differ
+    for(int shape = 0; shape < 2; ++shape)
+    {
+        int nrow = (shape == 0) ? 2 * size : size;
+        int ncol = (shape == 0) ? size : 2 * size;
+
+        // Generate A
+        PtrType* csr_ptr = NULL;
+        int*     csr_col = NULL;
+        T*       csr_val = NULL;
+
+        gen_random(nrow, ncol, 6, &csr_ptr, &csr_col, &csr_val);
+
+        int nnz = csr_ptr[nrow];
+
+        LocalMatrix<T> A;
+        A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, ncol);
+
+        LocalVector<T> x;
+        LocalVector<T> y;
+        LocalVector<T> z;
+
+        x.Allocate("x", nrow);
+        y.Allocate("y", ncol);
+        z.Allocate("z", ncol);
+
+        x.SetRandomUniform(12345ULL, static_cast<T>(-1), static_cast<T>(1));
+
+        // Check the transposed product on host and accelerator, in CSR and in a format
+        // without this kernel
+        for(int pass = 0; pass < 4; ++pass)
+        {
+            if(pass == 2)
+            {
+                A.MoveToAccelerator();
+                x.MoveToAccelerator();
+                y.MoveToAccelerator();
+                z.MoveToAccelerator();
+            }
+
+            if(pass % 2 == 0)
+            {
+                A.ConvertToCSR();
+            }
+            else
+            {
+                A.ConvertToELL();
+            }
+
+            // Reference transposed product y = A^T x
+            LocalMatrix<T> At;
+            At.CloneBackend(A);
+            A.Transpose(&At);
+            At.Apply(x, &y);
+
+            A.ApplyTranspose(x, &z);
+            z.ScaleAdd(static_cast<T>(-1), y);
+            success &= (z.Norm() <= 1e-4 * y.Norm());
+        }
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+void testing_local_matrix_coarsening_maps(const LocalMatrix<T>& A, int nrow, int* maps)
+{
+    LocalVector<int>  cf;
+    LocalVector<int>  conn;
+    LocalVector<int>  agg;
+    LocalVector<bool> S;
+
+    cf.CloneBackend(A);
+    conn.CloneBackend(A);
+    agg.CloneBackend(A);
+    S.CloneBackend(A);
+
+    A.RSCoarsening(0.25f, &cf, &S);
+    cf.CopyToData(maps);
+
+    A.RSPMISCoarsening(0.25f, &cf, &S);
+    cf.CopyToData(maps + nrow);
+
+    A.AMGConnect(static_cast<T>(0.01), &conn);
+
+    A.AMGAggregate(conn, &agg);
+    agg.CopyToData(maps + 2 * nrow);
+
+    A.AMGPMISAggregate(conn, &agg);
+    agg.CopyToData(maps + 3 * nrow);
+}
+
+template <typename T>
+bool testing_local_matrix_coarsening(Arguments argus)
+{
+    int         size        = argus.size;
+    std::string matrix_type = argus.matrix_type;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Generate A
+    PtrType* csr_ptr = NULL;
+    int*     csr_col = NULL;
+    T*       csr_val = NULL;
+
+    int nrow = 0;
+    if(matrix_type == "Laplacian2D")
+    {
+        nrow = gen_2d_laplacian(size, &csr_ptr, &csr_col, &csr_val);
+    }
+    else if(matrix_type == "Laplacian3D")
+    {
+        nrow = gen_3d_laplacian(size, &csr_ptr, &csr_col, &csr_val);
+    }
+    else
+    {
+        return false;
+    }
+
+    int nnz = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // Coarsening and aggregation have to be identical for any number of threads
+    std::vector<int> ref(4 * nrow);
+    std::vector<int> maps(4 * nrow);
+
+    set_omp_threads_rocalution(1);
+    testing_local_matrix_coarsening_maps(A, nrow, ref.data());
+
+    bool success = true;
+
+    for(int nthreads = 2; nthreads <= 8; nthreads *= 2)
+    {
+        set_omp_threads_rocalution(nthreads);
+        testing_local_matrix_coarsening_maps(A, nrow, maps.data());
+
+        success &= (maps == ref);
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_matrix_convert_to_best(Arguments argus)
+{
+    int         size        = argus.size;
+    std::string matrix_type = argus.matrix_type;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Generate A
+    PtrType* csr_ptr = NULL;
+    int*     csr_col = NULL;
+    T*       csr_val = NULL;
+
+    int nrow = 0;
+    int ncol = 0;
+    if(matrix_type == "Laplacian2D")
+    {
+        nrow = gen_2d_laplacian(size, &csr_ptr, &csr_col, &csr_val);
+        ncol = nrow;
+    }
+    else if(matrix_type == "PermutedIdentity")
+    {
+        nrow = gen_permuted_identity(size, &csr_ptr, &csr_col, &csr_val);
+        ncol = nrow;
+    }
+    else if(matrix_type == "Random")
+    {
+        nrow = gen_random(100 * size, 50 * size, 6, &csr_ptr, &csr_col, &csr_val);
+        ncol = 50 * size;
+    }
+    else
+    {
+        return false;
+    }
+
+    int nnz = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, ncol);
+
+    LocalVector<T> x;
+    LocalVector<T> y;
+    LocalVector<T> z;
+
+    x.Allocate("x", ncol);
+    y.Allocate("y", nrow);
+    z.Allocate("z", nrow);
+
+    x.SetRandomUniform(12345ULL, static_cast<T>(-1), static_cast<T>(1));
+
+    // Reference product in CSR format
+    A.Apply(x, &y);
+
+    // SELL is a host format, on the accelerator the conversion keeps CSR
+    bool accel = false;
+    {
+        LocalMatrix<T> probe;
+        probe.CloneFrom(A);
+        probe.MoveToAccelerator();
+        probe.ConvertTo(SELL);
+
+        accel = (probe.GetFormat() != SELL);
+    }
+
+    if(accel == true)
+    {
+        A.MoveToAccelerator();
+        x.MoveToAccelerator();
+        y.MoveToAccelerator();
+        z.MoveToAccelerator();
+    }
+
+    bool success = true;
+
+    // Select by estimated traffic and by timing, the second selection is cached
+    for(int pass = 0; pass < 4; ++pass)
+    {
+        bool benchmark = (pass >= 2);
+
+        LocalMatrix<T> B;
+        B.CloneFrom(A);
+
+        B.ConvertToBest(benchmark, 2.0);
+
+        // The padded formats move more data than CSR for random rows. The Laplacian is
+        // kept in CSR on the host, where the DIA product is slower, and stored in DIA
+        // format on the accelerator.
+        if(benchmark == false && matrix_type == "Random")
+        {
+            success &= (B.GetFormat() == CSR);
+        }
+        else if(benchmark == false && matrix_type == "Laplacian2D")
+        {
+            success &= (B.GetFormat() == (accel ? DIA : CSR));
+        }
+
+        if(pass % 2 == 1)
+        {
+            LocalMatrix<T> C;
+            C.CloneFrom(A);
+
+            // Record the second selection, a cached selection does not time any product
+            std::string profile = "testing_local_matrix_convert_to_best.json";
+
+            set_profiler_rocalution(true);
+            reset_profiler_rocalution();
+
+            C.ConvertToBest(benchmark, 2.0);
+
+            set_profiler_rocalution(false);
+            write_profiler_rocalution(profile);
+            reset_profiler_rocalution();
+
+            std::ifstream     file(profile.c_str());
+            std::stringstream regions;
+            regions << file.rdbuf();
+            file.close();
+
+            std::remove(profile.c_str());
+
+            success &= (regions.str().find("LocalMatrix::ConvertToBest") != std::string::npos);
+            success &= (regions.str().find("LocalMatrix::Apply") == std::string::npos);
+
+            success &= (C.GetFormat() == B.GetFormat());
+            success &= (C.GetBlockDimension() == B.GetBlockDimension());
+        }
+
+        B.Apply(x, &z);
+        z.ScaleAdd(static_cast<T>(-1), y);
+        success &= (z.Norm() <= 1e-4 * y.Norm());
+
+        // Without additional memory
+        B.CloneFrom(A);
+        B.ConvertToBest(benchmark, 1.0);
+
+        B.Apply(x, &z);
+        z.ScaleAdd(static_cast<T>(-1), y);
+        success &= (z.Norm() <= 1e-4 * y.Norm());
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
 template <typename T>
 bool testing_local_matrix_allocations(Arguments argus)
 {
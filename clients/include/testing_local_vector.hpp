@@ -133,6 +133,28 @@ void testing_local_vector_bad_args(void)
         free_host(&vint);
     }
 
+    // MDot
+    {
+        T*                    null_T = nullptr;
+        T*                    vdata  = nullptr;
+        const LocalVector<T>* x[1]   = {&vec};
+        allocate_host(safe_size, &vdata);
+        ASSERT_DEATH(vec.MDot(1, nullptr, vdata), ".*Assertion.*x != (NULL|__null)*");
+        ASSERT_DEATH(vec.MDot(1, x, null_T), ".*Assertion.*result != (NULL|__null)*");
+        free_host(&vdata);
+    }
+
+    // MAXPY
+    {
+        T*                    null_T = nullptr;
+        T*                    vdata  = nullptr;
+        const LocalVector<T>* x[1]   = {&vec};
+        allocate_host(safe_size, &vdata);
+        ASSERT_DEATH(vec.MAXPY(1, nullptr, vdata), ".*Assertion.*x != (NULL|__null)*");
+        ASSERT_DEATH(vec.MAXPY(1, x, null_T), ".*Assertion.*alpha != (NULL|__null)*");
+        free_host(&vdata);
+    }
+
     // Stop rocALUTION
     stop_rocalution();
 }
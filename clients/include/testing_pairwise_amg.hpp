@@ -51,6 +51,7 @@ bool testing_pairwise_amg(Arguments argus)
     unsigned int format         = argus.format;
     unsigned int ordering       = argus.ordering;
     bool         rebuildnumeric = argus.rebuildnumeric;
+    bool         mixed          = argus.mixed_precision;
 
     // Initialize rocALUTION platform
     set_device_rocalution(device);
@@ -64,9 +65,9 @@ bool testing_pairwise_amg(Arguments argus)
     LocalVector<T> e;
 
     // Generate A
-    int* csr_ptr = NULL;
-    int* csr_col = NULL;
-    T*   csr_val = NULL;
+    PtrType* csr_ptr = NULL;
+    int*     csr_col = NULL;
+    T*       csr_val = NULL;
 
     int nrow = gen_2d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
     int nnz  = csr_ptr[nrow];
@@ -120,6 +121,7 @@ bool testing_pairwise_amg(Arguments argus)
     p.SetOperator(A);
     p.SetManualSmoothers(true);
     p.SetManualSolver(true);
+    p.SetMixedPrecision(mixed);
     p.BuildHierarchy();
 
     // Get number of hierarchy levels
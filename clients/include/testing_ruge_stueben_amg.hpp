@@ -65,9 +65,9 @@ bool testing_ruge_stueben_amg(Arguments argus)
     LocalVector<T> e;
 
     // Generate A
-    int* csr_ptr = NULL;
-    int* csr_col = NULL;
-    T*   csr_val = NULL;
+    PtrType* csr_ptr = NULL;
+    int*     csr_col = NULL;
+    T*       csr_val = NULL;
 
     int nrow = gen_2d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
     int nnz  = csr_ptr[nrow];
@@ -150,6 +150,18 @@ bool testing_ruge_stueben_amg(Arguments argus)
             smooth[i] = new Jacobi<LocalMatrix<T>, LocalVector<T>, T>;
             fp->SetRelaxation(0.67);
         }
+        else if(smoother == "L1Jacobi")
+        {
+            smooth[i] = new L1Jacobi<LocalMatrix<T>, LocalVector<T>, T>;
+        }
+        else if(smoother == "HybridGS")
+        {
+            HybridGS<LocalMatrix<T>, LocalVector<T>, T>* hgs
+                = new HybridGS<LocalMatrix<T>, LocalVector<T>, T>;
+            hgs->SetNumberOfBlocks(8);
+
+            smooth[i] = hgs;
+        }
         else if(smoother == "MCGS")
         {
             smooth[i] = new MultiColoredGS<LocalMatrix<T>, LocalVector<T>, T>;
@@ -54,6 +54,7 @@ bool testing_saamg(Arguments argus)
     int          cycle               = argus.cycle;
     bool         scaling             = argus.ordering;
     bool         rebuildnumeric      = argus.rebuildnumeric;
+    bool         implicit            = argus.implicit_restriction;
 
     // Initialize rocALUTION platform
     set_device_rocalution(device);
@@ -67,9 +68,9 @@ bool testing_saamg(Arguments argus)
     LocalVector<T> e;
 
     // Generate A
-    int* csr_ptr = NULL;
-    int* csr_col = NULL;
-    T*   csr_val = NULL;
+    PtrType* csr_ptr = NULL;
+    int*     csr_col = NULL;
+    T*       csr_val = NULL;
 
     int nrow = 0;
     if(matrix_type == "Laplacian2D")
@@ -139,6 +140,7 @@ bool testing_saamg(Arguments argus)
     p.SetManualSmoothers(true);
     p.SetManualSolver(true);
     p.SetScaling(scaling);
+    p.SetImplicitRestriction(implicit);
 
     if(coarsening_strategy == "Greedy")
     {
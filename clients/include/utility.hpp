@@ -26,16 +26,19 @@
 #define TESTING_UTILITY_HPP
 
 #include <algorithm>
+#include <cmath>
 #include <string>
 
 #include "random.hpp"
 
+#include <rocalution/rocalution.hpp>
+
 extern int device;
 
 /* ============================================================================================ */
 /*! \brief  Generate 2D laplacian on unit square in CSR format */
 template <typename T>
-int gen_2d_laplacian(int ndim, int** rowptr, int** col, T** val)
+int gen_2d_laplacian(int ndim, rocalution::PtrType** rowptr, int** col, T** val)
 {
     if(ndim == 0)
     {
@@ -45,7 +48,7 @@ int gen_2d_laplacian(int ndim, int** rowptr, int** col, T** val)
     int n       = ndim * ndim;
     int nnz_mat = n * 5 - ndim * 4;
 
-    *rowptr = new int[n + 1];
+    *rowptr = new rocalution::PtrType[n + 1];
     *col    = new int[nnz_mat];
     *val    = new T[nnz_mat];
 
@@ -100,7 +103,7 @@ int gen_2d_laplacian(int ndim, int** rowptr, int** col, T** val)
 /* ============================================================================================ */
 /*! \brief  Generate 3D laplacian on unit square in CSR format */
 template <typename T>
-int gen_3d_laplacian(int ndim, int** row_ptr, int** col_ind, T** val)
+int gen_3d_laplacian(int ndim, rocalution::PtrType** row_ptr, int** col_ind, T** val)
 {
     // Do nothing
     if(ndim == 0)
@@ -113,7 +116,7 @@ int gen_3d_laplacian(int ndim, int** row_ptr, int** col_ind, T** val)
     // Approximate 27pt stencil
     int nnz_mat = 27 * n;
 
-    *row_ptr = new int[n + 1];
+    *row_ptr = new rocalution::PtrType[n + 1];
     *col_ind = new int[nnz_mat];
     *val     = new T[nnz_mat];
 
@@ -171,7 +174,7 @@ int gen_3d_laplacian(int ndim, int** row_ptr, int** col_ind, T** val)
 /* ============================================================================================ */
 /*! \brief  Generate full rank identity matrix where the row order has been permuted */
 template <typename T>
-int gen_permuted_identity(int ndim, int** rowptr, int** col, T** val)
+int gen_permuted_identity(int ndim, rocalution::PtrType** rowptr, int** col, T** val)
 {
     if(ndim == 0)
     {
@@ -181,7 +184,7 @@ int gen_permuted_identity(int ndim, int** rowptr, int** col, T** val)
     int n       = ndim * ndim;
     int nnz_mat = n;
 
-    *rowptr = new int[n + 1];
+    *rowptr = new rocalution::PtrType[n + 1];
     *col    = new int[nnz_mat];
     *val    = new T[nnz_mat];
 
@@ -213,7 +216,7 @@ int gen_permuted_identity(int ndim, int** rowptr, int** col, T** val)
 /* ============================================================================================ */
 /*! \brief  Generate random sparse matrix */
 template <typename T>
-int gen_random(int m, int n, int max_nnz_per_row, int** rowptr, int** col, T** val)
+int gen_random(int m, int n, int max_nnz_per_row, rocalution::PtrType** rowptr, int** col, T** val)
 {
     if(m == 0 || n == 0)
     {
@@ -224,11 +227,11 @@ int gen_random(int m, int n, int max_nnz_per_row, int** rowptr, int** col, T** v
     int* nnz_per_row = new int[m];
     for(int i = 0; i < m; i++)
     {
-        nnz_per_row[i] = random_generator_exact<int>(0, max_nnz_per_row);
+        nnz_per_row[i] = random_generator_exact<int>(0, std::min(max_nnz_per_row, n));
         nnz += nnz_per_row[i];
     }
 
-    *rowptr = new int[m + 1];
+    *rowptr = new rocalution::PtrType[m + 1];
     *col    = new int[nnz];
     *val    = new T[nnz];
 
@@ -245,7 +248,23 @@ int gen_random(int m, int n, int max_nnz_per_row, int** rowptr, int** col, T** v
 
         for(int j = row_start; j < row_end; j++)
         {
-            (*col)[j] = random_generator<int>(0, n);
+            // Draw distinct column indices within each row
+            bool unique = false;
+            while(!unique)
+            {
+                (*col)[j] = random_generator<int>(0, n - 1);
+                unique    = true;
+
+                for(int k = row_start; k < j; ++k)
+                {
+                    if((*col)[k] == (*col)[j])
+                    {
+                        unique = false;
+                        break;
+                    }
+                }
+            }
+
             (*val)[j] = random_generator<T>();
         }
     }
@@ -268,13 +287,94 @@ int gen_random(int m, int n, int max_nnz_per_row, int** rowptr, int** col, T** v
         }
     };
 
-    qsort(*col, nnz, sizeof(int), compare);
+    for(int i = 0; i < m; i++)
+    {
+        qsort(*col + (*rowptr)[i], nnz_per_row[i], sizeof(int), compare);
+    }
 
     delete[] nnz_per_row;
 
     return m;
 }
 
+/* ============================================================================================ */
+/*! \brief  Generate random non-symmetric, strictly diagonally dominant matrix */
+template <typename T>
+int gen_random_diagonally_dominant(int                   ndim,
+                                   int                   max_nnz_per_row,
+                                   rocalution::PtrType** rowptr,
+                                   int**                 col,
+                                   T**                   val)
+{
+    rocalution::PtrType* rand_ptr = NULL;
+    int*                 rand_col = NULL;
+    T*                   rand_val = NULL;
+
+    int n = gen_random(ndim * ndim, ndim * ndim, max_nnz_per_row, &rand_ptr, &rand_col, &rand_val);
+
+    if(n == 0)
+    {
+        return 0;
+    }
+
+    // Off-diagonal entries of the random pattern plus the full diagonal
+    *rowptr = new rocalution::PtrType[n + 1];
+    *col    = new int[rand_ptr[n] + n];
+    *val    = new T[rand_ptr[n] + n];
+
+    rocalution::PtrType nnz = 0;
+
+    (*rowptr)[0] = 0;
+
+    for(int i = 0; i < n; ++i)
+    {
+        T    sum  = static_cast<T>(0);
+        bool diag = false;
+
+        for(rocalution::PtrType j = rand_ptr[i]; j < rand_ptr[i + 1]; ++j)
+        {
+            if(rand_col[j] == i)
+            {
+                continue;
+            }
+
+            // Insert the diagonal entry in column order
+            if(diag == false && rand_col[j] > i)
+            {
+                (*col)[nnz++] = i;
+                diag          = true;
+            }
+
+            (*col)[nnz] = rand_col[j];
+            (*val)[nnz] = rand_val[j];
+            sum += std::abs(rand_val[j]);
+            ++nnz;
+        }
+
+        if(diag == false)
+        {
+            (*col)[nnz++] = i;
+        }
+
+        (*rowptr)[i + 1] = nnz;
+
+        // Set the diagonal value, once the row sum is known
+        for(rocalution::PtrType j = (*rowptr)[i]; j < nnz; ++j)
+        {
+            if((*col)[j] == i)
+            {
+                (*val)[j] = sum + static_cast<T>(1);
+            }
+        }
+    }
+
+    delete[] rand_ptr;
+    delete[] rand_col;
+    delete[] rand_val;
+
+    return n;
+}
+
 /* ============================================================================================ */
 
 /*! \brief Class used to parse command arguments in both client & gtest   */
@@ -316,6 +416,7 @@ public:
     std::string matrix              = "";
     std::string coarsening_strategy = "";
     std::string matrix_type         = "";
+    std::string orthogonalization   = "MGS";
 
     int pre_smooth     = 2;
     int post_smooth    = 2;
@@ -323,6 +424,9 @@ public:
     int cycle          = 0;
     int rebuildnumeric = 0;
 
+    int mixed_precision      = 0;
+    int implicit_restriction = 0;
+
     unsigned int format;
 
     Arguments& operator=(const Arguments& rhs)
@@ -358,7 +462,11 @@ public:
         this->cycle          = rhs.cycle;
         this->rebuildnumeric = rhs.rebuildnumeric;
 
+        this->mixed_precision      = rhs.mixed_precision;
+        this->implicit_restriction = rhs.implicit_restriction;
+
         this->coarsening_strategy = rhs.coarsening_strategy;
+        this->orthogonalization   = rhs.orthogonalization;
 
         this->format = rhs.format;
 
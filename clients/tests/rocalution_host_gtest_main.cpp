@@ -27,6 +27,10 @@
 #include <rocalution/rocalution.hpp>
 #include <stdexcept>
 
+#ifdef SUPPORT_MPI
+#include <mpi.h>
+#endif
+
 int device;
 
 /* =====================================================================
@@ -35,6 +39,11 @@ int device;
 
 int main(int argc, char** argv)
 {
+#ifdef SUPPORT_MPI
+    // The global structures are distributed among all processes of the test run
+    MPI_Init(&argc, &argv);
+#endif
+
     // Get device id from command line
     device = 0;
 
@@ -53,5 +62,11 @@ int main(int argc, char** argv)
 
     ::testing::InitGoogleTest(&argc, argv);
 
-    return RUN_ALL_TESTS();
+    int status = RUN_ALL_TESTS();
+
+#ifdef SUPPORT_MPI
+    MPI_Finalize();
+#endif
+
+    return status;
 }
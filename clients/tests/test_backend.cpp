@@ -63,6 +63,24 @@ TEST(backend_init_order, backend)
     testing_backend_init_order();
 }
 
+// Restore the default allocator, also if the test fails
+class backend_host_allocator : public testing::Test
+{
+protected:
+    backend_host_allocator() {}
+    virtual ~backend_host_allocator() {}
+    virtual void SetUp() {}
+    virtual void TearDown()
+    {
+        set_host_allocator_rocalution(HostAllocatorDefault);
+    }
+};
+
+TEST_F(backend_host_allocator, backend)
+{
+    testing_backend_host_allocator();
+}
+
 TEST_P(parameterized_backend, backend)
 {
     Arguments arg = setup_backend_arguments(GetParam());
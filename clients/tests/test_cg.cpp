@@ -29,7 +29,8 @@
 typedef std::tuple<int, std::string, unsigned int> cg_tuple;
 
 int          cg_size[]    = {7, 63};
-std::string  cg_precond[] = {"None", "FSAI", "SPAI", "TNS", "Jacobi", "IC", "MCSGS"};
+std::string  cg_precond[]
+    = {"None", "FSAI", "SPAI", "TNS", "Jacobi", "L1Jacobi", "HybridSGS", "IC", "ItIC", "MCSGS"};
 unsigned int cg_format[]  = {1, 3, 4, 6};
 
 class parameterized_cg : public testing::TestWithParam<cg_tuple>
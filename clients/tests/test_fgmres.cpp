@@ -26,12 +26,13 @@
 
 #include <gtest/gtest.h>
 
-typedef std::tuple<int, int, std::string, unsigned int> fgmres_tuple;
+typedef std::tuple<int, int, std::string, unsigned int, std::string> fgmres_tuple;
 
 int          fgmres_size[]    = {7, 63};
 int          fgmres_basis[]   = {20, 60};
-std::string  fgmres_precond[] = {"None", "SPAI", "TNS", "Jacobi", "GS", "ILUT", "MCGS"};
+std::string  fgmres_precond[] = {"None", "SPAI", "TNS", "Jacobi", "GS", "HybridGS", "ILUT", "MCGS"};
 unsigned int fgmres_format[]  = {1, 4, 5, 7};
+std::string  fgmres_ortho[]   = {"MGS", "CGS2"};
 
 class parameterized_fgmres : public testing::TestWithParam<fgmres_tuple>
 {
@@ -49,6 +50,8 @@ Arguments setup_fgmres_arguments(fgmres_tuple tup)
     arg.index   = std::get<1>(tup);
     arg.precond = std::get<2>(tup);
     arg.format  = std::get<3>(tup);
+
+    arg.orthogonalization = std::get<4>(tup);
     return arg;
 }
 
@@ -69,4 +72,5 @@ INSTANTIATE_TEST_CASE_P(fgmres,
                         testing::Combine(testing::ValuesIn(fgmres_size),
                                          testing::ValuesIn(fgmres_basis),
                                          testing::ValuesIn(fgmres_precond),
-                                         testing::ValuesIn(fgmres_format)));
+                                         testing::ValuesIn(fgmres_format),
+                                         testing::ValuesIn(fgmres_ortho)));
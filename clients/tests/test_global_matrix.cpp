@@ -25,6 +25,81 @@
 #include "utility.hpp"
 
 #include <gtest/gtest.h>
+
+typedef std::tuple<int, int, std::string> global_matrix_apply_tuple;
+
+// The larger size has more rows than one block of the overlapped Apply()
+int         global_matrix_apply_size[]     = {10, 100};
+int         global_matrix_apply_nthreads[] = {1, 2, 4};
+std::string global_matrix_apply_type[]     = {"Laplacian2D", "Random"};
+
+class parameterized_global_matrix_apply : public testing::TestWithParam<global_matrix_apply_tuple>
+{
+protected:
+    parameterized_global_matrix_apply() {}
+    virtual ~parameterized_global_matrix_apply() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_global_matrix_apply_arguments(global_matrix_apply_tuple tup)
+{
+    Arguments arg;
+    arg.size         = std::get<0>(tup);
+    arg.omp_nthreads = std::get<1>(tup);
+    arg.matrix_type  = std::get<2>(tup);
+    return arg;
+}
+
+typedef std::tuple<int, unsigned int, double> global_matrix_apply_add_tuple;
+
+// CSR takes the overlapped path of ApplyAdd(), COO the fallback
+int          global_matrix_apply_add_size[]   = {10, 100};
+unsigned int global_matrix_apply_add_format[] = {CSR, COO};
+double       global_matrix_apply_add_alpha[]  = {1.0, -0.5};
+
+class parameterized_global_matrix_apply_add
+    : public testing::TestWithParam<global_matrix_apply_add_tuple>
+{
+protected:
+    parameterized_global_matrix_apply_add() {}
+    virtual ~parameterized_global_matrix_apply_add() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_global_matrix_apply_add_arguments(global_matrix_apply_add_tuple tup)
+{
+    Arguments arg;
+    arg.size   = std::get<0>(tup);
+    arg.format = std::get<1>(tup);
+    arg.alpha  = std::get<2>(tup);
+    return arg;
+}
+typedef std::tuple<int, std::string, int> global_matrix_amg_tuple;
+
+// The coarsest level of 30 rows leaves processes without coarse rows
+int         global_matrix_amg_size[]     = {20, 100};
+std::string global_matrix_amg_precond[]  = {"RS", "SA", "UA"};
+int         global_matrix_amg_coarsest[] = {30, 300};
+
+class parameterized_global_matrix_amg : public testing::TestWithParam<global_matrix_amg_tuple>
+{
+protected:
+    parameterized_global_matrix_amg() {}
+    virtual ~parameterized_global_matrix_amg() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_global_matrix_amg_arguments(global_matrix_amg_tuple tup)
+{
+    Arguments arg;
+    arg.size    = std::get<0>(tup);
+    arg.precond = std::get<1>(tup);
+    arg.index   = std::get<2>(tup);
+    return arg;
+}
 /*
 typedef std::tuple<int, int, int, int, bool, int, bool> backend_tuple;
 
@@ -62,6 +137,60 @@ TEST(global_matrix_bad_args, global_matrix)
 {
     testing_global_matrix_bad_args<float>();
 }
+
+TEST_P(parameterized_global_matrix_apply, global_matrix_apply_float)
+{
+    Arguments arg = setup_global_matrix_apply_arguments(GetParam());
+    ASSERT_EQ(testing_global_matrix_apply<float>(arg), true);
+}
+
+TEST_P(parameterized_global_matrix_apply, global_matrix_apply_double)
+{
+    Arguments arg = setup_global_matrix_apply_arguments(GetParam());
+    ASSERT_EQ(testing_global_matrix_apply<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(global_matrix_apply,
+                        parameterized_global_matrix_apply,
+                        testing::Combine(testing::ValuesIn(global_matrix_apply_size),
+                                         testing::ValuesIn(global_matrix_apply_nthreads),
+                                         testing::ValuesIn(global_matrix_apply_type)));
+
+TEST_P(parameterized_global_matrix_apply_add, global_matrix_apply_add_float)
+{
+    Arguments arg = setup_global_matrix_apply_add_arguments(GetParam());
+    ASSERT_EQ(testing_global_matrix_apply_add<float>(arg), true);
+}
+
+TEST_P(parameterized_global_matrix_apply_add, global_matrix_apply_add_double)
+{
+    Arguments arg = setup_global_matrix_apply_add_arguments(GetParam());
+    ASSERT_EQ(testing_global_matrix_apply_add<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(global_matrix_apply_add,
+                        parameterized_global_matrix_apply_add,
+                        testing::Combine(testing::ValuesIn(global_matrix_apply_add_size),
+                                         testing::ValuesIn(global_matrix_apply_add_format),
+                                         testing::ValuesIn(global_matrix_apply_add_alpha)));
+
+TEST_P(parameterized_global_matrix_amg, global_matrix_amg_float)
+{
+    Arguments arg = setup_global_matrix_amg_arguments(GetParam());
+    ASSERT_EQ(testing_global_matrix_amg<float>(arg), true);
+}
+
+TEST_P(parameterized_global_matrix_amg, global_matrix_amg_double)
+{
+    Arguments arg = setup_global_matrix_amg_arguments(GetParam());
+    ASSERT_EQ(testing_global_matrix_amg<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(global_matrix_amg,
+                        parameterized_global_matrix_amg,
+                        testing::Combine(testing::ValuesIn(global_matrix_amg_size),
+                                         testing::ValuesIn(global_matrix_amg_precond),
+                                         testing::ValuesIn(global_matrix_amg_coarsest)));
 /*
 TEST_P(parameterized_backend, backend)
 {
@@ -25,6 +25,24 @@
 #include "utility.hpp"
 
 #include <gtest/gtest.h>
+
+int global_vector_restriction_size[] = {7, 10, 100};
+
+class parameterized_global_vector_restriction : public testing::TestWithParam<int>
+{
+protected:
+    parameterized_global_vector_restriction() {}
+    virtual ~parameterized_global_vector_restriction() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_global_vector_restriction_arguments(int size)
+{
+    Arguments arg;
+    arg.size = size;
+    return arg;
+}
 /*
 typedef std::tuple<int, int, int, int, bool, int, bool> backend_tuple;
 
@@ -62,6 +80,22 @@ TEST(global_vector_bad_args, global_vector)
 {
     testing_global_vector_bad_args<float>();
 }
+
+TEST_P(parameterized_global_vector_restriction, global_vector_restriction_float)
+{
+    Arguments arg = setup_global_vector_restriction_arguments(GetParam());
+    ASSERT_EQ(testing_global_vector_restriction<float>(arg), true);
+}
+
+TEST_P(parameterized_global_vector_restriction, global_vector_restriction_double)
+{
+    Arguments arg = setup_global_vector_restriction_arguments(GetParam());
+    ASSERT_EQ(testing_global_vector_restriction<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(global_vector_restriction,
+                        parameterized_global_vector_restriction,
+                        testing::ValuesIn(global_vector_restriction_size));
 /*
 TEST_P(parameterized_backend, backend)
 {
@@ -26,7 +26,7 @@
 
 #include <gtest/gtest.h>
 
-typedef std::tuple<int, int, std::string, std::string, unsigned int> gmres_tuple;
+typedef std::tuple<int, int, std::string, std::string, unsigned int, std::string> gmres_tuple;
 
 int          gmres_size[]               = {7, 63};
 int          gmres_basis[]              = {20, 60};
@@ -35,6 +35,7 @@ std::string  gmres_bad_precond_matrix[] = {"permuted_identity"};
 std::string  gmres_precond[]     = {"None", "Chebyshev", "GS", "ILU", "ILUT", "MCGS", "MCILU"};
 std::string  gmres_bad_precond[] = {"MCGS"};
 unsigned int gmres_format[]      = {1, 2, 5, 6};
+std::string  gmres_ortho[]       = {"MGS", "CGS2"};
 
 class parameterized_gmres : public testing::TestWithParam<gmres_tuple>
 {
@@ -62,6 +63,8 @@ Arguments setup_gmres_arguments(gmres_tuple tup)
     arg.matrix  = std::get<2>(tup);
     arg.precond = std::get<3>(tup);
     arg.format  = std::get<4>(tup);
+
+    arg.orthogonalization = std::get<5>(tup);
     return arg;
 }
 
@@ -89,7 +92,8 @@ INSTANTIATE_TEST_CASE_P(gmres,
                                          testing::ValuesIn(gmres_basis),
                                          testing::ValuesIn(gmres_matrix),
                                          testing::ValuesIn(gmres_precond),
-                                         testing::ValuesIn(gmres_format)));
+                                         testing::ValuesIn(gmres_format),
+                                         testing::ValuesIn(gmres_ortho)));
 
 INSTANTIATE_TEST_CASE_P(gmres_bad_precond,
                         parameterized_gmres_bad_precond,
@@ -97,4 +101,5 @@ INSTANTIATE_TEST_CASE_P(gmres_bad_precond,
                                          testing::ValuesIn(gmres_basis),
                                          testing::ValuesIn(gmres_bad_precond_matrix),
                                          testing::ValuesIn(gmres_bad_precond),
-                                         testing::ValuesIn(gmres_format)));
+                                         testing::ValuesIn(gmres_format),
+                                         testing::ValuesIn(gmres_ortho)));
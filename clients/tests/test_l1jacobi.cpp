@@ -0,0 +1,67 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_l1jacobi.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+
+typedef std::tuple<int, std::string> l1jacobi_tuple;
+
+int         l1jacobi_size[]        = {7, 16, 21};
+std::string l1jacobi_matrix_type[] = {"Laplacian2D", "Laplacian3D"};
+
+class parameterized_l1jacobi : public testing::TestWithParam<l1jacobi_tuple>
+{
+protected:
+    parameterized_l1jacobi() {}
+    virtual ~parameterized_l1jacobi() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_l1jacobi_arguments(l1jacobi_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.matrix_type = std::get<1>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_l1jacobi, l1jacobi_float)
+{
+    Arguments arg = setup_l1jacobi_arguments(GetParam());
+    ASSERT_EQ(testing_l1jacobi<float>(arg), true);
+}
+
+TEST_P(parameterized_l1jacobi, l1jacobi_double)
+{
+    Arguments arg = setup_l1jacobi_arguments(GetParam());
+    ASSERT_EQ(testing_l1jacobi<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(l1jacobi,
+                        parameterized_l1jacobi,
+                        testing::Combine(testing::ValuesIn(l1jacobi_size),
+                                         testing::ValuesIn(l1jacobi_matrix_type)));
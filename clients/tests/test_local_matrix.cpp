@@ -28,6 +28,10 @@
 
 typedef std::tuple<int, int, std::string> local_matrix_conversions_tuple;
 typedef std::tuple<int, int>              local_matrix_allocations_tuple;
+typedef std::tuple<int, std::string>      local_matrix_jacobi_sweep_tuple;
+typedef std::tuple<int, int>              local_matrix_apply_transpose_tuple;
+typedef std::tuple<int, std::string>      local_matrix_coarsening_tuple;
+typedef std::tuple<int, std::string>      local_matrix_convert_to_best_tuple;
 
 int         local_matrix_conversions_size[]     = {10, 17, 21};
 int         local_matrix_conversions_blockdim[] = {4, 7, 11};
@@ -36,6 +40,18 @@ std::string local_matrix_type[]                 = {"Laplacian2D", "PermutedIdent
 int local_matrix_allocations_size[]     = {100, 1475, 2524};
 int local_matrix_allocations_blockdim[] = {4, 7, 11};
 
+int         local_matrix_jacobi_sweep_size[] = {10, 17, 250};
+std::string local_matrix_jacobi_sweep_type[] = {"Laplacian2D", "PermutedIdentity"};
+
+int local_matrix_apply_transpose_size[]     = {10, 17, 250};
+int local_matrix_apply_transpose_nthreads[] = {1, 2, 4};
+
+// Sizes above the default OpenMP threshold
+int         local_matrix_coarsening_size[] = {25, 32};
+std::string local_matrix_coarsening_type[] = {"Laplacian3D"};
+
+int local_matrix_convert_to_best_size[] = {10, 17, 21};
+
 class parameterized_local_matrix_conversions
     : public testing::TestWithParam<local_matrix_conversions_tuple>
 {
@@ -73,6 +89,78 @@ Arguments setup_local_matrix_allocations_arguments(local_matrix_allocations_tupl
     return arg;
 }
 
+class parameterized_local_matrix_jacobi_sweep
+    : public testing::TestWithParam<local_matrix_jacobi_sweep_tuple>
+{
+protected:
+    parameterized_local_matrix_jacobi_sweep() {}
+    virtual ~parameterized_local_matrix_jacobi_sweep() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_jacobi_sweep_arguments(local_matrix_jacobi_sweep_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.matrix_type = std::get<1>(tup);
+    return arg;
+}
+
+class parameterized_local_matrix_apply_transpose
+    : public testing::TestWithParam<local_matrix_apply_transpose_tuple>
+{
+protected:
+    parameterized_local_matrix_apply_transpose() {}
+    virtual ~parameterized_local_matrix_apply_transpose() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_apply_transpose_arguments(local_matrix_apply_transpose_tuple tup)
+{
+    Arguments arg;
+    arg.size         = std::get<0>(tup);
+    arg.omp_nthreads = std::get<1>(tup);
+    return arg;
+}
+
+class parameterized_local_matrix_coarsening
+    : public testing::TestWithParam<local_matrix_coarsening_tuple>
+{
+protected:
+    parameterized_local_matrix_coarsening() {}
+    virtual ~parameterized_local_matrix_coarsening() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_coarsening_arguments(local_matrix_coarsening_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.matrix_type = std::get<1>(tup);
+    return arg;
+}
+
+class parameterized_local_matrix_convert_to_best
+    : public testing::TestWithParam<local_matrix_convert_to_best_tuple>
+{
+protected:
+    parameterized_local_matrix_convert_to_best() {}
+    virtual ~parameterized_local_matrix_convert_to_best() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_convert_to_best_arguments(local_matrix_convert_to_best_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.matrix_type = std::get<1>(tup);
+    return arg;
+}
+
 TEST(local_matrix_bad_args, local_matrix)
 {
     testing_local_matrix_bad_args<float>();
@@ -112,3 +200,71 @@ INSTANTIATE_TEST_CASE_P(local_matrix_allocations,
                         parameterized_local_matrix_allocations,
                         testing::Combine(testing::ValuesIn(local_matrix_allocations_size),
                                          testing::ValuesIn(local_matrix_allocations_blockdim)));
+
+TEST_P(parameterized_local_matrix_jacobi_sweep, local_matrix_jacobi_sweep_float)
+{
+    Arguments arg = setup_local_matrix_jacobi_sweep_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_jacobi_sweep<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_jacobi_sweep, local_matrix_jacobi_sweep_double)
+{
+    Arguments arg = setup_local_matrix_jacobi_sweep_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_jacobi_sweep<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_jacobi_sweep,
+                        parameterized_local_matrix_jacobi_sweep,
+                        testing::Combine(testing::ValuesIn(local_matrix_jacobi_sweep_size),
+                                         testing::ValuesIn(local_matrix_jacobi_sweep_type)));
+
+TEST_P(parameterized_local_matrix_apply_transpose, local_matrix_apply_transpose_float)
+{
+    Arguments arg = setup_local_matrix_apply_transpose_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_apply_transpose<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_apply_transpose, local_matrix_apply_transpose_double)
+{
+    Arguments arg = setup_local_matrix_apply_transpose_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_apply_transpose<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_apply_transpose,
+                        parameterized_local_matrix_apply_transpose,
+                        testing::Combine(testing::ValuesIn(local_matrix_apply_transpose_size),
+                                         testing::ValuesIn(local_matrix_apply_transpose_nthreads)));
+
+TEST_P(parameterized_local_matrix_coarsening, local_matrix_coarsening_float)
+{
+    Arguments arg = setup_local_matrix_coarsening_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_coarsening<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_coarsening, local_matrix_coarsening_double)
+{
+    Arguments arg = setup_local_matrix_coarsening_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_coarsening<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_coarsening,
+                        parameterized_local_matrix_coarsening,
+                        testing::Combine(testing::ValuesIn(local_matrix_coarsening_size),
+                                         testing::ValuesIn(local_matrix_coarsening_type)));
+
+TEST_P(parameterized_local_matrix_convert_to_best, local_matrix_convert_to_best_float)
+{
+    Arguments arg = setup_local_matrix_convert_to_best_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_convert_to_best<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_convert_to_best, local_matrix_convert_to_best_double)
+{
+    Arguments arg = setup_local_matrix_convert_to_best_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_convert_to_best<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_convert_to_best,
+                        parameterized_local_matrix_convert_to_best,
+                        testing::Combine(testing::ValuesIn(local_matrix_convert_to_best_size),
+                                         testing::ValuesIn(local_matrix_type)));
@@ -26,7 +26,7 @@
 
 #include <gtest/gtest.h>
 
-typedef std::tuple<int, std::string, unsigned int, int, int, int, int> pwamg_tuple;
+typedef std::tuple<int, std::string, unsigned int, int, int, int, int, int> pwamg_tuple;
 
 int          pwamg_size[]           = {63, 134};
 std::string  pwamg_smoother[]       = {"Jacobi"}; //, "MCILU"};
@@ -35,6 +35,7 @@ int          pwamg_pre_iter[]       = {1, 2};
 int          pwamg_post_iter[]      = {1, 2};
 int          pwamg_ordering[]       = {0, 1, 2, 3, 4, 5};
 int          pwamg_rebuildnumeric[] = {0, 1};
+int          pwamg_mixed[]          = {0, 1};
 
 class parameterized_pairwise_amg : public testing::TestWithParam<pwamg_tuple>
 {
@@ -48,13 +49,14 @@ protected:
 Arguments setup_pwamg_arguments(pwamg_tuple tup)
 {
     Arguments arg;
-    arg.size           = std::get<0>(tup);
-    arg.smoother       = std::get<1>(tup);
-    arg.format         = std::get<2>(tup);
-    arg.pre_smooth     = std::get<3>(tup);
-    arg.post_smooth    = std::get<4>(tup);
-    arg.ordering       = std::get<5>(tup);
-    arg.rebuildnumeric = std::get<6>(tup);
+    arg.size            = std::get<0>(tup);
+    arg.smoother        = std::get<1>(tup);
+    arg.format          = std::get<2>(tup);
+    arg.pre_smooth      = std::get<3>(tup);
+    arg.post_smooth     = std::get<4>(tup);
+    arg.ordering        = std::get<5>(tup);
+    arg.rebuildnumeric  = std::get<6>(tup);
+    arg.mixed_precision = std::get<7>(tup);
     return arg;
 }
 
@@ -78,4 +80,5 @@ INSTANTIATE_TEST_CASE_P(pairwise_amg,
                                          testing::ValuesIn(pwamg_pre_iter),
                                          testing::ValuesIn(pwamg_post_iter),
                                          testing::ValuesIn(pwamg_ordering),
-                                         testing::ValuesIn(pwamg_rebuildnumeric)));
+                                         testing::ValuesIn(pwamg_rebuildnumeric),
+                                         testing::ValuesIn(pwamg_mixed)));
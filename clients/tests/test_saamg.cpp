@@ -27,7 +27,7 @@
 #include <gtest/gtest.h>
 
 typedef std::
-    tuple<int, int, int, std::string, std::string, std::string, unsigned int, int, int, int>
+    tuple<int, int, int, std::string, std::string, std::string, unsigned int, int, int, int, int>
         saamg_tuple;
 
 int          saamg_size[]             = {22, 63, 134, 207};
@@ -40,6 +40,7 @@ unsigned int saamg_format[]           = {1, 6};
 int          saamg_cycle[]            = {2};
 int          saamg_scaling[]          = {1};
 int          saamg_rebuildnumeric[]   = {0, 1};
+int          saamg_implicit[]         = {0, 1};
 
 class parameterized_saamg : public testing::TestWithParam<saamg_tuple>
 {
@@ -53,16 +54,17 @@ protected:
 Arguments setup_saamg_arguments(saamg_tuple tup)
 {
     Arguments arg;
-    arg.size                = std::get<0>(tup);
-    arg.pre_smooth          = std::get<1>(tup);
-    arg.post_smooth         = std::get<2>(tup);
-    arg.smoother            = std::get<3>(tup);
-    arg.coarsening_strategy = std::get<4>(tup);
-    arg.matrix_type         = std::get<5>(tup);
-    arg.format              = std::get<6>(tup);
-    arg.cycle               = std::get<7>(tup);
-    arg.ordering            = std::get<8>(tup);
-    arg.rebuildnumeric      = std::get<9>(tup);
+    arg.size                 = std::get<0>(tup);
+    arg.pre_smooth           = std::get<1>(tup);
+    arg.post_smooth          = std::get<2>(tup);
+    arg.smoother             = std::get<3>(tup);
+    arg.coarsening_strategy  = std::get<4>(tup);
+    arg.matrix_type          = std::get<5>(tup);
+    arg.format               = std::get<6>(tup);
+    arg.cycle                = std::get<7>(tup);
+    arg.ordering             = std::get<8>(tup);
+    arg.rebuildnumeric       = std::get<9>(tup);
+    arg.implicit_restriction = std::get<10>(tup);
 
     return arg;
 }
@@ -90,4 +92,5 @@ INSTANTIATE_TEST_CASE_P(saamg,
                                          testing::ValuesIn(saamg_format),
                                          testing::ValuesIn(saamg_cycle),
                                          testing::ValuesIn(saamg_scaling),
-                                         testing::ValuesIn(saamg_rebuildnumeric)));
+                                         testing::ValuesIn(saamg_rebuildnumeric),
+                                         testing::ValuesIn(saamg_implicit)));
@@ -0,0 +1,69 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_sparse_lu.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+
+typedef std::tuple<int, unsigned int, std::string> sparse_lu_tuple;
+
+int          sparse_lu_size[]        = {7, 16, 21};
+unsigned int sparse_lu_format[]      = {1, 2, 3, 4, 5, 6, 7};
+std::string  sparse_lu_matrix_type[] = {"Laplacian2D", "DiagonallyDominant"};
+
+class parameterized_sparse_lu : public testing::TestWithParam<sparse_lu_tuple>
+{
+protected:
+    parameterized_sparse_lu() {}
+    virtual ~parameterized_sparse_lu() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_sparse_lu_arguments(sparse_lu_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.format      = std::get<1>(tup);
+    arg.matrix_type = std::get<2>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_sparse_lu, sparse_lu_float)
+{
+    Arguments arg = setup_sparse_lu_arguments(GetParam());
+    ASSERT_EQ(testing_sparse_lu<float>(arg), true);
+}
+
+TEST_P(parameterized_sparse_lu, sparse_lu_double)
+{
+    Arguments arg = setup_sparse_lu_arguments(GetParam());
+    ASSERT_EQ(testing_sparse_lu<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(sparse_lu,
+                        parameterized_sparse_lu,
+                        testing::Combine(testing::ValuesIn(sparse_lu_size),
+                                         testing::ValuesIn(sparse_lu_format),
+                                         testing::ValuesIn(sparse_lu_matrix_type)));
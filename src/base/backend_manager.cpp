@@ -24,6 +24,7 @@
 #include "backend_manager.hpp"
 #include "../utils/def.hpp"
 #include "../utils/log.hpp"
+#include "../utils/profiler.hpp"
 #include "base_matrix.hpp"
 #include "base_rocalution.hpp"
 #include "base_vector.hpp"
@@ -36,6 +37,7 @@
 #include "host/host_matrix_ell.hpp"
 #include "host/host_matrix_hyb.hpp"
 #include "host/host_matrix_mcsr.hpp"
+#include "host/host_matrix_sell.hpp"
 #include "host/host_vector.hpp"
 #include "rocalution/version.hpp"
 
@@ -193,6 +195,8 @@ namespace rocalution
 
         _get_backend_descriptor()->init = true;
 
+        _rocalution_open_profiler();
+
         log_debug(0, "init_rocalution()", "* end");
 
         return 0;
@@ -207,8 +211,12 @@ namespace rocalution
             return 0;
         }
 
+        _rocalution_close_profiler();
+
         _rocalution_delete_all_obj();
 
+        _rocalution_clear_host_pool();
+
 #ifdef SUPPORT_HIP
         if(_get_backend_descriptor()->disable_accelerator == false)
         {
@@ -323,6 +331,8 @@ namespace rocalution
         LOG_INFO("No OpenMP support");
 #endif
 
+        _rocalution_info_host_allocator();
+
         if(backend_descriptor.disable_accelerator == true)
         {
             LOG_INFO("The accelerator is disabled");
@@ -507,6 +517,9 @@ namespace rocalution
         case BCSR:
             return new HostMatrixBCSR<ValueType>(backend_descriptor, blockdim);
             break;
+        case SELL:
+            return new HostMatrixSELL<ValueType>(backend_descriptor);
+            break;
         default:
             return NULL;
         }
@@ -523,7 +536,7 @@ namespace rocalution
     }
 
     void _set_omp_backend_threads(const struct Rocalution_Backend_Descriptor& backend_descriptor,
-                                  int                                         size)
+                                  int64_t                                     size)
     {
         // if the threshold is disabled or if the size is not in the threshold limit
         if((backend_descriptor.OpenMP_threshold > 0)
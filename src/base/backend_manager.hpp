@@ -26,6 +26,8 @@
 
 #include "rocalution/export.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <map>
@@ -225,6 +227,134 @@ namespace rocalution
     ROCALUTION_EXPORT
     void set_omp_threshold_rocalution(int threshold);
 
+    /** \ingroup backend_module
+  * \brief Host memory allocators
+  */
+    enum _host_allocator
+    {
+        HostAllocatorDefault = 0,
+        HostAllocatorAligned = 1,
+        HostAllocatorPool    = 2
+    };
+
+    /** \ingroup backend_module
+  * \brief Set the host memory allocator
+  * \details
+  * \p set_host_allocator_rocalution selects how allocate_host() obtains memory.
+  * - HostAllocatorDefault uses \p new[] (default).
+  * - HostAllocatorAligned returns buffers aligned to \p alignment bytes. Buffers above
+  *   the OpenMP threshold size are first touched in parallel, using the same static
+  *   OpenMP schedule as the host backend kernels, such that on NUMA systems each page
+  *   is placed on the node of the thread that works on it.
+  * - HostAllocatorPool behaves like HostAllocatorAligned, but keeps released buffers in
+  *   size classes and hands them out again, avoiding repeated allocation and first
+  *   touch of the temporary buffers created by solvers and multigrid setup. At most
+  *   \p pool_limit bytes are kept in the pool, further released buffers are freed. The
+  *   pool is emptied when the allocator is changed and by stop_rocalution().
+  *
+  * Buffers remain valid when the allocator is changed, free_host() always releases a
+  * buffer with the allocator that provided it.
+  *
+  * @param[in]
+  * allocator   HostAllocatorDefault, HostAllocatorAligned or HostAllocatorPool
+  * @param[in]
+  * alignment   alignment in bytes, a power of two and a multiple of sizeof(void*)
+  * @param[in]
+  * pool_limit  maximum number of bytes kept in the pool of HostAllocatorPool
+  */
+    ROCALUTION_EXPORT
+    void set_host_allocator_rocalution(_host_allocator allocator,
+                                       size_t          alignment  = 64,
+                                       size_t          pool_limit = size_t(1) << 30);
+
+    /** \ingroup backend_module
+  * \brief Set a user defined host memory allocator
+  * \details
+  * \p set_host_allocator_rocalution lets allocate_host() obtain memory from
+  * \p allocate, buffers are released with \p deallocate.
+  *
+  * @param[in]
+  * allocate    function returning a buffer of the requested size in bytes, or NULL
+  * @param[in]
+  * deallocate  function releasing a buffer obtained from \p allocate
+  */
+    ROCALUTION_EXPORT
+    void set_host_allocator_rocalution(void* (*allocate)(size_t size),
+                                       void (*deallocate)(void* ptr));
+
+    /** \ingroup backend_module
+  * \brief Enable/disable the profiler
+  * \details
+  * \p set_profiler_rocalution enables / disables the profiler. While enabled, the
+  * profiler records hierarchical regions of the solver setup and solve phases, such as
+  * solver Build() and Solve(), Krylov iterations, multigrid levels, smoothers and
+  * intergrid transfers, as well as kernels, such as matrix vector products and vector
+  * updates. For each region, the number of calls and the wall time are accumulated per
+  * parent region. Kernels additionally estimate the bytes moved and the floating point
+  * operations from the sizes and the format of their operands. Regions may be recorded
+  * from several host threads.
+  *
+  * Krylov iterations are recorded as \p iteration regions once the residual of the
+  * iteration has been checked. Thus, they are siblings of the kernels of the iteration
+  * under the solver Solve() region, and their time includes the time of these kernels.
+  *
+  * Timing synchronizes the accelerator, thus the profiler should be disabled for
+  * production runs. The recorded regions are kept until reset_profiler_rocalution() is
+  * called.
+  *
+  * The profiler can also be enabled by the environment variable \p ROCALUTION_PROFILE.
+  * With \p ROCALUTION_PROFILE=1, the summary is printed by stop_rocalution(). With
+  * \p ROCALUTION_PROFILE=2, stop_rocalution() additionally writes the regions and the
+  * timeline to \p rocalution-profile-rank-<rank>.json and
+  * \p rocalution-trace-rank-<rank>.json.
+  *
+  * @param[in]
+  * enable  boolean to turn on/off the profiler
+  */
+    ROCALUTION_EXPORT
+    void set_profiler_rocalution(bool enable);
+
+    /** \ingroup backend_module
+  * \brief Discard all regions recorded by the profiler
+  */
+    ROCALUTION_EXPORT
+    void reset_profiler_rocalution(void);
+
+    /** \ingroup backend_module
+  * \brief Print the profiler summary
+  * \details
+  * \p print_profiler_rocalution prints the recorded regions as a tree, with the number of
+  * calls, total and average time, the share of the total time and, for kernels, the
+  * achieved bandwidth and floating point rate.
+  */
+    ROCALUTION_EXPORT
+    void print_profiler_rocalution(void);
+
+    /** \ingroup backend_module
+  * \brief Write the profiler regions to a JSON file
+  * \details
+  * \p write_profiler_rocalution writes the tree of recorded regions, with the number
+  * of calls, the time in microseconds, the estimated bytes and flops of each region.
+  *
+  * @param[in]
+  * filename    name of the JSON file
+  */
+    ROCALUTION_EXPORT
+    void write_profiler_rocalution(const std::string& filename);
+
+    /** \ingroup backend_module
+  * \brief Write the profiler timeline to a trace file
+  * \details
+  * \p write_profiler_trace_rocalution writes each recorded call in the Chrome trace
+  * event format, which can be viewed with chrome://tracing or Perfetto. The MPI rank is
+  * used as process id. At most \f$2^{20}\f$ calls are kept for the timeline.
+  *
+  * @param[in]
+  * filename    name of the trace file
+  */
+    ROCALUTION_EXPORT
+    void write_profiler_trace_rocalution(const std::string& filename);
+
     /** \ingroup backend_module
   * \brief Print info about rocALUTION
   * \details
@@ -266,9 +396,15 @@ namespace rocalution
     // Set backend descriptor
     void _set_backend_descriptor(const struct Rocalution_Backend_Descriptor& backend_descriptor);
 
+    // Release the buffers cached by the host memory pool
+    void _rocalution_clear_host_pool(void);
+
+    // Print info about the host memory allocator
+    void _rocalution_info_host_allocator(void);
+
     // Set the OMP threads based on the size threshold
     void _set_omp_backend_threads(const struct Rocalution_Backend_Descriptor& backend_descriptor,
-                                  int                                         size);
+                                  int64_t                                     size);
 
     // Build (and return) a vector on the selected in the descriptor accelerator
     template <typename ValueType>
@@ -61,7 +61,7 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    inline int BaseMatrix<ValueType>::GetNnz(void) const
+    inline PtrType BaseMatrix<ValueType>::GetNnz(void) const
     {
         return this->nnz_;
     }
@@ -99,11 +99,11 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void BaseMatrix<ValueType>::CopyFromCSR(const int*       row_offsets,
+    void BaseMatrix<ValueType>::CopyFromCSR(const PtrType*   row_offsets,
                                             const int*       col,
                                             const ValueType* val)
     {
-        LOG_INFO("CopyFromCSR(const int* row_offsets, const int* col, const ValueType* val)");
+        LOG_INFO("CopyFromCSR(const PtrType* row_offsets, const int* col, const ValueType* val)");
         LOG_INFO("Matrix format=" << _matrix_format_names[this->GetMatFormat()]);
         this->Info();
         LOG_INFO("This function is not available for this backend");
@@ -111,9 +111,9 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void BaseMatrix<ValueType>::CopyToCSR(int* row_offsets, int* col, ValueType* val) const
+    void BaseMatrix<ValueType>::CopyToCSR(PtrType* row_offsets, int* col, ValueType* val) const
     {
-        LOG_INFO("CopyToCSR(int *row_offsets, int *col, ValueType *val) const");
+        LOG_INFO("CopyToCSR(PtrType *row_offsets, int *col, ValueType *val) const");
         LOG_INFO("Matrix format=" << _matrix_format_names[this->GetMatFormat()]);
         this->Info();
         LOG_INFO("This function is not available for this backend");
@@ -141,12 +141,15 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void BaseMatrix<ValueType>::CopyFromHostCSR(
-        const int* row_offset, const int* col, const ValueType* val, int nnz, int nrow, int ncol)
+    void BaseMatrix<ValueType>::CopyFromHostCSR(const PtrType*   row_offset,
+                                                const int*       col,
+                                                const ValueType* val,
+                                                PtrType          nnz,
+                                                int              nrow,
+                                                int              ncol)
     {
-        LOG_INFO(
-            "CopyFromHostCSR(const int* row_offsets, const int* col, const ValueType* val, int "
-            "nnz, int nrow, int ncol)");
+        LOG_INFO("CopyFromHostCSR(const PtrType* row_offsets, const int* col, const ValueType* "
+                 "val, PtrType nnz, int nrow, int ncol)");
         LOG_INFO("Matrix format=" << _matrix_format_names[this->GetMatFormat()]);
         this->Info();
         LOG_INFO("This function is not available for this backend");
@@ -154,9 +157,9 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void BaseMatrix<ValueType>::AllocateCSR(int nnz, int nrow, int ncol)
+    void BaseMatrix<ValueType>::AllocateCSR(PtrType nnz, int nrow, int ncol)
     {
-        LOG_INFO("AllocateCSR(int nnz, int nrow, int ncol)");
+        LOG_INFO("AllocateCSR(PtrType nnz, int nrow, int ncol)");
         LOG_INFO("Matrix format=" << _matrix_format_names[this->GetMatFormat()]);
         this->Info();
         LOG_INFO("This is NOT a CSR matrix");
@@ -174,9 +177,9 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void BaseMatrix<ValueType>::AllocateCOO(int nnz, int nrow, int ncol)
+    void BaseMatrix<ValueType>::AllocateCOO(PtrType nnz, int nrow, int ncol)
     {
-        LOG_INFO("AllocateCOO(int nnz, int nrow, int ncol)");
+        LOG_INFO("AllocateCOO(PtrType nnz, int nrow, int ncol)");
         LOG_INFO("Matrix format=" << _matrix_format_names[this->GetMatFormat()]);
         this->Info();
         LOG_INFO("This is NOT a COO matrix");
@@ -255,7 +258,8 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    bool BaseMatrix<ValueType>::WriteFileCSR(const std::string& filename) const
+    bool BaseMatrix<ValueType>::WriteFileCSR(const std::string& filename,
+                                             unsigned int       format) const
     {
         return false;
     }
@@ -294,6 +298,14 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ExtractL1BlockDiagonal(int                          block_size,
+                                                       const BaseMatrix<ValueType>* ghost,
+                                                       BaseMatrix<ValueType>*       mat) const
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::ExtractU(BaseMatrix<ValueType>* U) const
     {
@@ -334,6 +346,12 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ItILU0Factorize(int sweeps)
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::ILUTFactorize(double t, int maxrow)
     {
@@ -346,6 +364,12 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ItICFactorize(BaseVector<ValueType>* inv_diag, int sweeps)
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::Permute(const BaseVector<int>& permutation)
     {
@@ -376,6 +400,12 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::MinimumDegree(BaseVector<int>* permutation) const
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::MultiColoring(int&             num_colors,
                                               int**            size_colors,
@@ -402,6 +432,12 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::SymbolicLU(void)
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::SymbolicMatMatMult(const BaseMatrix<ValueType>& src)
     {
@@ -429,6 +465,56 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ApplyTranspose(const BaseVector<ValueType>& in,
+                                               BaseVector<ValueType>*       out) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::Residual(const BaseVector<ValueType>& rhs,
+                                         const BaseVector<ValueType>& in,
+                                         BaseVector<ValueType>*       res) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::JacobiSweep(const BaseVector<ValueType>& inv_diag,
+                                            const BaseVector<ValueType>& rhs,
+                                            ValueType                    omega,
+                                            const BaseVector<ValueType>& in,
+                                            BaseVector<ValueType>*       out) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ApplyRows(const BaseVector<int>&       rows,
+                                          int                          start,
+                                          int                          end,
+                                          const BaseVector<ValueType>& in,
+                                          ValueType                    scalar,
+                                          bool                         add,
+                                          BaseVector<ValueType>*       out) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ApplyRowsGhost(const BaseVector<int>&       rows,
+                                               const BaseVector<int>&       ghost_offset,
+                                               const BaseMatrix<ValueType>& ghost,
+                                               const BaseVector<ValueType>& in,
+                                               const BaseVector<ValueType>& ghost_in,
+                                               ValueType                    scalar,
+                                               bool                         add,
+                                               BaseVector<ValueType>*       out) const
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::Scale(ValueType alpha)
     {
@@ -566,6 +652,22 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::TripleMatMult(const BaseMatrix<ValueType>& R,
+                                              const BaseMatrix<ValueType>& A,
+                                              const BaseMatrix<ValueType>& P)
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::NumericTripleMatMult(const BaseMatrix<ValueType>& R,
+                                                     const BaseMatrix<ValueType>& A,
+                                                     const BaseMatrix<ValueType>& P)
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::SymbolicMatMatMult(const BaseMatrix<ValueType>& A,
                                                    const BaseMatrix<ValueType>& B)
@@ -628,6 +730,49 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::RSPMISStrongInfluences(float                        eps,
+                                                       BaseVector<bool>*            S,
+                                                       BaseVector<float>*           omega,
+                                                       unsigned long long           seed,
+                                                       const BaseMatrix<ValueType>& ghost) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::RSPMISUnassignedToCoarse(BaseVector<int>*         CFmap,
+                                                         BaseVector<bool>*        marked,
+                                                         const BaseVector<float>& omega) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::RSPMISCorrectCoarse(BaseVector<int>*             CFmap,
+                                                    const BaseVector<bool>&      S,
+                                                    const BaseVector<bool>&      marked,
+                                                    const BaseVector<float>&     omega,
+                                                    const BaseMatrix<ValueType>& ghost) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::RSPMISCoarseEdgesToFine(BaseVector<int>*             CFmap,
+                                                        const BaseVector<bool>&      S,
+                                                        const BaseMatrix<ValueType>& ghost) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::RSPMISCheckUndecided(bool&                  undecided,
+                                                     const BaseVector<int>& CFmap) const
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::RSDirectInterpolation(const BaseVector<int>&  CFmap,
                                                       const BaseVector<bool>& S,
@@ -824,9 +969,15 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::StructureStats(MatrixStructureStats* stats) const
+    {
+        return false;
+    }
+
     template <typename ValueType>
     void BaseMatrix<ValueType>::SetDataPtrCOO(
-        int** row, int** col, ValueType** val, int nnz, int nrow, int ncol)
+        int** row, int** col, ValueType** val, PtrType nnz, int nrow, int ncol)
     {
         LOG_INFO("BaseMatrix<ValueType>::SetDataPtrCOO(...)");
         LOG_INFO("Matrix format=" << _matrix_format_names[this->GetMatFormat()]);
@@ -847,7 +998,7 @@ namespace rocalution
 
     template <typename ValueType>
     void BaseMatrix<ValueType>::SetDataPtrCSR(
-        int** row_offset, int** col, ValueType** val, int nnz, int nrow, int ncol)
+        PtrType** row_offset, int** col, ValueType** val, PtrType nnz, int nrow, int ncol)
     {
         LOG_INFO("BaseMatrix<ValueType>::SetDataPtrCSR(...)");
         LOG_INFO("Matrix format=" << _matrix_format_names[this->GetMatFormat()]);
@@ -857,7 +1008,7 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void BaseMatrix<ValueType>::LeaveDataPtrCSR(int** row_offset, int** col, ValueType** val)
+    void BaseMatrix<ValueType>::LeaveDataPtrCSR(PtrType** row_offset, int** col, ValueType** val)
     {
         LOG_INFO("BaseMatrix<ValueType>::LeaveDataPtrCSR(...)");
         LOG_INFO("Matrix format=" << _matrix_format_names[this->GetMatFormat()]);
@@ -24,6 +24,7 @@
 #ifndef ROCALUTION_BASE_MATRIX_HPP_
 #define ROCALUTION_BASE_MATRIX_HPP_
 
+#include "../utils/types.hpp"
 #include "backend_manager.hpp"
 #include "matrix_formats.hpp"
 
@@ -53,6 +54,31 @@ namespace rocalution
     class HostMatrixMCSR;
     template <typename ValueType>
     class HostMatrixBCSR;
+    template <typename ValueType>
+    class HostMatrixSELL;
+
+    // Structure statistics of a sparse matrix, used to select its storage format
+    struct MatrixStructureStats
+    {
+        int64_t nrow;
+        int64_t ncol;
+        int64_t nnz;
+
+        // Longest row and histogram of the row lengths, where bucket 0 counts the empty rows
+        // and bucket k the rows with 2^(k-1) to 2^k - 1 entries
+        int64_t max_row_nnz;
+        int64_t row_hist[32];
+
+        // Number of populated diagonals
+        int64_t ndiag;
+
+        // Entries that exceed the ELL part of the HYB format, which has the mean row length
+        int64_t hyb_coo_nnz;
+
+        // Non-zero blocks of BCSR with block dimension 2, 3 and 4, zero if the matrix
+        // dimensions are not a multiple of the block dimension
+        int64_t nnzb[3];
+    };
 
     template <typename ValueType>
     class HIPAcceleratorMatrixCSR;
@@ -84,7 +110,7 @@ namespace rocalution
         /// Return the number of columns in the matrix
         int GetN(void) const;
         /// Return the non-zeros of the matrix
-        int GetNnz(void) const;
+        PtrType GetNnz(void) const;
         /// Shows simple info about the object
         virtual void Info(void) const = 0;
         /// Return the matrix format id (see matrix_formats.hpp)
@@ -100,13 +126,13 @@ namespace rocalution
         virtual bool Check(void) const;
 
         /// Allocate CSR Matrix
-        virtual void AllocateCSR(int nnz, int nrow, int ncol);
+        virtual void AllocateCSR(PtrType nnz, int nrow, int ncol);
         /// Allocate BCSR Matrix
         virtual void AllocateBCSR(int nnzb, int nrowb, int ncolb, int blockdim);
         /// Allocate MCSR Matrix
         virtual void AllocateMCSR(int nnz, int nrow, int ncol);
         /// Allocate COO Matrix
-        virtual void AllocateCOO(int nnz, int nrow, int ncol);
+        virtual void AllocateCOO(PtrType nnz, int nrow, int ncol);
         /// Allocate DIA Matrix
         virtual void AllocateDIA(int nnz, int nrow, int ncol, int ndiag);
         /// Allocate ELL Matrix
@@ -118,15 +144,15 @@ namespace rocalution
 
         /// Initialize a COO matrix on the Host with externally allocated data
         virtual void
-            SetDataPtrCOO(int** row, int** col, ValueType** val, int nnz, int nrow, int ncol);
+            SetDataPtrCOO(int** row, int** col, ValueType** val, PtrType nnz, int nrow, int ncol);
         /// Leave a COO matrix to Host pointers
         virtual void LeaveDataPtrCOO(int** row, int** col, ValueType** val);
 
         /// Initialize a CSR matrix on the Host with externally allocated data
         virtual void SetDataPtrCSR(
-            int** row_offset, int** col, ValueType** val, int nnz, int nrow, int ncol);
+            PtrType** row_offset, int** col, ValueType** val, PtrType nnz, int nrow, int ncol);
         /// Leave a CSR matrix to Host pointers
-        virtual void LeaveDataPtrCSR(int** row_offset, int** col, ValueType** val);
+        virtual void LeaveDataPtrCSR(PtrType** row_offset, int** col, ValueType** val);
 
         /// Initialize a BCSR matrix on the Host with externally allocated data
         virtual void SetDataPtrBCSR(int**       row_offset,
@@ -200,6 +226,12 @@ namespace rocalution
         virtual bool ExtractL(BaseMatrix<ValueType>* L) const;
         /// Extract the lower triangular matrix including diagonal
         virtual bool ExtractLDiagonal(BaseMatrix<ValueType>* L) const;
+        /// Extract the l1 block diagonal part of the matrix, where the absolute values
+        /// of all entries outside of the row blocks (and of the optional ghost matrix)
+        /// are added to the diagonal
+        virtual bool ExtractL1BlockDiagonal(int                          block_size,
+                                            const BaseMatrix<ValueType>* ghost,
+                                            BaseMatrix<ValueType>*       mat) const;
 
         /// Perform (forward) permutation of the matrix
         virtual bool Permute(const BaseVector<int>& permutation);
@@ -213,6 +245,8 @@ namespace rocalution
         virtual bool RCMK(BaseVector<int>* permutation) const;
         /// Create permutation vector for connectivity reordering of the matrix (increasing nnz per row)
         virtual bool ConnectivityOrder(BaseVector<int>* permutation) const;
+        /// Create permutation vector for minimum degree (fill-reducing) reordering of the matrix
+        virtual bool MinimumDegree(BaseVector<int>* permutation) const;
 
         /// Perform multi-coloring decomposition of the matrix; Returns number of
         /// colors, the corresponding sizes (the array is allocated in the function)
@@ -245,10 +279,10 @@ namespace rocalution
         virtual void CopyToAsync(BaseMatrix<ValueType>* mat) const;
 
         /// Copy from CSR array (the matrix has to be allocated)
-        virtual void CopyFromCSR(const int* row_offsets, const int* col, const ValueType* val);
+        virtual void CopyFromCSR(const PtrType* row_offsets, const int* col, const ValueType* val);
 
         /// Copy to CSR array (the arrays have to be allocated)
-        virtual void CopyToCSR(int* row_offsets, int* col, ValueType* val) const;
+        virtual void CopyToCSR(PtrType* row_offsets, int* col, ValueType* val) const;
 
         /// Copy from COO array (the matrix has to be allocated)
         virtual void CopyFromCOO(const int* row, const int* col, const ValueType* val);
@@ -257,10 +291,10 @@ namespace rocalution
         virtual void CopyToCOO(int* row, int* col, ValueType* val) const;
 
         /// Allocates and copies a host CSR matrix
-        virtual void CopyFromHostCSR(const int*       row_offset,
+        virtual void CopyFromHostCSR(const PtrType*   row_offset,
                                      const int*       col,
                                      const ValueType* val,
-                                     int              nnz,
+                                     PtrType          nnz,
                                      int              nrow,
                                      int              ncol);
 
@@ -277,12 +311,17 @@ namespace rocalution
 
         /// Read matrix from CSR (ROCALUTION binary format) file
         virtual bool ReadFileCSR(const std::string& filename);
-        /// Write matrix to CSR (ROCALUTION binary format) file
-        virtual bool WriteFileCSR(const std::string& filename) const;
+        /// Write matrix to CSR (ROCALUTION binary format) file, in the stream or the
+        /// mapped layout
+        virtual bool WriteFileCSR(const std::string& filename, unsigned int format) const;
 
         /// Perform symbolic computation (structure only) of |this|^p
         virtual bool SymbolicPower(int p);
 
+        /// Extend the structure by the fill-in of the complete LU factorization (explicit
+        /// zero entries)
+        virtual bool SymbolicLU(void);
+
         /// Perform symbolic matrix-matrix multiplication (i.e. determine the structure),
         /// this = this*src
         virtual bool SymbolicMatMatMult(const BaseMatrix<ValueType>& src);
@@ -296,6 +335,15 @@ namespace rocalution
         /// this = A*B
         virtual bool NumericMatMatMult(const BaseMatrix<ValueType>& A,
                                        const BaseMatrix<ValueType>& B);
+        /// Multiply three matrices, this = R*A*P
+        virtual bool TripleMatMult(const BaseMatrix<ValueType>& R,
+                                   const BaseMatrix<ValueType>& A,
+                                   const BaseMatrix<ValueType>& P);
+        /// Perform numerical triple matrix product (i.e. value computation) in the
+        /// existing structure, this = R*A*P
+        virtual bool NumericTripleMatMult(const BaseMatrix<ValueType>& R,
+                                          const BaseMatrix<ValueType>& A,
+                                          const BaseMatrix<ValueType>& P);
         /// Multiply the matrix with diagonal matrix (stored in LocalVector),
         /// this=this*diag (right multiplication)
         virtual bool DiagonalMatrixMultR(const BaseVector<ValueType>& diag);
@@ -312,6 +360,8 @@ namespace rocalution
 
         /// Perform ILU(0) factorization
         virtual bool ILU0Factorize(void);
+        /// Perform fine-grained iterative ILU(0) factorization with a fixed number of sweeps
+        virtual bool ItILU0Factorize(int sweeps);
         /// Perform LU factorization
         virtual bool LUFactorize(void);
         /// Perform ILU(t,m) factorization based on threshold and maximum
@@ -325,6 +375,8 @@ namespace rocalution
 
         /// Perform IC(0) factorization
         virtual bool ICFactorize(BaseVector<ValueType>* inv_diag);
+        /// Perform fine-grained iterative IC(0) factorization with a fixed number of sweeps
+        virtual bool ItICFactorize(BaseVector<ValueType>* inv_diag, int sweeps);
 
         /// Analyse the structure (level-scheduling)
         virtual void LUAnalyse(void);
@@ -384,6 +436,41 @@ namespace rocalution
         virtual void ApplyAdd(const BaseVector<ValueType>& in,
                               ValueType                    scalar,
                               BaseVector<ValueType>*       out) const = 0;
+        /// Apply the transposed matrix to vector, out = this^T*in;
+        virtual bool ApplyTranspose(const BaseVector<ValueType>& in,
+                                    BaseVector<ValueType>*       out) const;
+        /// Compute the residual in a single pass, res = rhs - this*in;
+        virtual bool Residual(const BaseVector<ValueType>& rhs,
+                              const BaseVector<ValueType>& in,
+                              BaseVector<ValueType>*       res) const;
+        /// Perform a damped Jacobi sweep in a single pass,
+        /// out = in + omega * inv_diag * (rhs - this*in);
+        virtual bool JacobiSweep(const BaseVector<ValueType>& inv_diag,
+                                 const BaseVector<ValueType>& rhs,
+                                 ValueType                    omega,
+                                 const BaseVector<ValueType>& in,
+                                 BaseVector<ValueType>*       out) const;
+        /// Apply the rows rows[start], ..., rows[end - 1] of the matrix to vector,
+        /// out[rows[i]] = scalar*this[rows[i], :]*in, added to out[rows[i]] if add is set;
+        virtual bool ApplyRows(const BaseVector<int>&       rows,
+                               int                          start,
+                               int                          end,
+                               const BaseVector<ValueType>& in,
+                               ValueType                    scalar,
+                               bool                         add,
+                               BaseVector<ValueType>*       out) const;
+        /// Apply the rows of the matrix together with the row sorted COO matrix ghost,
+        /// out[rows[i]] = scalar*(this[rows[i], :]*in + ghost[rows[i], :]*ghost_in), added to
+        /// out[rows[i]] if add is set, where the entries of row rows[i] of ghost start at
+        /// position ghost_offset[i]
+        virtual bool ApplyRowsGhost(const BaseVector<int>&       rows,
+                                    const BaseVector<int>&       ghost_offset,
+                                    const BaseMatrix<ValueType>& ghost,
+                                    const BaseVector<ValueType>& in,
+                                    const BaseVector<ValueType>& ghost_in,
+                                    ValueType                    scalar,
+                                    bool                         add,
+                                    BaseVector<ValueType>*       out) const;
 
         /// Delete all entries abs(a_ij) <= drop_off;
         /// the diagonal elements are never deleted
@@ -400,6 +487,9 @@ namespace rocalution
         // Return key for row, col and val
         virtual bool Key(long int& row_key, long int& col_key, long int& val_key) const;
 
+        /// Compute the structure statistics of the matrix
+        virtual bool StructureStats(MatrixStructureStats* stats) const;
+
         /// Replace a column vector of a matrix
         virtual bool ReplaceColumnVector(int idx, const BaseVector<ValueType>& vec);
 
@@ -431,6 +521,28 @@ namespace rocalution
         virtual bool RSCoarsening(float eps, BaseVector<int>* CFmap, BaseVector<bool>* S) const;
         /// Parallel maximal independent set coarsening
         virtual bool RSPMISCoarsening(float eps, BaseVector<int>* CFmap, BaseVector<bool>* S) const;
+        /// Strong influences and weights of the PMIS coarsening, with ghost layer
+        virtual bool RSPMISStrongInfluences(float                        eps,
+                                            BaseVector<bool>*            S,
+                                            BaseVector<float>*           omega,
+                                            unsigned long long           seed,
+                                            const BaseMatrix<ValueType>& ghost) const;
+        /// Mark undecided vertices of the PMIS coarsening as coarse or fine
+        virtual bool RSPMISUnassignedToCoarse(BaseVector<int>*         CFmap,
+                                              BaseVector<bool>*        marked,
+                                              const BaseVector<float>& omega) const;
+        /// Revert competing coarse vertices of the PMIS coarsening, with ghost layer
+        virtual bool RSPMISCorrectCoarse(BaseVector<int>*             CFmap,
+                                         const BaseVector<bool>&      S,
+                                         const BaseVector<bool>&      marked,
+                                         const BaseVector<float>&     omega,
+                                         const BaseMatrix<ValueType>& ghost) const;
+        /// Mark undecided neighbors of coarse vertices as fine, with ghost layer
+        virtual bool RSPMISCoarseEdgesToFine(BaseVector<int>*             CFmap,
+                                             const BaseVector<bool>&      S,
+                                             const BaseMatrix<ValueType>& ghost) const;
+        /// Check for undecided vertices of the PMIS coarsening
+        virtual bool RSPMISCheckUndecided(bool& undecided, const BaseVector<int>& CFmap) const;
 
         /// Ruge Stueben Direct Interpolation
         virtual bool RSDirectInterpolation(const BaseVector<int>&  CFmap,
@@ -507,7 +619,7 @@ namespace rocalution
         /// Number of columns
         int ncol_;
         /// Number of non-zero elements
-        int nnz_;
+        PtrType nnz_;
 
         /// Backend descriptor (local copy)
         Rocalution_Backend_Descriptor local_backend_;
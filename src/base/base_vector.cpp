@@ -121,6 +121,34 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    void BaseVector<ValueType>::MDot(int                                 count,
+                                     const BaseVector<ValueType>* const* x,
+                                     ValueType*                          result) const
+    {
+        // default is one dot product per vector
+        LOG_VERBOSE_INFO(4, "*** info: BaseVector::MDot() no fused version available");
+
+        for(int i = 0; i < count; ++i)
+        {
+            result[i] = x[i]->Dot(*this);
+        }
+    }
+
+    template <typename ValueType>
+    void BaseVector<ValueType>::MAXPY(int                                 count,
+                                      const BaseVector<ValueType>* const* x,
+                                      const ValueType*                    alpha)
+    {
+        // default is one vector update per vector
+        LOG_VERBOSE_INFO(4, "*** info: BaseVector::MAXPY() no fused version available");
+
+        for(int i = 0; i < count; ++i)
+        {
+            this->AddScale(*x[i], alpha[i]);
+        }
+    }
+
     template <typename ValueType>
     void BaseVector<ValueType>::CopyFromAsync(const BaseVector<ValueType>& vec)
     {
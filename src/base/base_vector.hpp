@@ -147,6 +147,11 @@ namespace rocalution
         virtual ValueType Dot(const BaseVector<ValueType>& x) const = 0;
         /// Compute non-conjugated dot (scalar) product, return this^T y
         virtual ValueType DotNonConj(const BaseVector<ValueType>& x) const = 0;
+        /// Compute multiple dot products, result[i] = x[i]^H this
+        virtual void
+            MDot(int count, const BaseVector<ValueType>* const* x, ValueType* result) const;
+        /// Perform vector update of type this = this + sum(alpha[i]*x[i])
+        virtual void MAXPY(int count, const BaseVector<ValueType>* const* x, const ValueType* alpha);
         /// Compute L2 norm of the vector, return =  srqt(this^T this)
         virtual ValueType Norm(void) const = 0;
         /// Reduce vector
@@ -22,10 +22,12 @@
  * ************************************************************************ */
 
 #include "global_matrix.hpp"
+#include "base_matrix.hpp"
 #include "../utils/allocate_free.hpp"
 #include "../utils/def.hpp"
 #include "../utils/log.hpp"
 #include "../utils/math_functions.hpp"
+#include "../utils/profiler.hpp"
 #include "global_vector.hpp"
 #include "local_matrix.hpp"
 #include "local_vector.hpp"
@@ -39,10 +41,14 @@
 #include <complex>
 #include <limits>
 #include <sstream>
+#include <vector>
 
 namespace rocalution
 {
 
+    // Number of rows computed by Apply() between two tests of the ghost exchange
+    static const int global_matrix_apply_block = 8192;
+
     template <typename ValueType>
     GlobalMatrix<ValueType>::GlobalMatrix()
     {
@@ -55,7 +61,8 @@ namespace rocalution
 
         this->object_name_ = "";
 
-        this->nnz_ = 0;
+        this->nnz_       = 0;
+        this->row_split_ = false;
     }
 
     template <typename ValueType>
@@ -69,7 +76,8 @@ namespace rocalution
 
         this->pm_ = &pm;
 
-        this->nnz_ = 0;
+        this->nnz_       = 0;
+        this->row_split_ = false;
     }
 
     template <typename ValueType>
@@ -88,7 +96,8 @@ namespace rocalution
         this->matrix_interior_.Clear();
         this->matrix_ghost_.Clear();
 
-        this->nnz_ = 0;
+        this->nnz_       = 0;
+        this->row_split_ = false;
     }
 
     template <typename ValueType>
@@ -189,6 +198,8 @@ namespace rocalution
         this->matrix_ghost_.AllocateCSR(
             ghost_name, ghost_nnz, this->pm_->GetLocalSize(), this->pm_->GetNumReceivers());
 
+        this->row_split_ = false;
+
 #ifdef SUPPORT_MULTINODE
         IndexType2 nnz_local;
         IndexType2 nnz_ghost;
@@ -220,6 +231,8 @@ namespace rocalution
         this->matrix_ghost_.AllocateCOO(
             ghost_name, ghost_nnz, this->pm_->GetLocalSize(), this->pm_->GetNumReceivers());
 
+        this->row_split_ = false;
+
 #ifdef SUPPORT_MULTINODE
         IndexType2 nnz_local;
         IndexType2 nnz_ghost;
@@ -234,10 +247,10 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void GlobalMatrix<ValueType>::SetDataPtrCSR(int**       local_row_offset,
+    void GlobalMatrix<ValueType>::SetDataPtrCSR(PtrType**   local_row_offset,
                                                 int**       local_col,
                                                 ValueType** local_val,
-                                                int**       ghost_row_offset,
+                                                PtrType**   ghost_row_offset,
                                                 int**       ghost_col,
                                                 ValueType** ghost_val,
                                                 std::string name,
@@ -297,6 +310,8 @@ namespace rocalution
                                           this->pm_->GetLocalSize(),
                                           this->pm_->GetNumReceivers());
 
+        this->row_split_ = false;
+
         this->matrix_ghost_.ConvertTo(COO);
 
 #ifdef SUPPORT_MULTINODE
@@ -376,6 +391,8 @@ namespace rocalution
                                           this->pm_->GetLocalSize(),
                                           this->pm_->GetNumReceivers());
 
+        this->row_split_ = false;
+
 #ifdef SUPPORT_MULTINODE
         IndexType2 nnz_local;
         IndexType2 nnz_ghost;
@@ -391,7 +408,7 @@ namespace rocalution
 
     template <typename ValueType>
     void GlobalMatrix<ValueType>::SetLocalDataPtrCSR(
-        int** row_offset, int** col, ValueType** val, std::string name, int nnz)
+        PtrType** row_offset, int** col, ValueType** val, std::string name, int nnz)
     {
         log_debug(this, "GlobalMatrix::SetLocalDataPtrCSR()", row_offset, col, val, name, nnz);
 
@@ -475,7 +492,7 @@ namespace rocalution
 
     template <typename ValueType>
     void GlobalMatrix<ValueType>::SetGhostDataPtrCSR(
-        int** row_offset, int** col, ValueType** val, std::string name, int nnz)
+        PtrType** row_offset, int** col, ValueType** val, std::string name, int nnz)
     {
         log_debug(this, "GlobalMatrix::SetGhostDataPtrCSR()", row_offset, col, val, name, nnz);
 
@@ -501,6 +518,8 @@ namespace rocalution
                                           this->pm_->GetLocalSize(),
                                           this->pm_->GetNumReceivers());
 
+        this->row_split_ = false;
+
         this->matrix_ghost_.ConvertTo(COO);
 
 #ifdef SUPPORT_MULTINODE
@@ -544,6 +563,8 @@ namespace rocalution
                                           this->pm_->GetLocalSize(),
                                           this->pm_->GetNumReceivers());
 
+        this->row_split_ = false;
+
         // Sort ghost matrix
         this->matrix_ghost_.Sort();
 
@@ -561,10 +582,10 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void GlobalMatrix<ValueType>::LeaveDataPtrCSR(int**       local_row_offset,
+    void GlobalMatrix<ValueType>::LeaveDataPtrCSR(PtrType**   local_row_offset,
                                                   int**       local_col,
                                                   ValueType** local_val,
-                                                  int**       ghost_row_offset,
+                                                  PtrType**   ghost_row_offset,
                                                   int**       ghost_col,
                                                   ValueType** ghost_val)
     {
@@ -596,6 +617,8 @@ namespace rocalution
         this->matrix_interior_.LeaveDataPtrCSR(local_row_offset, local_col, local_val);
         this->matrix_ghost_.LeaveDataPtrCSR(ghost_row_offset, ghost_col, ghost_val);
 
+        this->row_split_ = false;
+
         this->nnz_ = 0;
     }
 
@@ -635,11 +658,15 @@ namespace rocalution
         this->matrix_interior_.LeaveDataPtrCOO(local_row, local_col, local_val);
         this->matrix_ghost_.LeaveDataPtrCOO(ghost_row, ghost_col, ghost_val);
 
+        this->row_split_ = false;
+
         this->nnz_ = 0;
     }
 
     template <typename ValueType>
-    void GlobalMatrix<ValueType>::LeaveLocalDataPtrCSR(int** row_offset, int** col, ValueType** val)
+    void GlobalMatrix<ValueType>::LeaveLocalDataPtrCSR(PtrType**   row_offset,
+                                                       int**       col,
+                                                       ValueType** val)
     {
         log_debug(this, "GlobalMatrix::LeaveLocalDataPtrCSR()", row_offset, col, val);
 
@@ -675,7 +702,9 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void GlobalMatrix<ValueType>::LeaveGhostDataPtrCSR(int** row_offset, int** col, ValueType** val)
+    void GlobalMatrix<ValueType>::LeaveGhostDataPtrCSR(PtrType**   row_offset,
+                                                       int**       col,
+                                                       ValueType** val)
     {
         log_debug(this, "GlobalMatrix::LeaveGhostDataPtrCSR()", row_offset, col, val);
 
@@ -689,6 +718,8 @@ namespace rocalution
 
         this->matrix_ghost_.LeaveDataPtrCSR(row_offset, col, val);
 
+        this->row_split_ = false;
+
         this->nnz_ = 0;
     }
 
@@ -707,6 +738,8 @@ namespace rocalution
 
         this->matrix_ghost_.LeaveDataPtrCOO(row, col, val);
 
+        this->row_split_ = false;
+
         this->nnz_ = 0;
     }
 
@@ -808,6 +841,8 @@ namespace rocalution
         this->matrix_interior_.CopyFrom(src.GetInterior());
         this->matrix_ghost_.CopyFrom(src.GetGhost());
 
+        this->row_split_ = false;
+
         this->object_name_ = "Copy from " + src.object_name_;
         this->pm_          = src.pm_;
 
@@ -879,6 +914,8 @@ namespace rocalution
     {
         log_debug(this, "GlobalMatrix::Apply()", (const void*&)in, out);
 
+        ProfilerRegion region("GlobalMatrix::Apply");
+
         assert(out != NULL);
         assert(&in != out);
 
@@ -889,6 +926,11 @@ namespace rocalution
 
         out->UpdateGhostValuesAsync_(in);
 
+        if(this->ApplyOverlapped_(in, static_cast<ValueType>(1), false, out) == true)
+        {
+            return;
+        }
+
         this->matrix_interior_.Apply(in.vector_interior_, &out->vector_interior_);
 
         out->UpdateGhostValuesSync_();
@@ -904,6 +946,8 @@ namespace rocalution
     {
         log_debug(this, "GlobalMatrix::ApplyAdd()", (const void*&)in, scalar, out);
 
+        ProfilerRegion region("GlobalMatrix::ApplyAdd");
+
         assert(out != NULL);
         assert(&in != out);
 
@@ -912,7 +956,92 @@ namespace rocalution
         assert(this->is_host_() == in.is_host_());
         assert(this->is_host_() == out->is_host_());
 
-        FATAL_ERROR(__FILE__, __LINE__);
+        out->UpdateGhostValuesAsync_(in);
+
+        if(this->ApplyOverlapped_(in, scalar, true, out) == true)
+        {
+            return;
+        }
+
+        this->matrix_interior_.ApplyAdd(in.vector_interior_, scalar, &out->vector_interior_);
+
+        out->UpdateGhostValuesSync_();
+
+        this->matrix_ghost_.ApplyAdd(out->vector_ghost_, scalar, &out->vector_interior_);
+    }
+
+    template <typename ValueType>
+    bool GlobalMatrix<ValueType>::ApplyOverlapped_(const GlobalVector<ValueType>& in,
+                                                   ValueType                      scalar,
+                                                   bool                           add,
+                                                   GlobalVector<ValueType>*       out) const
+    {
+        log_debug(this, "GlobalMatrix::ApplyOverlapped_()", (const void*&)in, scalar, add, out);
+
+        if((this->is_host_() == false) || (this->matrix_interior_.GetFormat() != CSR)
+           || (this->matrix_ghost_.GetFormat() != COO))
+        {
+            return false;
+        }
+
+        if((this->row_split_ == false)
+           || (this->inner_rows_.GetSize() + this->halo_rows_.GetSize()
+               != this->matrix_interior_.GetM()))
+        {
+            this->SplitRows_();
+        }
+
+        // Compute the rows without ghost entries in blocks, and test the ghost exchange in
+        // between, such that the messages progress meanwhile
+        int  ninner = this->inner_rows_.GetSize();
+        bool done   = false;
+
+        for(int start = 0; start < ninner; start += global_matrix_apply_block)
+        {
+            int end = std::min(start + global_matrix_apply_block, ninner);
+
+            if(this->matrix_interior_.ApplyRows_(this->inner_rows_,
+                                                 start,
+                                                 end,
+                                                 in.vector_interior_,
+                                                 scalar,
+                                                 add,
+                                                 &out->vector_interior_)
+               == false)
+            {
+                LOG_INFO("Computation of GlobalMatrix::Apply() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(done == false)
+            {
+                done = out->UpdateGhostValuesTest_();
+            }
+        }
+
+        out->UpdateGhostValuesSync_();
+
+        // Rows with ghost entries, the ghost part is applied in the same pass
+        if(this->halo_rows_.GetSize() > 0)
+        {
+            if(this->matrix_interior_.ApplyRowsGhost_(this->halo_rows_,
+                                                      this->halo_ghost_offset_,
+                                                      this->matrix_ghost_,
+                                                      in.vector_interior_,
+                                                      out->vector_ghost_,
+                                                      scalar,
+                                                      add,
+                                                      &out->vector_interior_)
+               == false)
+            {
+                LOG_INFO("Computation of GlobalMatrix::Apply() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+        }
+
+        return true;
     }
 
     template <typename ValueType>
@@ -958,6 +1087,8 @@ namespace rocalution
         this->matrix_interior_.ReadFileMTX(path + interior_name);
         this->matrix_ghost_.ReadFileMTX(path + ghost_name);
 
+        this->row_split_ = false;
+
         // Convert ghost matrix to COO
         this->matrix_ghost_.ConvertToCOO();
 
@@ -1059,6 +1190,8 @@ namespace rocalution
         this->matrix_interior_.ReadFileCSR(path + interior_name);
         this->matrix_ghost_.ReadFileCSR(path + ghost_name);
 
+        this->row_split_ = false;
+
         // Convert ghost matrix to COO
         this->matrix_ghost_.ConvertToCOO();
 
@@ -1078,9 +1211,10 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void GlobalMatrix<ValueType>::WriteFileCSR(const std::string& filename) const
+    void GlobalMatrix<ValueType>::WriteFileCSR(const std::string& filename,
+                                               unsigned int       format) const
     {
-        log_debug(this, "GlobalMatrix::WriteFileCSR()", filename);
+        log_debug(this, "GlobalMatrix::WriteFileCSR()", filename, format);
 
         // Master rank writes the global headfile
         if(this->pm_->rank_ == 0)
@@ -1113,8 +1247,8 @@ namespace rocalution
         std::string interior_name = filename + ".interior.rank." + rs.str();
         std::string ghost_name    = filename + ".ghost.rank." + rs.str();
 
-        this->matrix_interior_.WriteFileCSR(interior_name);
-        this->matrix_ghost_.WriteFileCSR(ghost_name);
+        this->matrix_interior_.WriteFileCSR(interior_name, format);
+        this->matrix_ghost_.WriteFileCSR(ghost_name, format);
     }
 
     template <typename ValueType>
@@ -1368,7 +1502,7 @@ namespace rocalution
             this->matrix_interior_.CoarsenOperator(&tmp, pm, nrow, nrow, G, Gsize, rG, rGsize);
         }
 
-        int*       Ac_interior_row_offset = NULL;
+        PtrType*   Ac_interior_row_offset = NULL;
         int*       Ac_interior_col        = NULL;
         ValueType* Ac_interior_val        = NULL;
 
@@ -1394,12 +1528,16 @@ namespace rocalution
         }
 
         delete[] send_ghost_map;
-        free_host(&send_map_size);
+
+        if(send_map_size != NULL)
+        {
+            free_host(&send_map_size);
+        }
 
         // Prepare ghost G sets
         int* ghost_G = NULL;
 
-        allocate_host(this->pm_->recv_offset_index_[this->pm_->nrecv_], &ghost_G);
+        allocate_host(this->pm_->GetNumReceivers(), &ghost_G);
 
         int k = 0;
         for(int n = 0; n < this->pm_->nrecv_; ++n)
@@ -1421,16 +1559,27 @@ namespace rocalution
         }
 
         delete[] recv_ghost_map;
-        free_host(&recv_map_size);
 
-        // Coarsen ghost part of the matrix on the host (no accelerator support)
-        LocalVector<int> G_ghost;
-        G_ghost.SetDataPtr(&ghost_G, "G ghost", this->pm_->recv_offset_index_[this->pm_->nrecv_]);
+        if(recv_map_size != NULL)
+        {
+            free_host(&recv_map_size);
+        }
 
+        // Coarsen ghost part of the matrix on the host (no accelerator support)
+        LocalVector<int>       G_ghost;
         LocalMatrix<ValueType> tmp_ghost;
         LocalMatrix<ValueType> host_ghost;
 
-        if(this->is_accel_())
+        if(ghost_G != NULL)
+        {
+            G_ghost.SetDataPtr(&ghost_G, "G ghost", this->pm_->GetNumReceivers());
+        }
+
+        if(this->matrix_ghost_.GetNnz() == 0)
+        {
+            // Processes without neighbors have no ghost part
+        }
+        else if(this->is_accel_())
         {
             host_ghost.ConvertTo(this->GetGhost().GetFormat(),
                                  this->GetGhost().GetBlockDimension());
@@ -1447,12 +1596,16 @@ namespace rocalution
 
         G_ghost.Clear();
 
-        int*       Ac_ghost_row_offset = NULL;
+        PtrType*   Ac_ghost_row_offset = NULL;
         int*       Ac_ghost_col        = NULL;
         ValueType* Ac_ghost_val        = NULL;
 
         int nnzg = tmp_ghost.GetNnz();
-        tmp_ghost.LeaveDataPtrCSR(&Ac_ghost_row_offset, &Ac_ghost_col, &Ac_ghost_val);
+
+        if(nnzg > 0)
+        {
+            tmp_ghost.LeaveDataPtrCSR(&Ac_ghost_row_offset, &Ac_ghost_col, &Ac_ghost_val);
+        }
 
         // Communicator
         pm->Clear();
@@ -1467,13 +1620,23 @@ namespace rocalution
         pm->SetLocalSize(nrow);
 
         // New boundary and boundary offsets
-        pm->SetBoundaryIndex(boundary_size, boundary_index);
-        free_host(&boundary_index);
+        if(boundary_index != NULL)
+        {
+            pm->SetBoundaryIndex(boundary_size, boundary_index);
+            free_host(&boundary_index);
+        }
 
-        pm->SetReceivers(this->pm_->nrecv_, this->pm_->recvs_, recv_offset_index);
-        free_host(&recv_offset_index);
+        if(this->pm_->nrecv_ > 0)
+        {
+            pm->SetReceivers(this->pm_->nrecv_, this->pm_->recvs_, recv_offset_index);
+        }
+
+        if(this->pm_->nsend_ > 0)
+        {
+            pm->SetSenders(this->pm_->nsend_, this->pm_->sends_, send_offset_index);
+        }
 
-        pm->SetSenders(this->pm_->nsend_, this->pm_->sends_, send_offset_index);
+        free_host(&recv_offset_index);
         free_host(&send_offset_index);
 
         // Allocate
@@ -1481,15 +1644,24 @@ namespace rocalution
         bool isaccel = Ac->is_accel_();
         Ac->MoveToHost();
         Ac->SetParallelManager(*pm);
-        Ac->SetDataPtrCSR(&Ac_interior_row_offset,
-                          &Ac_interior_col,
-                          &Ac_interior_val,
-                          &Ac_ghost_row_offset,
-                          &Ac_ghost_col,
-                          &Ac_ghost_val,
-                          "",
-                          nnzc,
-                          nnzg);
+
+        if(nnzg > 0)
+        {
+            Ac->SetDataPtrCSR(&Ac_interior_row_offset,
+                              &Ac_interior_col,
+                              &Ac_interior_val,
+                              &Ac_ghost_row_offset,
+                              &Ac_ghost_col,
+                              &Ac_ghost_val,
+                              "",
+                              nnzc,
+                              nnzg);
+        }
+        else
+        {
+            Ac->SetLocalDataPtrCSR(
+                &Ac_interior_row_offset, &Ac_interior_col, &Ac_interior_val, "", nnzc);
+        }
 
         if(isaccel == true)
         {
@@ -1498,6 +1670,2607 @@ namespace rocalution
 #endif
     }
 
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::SplitRows_(void) const
+    {
+        log_debug(this, "GlobalMatrix::SplitRows_()");
+
+        int nrow = this->matrix_interior_.GetM();
+
+        // Row offsets of the ghost part, that coincide with the positions of the rows in
+        // the row sorted COO ghost part
+        PtrType* ghost_row_offset = NULL;
+
+        if(this->matrix_ghost_.GetNnz() > 0)
+        {
+            assert(this->matrix_ghost_.GetM() == nrow);
+
+            LocalMatrix<ValueType> ghost;
+            ghost.CloneFrom(this->matrix_ghost_);
+            ghost.MoveToHost();
+            ghost.ConvertToCSR();
+
+            int*       ghost_col = NULL;
+            ValueType* ghost_val = NULL;
+
+            ghost.LeaveDataPtrCSR(&ghost_row_offset, &ghost_col, &ghost_val);
+
+            free_host(&ghost_col);
+            free_host(&ghost_val);
+        }
+
+        std::vector<int> inner;
+        std::vector<int> halo;
+        std::vector<int> offset(1, 0);
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            if((ghost_row_offset != NULL) && (ghost_row_offset[i + 1] > ghost_row_offset[i]))
+            {
+                halo.push_back(i);
+                offset.push_back(static_cast<int>(ghost_row_offset[i + 1]));
+            }
+            else
+            {
+                inner.push_back(i);
+            }
+        }
+
+        if(ghost_row_offset != NULL)
+        {
+            free_host(&ghost_row_offset);
+        }
+
+        this->inner_rows_.Clear();
+        this->halo_rows_.Clear();
+        this->halo_ghost_offset_.Clear();
+
+        this->inner_rows_.Allocate("inner rows", inner.size());
+        this->halo_rows_.Allocate("halo rows", halo.size());
+        this->halo_ghost_offset_.Allocate("halo ghost offset", offset.size());
+
+        if(inner.size() > 0)
+        {
+            this->inner_rows_.CopyFromData(inner.data());
+        }
+
+        if(halo.size() > 0)
+        {
+            this->halo_rows_.CopyFromData(halo.data());
+        }
+
+        this->halo_ghost_offset_.CopyFromData(offset.data());
+
+        this->row_split_ = true;
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::LumpGhostToDiagonal_(LocalMatrix<ValueType>* mat) const
+    {
+        log_debug(this, "GlobalMatrix::LumpGhostToDiagonal_()", mat);
+
+        assert(mat != NULL);
+
+        mat->Clear();
+        mat->ConvertTo(this->matrix_interior_.GetFormat(),
+                       this->matrix_interior_.GetBlockDimension());
+        mat->CopyFrom(this->matrix_interior_);
+
+        if(this->matrix_ghost_.GetNnz() > 0)
+        {
+            // Row sums of the ghost part
+            LocalVector<ValueType> ones;
+            LocalVector<ValueType> row_sum;
+
+            ones.CloneBackend(this->matrix_ghost_);
+            row_sum.CloneBackend(this->matrix_ghost_);
+
+            ones.Allocate("ones", this->matrix_ghost_.GetN());
+            row_sum.Allocate("ghost row sums", this->matrix_ghost_.GetM());
+
+            ones.Ones();
+            this->matrix_ghost_.Apply(ones, &row_sum);
+
+            // Add them to the diagonal on the host
+            bool isaccel = mat->is_accel_();
+
+            mat->MoveToHost();
+            mat->ConvertToCSR();
+
+            int        nrow       = mat->GetM();
+            int        ncol       = mat->GetN();
+            PtrType    nnz        = mat->GetNnz();
+            PtrType*   row_offset = NULL;
+            int*       col        = NULL;
+            ValueType* val        = NULL;
+            ValueType* sum        = NULL;
+
+            mat->LeaveDataPtrCSR(&row_offset, &col, &val);
+            row_sum.LeaveDataPtr(&sum);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int i = 0; i < nrow; ++i)
+            {
+                for(PtrType j = row_offset[i]; j < row_offset[i + 1]; ++j)
+                {
+                    if(col[j] == i)
+                    {
+                        val[j] += sum[i];
+                        break;
+                    }
+                }
+            }
+
+            free_host(&sum);
+
+            mat->SetDataPtrCSR(&row_offset, &col, &val, "Lumped interior", nnz, nrow, ncol);
+
+            if(isaccel == true)
+            {
+                mat->MoveToAccelerator();
+            }
+        }
+        else
+        {
+            mat->ConvertToCSR();
+        }
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::AMGConnect(ValueType eps, LocalVector<int>* connections) const
+    {
+        log_debug(this, "GlobalMatrix::AMGConnect()", eps, connections);
+
+        this->matrix_interior_.AMGConnect(eps, connections);
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::AMGAggregate(const LocalVector<int>& connections,
+                                               LocalVector<int>*       aggregates) const
+    {
+        log_debug(this, "GlobalMatrix::AMGAggregate()", (const void*&)connections, aggregates);
+
+        this->matrix_interior_.AMGAggregate(connections, aggregates);
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::AMGPMISAggregate(const LocalVector<int>& connections,
+                                                   LocalVector<int>*       aggregates) const
+    {
+        log_debug(this, "GlobalMatrix::AMGPMISAggregate()", (const void*&)connections, aggregates);
+
+        this->matrix_interior_.AMGPMISAggregate(connections, aggregates);
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::AMGSmoothedAggregation(ValueType               relax,
+                                                         const LocalVector<int>& aggregates,
+                                                         const LocalVector<int>& connections,
+                                                         LocalMatrix<ValueType>* prolong,
+                                                         LocalMatrix<ValueType>* restrict,
+                                                         int lumping_strat) const
+    {
+        log_debug(this,
+                  "GlobalMatrix::AMGSmoothedAggregation()",
+                  relax,
+                  (const void*&)aggregates,
+                  (const void*&)connections,
+                  prolong,
+                  restrict,
+                  lumping_strat);
+
+        // The smoothed prolongation preserves the near null space of the full matrix
+        LocalMatrix<ValueType> interior;
+        this->LumpGhostToDiagonal_(&interior);
+
+        interior.AMGSmoothedAggregation(
+            relax, aggregates, connections, prolong, restrict, lumping_strat);
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::AMGAggregation(const LocalVector<int>& aggregates,
+                                                 LocalMatrix<ValueType>* prolong,
+                                                 LocalMatrix<ValueType>* restrict) const
+    {
+        log_debug(
+            this, "GlobalMatrix::AMGAggregation()", (const void*&)aggregates, prolong, restrict);
+
+        this->matrix_interior_.AMGAggregation(aggregates, prolong, restrict);
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::RSCoarsening(float              eps,
+                                               LocalVector<int>*  CFmap,
+                                               LocalVector<bool>* S) const
+    {
+        log_debug(this, "GlobalMatrix::RSCoarsening()", eps, CFmap, S);
+
+        this->matrix_interior_.RSCoarsening(eps, CFmap, S);
+    }
+
+    // Update the ghost entries of a host vector, that holds the values of the local
+    // vertices followed by the values of the ghost vertices
+    template <typename DataType>
+    static void communicate_ghost_entries(const ParallelManager& pm, LocalVector<DataType>* vec)
+    {
+        DataType* data = NULL;
+        int       size = static_cast<int>(vec->GetSize());
+
+        vec->LeaveDataPtr(&data);
+        pm.CommunicateGhostValues(data, data + pm.GetLocalSize());
+        vec->SetDataPtr(&data, "", size);
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::RSPMISCoarsening(float              eps,
+                                                   LocalVector<int>*  CFmap,
+                                                   LocalVector<bool>* S) const
+    {
+        log_debug(this, "GlobalMatrix::RSPMISCoarsening()", eps, CFmap, S);
+
+        assert(eps < 1.0f);
+        assert(eps > 0.0f);
+        assert(CFmap != NULL);
+        assert(S != NULL);
+
+        int  nrow = this->GetLocalM();
+        int  nnz  = this->GetLocalNnz();
+        int  ngst = this->pm_->GetNumReceivers();
+        int  gnnz = this->GetGhostNnz();
+        int  nbnd = this->pm_->GetNumSenders();
+        int* bidx = this->pm_->boundary_index_;
+
+        // Coarsen on the host (no accelerator support)
+        LocalMatrix<ValueType> interior;
+        LocalMatrix<ValueType> ghost;
+
+        interior.ConvertTo(this->matrix_interior_.GetFormat(),
+                           this->matrix_interior_.GetBlockDimension());
+        interior.CopyFrom(this->matrix_interior_);
+        interior.ConvertToCSR();
+
+        if(gnnz > 0)
+        {
+            ghost.ConvertTo(this->matrix_ghost_.GetFormat(),
+                            this->matrix_ghost_.GetBlockDimension());
+            ghost.CopyFrom(this->matrix_ghost_);
+            ghost.ConvertToCSR();
+        }
+
+        // Strong influences of the interior part, followed by those of the ghost part
+        LocalVector<bool> S_full;
+        S_full.Allocate("S", nnz + gnnz);
+
+        // Weights, C/F map and coarse marks of the local vertices, followed by those of the
+        // ghost vertices
+        LocalVector<float> omega;
+        LocalVector<int>   cf;
+        LocalVector<bool>  marked;
+
+        omega.Allocate("omega", nrow + ngst);
+        cf.Allocate("CF map", nrow + ngst);
+        marked.Allocate("marked", nrow + ngst);
+
+        interior.RSPMISStrongInfluences(
+            eps, &S_full, &omega, 1234ULL + this->pm_->GetRank(), ghost);
+
+        // The owners add up the strong influences on their boundary vertices, then the
+        // final weights are distributed to the ghost layers
+        float* w = NULL;
+        omega.LeaveDataPtr(&w);
+
+        float* w_bnd = NULL;
+        allocate_host(nbnd, &w_bnd);
+
+        this->pm_->CommunicateBoundaryValues(w + nrow, w_bnd);
+
+        for(int i = 0; i < nbnd; ++i)
+        {
+            w[bidx[i]] += w_bnd[i];
+        }
+
+        this->pm_->CommunicateGhostValues(w, w + nrow);
+
+        omega.SetDataPtr(&w, "omega", nrow + ngst);
+
+        if(w_bnd != NULL)
+        {
+            free_host(&w_bnd);
+        }
+
+        int* cf_bnd = NULL;
+        allocate_host(nbnd, &cf_bnd);
+
+        // Mark all vertices as undecided
+        cf.Zeros();
+
+        int iter = 0;
+
+        while(true)
+        {
+            interior.RSPMISUnassignedToCoarse(&cf, &marked, omega);
+
+            communicate_ghost_entries(*this->pm_, &marked);
+            communicate_ghost_entries(*this->pm_, &cf);
+
+            interior.RSPMISCorrectCoarse(&cf, S_full, marked, omega, ghost);
+
+            // Ghost vertices, that have been reverted to undecided, are reverted by their
+            // owners as well
+            int* cf_ptr = NULL;
+            cf.LeaveDataPtr(&cf_ptr);
+
+            this->pm_->CommunicateBoundaryValues(cf_ptr + nrow, cf_bnd);
+
+            for(int i = 0; i < nbnd; ++i)
+            {
+                if(cf_bnd[i] == 0)
+                {
+                    cf_ptr[bidx[i]] = 0;
+                }
+            }
+
+            this->pm_->CommunicateGhostValues(cf_ptr, cf_ptr + nrow);
+
+            cf.SetDataPtr(&cf_ptr, "CF map", nrow + ngst);
+
+            interior.RSPMISCoarseEdgesToFine(&cf, S_full, ghost);
+
+            // Check whether there are undecided vertices left on any process
+            bool undecided;
+            interior.RSPMISCheckUndecided(undecided, cf);
+
+            int local_undecided  = undecided ? 1 : 0;
+            int global_undecided = local_undecided;
+
+#ifdef SUPPORT_MULTINODE
+            communication_allreduce_single_sum(
+                local_undecided, &global_undecided, this->pm_->comm_);
+#endif
+
+            if(global_undecided == 0)
+            {
+                break;
+            }
+
+            ++iter;
+
+            if(iter > 20)
+            {
+                LOG_VERBOSE_INFO(2,
+                                 "*** warning: GlobalMatrix::RSPMISCoarsening() Current number "
+                                 "of iterations: "
+                                     << iter);
+            }
+        }
+
+        if(cf_bnd != NULL)
+        {
+            free_host(&cf_bnd);
+        }
+
+        omega.Clear();
+        marked.Clear();
+
+        // C/F map of the interior part, strong influences of the interior and the ghost
+        // part
+        int*  cf_ptr = NULL;
+        bool* S_ptr  = NULL;
+
+        cf.LeaveDataPtr(&cf_ptr);
+        S_full.LeaveDataPtr(&S_ptr);
+
+        CFmap->Clear();
+        CFmap->Allocate("CF map", nrow);
+        CFmap->CopyFromData(cf_ptr);
+
+        S->Clear();
+        S->Allocate("S", nnz + gnnz);
+        S->CopyFromData(S_ptr);
+
+        free_host(&cf_ptr);
+        free_host(&S_ptr);
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::RSExtend_(const LocalVector<int>&  CFmap,
+                                            const LocalVector<bool>& S,
+                                            bool                     ghost_rows,
+                                            LocalMatrix<ValueType>*  A,
+                                            LocalVector<int>*        CF,
+                                            LocalVector<bool>*       strong) const
+    {
+        log_debug(this,
+                  "GlobalMatrix::RSExtend_()",
+                  (const void*&)CFmap,
+                  (const void*&)S,
+                  ghost_rows,
+                  A,
+                  CF,
+                  strong);
+
+        assert(A != NULL);
+        assert(CF != NULL);
+        assert(strong != NULL);
+        assert(CFmap.GetSize() == this->GetLocalM());
+        assert(S.GetSize() == this->GetLocalNnz()
+               || S.GetSize() == this->GetLocalNnz() + this->GetGhostNnz());
+
+        int nrow = this->GetLocalM();
+        int nnz  = this->GetLocalNnz();
+        int ngst = this->pm_->GetNumReceivers();
+        int gnnz = this->GetGhostNnz();
+        int rank = this->pm_->GetRank();
+
+        // Host CSR copies of the interior and the ghost part
+        LocalMatrix<ValueType> tmp;
+
+        PtrType*   int_row_offset = NULL;
+        int*       int_col        = NULL;
+        ValueType* int_val        = NULL;
+
+        tmp.CloneFrom(this->matrix_interior_);
+        tmp.MoveToHost();
+        tmp.ConvertToCSR();
+        tmp.LeaveDataPtrCSR(&int_row_offset, &int_col, &int_val);
+
+        PtrType*   gst_row_offset = NULL;
+        int*       gst_col        = NULL;
+        ValueType* gst_val        = NULL;
+
+        if(gnnz > 0)
+        {
+            tmp.CloneFrom(this->matrix_ghost_);
+            tmp.MoveToHost();
+            tmp.ConvertToCSR();
+            tmp.LeaveDataPtrCSR(&gst_row_offset, &gst_col, &gst_val);
+        }
+        else
+        {
+            allocate_host(nrow + 1, &gst_row_offset);
+            set_to_zero_host(nrow + 1, gst_row_offset);
+        }
+
+        // C/F map of the local points, followed by the ghost points
+        int* cf = NULL;
+        allocate_host(nrow + ngst, &cf);
+
+        CFmap.CopyToData(cf);
+        this->pm_->CommunicateGhostValues(cf, cf + nrow);
+
+        // Strong influences of the interior part, followed by the ghost part, which is
+        // weak if not given
+        bool* s = NULL;
+        allocate_host(nnz + gnnz, &s);
+
+        S.CopyToData(s);
+
+        if(S.GetSize() == nnz)
+        {
+            for(int j = 0; j < gnnz; ++j)
+            {
+                s[nnz + j] = false;
+            }
+        }
+
+        // Rows of the ghost points in local numbering, columns that are neither local nor
+        // ghost points are marked by -1
+        PtrType*   ext_offset = NULL;
+        int*       ext_col    = NULL;
+        int*       ext_strong = NULL;
+        ValueType* ext_val    = NULL;
+
+        allocate_host(ngst + 1, &ext_offset);
+        set_to_zero_host(ngst + 1, ext_offset);
+
+        if(ghost_rows == true && ngst > 0)
+        {
+            // Owner and index on the owner of each ghost point
+            int* owner = NULL;
+            int* index = NULL;
+
+            allocate_host(ngst, &owner);
+            allocate_host(nrow + ngst, &index);
+
+            for(int n = 0; n < this->pm_->nrecv_; ++n)
+            {
+                for(int k = this->pm_->recv_offset_index_[n];
+                    k < this->pm_->recv_offset_index_[n + 1];
+                    ++k)
+                {
+                    owner[k] = this->pm_->recvs_[n];
+                }
+            }
+
+            for(int i = 0; i < nrow; ++i)
+            {
+                index[i] = i;
+            }
+
+            this->pm_->CommunicateGhostValues(index, index + nrow);
+
+            // Local rows with columns given by owner and index on the owner
+            int*     row_nnz    = NULL;
+            PtrType* row_offset = NULL;
+
+            allocate_host(nrow + ngst, &row_nnz);
+            allocate_host(nrow + 1, &row_offset);
+
+            int*       row_owner  = NULL;
+            int*       row_index  = NULL;
+            int*       row_strong = NULL;
+            ValueType* row_val    = NULL;
+
+            allocate_host(nnz + gnnz, &row_owner);
+            allocate_host(nnz + gnnz, &row_index);
+            allocate_host(nnz + gnnz, &row_strong);
+            allocate_host(nnz + gnnz, &row_val);
+
+            row_offset[0] = 0;
+
+            for(int i = 0; i < nrow; ++i)
+            {
+                PtrType idx = row_offset[i];
+
+                for(PtrType j = int_row_offset[i]; j < int_row_offset[i + 1]; ++j)
+                {
+                    row_owner[idx]  = rank;
+                    row_index[idx]  = int_col[j];
+                    row_strong[idx] = s[j] ? 1 : 0;
+                    row_val[idx]    = int_val[j];
+                    ++idx;
+                }
+
+                for(PtrType j = gst_row_offset[i]; j < gst_row_offset[i + 1]; ++j)
+                {
+                    row_owner[idx]  = owner[gst_col[j]];
+                    row_index[idx]  = index[nrow + gst_col[j]];
+                    row_strong[idx] = s[nnz + j] ? 1 : 0;
+                    row_val[idx]    = gst_val[j];
+                    ++idx;
+                }
+
+                row_offset[i + 1] = idx;
+                row_nnz[i]        = static_cast<int>(idx - row_offset[i]);
+            }
+
+            this->pm_->CommunicateGhostValues(row_nnz, row_nnz + nrow);
+
+            for(int g = 0; g < ngst; ++g)
+            {
+                ext_offset[g + 1] = ext_offset[g] + row_nnz[nrow + g];
+            }
+
+            PtrType ext_nnz = ext_offset[ngst];
+
+            int* ext_owner = NULL;
+            int* ext_index = NULL;
+
+            allocate_host(ext_nnz, &ext_owner);
+            allocate_host(ext_nnz, &ext_index);
+            allocate_host(ext_nnz, &ext_strong);
+            allocate_host(ext_nnz, &ext_val);
+
+            this->pm_->CommunicateGhostRows(row_offset, row_owner, ext_offset, ext_owner);
+            this->pm_->CommunicateGhostRows(row_offset, row_index, ext_offset, ext_index);
+            this->pm_->CommunicateGhostRows(row_offset, row_strong, ext_offset, ext_strong);
+            this->pm_->CommunicateGhostRows(row_offset, row_val, ext_offset, ext_val);
+
+            free_host(&row_nnz);
+            free_host(&row_offset);
+
+            if(nnz + gnnz > 0)
+            {
+                free_host(&row_owner);
+                free_host(&row_index);
+                free_host(&row_strong);
+                free_host(&row_val);
+            }
+
+            // Ghost points ordered by owner and index on the owner
+            std::vector<std::pair<std::pair<int, int>, int>> ghost(ngst);
+
+            for(int g = 0; g < ngst; ++g)
+            {
+                ghost[g] = std::make_pair(std::make_pair(owner[g], index[nrow + g]), g);
+            }
+
+            std::sort(ghost.begin(), ghost.end());
+
+            allocate_host(ext_nnz, &ext_col);
+
+            for(PtrType j = 0; j < ext_nnz; ++j)
+            {
+                if(ext_owner[j] == rank)
+                {
+                    ext_col[j] = ext_index[j];
+                    continue;
+                }
+
+                std::pair<std::pair<int, int>, int> key(
+                    std::make_pair(ext_owner[j], ext_index[j]), -1);
+
+                typename std::vector<std::pair<std::pair<int, int>, int>>::iterator it
+                    = std::lower_bound(ghost.begin(), ghost.end(), key);
+
+                ext_col[j] = (it != ghost.end() && it->first == key.first) ? nrow + it->second
+                                                                           : -1;
+            }
+
+            free_host(&owner);
+            free_host(&index);
+
+            if(ext_nnz > 0)
+            {
+                free_host(&ext_owner);
+                free_host(&ext_index);
+            }
+        }
+
+        // Interior part followed by the ghost part for the local points, the received rows
+        // for the ghost points
+        PtrType* row_offset = NULL;
+        allocate_host(nrow + ngst + 1, &row_offset);
+
+        row_offset[0] = 0;
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            row_offset[i + 1] = row_offset[i] + (int_row_offset[i + 1] - int_row_offset[i])
+                                + (gst_row_offset[i + 1] - gst_row_offset[i]);
+        }
+
+        for(int g = 0; g < ngst; ++g)
+        {
+            row_offset[nrow + g + 1] = row_offset[nrow + g];
+
+            for(PtrType j = ext_offset[g]; j < ext_offset[g + 1]; ++j)
+            {
+                if(ext_col[j] >= 0)
+                {
+                    ++row_offset[nrow + g + 1];
+                }
+            }
+        }
+
+        PtrType    nnz_ext = row_offset[nrow + ngst];
+        int*       col     = NULL;
+        ValueType* val     = NULL;
+        bool*      s_ext   = NULL;
+
+        allocate_host(nnz_ext, &col);
+        allocate_host(nnz_ext, &val);
+        allocate_host(nnz_ext, &s_ext);
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            PtrType idx = row_offset[i];
+
+            for(PtrType j = int_row_offset[i]; j < int_row_offset[i + 1]; ++j)
+            {
+                col[idx]   = int_col[j];
+                val[idx]   = int_val[j];
+                s_ext[idx] = s[j];
+                ++idx;
+            }
+
+            for(PtrType j = gst_row_offset[i]; j < gst_row_offset[i + 1]; ++j)
+            {
+                col[idx]   = nrow + gst_col[j];
+                val[idx]   = gst_val[j];
+                s_ext[idx] = s[nnz + j];
+                ++idx;
+            }
+        }
+
+        for(int g = 0; g < ngst; ++g)
+        {
+            PtrType idx = row_offset[nrow + g];
+
+            for(PtrType j = ext_offset[g]; j < ext_offset[g + 1]; ++j)
+            {
+                if(ext_col[j] >= 0)
+                {
+                    col[idx]   = ext_col[j];
+                    val[idx]   = ext_val[j];
+                    s_ext[idx] = ext_strong[j] != 0;
+                    ++idx;
+                }
+            }
+        }
+
+        free_host(&int_row_offset);
+        free_host(&int_col);
+        free_host(&int_val);
+        free_host(&gst_row_offset);
+        free_host(&ext_offset);
+
+        if(gnnz > 0)
+        {
+            free_host(&gst_col);
+            free_host(&gst_val);
+        }
+
+        if(nnz + gnnz > 0)
+        {
+            free_host(&s);
+        }
+
+        if(ext_col != NULL)
+        {
+            free_host(&ext_col);
+            free_host(&ext_strong);
+            free_host(&ext_val);
+        }
+
+        A->Clear();
+        A->SetDataPtrCSR(
+            &row_offset, &col, &val, "Extended matrix", nnz_ext, nrow + ngst, nrow + ngst);
+
+        CF->Clear();
+        CF->SetDataPtr(&cf, "CF map", nrow + ngst);
+
+        strong->Clear();
+        strong->SetDataPtr(&s_ext, "S", static_cast<int>(nnz_ext));
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::RSRestrictToLocal_(const LocalVector<int>&       CF,
+                                                     const LocalMatrix<ValueType>& P,
+                                                     LocalMatrix<ValueType>*       prolong,
+                                                     LocalMatrix<ValueType>* restrict,
+                                                     LocalVector<int>*             map) const
+    {
+        log_debug(this,
+                  "GlobalMatrix::RSRestrictToLocal_()",
+                  (const void*&)CF,
+                  (const void*&)P,
+                  prolong,
+                  restrict,
+                  map);
+
+        assert(prolong != NULL);
+        assert(restrict != NULL);
+        assert(map != NULL);
+
+        int nrow = this->GetLocalM();
+        int next = static_cast<int>(CF.GetSize());
+        int ncol = static_cast<int>(P.GetN());
+
+        // Column of each local and ghost point, the coarse points are numbered in the order
+        // of the extended matrix
+        int* cf = NULL;
+        allocate_host(next, &cf);
+
+        CF.CopyToData(cf);
+
+        for(int i = 0, nc = 0; i < next; ++i)
+        {
+            cf[i] = (cf[i] == 1) ? nc++ : -1;
+        }
+
+        map->Clear();
+        map->Allocate("Coarse map", next);
+        map->CopyFromData(cf);
+
+        free_host(&cf);
+
+        // The rows of the local points are the first rows of P
+        LocalMatrix<ValueType> tmp;
+        LocalMatrix<ValueType> R;
+
+        PtrType*   row_offset = NULL;
+        int*       col        = NULL;
+        ValueType* val        = NULL;
+        PtrType    nnz        = 0;
+
+        if(P.GetNnz() > 0)
+        {
+            tmp.CloneFrom(P);
+            tmp.MoveToHost();
+            tmp.ConvertToCSR();
+            tmp.LeaveDataPtrCSR(&row_offset, &col, &val);
+
+            nnz = row_offset[nrow];
+        }
+
+        tmp.Clear();
+
+        if(nnz > 0)
+        {
+            // The arrays keep the trailing rows of the ghost points
+            tmp.SetDataPtrCSR(&row_offset, &col, &val, "Prolongation", nnz, nrow, ncol);
+            tmp.Transpose(&R);
+        }
+        else
+        {
+            // Without coarse points to interpolate from, P is an empty nrow x ncol matrix,
+            // host matrices without entries keep their dimensions
+            tmp.ConvertToCSR();
+            R.ConvertToCSR();
+
+            tmp.matrix_->AllocateCSR(0, nrow, ncol);
+            R.matrix_->AllocateCSR(0, ncol, nrow);
+
+            if(row_offset != NULL)
+            {
+                free_host(&row_offset);
+                free_host(&col);
+                free_host(&val);
+            }
+        }
+
+        prolong->Clear();
+        prolong->ConvertToCSR();
+        prolong->CopyFrom(tmp);
+
+        restrict->Clear();
+        restrict->ConvertToCSR();
+        restrict->CopyFrom(R);
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::RSDirectInterpolation(const LocalVector<int>&  CFmap,
+                                                        const LocalVector<bool>& S,
+                                                        LocalMatrix<ValueType>*  prolong,
+                                                        LocalMatrix<ValueType>* restrict,
+                                                        LocalVector<int>*        map) const
+    {
+        log_debug(this,
+                  "GlobalMatrix::RSDirectInterpolation()",
+                  (const void*&)CFmap,
+                  (const void*&)S,
+                  prolong,
+                  restrict,
+                  map);
+
+        assert(prolong != NULL);
+        assert(restrict != NULL);
+        assert(map != NULL);
+
+        // Processes without rows on this level have an empty interpolation
+        if(this->GetLocalM() == 0)
+        {
+            prolong->Clear();
+            restrict->Clear();
+            map->Clear();
+
+            return;
+        }
+
+        // Direct interpolation only reads the rows of the local points
+        LocalMatrix<ValueType> A;
+        LocalVector<int>       CF;
+        LocalVector<bool>      strong;
+
+        this->RSExtend_(CFmap, S, false, &A, &CF, &strong);
+
+        LocalMatrix<ValueType> P;
+        LocalMatrix<ValueType> R;
+
+        A.RSDirectInterpolation(CF, strong, &P, &R);
+
+        this->RSRestrictToLocal_(CF, P, prolong, restrict, map);
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::RSExtPIInterpolation(const LocalVector<int>&  CFmap,
+                                                       const LocalVector<bool>& S,
+                                                       bool                     FF1,
+                                                       float                    trunc,
+                                                       LocalMatrix<ValueType>*  prolong,
+                                                       LocalMatrix<ValueType>* restrict,
+                                                       LocalVector<int>*        map) const
+    {
+        log_debug(this,
+                  "GlobalMatrix::RSExtPIInterpolation()",
+                  (const void*&)CFmap,
+                  (const void*&)S,
+                  FF1,
+                  trunc,
+                  prolong,
+                  restrict,
+                  map);
+
+        assert(prolong != NULL);
+        assert(restrict != NULL);
+        assert(map != NULL);
+
+        // Processes without rows on this level have an empty interpolation
+        if(this->GetLocalM() == 0)
+        {
+            prolong->Clear();
+            restrict->Clear();
+            map->Clear();
+
+            return;
+        }
+
+        // Fine points of the ghost layer pass on the coarse points they are influenced by
+        LocalMatrix<ValueType> A;
+        LocalVector<int>       CF;
+        LocalVector<bool>      strong;
+
+        this->RSExtend_(CFmap, S, true, &A, &CF, &strong);
+
+        LocalMatrix<ValueType> P;
+        LocalMatrix<ValueType> R;
+
+        A.RSExtPIInterpolation(CF, strong, FF1, trunc, &P, &R);
+
+        this->RSRestrictToLocal_(CF, P, prolong, restrict, map);
+    }
+
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::RestrictCoarseGhost(const LocalVector<int>&       map,
+                                                      const LocalVector<ValueType>& ext,
+                                                      LocalVector<ValueType>*       coarse) const
+    {
+        log_debug(this,
+                  "GlobalMatrix::RestrictCoarseGhost()",
+                  (const void*&)map,
+                  (const void*&)ext,
+                  coarse);
+
+        assert(coarse != NULL);
+        assert(map.GetSize() == this->GetLocalM() + this->pm_->GetNumReceivers());
+        assert(ext.GetSize() >= coarse->GetSize());
+
+        int  nrow = this->GetLocalM();
+        int  ngst = this->pm_->GetNumReceivers();
+        int  nbnd = this->pm_->GetNumSenders();
+        int  next = static_cast<int>(ext.GetSize());
+        int* bidx = this->pm_->boundary_index_;
+
+        int*       cmap      = NULL;
+        ValueType* values    = NULL;
+        ValueType* ghost     = NULL;
+        ValueType* boundary  = NULL;
+
+        allocate_host(nrow + ngst, &cmap);
+        allocate_host(next, &values);
+        allocate_host(ngst, &ghost);
+        allocate_host(nbnd, &boundary);
+
+        map.CopyToData(cmap);
+
+        if(next > 0)
+        {
+            ext.CopyToData(values);
+        }
+
+        // The entries of the coarse points of the ghost layer go to their owners
+        for(int g = 0; g < ngst; ++g)
+        {
+            int c = cmap[nrow + g];
+
+            ghost[g] = (c >= 0) ? values[c] : static_cast<ValueType>(0);
+        }
+
+        this->pm_->CommunicateBoundaryValues(ghost, boundary);
+
+        for(int k = 0; k < nbnd; ++k)
+        {
+            int c = cmap[bidx[k]];
+
+            if(c >= 0)
+            {
+                values[c] += boundary[k];
+            }
+        }
+
+        if(coarse->GetSize() > 0)
+        {
+            coarse->CopyFromData(values);
+        }
+
+        free_host(&cmap);
+
+        if(values != NULL)
+        {
+            free_host(&values);
+        }
+
+        if(ghost != NULL)
+        {
+            free_host(&ghost);
+        }
+
+        if(boundary != NULL)
+        {
+            free_host(&boundary);
+        }
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::ProlongCoarseGhost(const LocalVector<int>&       map,
+                                                     const LocalVector<ValueType>& coarse,
+                                                     LocalVector<ValueType>*       ext) const
+    {
+        log_debug(this,
+                  "GlobalMatrix::ProlongCoarseGhost()",
+                  (const void*&)map,
+                  (const void*&)coarse,
+                  ext);
+
+        assert(ext != NULL);
+        assert(map.GetSize() == this->GetLocalM() + this->pm_->GetNumReceivers());
+        assert(ext->GetSize() >= coarse.GetSize());
+
+        int  nrow = this->GetLocalM();
+        int  ngst = this->pm_->GetNumReceivers();
+        int  nbnd = this->pm_->GetNumSenders();
+        int  next = static_cast<int>(ext->GetSize());
+        int* bidx = this->pm_->boundary_index_;
+
+        int*       cmap   = NULL;
+        ValueType* values = NULL;
+        ValueType* local  = NULL;
+        ValueType* ghost  = NULL;
+
+        allocate_host(nrow + ngst, &cmap);
+        allocate_host(next, &values);
+        allocate_host(nrow, &local);
+        allocate_host(ngst, &ghost);
+
+        map.CopyToData(cmap);
+
+        if(coarse.GetSize() > 0)
+        {
+            coarse.CopyToData(values);
+        }
+
+        // Only the boundary points are sent to the neighbors
+        for(int k = 0; k < nbnd; ++k)
+        {
+            int c = cmap[bidx[k]];
+
+            local[bidx[k]] = (c >= 0) ? values[c] : static_cast<ValueType>(0);
+        }
+
+        this->pm_->CommunicateGhostValues(local, ghost);
+
+        for(int g = 0; g < ngst; ++g)
+        {
+            int c = cmap[nrow + g];
+
+            if(c >= 0)
+            {
+                values[c] = ghost[g];
+            }
+        }
+
+        if(next > 0)
+        {
+            ext->CopyFromData(values);
+        }
+
+        free_host(&cmap);
+
+        if(values != NULL)
+        {
+            free_host(&values);
+        }
+
+        if(local != NULL)
+        {
+            free_host(&local);
+        }
+
+        if(ghost != NULL)
+        {
+            free_host(&ghost);
+        }
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::CoarsenOperator(GlobalMatrix<ValueType>*      Ac,
+                                                  ParallelManager*              pm,
+                                                  const LocalMatrix<ValueType>& restrict,
+                                                  const LocalMatrix<ValueType>& prolong,
+                                                  const LocalVector<int>&       map) const
+    {
+        log_debug(this,
+                  "GlobalMatrix::CoarsenOperator()",
+                  Ac,
+                  pm,
+                  (const void*&)restrict,
+                  (const void*&)prolong,
+                  (const void*&)map);
+
+        assert(Ac != NULL);
+        assert(Ac != this);
+        assert(pm != NULL);
+        assert(prolong.GetM() == this->GetLocalM());
+        assert(restrict.GetN() == this->GetLocalM());
+        assert(restrict.GetM() == prolong.GetN());
+        assert(map.GetSize() == 0
+               || map.GetSize() == this->GetLocalM() + this->pm_->GetNumReceivers());
+
+#ifdef SUPPORT_MULTINODE
+        int  nrow = this->GetLocalM();
+        int  ngst = this->pm_->GetNumReceivers();
+        int  nbnd = this->pm_->GetNumSenders();
+        int  ncol = static_cast<int>(prolong.GetN());
+        int  rank = this->pm_->GetRank();
+        int* bidx = this->pm_->boundary_index_;
+
+        // Column of the prolongation of each local and ghost point, -1 for fine points.
+        // The local coarse points are the first columns, without map there are no others.
+        int* cmap = NULL;
+        allocate_host(nrow + ngst, &cmap);
+
+        int nrowc = ncol;
+
+        if(map.GetSize() > 0)
+        {
+            map.CopyToData(cmap);
+
+            nrowc = 0;
+            for(int i = 0; i < nrow; ++i)
+            {
+                if(cmap[i] >= 0)
+                {
+                    ++nrowc;
+                }
+            }
+        }
+        else
+        {
+            for(int i = 0; i < nrow + ngst; ++i)
+            {
+                cmap[i] = -1;
+            }
+        }
+
+        // Owner and index on the owner of each column of the prolongation, the owners send
+        // the coarse index of their boundary points
+        int* owner = NULL;
+        int* cidx  = NULL;
+
+        allocate_host(ngst, &owner);
+        allocate_host(nrow + ngst, &cidx);
+
+        for(int n = 0; n < this->pm_->nrecv_; ++n)
+        {
+            for(int k = this->pm_->recv_offset_index_[n]; k < this->pm_->recv_offset_index_[n + 1];
+                ++k)
+            {
+                owner[k] = this->pm_->recvs_[n];
+            }
+        }
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            cidx[i] = cmap[i];
+        }
+
+        this->pm_->CommunicateGhostValues(cidx, cidx + nrow);
+
+        std::vector<int> col_owner(ncol, rank);
+        std::vector<int> col_index(ncol);
+
+        for(int c = 0; c < ncol; ++c)
+        {
+            col_index[c] = c;
+        }
+
+        for(int g = 0; g < ngst; ++g)
+        {
+            int c = cmap[nrow + g];
+
+            if(c >= 0)
+            {
+                col_owner[c] = owner[g];
+                col_index[c] = cidx[nrow + g];
+            }
+        }
+
+        if(cidx != NULL)
+        {
+            free_host(&cidx);
+        }
+
+        // Coarsen on the host (no accelerator support)
+        LocalMatrix<ValueType> R;
+        LocalMatrix<ValueType> P;
+        LocalMatrix<ValueType> A;
+
+        R.ConvertTo(restrict.GetFormat(), restrict.GetBlockDimension());
+        P.ConvertTo(prolong.GetFormat(), prolong.GetBlockDimension());
+
+        R.CopyFrom(restrict);
+        P.CopyFrom(prolong);
+
+        R.ConvertToCSR();
+        P.ConvertToCSR();
+
+        PtrType*   P_row_offset = NULL;
+        int*       P_col        = NULL;
+        ValueType* P_val        = NULL;
+
+        if(P.GetNnz() > 0)
+        {
+            P.LeaveDataPtrCSR(&P_row_offset, &P_col, &P_val);
+        }
+        else
+        {
+            allocate_host(nrow + 1, &P_row_offset);
+            set_to_zero_host(nrow + 1, P_row_offset);
+        }
+
+        PtrType P_nnz = P_row_offset[nrow];
+
+        // Exchange the rows of the prolongation that belong to the ghost layer, with the
+        // columns given by owner and index on the owner
+        int* P_owner = NULL;
+        int* P_index = NULL;
+
+        allocate_host(P_nnz, &P_owner);
+        allocate_host(P_nnz, &P_index);
+
+        for(PtrType j = 0; j < P_nnz; ++j)
+        {
+            P_owner[j] = col_owner[P_col[j]];
+            P_index[j] = col_index[P_col[j]];
+        }
+
+        int*     row_nnz          = NULL;
+        PtrType* ghost_row_offset = NULL;
+
+        allocate_host(nrow + ngst, &row_nnz);
+        allocate_host(ngst + 1, &ghost_row_offset);
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            row_nnz[i] = static_cast<int>(P_row_offset[i + 1] - P_row_offset[i]);
+        }
+
+        this->pm_->CommunicateGhostValues(row_nnz, row_nnz + nrow);
+
+        ghost_row_offset[0] = 0;
+        for(int g = 0; g < ngst; ++g)
+        {
+            ghost_row_offset[g + 1] = ghost_row_offset[g] + row_nnz[nrow + g];
+        }
+
+        if(row_nnz != NULL)
+        {
+            free_host(&row_nnz);
+        }
+
+        PtrType    ghost_nnz   = ghost_row_offset[ngst];
+        int*       ghost_owner = NULL;
+        int*       ghost_index = NULL;
+        ValueType* ghost_val   = NULL;
+
+        allocate_host(ghost_nnz, &ghost_owner);
+        allocate_host(ghost_nnz, &ghost_index);
+        allocate_host(ghost_nnz, &ghost_val);
+
+        this->pm_->CommunicateGhostRows(P_row_offset, P_owner, ghost_row_offset, ghost_owner);
+        this->pm_->CommunicateGhostRows(P_row_offset, P_index, ghost_row_offset, ghost_index);
+        this->pm_->CommunicateGhostRows(P_row_offset, P_val, ghost_row_offset, ghost_val);
+
+        if(P_nnz > 0)
+        {
+            free_host(&P_owner);
+            free_host(&P_index);
+        }
+
+        // Columns of the products are the columns of the prolongation, followed by the
+        // further coarse points, that the ghost points interpolate from
+        std::vector<std::pair<std::pair<int, int>, int>> cols;
+
+        for(int c = nrowc; c < ncol; ++c)
+        {
+            cols.push_back(std::make_pair(std::make_pair(col_owner[c], col_index[c]), c));
+        }
+
+        std::sort(cols.begin(), cols.end());
+
+        std::vector<std::pair<int, int>> further;
+
+        for(PtrType j = 0; j < ghost_nnz; ++j)
+        {
+            if(ghost_owner[j] == rank)
+            {
+                continue;
+            }
+
+            std::pair<std::pair<int, int>, int> key(
+                std::make_pair(ghost_owner[j], ghost_index[j]), -1);
+
+            typename std::vector<std::pair<std::pair<int, int>, int>>::iterator it
+                = std::lower_bound(cols.begin(), cols.end(), key);
+
+            if(it == cols.end() || it->first != key.first)
+            {
+                further.push_back(key.first);
+            }
+        }
+
+        std::sort(further.begin(), further.end());
+        further.erase(std::unique(further.begin(), further.end()), further.end());
+
+        int ncomp = ncol + static_cast<int>(further.size());
+
+        for(size_t k = 0; k < further.size(); ++k)
+        {
+            col_owner.push_back(further[k].first);
+            col_index.push_back(further[k].second);
+            cols.push_back(std::make_pair(further[k], ncol + static_cast<int>(k)));
+        }
+
+        std::sort(cols.begin(), cols.end());
+
+        int* ghost_col = NULL;
+        allocate_host(ghost_nnz, &ghost_col);
+
+        for(PtrType j = 0; j < ghost_nnz; ++j)
+        {
+            if(ghost_owner[j] == rank)
+            {
+                ghost_col[j] = ghost_index[j];
+                continue;
+            }
+
+            std::pair<std::pair<int, int>, int> key(
+                std::make_pair(ghost_owner[j], ghost_index[j]), -1);
+
+            ghost_col[j] = std::lower_bound(cols.begin(), cols.end(), key)->second;
+        }
+
+        if(ghost_nnz > 0)
+        {
+            free_host(&ghost_owner);
+            free_host(&ghost_index);
+        }
+
+        // Contributions of the local rows of this matrix to the rows of all columns of the
+        // prolongation, Ac = R [A_interior A_ghost] [P; P_ghost]
+        PtrType*   ext_row_offset = NULL;
+        int*       ext_col        = NULL;
+        ValueType* ext_val        = NULL;
+
+        if(P_nnz > 0)
+        {
+            // Interior part followed by the ghost part of this matrix
+            PtrType*   int_row_offset = NULL;
+            int*       int_col        = NULL;
+            ValueType* int_val        = NULL;
+            PtrType*   gst_row_offset = NULL;
+            int*       gst_col        = NULL;
+            ValueType* gst_val        = NULL;
+
+            A.CloneFrom(this->matrix_interior_);
+            A.MoveToHost();
+            A.ConvertToCSR();
+            A.LeaveDataPtrCSR(&int_row_offset, &int_col, &int_val);
+
+            if(this->matrix_ghost_.GetNnz() > 0)
+            {
+                A.CloneFrom(this->matrix_ghost_);
+                A.MoveToHost();
+                A.ConvertToCSR();
+                A.LeaveDataPtrCSR(&gst_row_offset, &gst_col, &gst_val);
+            }
+
+            PtrType*   row_offset = NULL;
+            int*       col        = NULL;
+            ValueType* val        = NULL;
+
+            allocate_host(nrow + 1, &row_offset);
+
+            row_offset[0] = 0;
+            for(int i = 0; i < nrow; ++i)
+            {
+                row_offset[i + 1] = row_offset[i] + int_row_offset[i + 1] - int_row_offset[i];
+
+                if(gst_row_offset != NULL)
+                {
+                    row_offset[i + 1] += gst_row_offset[i + 1] - gst_row_offset[i];
+                }
+            }
+
+            allocate_host(row_offset[nrow], &col);
+            allocate_host(row_offset[nrow], &val);
+
+            for(int i = 0; i < nrow; ++i)
+            {
+                PtrType idx = row_offset[i];
+
+                for(PtrType j = int_row_offset[i]; j < int_row_offset[i + 1]; ++j)
+                {
+                    col[idx] = int_col[j];
+                    val[idx] = int_val[j];
+                    ++idx;
+                }
+
+                if(gst_row_offset != NULL)
+                {
+                    for(PtrType j = gst_row_offset[i]; j < gst_row_offset[i + 1]; ++j)
+                    {
+                        col[idx] = nrow + gst_col[j];
+                        val[idx] = gst_val[j];
+                        ++idx;
+                    }
+                }
+            }
+
+
+            A.SetDataPtrCSR(&row_offset, &col, &val, "", row_offset[nrow], nrow, nrow + ngst);
+
+            free_host(&int_row_offset);
+            free_host(&int_col);
+            free_host(&int_val);
+
+            if(gst_row_offset != NULL)
+            {
+                free_host(&gst_row_offset);
+                free_host(&gst_col);
+                free_host(&gst_val);
+            }
+
+            // Rows of the local points followed by the rows of the ghost points
+            PtrType*   all_row_offset = NULL;
+            int*       all_col        = NULL;
+            ValueType* all_val        = NULL;
+
+            allocate_host(nrow + ngst + 1, &all_row_offset);
+            allocate_host(P_nnz + ghost_nnz, &all_col);
+            allocate_host(P_nnz + ghost_nnz, &all_val);
+
+            for(int i = 0; i < nrow + 1; ++i)
+            {
+                all_row_offset[i] = P_row_offset[i];
+            }
+
+            for(int g = 0; g < ngst; ++g)
+            {
+                all_row_offset[nrow + g + 1] = P_nnz + ghost_row_offset[g + 1];
+            }
+
+            for(PtrType j = 0; j < P_nnz; ++j)
+            {
+                all_col[j] = P_col[j];
+                all_val[j] = P_val[j];
+            }
+
+            for(PtrType j = 0; j < ghost_nnz; ++j)
+            {
+                all_col[P_nnz + j] = ghost_col[j];
+                all_val[P_nnz + j] = ghost_val[j];
+            }
+
+            LocalMatrix<ValueType> P_all;
+            P_all.SetDataPtrCSR(&all_row_offset,
+                                &all_col,
+                                &all_val,
+                                "Prolongation",
+                                P_nnz + ghost_nnz,
+                                nrow + ngst,
+                                ncomp);
+
+            LocalMatrix<ValueType> tmp;
+            tmp.TripleMatrixMult(R, A, P_all);
+
+            if(tmp.GetNnz() > 0)
+            {
+                tmp.LeaveDataPtrCSR(&ext_row_offset, &ext_col, &ext_val);
+            }
+        }
+
+        if(ext_row_offset == NULL)
+        {
+            allocate_host(ncol + 1, &ext_row_offset);
+            set_to_zero_host(ncol + 1, ext_row_offset);
+        }
+
+        R.Clear();
+        A.Clear();
+
+        free_host(&P_row_offset);
+        free_host(&ghost_row_offset);
+
+        if(P_col != NULL)
+        {
+            free_host(&P_col);
+            free_host(&P_val);
+        }
+
+        if(ghost_nnz > 0)
+        {
+            free_host(&ghost_col);
+            free_host(&ghost_val);
+        }
+
+        // The rows of the coarse points of the ghost layer are sent to their owners
+        int*     send_nnz        = NULL;
+        int*     recv_nnz        = NULL;
+        PtrType* send_row_offset = NULL;
+        PtrType* recv_row_offset = NULL;
+
+        allocate_host(ngst, &send_nnz);
+        allocate_host(nbnd, &recv_nnz);
+        allocate_host(ngst + 1, &send_row_offset);
+        allocate_host(nbnd + 1, &recv_row_offset);
+
+        send_row_offset[0] = 0;
+        for(int g = 0; g < ngst; ++g)
+        {
+            int c = cmap[nrow + g];
+
+            send_nnz[g]
+                = (c >= 0) ? static_cast<int>(ext_row_offset[c + 1] - ext_row_offset[c]) : 0;
+            send_row_offset[g + 1] = send_row_offset[g] + send_nnz[g];
+        }
+
+        this->pm_->CommunicateBoundaryValues(send_nnz, recv_nnz);
+
+        recv_row_offset[0] = 0;
+        for(int k = 0; k < nbnd; ++k)
+        {
+            recv_row_offset[k + 1] = recv_row_offset[k] + recv_nnz[k];
+        }
+
+        PtrType send_size = send_row_offset[ngst];
+        PtrType recv_size = recv_row_offset[nbnd];
+
+        int*       send_owner = NULL;
+        int*       send_index = NULL;
+        ValueType* send_val   = NULL;
+        int*       recv_owner = NULL;
+        int*       recv_index = NULL;
+        ValueType* recv_val   = NULL;
+
+        allocate_host(send_size, &send_owner);
+        allocate_host(send_size, &send_index);
+        allocate_host(send_size, &send_val);
+        allocate_host(recv_size, &recv_owner);
+        allocate_host(recv_size, &recv_index);
+        allocate_host(recv_size, &recv_val);
+
+        for(int g = 0; g < ngst; ++g)
+        {
+            int c = cmap[nrow + g];
+
+            if(c < 0)
+            {
+                continue;
+            }
+
+            PtrType idx = send_row_offset[g];
+
+            for(PtrType j = ext_row_offset[c]; j < ext_row_offset[c + 1]; ++j)
+            {
+                send_owner[idx] = col_owner[ext_col[j]];
+                send_index[idx] = col_index[ext_col[j]];
+                send_val[idx]   = ext_val[j];
+                ++idx;
+            }
+        }
+
+        this->pm_->CommunicateBoundaryRows(
+            send_row_offset, send_owner, recv_row_offset, recv_owner);
+        this->pm_->CommunicateBoundaryRows(
+            send_row_offset, send_index, recv_row_offset, recv_index);
+        this->pm_->CommunicateBoundaryRows(send_row_offset, send_val, recv_row_offset, recv_val);
+
+        if(send_size > 0)
+        {
+            free_host(&send_owner);
+            free_host(&send_index);
+            free_host(&send_val);
+        }
+
+        // Couplings to processes, that are no neighbors of this level, are lumped into the
+        // diagonal, the other ghost couplings are kept with the neighbor and index on the
+        // neighbor
+        std::vector<std::pair<int, int>> neighbors;
+
+        for(int n = 0; n < this->pm_->nrecv_; ++n)
+        {
+            neighbors.push_back(std::make_pair(this->pm_->recvs_[n], n));
+        }
+
+        std::sort(neighbors.begin(), neighbors.end());
+
+        std::vector<std::vector<int>> requested(this->pm_->nrecv_);
+
+        std::vector<PtrType>   Ac_int_row_offset(nrowc + 1, 0);
+        std::vector<int>       Ac_int_col;
+        std::vector<ValueType> Ac_int_val;
+        std::vector<PtrType>   Ac_gst_row_offset(nrowc + 1, 0);
+        std::vector<int>       Ac_gst_nbr;
+        std::vector<int>       Ac_gst_index;
+        std::vector<ValueType> Ac_gst_val;
+
+        // Position of the contributions of each local coarse point, that the neighbors send
+        std::vector<std::vector<int>> contributions(nrowc);
+
+        for(int k = 0; k < nbnd; ++k)
+        {
+            int c = cmap[bidx[k]];
+
+            if(c >= 0 && recv_nnz[k] > 0)
+            {
+                contributions[c].push_back(k);
+            }
+        }
+
+        std::vector<std::pair<std::pair<int, int>, PtrType>> entries;
+        std::vector<ValueType>                               values;
+
+        for(int I = 0; I < nrowc; ++I)
+        {
+            entries.clear();
+            values.clear();
+
+            // The diagonal is always part of the row
+            entries.push_back(std::make_pair(std::make_pair(rank, I), static_cast<PtrType>(0)));
+            values.push_back(static_cast<ValueType>(0));
+
+            for(PtrType j = ext_row_offset[I]; j < ext_row_offset[I + 1]; ++j)
+            {
+                entries.push_back(std::make_pair(
+                    std::make_pair(col_owner[ext_col[j]], col_index[ext_col[j]]),
+                    static_cast<PtrType>(values.size())));
+                values.push_back(ext_val[j]);
+            }
+
+            for(size_t n = 0; n < contributions[I].size(); ++n)
+            {
+                int k = contributions[I][n];
+
+                for(PtrType j = recv_row_offset[k]; j < recv_row_offset[k + 1]; ++j)
+                {
+                    entries.push_back(std::make_pair(std::make_pair(recv_owner[j], recv_index[j]),
+                                                     static_cast<PtrType>(values.size())));
+                    values.push_back(recv_val[j]);
+                }
+            }
+
+            std::sort(entries.begin(), entries.end());
+
+            PtrType   diag   = -1;
+            ValueType lumped = static_cast<ValueType>(0);
+
+            for(size_t e = 0; e < entries.size();)
+            {
+                std::pair<int, int> key = entries[e].first;
+                ValueType           sum = static_cast<ValueType>(0);
+
+                for(; e < entries.size() && entries[e].first == key; ++e)
+                {
+                    sum += values[entries[e].second];
+                }
+
+                if(key.first == rank)
+                {
+                    if(key.second == I)
+                    {
+                        diag = static_cast<PtrType>(Ac_int_col.size());
+                    }
+
+                    Ac_int_col.push_back(key.second);
+                    Ac_int_val.push_back(sum);
+
+                    continue;
+                }
+
+                std::vector<std::pair<int, int>>::iterator it = std::lower_bound(
+                    neighbors.begin(), neighbors.end(), std::make_pair(key.first, -1));
+
+                if(it != neighbors.end() && it->first == key.first)
+                {
+                    requested[it->second].push_back(key.second);
+
+                    Ac_gst_nbr.push_back(it->second);
+                    Ac_gst_index.push_back(key.second);
+                    Ac_gst_val.push_back(sum);
+                }
+                else
+                {
+                    lumped += sum;
+                }
+            }
+
+            Ac_int_val[diag] += lumped;
+
+            Ac_int_row_offset[I + 1] = static_cast<PtrType>(Ac_int_col.size());
+            Ac_gst_row_offset[I + 1] = static_cast<PtrType>(Ac_gst_val.size());
+        }
+
+        free_host(&cmap);
+        free_host(&ext_row_offset);
+
+        if(ext_col != NULL)
+        {
+            free_host(&ext_col);
+            free_host(&ext_val);
+        }
+
+        if(owner != NULL)
+        {
+            free_host(&owner);
+        }
+
+        if(ngst > 0)
+        {
+            free_host(&send_nnz);
+        }
+
+        if(nbnd > 0)
+        {
+            free_host(&recv_nnz);
+        }
+
+        free_host(&send_row_offset);
+        free_host(&recv_row_offset);
+
+        if(recv_size > 0)
+        {
+            free_host(&recv_owner);
+            free_host(&recv_index);
+            free_host(&recv_val);
+        }
+
+        // The coarse ghost layer consists of the requested coarse points of each neighbor in
+        // ascending order, neighbors without requested coarse points are dropped
+        int* recvs             = NULL;
+        int* recv_offset_index = NULL;
+
+        allocate_host(this->pm_->nrecv_, &recvs);
+        allocate_host(this->pm_->nrecv_ + 1, &recv_offset_index);
+
+        std::vector<int> recv_start(this->pm_->nrecv_, 0);
+
+        int nrecv            = 0;
+        recv_offset_index[0] = 0;
+
+        for(int n = 0; n < this->pm_->nrecv_; ++n)
+        {
+            std::sort(requested[n].begin(), requested[n].end());
+            requested[n].erase(std::unique(requested[n].begin(), requested[n].end()),
+                               requested[n].end());
+
+            recv_start[n] = recv_offset_index[nrecv];
+
+            if(requested[n].size() > 0)
+            {
+                recvs[nrecv] = this->pm_->recvs_[n];
+                recv_offset_index[nrecv + 1]
+                    = recv_offset_index[nrecv] + static_cast<int>(requested[n].size());
+                ++nrecv;
+            }
+        }
+
+        // The owners learn which of their coarse points are requested
+        std::vector<int>      request_size(this->pm_->nrecv_);
+        std::vector<int>      boundary_size(this->pm_->nsend_);
+        std::vector<MRequest> req(this->pm_->nrecv_ + this->pm_->nsend_);
+
+        int nreq = 0;
+
+        for(int n = 0; n < this->pm_->nsend_; ++n)
+        {
+            communication_async_recv(
+                &boundary_size[n], 1, this->pm_->sends_[n], 0, &req[nreq++], this->pm_->comm_);
+        }
+
+        for(int n = 0; n < this->pm_->nrecv_; ++n)
+        {
+            request_size[n] = static_cast<int>(requested[n].size());
+
+            communication_async_send(
+                &request_size[n], 1, this->pm_->recvs_[n], 0, &req[nreq++], this->pm_->comm_);
+        }
+
+        if(nreq > 0)
+        {
+            communication_syncall(nreq, &req[0]);
+        }
+
+        int* sends             = NULL;
+        int* send_offset_index = NULL;
+
+        allocate_host(this->pm_->nsend_, &sends);
+        allocate_host(this->pm_->nsend_ + 1, &send_offset_index);
+
+        std::vector<int> boundary_offset(this->pm_->nsend_ + 1, 0);
+
+        for(int n = 0; n < this->pm_->nsend_; ++n)
+        {
+            boundary_offset[n + 1] = boundary_offset[n] + boundary_size[n];
+        }
+
+        std::vector<int> boundary_index(boundary_offset[this->pm_->nsend_]);
+
+        nreq = 0;
+
+        for(int n = 0; n < this->pm_->nsend_; ++n)
+        {
+            if(boundary_size[n] > 0)
+            {
+                communication_async_recv(&boundary_index[boundary_offset[n]],
+                                         boundary_size[n],
+                                         this->pm_->sends_[n],
+                                         0,
+                                         &req[nreq++],
+                                         this->pm_->comm_);
+            }
+        }
+
+        for(int n = 0; n < this->pm_->nrecv_; ++n)
+        {
+            if(request_size[n] > 0)
+            {
+                communication_async_send(&requested[n][0],
+                                         request_size[n],
+                                         this->pm_->recvs_[n],
+                                         0,
+                                         &req[nreq++],
+                                         this->pm_->comm_);
+            }
+        }
+
+        if(nreq > 0)
+        {
+            communication_syncall(nreq, &req[0]);
+        }
+
+        // Neighbors without requested coarse points are dropped
+        int nsend            = 0;
+        send_offset_index[0] = 0;
+
+        for(int n = 0; n < this->pm_->nsend_; ++n)
+        {
+            if(boundary_size[n] > 0)
+            {
+                sends[nsend]                 = this->pm_->sends_[n];
+                send_offset_index[nsend + 1] = boundary_offset[n + 1];
+                ++nsend;
+            }
+        }
+
+        // Ghost part of the coarse operator, the columns are the positions in the coarse
+        // ghost layer
+        int nnzc = static_cast<int>(Ac_int_col.size());
+        int nnzg = static_cast<int>(Ac_gst_val.size());
+
+        PtrType*   Ac_interior_row_offset = NULL;
+        int*       Ac_interior_col        = NULL;
+        ValueType* Ac_interior_val        = NULL;
+        PtrType*   Ac_ghost_row_offset    = NULL;
+        int*       Ac_ghost_col           = NULL;
+        ValueType* Ac_ghost_val           = NULL;
+
+        if(nnzc > 0)
+        {
+            allocate_host(nrowc + 1, &Ac_interior_row_offset);
+            allocate_host(nnzc, &Ac_interior_col);
+            allocate_host(nnzc, &Ac_interior_val);
+
+            for(int i = 0; i < nrowc + 1; ++i)
+            {
+                Ac_interior_row_offset[i] = Ac_int_row_offset[i];
+            }
+
+            for(int j = 0; j < nnzc; ++j)
+            {
+                Ac_interior_col[j] = Ac_int_col[j];
+                Ac_interior_val[j] = Ac_int_val[j];
+            }
+        }
+
+        if(nnzg > 0)
+        {
+            allocate_host(nrowc + 1, &Ac_ghost_row_offset);
+            allocate_host(nnzg, &Ac_ghost_col);
+            allocate_host(nnzg, &Ac_ghost_val);
+
+            for(int i = 0; i < nrowc + 1; ++i)
+            {
+                Ac_ghost_row_offset[i] = Ac_gst_row_offset[i];
+            }
+
+            for(int j = 0; j < nnzg; ++j)
+            {
+                int n = Ac_gst_nbr[j];
+
+                Ac_ghost_col[j] = recv_start[n]
+                                  + static_cast<int>(std::lower_bound(requested[n].begin(),
+                                                                      requested[n].end(),
+                                                                      Ac_gst_index[j])
+                                                     - requested[n].begin());
+                Ac_ghost_val[j] = Ac_gst_val[j];
+            }
+        }
+
+        // Communicator
+        pm->Clear();
+        pm->SetMPICommunicator(this->pm_->comm_);
+
+        // Get the global size
+        int global_size;
+        communication_allreduce_single_sum(nrowc, &global_size, this->pm_->comm_);
+        pm->SetGlobalSize(global_size);
+
+        // Local size
+        pm->SetLocalSize(nrowc);
+
+        // New boundary and boundary offsets
+        if(boundary_index.size() > 0)
+        {
+            pm->SetBoundaryIndex(static_cast<int>(boundary_index.size()), &boundary_index[0]);
+        }
+
+        if(nrecv > 0)
+        {
+            pm->SetReceivers(nrecv, recvs, recv_offset_index);
+        }
+
+        if(nsend > 0)
+        {
+            pm->SetSenders(nsend, sends, send_offset_index);
+        }
+
+        if(recvs != NULL)
+        {
+            free_host(&recvs);
+        }
+
+        if(sends != NULL)
+        {
+            free_host(&sends);
+        }
+
+        free_host(&recv_offset_index);
+        free_host(&send_offset_index);
+
+        // Allocate
+        Ac->Clear();
+        bool isaccel = Ac->is_accel_();
+        Ac->MoveToHost();
+        Ac->SetParallelManager(*pm);
+
+        if(nnzg > 0)
+        {
+            Ac->SetDataPtrCSR(&Ac_interior_row_offset,
+                              &Ac_interior_col,
+                              &Ac_interior_val,
+                              &Ac_ghost_row_offset,
+                              &Ac_ghost_col,
+                              &Ac_ghost_val,
+                              "",
+                              nnzc,
+                              nnzg);
+        }
+        else if(nnzc > 0)
+        {
+            if(Ac_ghost_row_offset != NULL)
+            {
+                free_host(&Ac_ghost_row_offset);
+            }
+
+            Ac->SetLocalDataPtrCSR(
+                &Ac_interior_row_offset, &Ac_interior_col, &Ac_interior_val, "", nnzc);
+        }
+        else
+        {
+            // Processes without coarse points keep an empty coarse operator, but take part
+            // in the reductions of the global number of non-zeros
+            IndexType2 nnz_local;
+            IndexType2 nnz_ghost;
+
+            communication_allreduce_single_sum(
+                static_cast<IndexType2>(0), &nnz_local, this->pm_->comm_);
+            communication_allreduce_single_sum(
+                static_cast<IndexType2>(0), &nnz_ghost, this->pm_->comm_);
+
+            Ac->nnz_ = nnz_local + nnz_ghost;
+        }
+
+        if(isaccel == true)
+        {
+            Ac->MoveToAccelerator();
+        }
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::Agglomerate(ParallelManager*         pm,
+                                              GlobalMatrix<ValueType>* agg) const
+    {
+        log_debug(this, "GlobalMatrix::Agglomerate()", pm, agg);
+
+        assert(pm != NULL);
+        assert(agg != NULL);
+        assert(agg != this);
+        assert(pm->IsAgglomerated() == true);
+        assert(pm->agg_comm_ == this->pm_->comm_);
+        assert(pm->agg_local_size_ == this->GetLocalM());
+
+#ifdef SUPPORT_MULTINODE
+        int nrow  = this->GetLocalM();
+        int ngst  = this->pm_->GetNumReceivers();
+        int group = pm->agg_leader_ / pm->agg_group_size_;
+
+        bool leader = (pm->agg_nmember_ > 0);
+
+        // Index of each row within the agglomerated local part of its group, the ghost
+        // rows receive the index from their owners
+        int* agg_index = NULL;
+        allocate_host(nrow + ngst, &agg_index);
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            agg_index[i] = pm->agg_local_offset_ + i;
+        }
+
+        this->pm_->CommunicateGhostValues(agg_index, agg_index + nrow);
+
+        // Group of the owner of each ghost row and neighboring groups of this process
+        std::vector<int> ghost_group(ngst);
+        std::vector<int> nbr_groups;
+
+        for(int n = 0; n < this->pm_->nrecv_; ++n)
+        {
+            int g = this->pm_->recvs_[n] / pm->agg_group_size_;
+
+            for(int k = this->pm_->recv_offset_index_[n]; k < this->pm_->recv_offset_index_[n + 1];
+                ++k)
+            {
+                ghost_group[k] = g;
+            }
+
+            if(g != group)
+            {
+                nbr_groups.push_back(g);
+            }
+        }
+
+        // Separator between the groups, this process receives from and sends to
+        nbr_groups.push_back(-1);
+
+        for(int n = 0; n < this->pm_->nsend_; ++n)
+        {
+            int g = this->pm_->sends_[n] / pm->agg_group_size_;
+
+            if(g != group)
+            {
+                nbr_groups.push_back(g);
+            }
+        }
+
+        // Host CSR copies of the interior and the ghost part
+        LocalMatrix<ValueType> A;
+
+        A.CloneFrom(this->matrix_interior_);
+        A.MoveToHost();
+        A.ConvertToCSR();
+
+        PtrType*   int_row_offset = NULL;
+        int*       int_col        = NULL;
+        ValueType* int_val        = NULL;
+
+        A.LeaveDataPtrCSR(&int_row_offset, &int_col, &int_val);
+
+        PtrType*   gst_row_offset = NULL;
+        int*       gst_col        = NULL;
+        ValueType* gst_val        = NULL;
+
+        bool gst = this->matrix_ghost_.GetNnz() > 0;
+
+        if(gst == true)
+        {
+            A.CloneFrom(this->matrix_ghost_);
+            A.MoveToHost();
+            A.ConvertToCSR();
+            A.LeaveDataPtrCSR(&gst_row_offset, &gst_col, &gst_val);
+        }
+
+        // Rows of this process with (group, agglomerated index) column pairs
+        int*     row_nnz    = NULL;
+        PtrType* row_offset = NULL;
+
+        allocate_host(nrow, &row_nnz);
+        allocate_host(nrow + 1, &row_offset);
+
+        row_offset[0] = 0;
+        for(int i = 0; i < nrow; ++i)
+        {
+            row_nnz[i] = static_cast<int>(int_row_offset[i + 1] - int_row_offset[i]);
+
+            if(gst == true)
+            {
+                row_nnz[i] += static_cast<int>(gst_row_offset[i + 1] - gst_row_offset[i]);
+            }
+
+            row_offset[i + 1] = row_offset[i] + row_nnz[i];
+        }
+
+        int*       col_group = NULL;
+        int*       col_index = NULL;
+        ValueType* val       = NULL;
+
+        allocate_host(row_offset[nrow], &col_group);
+        allocate_host(row_offset[nrow], &col_index);
+        allocate_host(row_offset[nrow], &val);
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            PtrType idx = row_offset[i];
+
+            for(PtrType j = int_row_offset[i]; j < int_row_offset[i + 1]; ++j)
+            {
+                col_group[idx] = group;
+                col_index[idx] = agg_index[int_col[j]];
+                val[idx]       = int_val[j];
+                ++idx;
+            }
+
+            if(gst == true)
+            {
+                for(PtrType j = gst_row_offset[i]; j < gst_row_offset[i + 1]; ++j)
+                {
+                    col_group[idx] = ghost_group[gst_col[j]];
+                    col_index[idx] = agg_index[nrow + gst_col[j]];
+                    val[idx]       = gst_val[j];
+                    ++idx;
+                }
+            }
+        }
+
+        if(agg_index != NULL)
+        {
+            free_host(&agg_index);
+        }
+
+        if(int_row_offset != NULL)
+        {
+            free_host(&int_row_offset);
+        }
+
+        if(int_col != NULL)
+        {
+            free_host(&int_col);
+            free_host(&int_val);
+        }
+
+        if(gst == true)
+        {
+            free_host(&gst_row_offset);
+            free_host(&gst_col);
+            free_host(&gst_val);
+        }
+
+        // Gather the rows and the neighboring groups on the group leader
+        int agg_nrow = (leader == true) ? pm->agg_offset_[pm->agg_nmember_] : 0;
+
+        int*     agg_row_nnz    = NULL;
+        PtrType* agg_row_offset = NULL;
+
+        allocate_host(agg_nrow, &agg_row_nnz);
+        allocate_host(agg_nrow + 1, &agg_row_offset);
+
+        pm->GatherAgglomerated(row_nnz, agg_row_nnz);
+
+        agg_row_offset[0] = 0;
+        for(int i = 0; i < agg_nrow; ++i)
+        {
+            agg_row_offset[i + 1] = agg_row_offset[i] + agg_row_nnz[i];
+        }
+
+        if(row_nnz != NULL)
+        {
+            free_host(&row_nnz);
+        }
+
+        if(agg_row_nnz != NULL)
+        {
+            free_host(&agg_row_nnz);
+        }
+
+        int*       agg_col_group = NULL;
+        int*       agg_col_index = NULL;
+        ValueType* agg_val       = NULL;
+
+        allocate_host(agg_row_offset[agg_nrow], &agg_col_group);
+        allocate_host(agg_row_offset[agg_nrow], &agg_col_index);
+        allocate_host(agg_row_offset[agg_nrow], &agg_val);
+
+        pm->GatherAgglomeratedRows(row_offset, col_group, agg_row_offset, agg_col_group);
+        pm->GatherAgglomeratedRows(row_offset, col_index, agg_row_offset, agg_col_index);
+        pm->GatherAgglomeratedRows(row_offset, val, agg_row_offset, agg_val);
+
+        free_host(&row_offset);
+
+        if(col_group != NULL)
+        {
+            free_host(&col_group);
+            free_host(&col_index);
+            free_host(&val);
+        }
+
+        std::vector<MRequest> req(std::max(pm->agg_nmember_, 1));
+
+        int nreq = 0;
+
+        if(leader == false)
+        {
+            int size = static_cast<int>(nbr_groups.size());
+
+            communication_async_send(&size, 1, pm->agg_leader_, 0, &req[nreq++], pm->agg_comm_);
+            communication_syncall(nreq, &req[0]);
+
+            nreq = 0;
+
+            communication_async_send(
+                &nbr_groups[0], size, pm->agg_leader_, 0, &req[nreq++], pm->agg_comm_);
+            communication_syncall(nreq, &req[0]);
+
+            free_host(&agg_row_offset);
+
+            // Idle processes keep an empty matrix
+            agg->Clear();
+            agg->pm_ = pm;
+
+            return;
+        }
+
+        std::vector<int> recv_groups;
+        std::vector<int> send_groups;
+        std::vector<int> sizes(pm->agg_nmember_, 0);
+
+        for(int k = 1; k < pm->agg_nmember_; ++k)
+        {
+            communication_async_recv(
+                &sizes[k], 1, pm->agg_leader_ + k, 0, &req[nreq++], pm->agg_comm_);
+        }
+
+        if(nreq > 0)
+        {
+            communication_syncall(nreq, &req[0]);
+        }
+
+        sizes[0] = static_cast<int>(nbr_groups.size());
+
+        std::vector<int> offsets(pm->agg_nmember_ + 1, 0);
+
+        for(int k = 0; k < pm->agg_nmember_; ++k)
+        {
+            offsets[k + 1] = offsets[k] + sizes[k];
+        }
+
+        std::vector<int> member_groups(offsets[pm->agg_nmember_]);
+        std::copy(nbr_groups.begin(), nbr_groups.end(), member_groups.begin());
+
+        nreq = 0;
+
+        for(int k = 1; k < pm->agg_nmember_; ++k)
+        {
+            communication_async_recv(&member_groups[offsets[k]],
+                                     sizes[k],
+                                     pm->agg_leader_ + k,
+                                     0,
+                                     &req[nreq++],
+                                     pm->agg_comm_);
+        }
+
+        if(nreq > 0)
+        {
+            communication_syncall(nreq, &req[0]);
+        }
+
+        for(int k = 0; k < pm->agg_nmember_; ++k)
+        {
+            bool send = false;
+
+            for(int j = offsets[k]; j < offsets[k + 1]; ++j)
+            {
+                if(member_groups[j] < 0)
+                {
+                    send = true;
+                }
+                else if(send == true)
+                {
+                    send_groups.push_back(member_groups[j]);
+                }
+                else
+                {
+                    recv_groups.push_back(member_groups[j]);
+                }
+            }
+        }
+
+        std::sort(recv_groups.begin(), recv_groups.end());
+        recv_groups.erase(std::unique(recv_groups.begin(), recv_groups.end()), recv_groups.end());
+        std::sort(send_groups.begin(), send_groups.end());
+        send_groups.erase(std::unique(send_groups.begin(), send_groups.end()), send_groups.end());
+
+        // The agglomerated ghost layer consists of the columns of other groups, in
+        // ascending order of their group and index
+        std::vector<std::pair<int, int>> ghost;
+
+        for(PtrType j = 0; j < agg_row_offset[agg_nrow]; ++j)
+        {
+            if(agg_col_group[j] != group)
+            {
+                ghost.push_back(std::make_pair(agg_col_group[j], agg_col_index[j]));
+            }
+        }
+
+        std::sort(ghost.begin(), ghost.end());
+        ghost.erase(std::unique(ghost.begin(), ghost.end()), ghost.end());
+
+        int ngstc = static_cast<int>(ghost.size());
+
+        // Split the rows into interior and ghost part, sorted by column
+        PtrType*   Ac_interior_row_offset = NULL;
+        int*       Ac_interior_col        = NULL;
+        ValueType* Ac_interior_val        = NULL;
+        PtrType*   Ac_ghost_row_offset    = NULL;
+        int*       Ac_ghost_col           = NULL;
+        ValueType* Ac_ghost_val           = NULL;
+
+        allocate_host(agg_nrow + 1, &Ac_interior_row_offset);
+        allocate_host(agg_nrow + 1, &Ac_ghost_row_offset);
+
+        Ac_interior_row_offset[0] = 0;
+        Ac_ghost_row_offset[0]    = 0;
+
+        for(int i = 0; i < agg_nrow; ++i)
+        {
+            PtrType nnz_gst = 0;
+
+            for(PtrType j = agg_row_offset[i]; j < agg_row_offset[i + 1]; ++j)
+            {
+                if(agg_col_group[j] != group)
+                {
+                    ++nnz_gst;
+                }
+            }
+
+            Ac_interior_row_offset[i + 1]
+                = Ac_interior_row_offset[i] + agg_row_offset[i + 1] - agg_row_offset[i] - nnz_gst;
+            Ac_ghost_row_offset[i + 1] = Ac_ghost_row_offset[i] + nnz_gst;
+        }
+
+        int nnzc = static_cast<int>(Ac_interior_row_offset[agg_nrow]);
+        int nnzg = static_cast<int>(Ac_ghost_row_offset[agg_nrow]);
+
+        allocate_host(nnzc, &Ac_interior_col);
+        allocate_host(nnzc, &Ac_interior_val);
+        allocate_host(nnzg, &Ac_ghost_col);
+        allocate_host(nnzg, &Ac_ghost_val);
+
+        for(int i = 0; i < agg_nrow; ++i)
+        {
+            std::vector<std::pair<int, PtrType>> int_row;
+            std::vector<std::pair<int, PtrType>> gst_row;
+
+            for(PtrType j = agg_row_offset[i]; j < agg_row_offset[i + 1]; ++j)
+            {
+                if(agg_col_group[j] == group)
+                {
+                    int_row.push_back(std::make_pair(agg_col_index[j], j));
+                }
+                else
+                {
+                    int col = static_cast<int>(
+                        std::lower_bound(ghost.begin(),
+                                         ghost.end(),
+                                         std::make_pair(agg_col_group[j], agg_col_index[j]))
+                        - ghost.begin());
+
+                    gst_row.push_back(std::make_pair(col, j));
+                }
+            }
+
+            std::sort(int_row.begin(), int_row.end());
+            std::sort(gst_row.begin(), gst_row.end());
+
+            for(size_t k = 0; k < int_row.size(); ++k)
+            {
+                Ac_interior_col[Ac_interior_row_offset[i] + k] = int_row[k].first;
+                Ac_interior_val[Ac_interior_row_offset[i] + k] = agg_val[int_row[k].second];
+            }
+
+            for(size_t k = 0; k < gst_row.size(); ++k)
+            {
+                Ac_ghost_col[Ac_ghost_row_offset[i] + k] = gst_row[k].first;
+                Ac_ghost_val[Ac_ghost_row_offset[i] + k] = agg_val[gst_row[k].second];
+            }
+        }
+
+        free_host(&agg_row_offset);
+
+        if(agg_col_group != NULL)
+        {
+            free_host(&agg_col_group);
+            free_host(&agg_col_index);
+            free_host(&agg_val);
+        }
+
+        // Receivers and the indices requested from them
+        int* recvs             = NULL;
+        int* recv_offset_index = NULL;
+
+        allocate_host(static_cast<int>(recv_groups.size()), &recvs);
+        allocate_host(static_cast<int>(recv_groups.size()) + 1, &recv_offset_index);
+
+        std::vector<int> request_size(recv_groups.size(), 0);
+        std::vector<int> request_index(ngstc);
+
+        int nrecv            = 0;
+        recv_offset_index[0] = 0;
+
+        for(size_t n = 0; n < recv_groups.size(); ++n)
+        {
+            int begin = recv_offset_index[nrecv];
+            int end   = begin;
+
+            while(end < ngstc && ghost[end].first == recv_groups[n])
+            {
+                request_index[end] = ghost[end].second;
+                ++end;
+            }
+
+            request_size[n] = end - begin;
+
+            // Groups without ghost columns are dropped
+            if(end > begin)
+            {
+                recvs[nrecv]                 = recv_groups[n];
+                recv_offset_index[nrecv + 1] = end;
+                ++nrecv;
+            }
+        }
+
+        assert(recv_offset_index[nrecv] == ngstc);
+
+        // Exchange the requested indices with the neighboring group leaders
+        std::vector<int> send_size(send_groups.size(), 0);
+
+        req.resize(recv_groups.size() + send_groups.size() + 1);
+        nreq = 0;
+
+        for(size_t n = 0; n < send_groups.size(); ++n)
+        {
+            communication_async_recv(
+                &send_size[n], 1, send_groups[n], 0, &req[nreq++], pm->comm_);
+        }
+
+        for(size_t n = 0; n < recv_groups.size(); ++n)
+        {
+            communication_async_send(
+                &request_size[n], 1, recv_groups[n], 0, &req[nreq++], pm->comm_);
+        }
+
+        if(nreq > 0)
+        {
+            communication_syncall(nreq, &req[0]);
+        }
+
+        int* sends             = NULL;
+        int* send_offset_index = NULL;
+
+        allocate_host(static_cast<int>(send_groups.size()), &sends);
+        allocate_host(static_cast<int>(send_groups.size()) + 1, &send_offset_index);
+
+        int nsend            = 0;
+        send_offset_index[0] = 0;
+
+        for(size_t n = 0; n < send_groups.size(); ++n)
+        {
+            if(send_size[n] > 0)
+            {
+                sends[nsend]                 = send_groups[n];
+                send_offset_index[nsend + 1] = send_offset_index[nsend] + send_size[n];
+                ++nsend;
+            }
+        }
+
+        std::vector<int> boundary_index(send_offset_index[nsend]);
+
+        nreq = 0;
+
+        for(int n = 0; n < nsend; ++n)
+        {
+            communication_async_recv(&boundary_index[send_offset_index[n]],
+                                     send_offset_index[n + 1] - send_offset_index[n],
+                                     sends[n],
+                                     0,
+                                     &req[nreq++],
+                                     pm->comm_);
+        }
+
+        for(int n = 0; n < nrecv; ++n)
+        {
+            communication_async_send(&request_index[recv_offset_index[n]],
+                                     recv_offset_index[n + 1] - recv_offset_index[n],
+                                     recvs[n],
+                                     0,
+                                     &req[nreq++],
+                                     pm->comm_);
+        }
+
+        if(nreq > 0)
+        {
+            communication_syncall(nreq, &req[0]);
+        }
+
+        // Parallel manager of the agglomerated matrix
+        pm->Clear();
+        pm->SetGlobalSize(this->pm_->global_size_);
+        pm->SetLocalSize(agg_nrow);
+
+        if(boundary_index.size() > 0)
+        {
+            pm->SetBoundaryIndex(static_cast<int>(boundary_index.size()), &boundary_index[0]);
+        }
+
+        if(nrecv > 0)
+        {
+            pm->SetReceivers(nrecv, recvs, recv_offset_index);
+        }
+
+        if(nsend > 0)
+        {
+            pm->SetSenders(nsend, sends, send_offset_index);
+        }
+
+        if(recvs != NULL)
+        {
+            free_host(&recvs);
+        }
+
+        if(sends != NULL)
+        {
+            free_host(&sends);
+        }
+
+        free_host(&recv_offset_index);
+        free_host(&send_offset_index);
+
+        // Allocate
+        agg->Clear();
+        bool isaccel = agg->is_accel_();
+        agg->MoveToHost();
+        agg->SetParallelManager(*pm);
+
+        if(nnzg > 0)
+        {
+            agg->SetDataPtrCSR(&Ac_interior_row_offset,
+                               &Ac_interior_col,
+                               &Ac_interior_val,
+                               &Ac_ghost_row_offset,
+                               &Ac_ghost_col,
+                               &Ac_ghost_val,
+                               "",
+                               nnzc,
+                               nnzg);
+        }
+        else
+        {
+            free_host(&Ac_ghost_row_offset);
+
+            agg->SetLocalDataPtrCSR(
+                &Ac_interior_row_offset, &Ac_interior_col, &Ac_interior_val, "", nnzc);
+        }
+
+        if(isaccel == true)
+        {
+            agg->MoveToAccelerator();
+        }
+#endif
+    }
+
     template class GlobalMatrix<double>;
     template class GlobalMatrix<float>;
 #ifdef SUPPORT_COMPLEX
@@ -25,6 +25,8 @@
 #define ROCALUTION_GLOBAL_MATRIX_HPP_
 
 #include "../utils/types.hpp"
+#include "local_vector.hpp"
+#include "matrix_formats.hpp"
 #include "operator.hpp"
 #include "parallel_manager.hpp"
 
@@ -105,10 +107,10 @@ namespace rocalution
         void SetParallelManager(const ParallelManager& pm);
 
         /** \brief Initialize a CSR matrix on the host with externally allocated data */
-        void SetDataPtrCSR(int**       local_row_offset,
+        void SetDataPtrCSR(PtrType**   local_row_offset,
                            int**       local_col,
                            ValueType** local_val,
-                           int**       ghost_row_offset,
+                           PtrType**   ghost_row_offset,
                            int**       ghost_col,
                            ValueType** ghost_val,
                            std::string name,
@@ -127,21 +129,21 @@ namespace rocalution
 
         /** \brief Initialize a CSR matrix on the host with externally allocated local data */
         void SetLocalDataPtrCSR(
-            int** row_offset, int** col, ValueType** val, std::string name, int nnz);
+            PtrType** row_offset, int** col, ValueType** val, std::string name, int nnz);
         /** \brief Initialize a COO matrix on the host with externally allocated local data */
         void SetLocalDataPtrCOO(int** row, int** col, ValueType** val, std::string name, int nnz);
 
         /** \brief Initialize a CSR matrix on the host with externally allocated ghost data */
         void SetGhostDataPtrCSR(
-            int** row_offset, int** col, ValueType** val, std::string name, int nnz);
+            PtrType** row_offset, int** col, ValueType** val, std::string name, int nnz);
         /** \brief Initialize a COO matrix on the host with externally allocated ghost data */
         void SetGhostDataPtrCOO(int** row, int** col, ValueType** val, std::string name, int nnz);
 
         /** \brief Leave a CSR matrix to host pointers */
-        void LeaveDataPtrCSR(int**       local_row_offset,
+        void LeaveDataPtrCSR(PtrType**   local_row_offset,
                              int**       local_col,
                              ValueType** local_val,
-                             int**       ghost_row_offset,
+                             PtrType**   ghost_row_offset,
                              int**       ghost_col,
                              ValueType** ghost_val);
         /** \brief Leave a COO matrix to host pointers */
@@ -152,11 +154,11 @@ namespace rocalution
                              int**       ghost_col,
                              ValueType** ghost_val);
         /** \brief Leave a local CSR matrix to host pointers */
-        void LeaveLocalDataPtrCSR(int** row_offset, int** col, ValueType** val);
+        void LeaveLocalDataPtrCSR(PtrType** row_offset, int** col, ValueType** val);
         /** \brief Leave a local COO matrix to host pointers */
         void LeaveLocalDataPtrCOO(int** row, int** col, ValueType** val);
         /** \brief Leave a CSR ghost matrix to host pointers */
-        void LeaveGhostDataPtrCSR(int** row_offset, int** col, ValueType** val);
+        void LeaveGhostDataPtrCSR(PtrType** row_offset, int** col, ValueType** val);
         /** \brief Leave a COO ghost matrix to host pointers */
         void LeaveGhostDataPtrCOO(int** row, int** col, ValueType** val);
 
@@ -197,8 +199,9 @@ namespace rocalution
         void WriteFileMTX(const std::string& filename) const;
         /** \brief Read matrix from CSR (ROCALUTION binary format) file */
         void ReadFileCSR(const std::string& filename);
-        /** \brief Write matrix to CSR (ROCALUTION binary format) file */
-        void WriteFileCSR(const std::string& filename) const;
+        /** \brief Write matrix to CSR (ROCALUTION binary format) file, see
+      * LocalMatrix::WriteFileCSR() for the available layouts */
+        void WriteFileCSR(const std::string& filename, unsigned int format = CSRFileStream) const;
 
         /** \brief Sort the matrix indices
       * \details
@@ -242,16 +245,162 @@ namespace rocalution
                              const int*               rG,
                              int                      rGsize) const;
 
+        /** \brief Strength of connection of the interior part for aggregation based AMG */
+        void AMGConnect(ValueType eps, LocalVector<int>* connections) const;
+        /** \brief Plain aggregation of the interior part, aggregates do not cross the process
+      * boundaries
+      */
+        void AMGAggregate(const LocalVector<int>& connections, LocalVector<int>* aggregates) const;
+        /** \brief Parallel maximal independent set aggregation of the interior part,
+      * aggregates do not cross the process boundaries
+      */
+        void AMGPMISAggregate(const LocalVector<int>& connections,
+                              LocalVector<int>*       aggregates) const;
+        /** \brief Smoothed aggregation interpolation of the interior part, couplings to the
+      * ghost layer are lumped into the diagonal
+      */
+        void AMGSmoothedAggregation(ValueType               relax,
+                                    const LocalVector<int>& aggregates,
+                                    const LocalVector<int>& connections,
+                                    LocalMatrix<ValueType>* prolong,
+                                    LocalMatrix<ValueType>* restrict,
+                                    int lumping_strat = 0) const;
+        /** \brief Aggregation-based interpolation of the interior part */
+        void AMGAggregation(const LocalVector<int>& aggregates,
+                            LocalMatrix<ValueType>* prolong,
+                            LocalMatrix<ValueType>* restrict) const;
+
+        /** \brief Ruge Stueben coarsening of the interior part */
+        void RSCoarsening(float eps, LocalVector<int>* CFmap, LocalVector<bool>* S) const;
+        /** \brief Parallel maximal independent set coarsening for RS AMG
+      * \details
+      * The strong influences across the process boundaries take part in the coarsening.
+      * The C/F map is returned for the interior part, the strong influences \p S for the
+      * interior part followed by those of the ghost part.
+      */
+        void RSPMISCoarsening(float eps, LocalVector<int>* CFmap, LocalVector<bool>* S) const;
+
+        /** \brief Ruge Stueben Direct Interpolation across the process boundaries
+      * \details
+      * Fine points interpolate from the coarse points of the ghost layer as well. The
+      * columns of \p prolong are the local coarse points, followed by the coarse points
+      * of the ghost layer. \p map holds the column of each local point, followed by the
+      * column of each ghost point, -1 for fine points. \p S holds the strong influences
+      * of the interior part, optionally followed by those of the ghost part.
+      */
+        void RSDirectInterpolation(const LocalVector<int>&  CFmap,
+                                   const LocalVector<bool>& S,
+                                   LocalMatrix<ValueType>*  prolong,
+                                   LocalMatrix<ValueType>* restrict,
+                                   LocalVector<int>*        map) const;
+        /** \brief Ruge Stueben Ext+i Interpolation across the process boundaries
+      * \details
+      * The rows of the ghost layer are exchanged with the neighboring processes, such
+      * that fine points interpolate from the coarse points of the ghost layer as well,
+      * including those reached through fine points of the ghost layer. Coarse points
+      * beyond the ghost layer are left out. \p prolong and \p map are laid out as for
+      * RSDirectInterpolation().
+      */
+        void RSExtPIInterpolation(const LocalVector<int>&  CFmap,
+                                  const LocalVector<bool>& S,
+                                  bool                     FF1,
+                                  float                    trunc,
+                                  LocalMatrix<ValueType>*  prolong,
+                                  LocalMatrix<ValueType>* restrict,
+                                  LocalVector<int>*        map) const;
+
+        /** \brief Build the Galerkin product Ac = R A P
+      * \details
+      * \p prolong maps the coarse points to the local rows of this matrix. Its columns
+      * are the local coarse points, optionally followed by coarse points of the ghost
+      * layer, as described by \p map (see RSDirectInterpolation()). An empty \p map
+      * denotes a prolongation without ghost columns. The rows of \p prolong that belong
+      * to the ghost layer are exchanged with the neighboring processes and the rows of
+      * \p Ac, that belong to coarse points of the ghost layer, are sent to their owners,
+      * to build the ghost part of \p Ac and its parallel manager \p pm. Couplings to
+      * coarse points of processes, that are not neighbors on this level, are lumped into
+      * the diagonal.
+      */
+        void CoarsenOperator(GlobalMatrix<ValueType>*      Ac,
+                             ParallelManager*              pm,
+                             const LocalMatrix<ValueType>& restrict,
+                             const LocalMatrix<ValueType>& prolong,
+                             const LocalVector<int>&       map) const;
+
+        // Restriction with a prolongation, that has ghost columns: the entries of ext
+        // beyond the local coarse points are added to coarse on the owners of the coarse
+        // points, map is laid out as for RSDirectInterpolation()
+        /** \private */
+        void RestrictCoarseGhost(const LocalVector<int>&       map,
+                                 const LocalVector<ValueType>& ext,
+                                 LocalVector<ValueType>*       coarse) const;
+        // Extend coarse by the values of the coarse points of the ghost layer into ext,
+        // for the prolongation with ghost columns
+        /** \private */
+        void ProlongCoarseGhost(const LocalVector<int>&       map,
+                                const LocalVector<ValueType>& coarse,
+                                LocalVector<ValueType>*       ext) const;
+
+        /** \brief Gather this matrix onto fewer processes
+      * \details
+      * The local parts of each group of processes of the agglomerated parallel manager
+      * \p pm are gathered by the group leader into \p agg. The ghost part of \p agg and
+      * the boundary of \p pm are rebuilt on the communicator of the group leaders. On all
+      * other processes, \p agg remains empty.
+      */
+        void Agglomerate(ParallelManager* pm, GlobalMatrix<ValueType>* agg) const;
+
     protected:
         virtual bool is_host_(void) const;
         virtual bool is_accel_(void) const;
 
     private:
+        // Copy of the interior part in CSR format, with the row sums of the ghost part
+        // added to the diagonal
+        void LumpGhostToDiagonal_(LocalMatrix<ValueType>* mat) const;
+
+        // Interior part followed by the ghost part in a square host CSR matrix over the
+        // local and the ghost points, with the C/F map and the strong influences of all
+        // entries. With ghost_rows set, the rows of the ghost points are received from
+        // their owners, restricted to local and ghost points, otherwise they are empty.
+        void RSExtend_(const LocalVector<int>&  CFmap,
+                       const LocalVector<bool>& S,
+                       bool                     ghost_rows,
+                       LocalMatrix<ValueType>*  A,
+                       LocalVector<int>*        CF,
+                       LocalVector<bool>*       strong) const;
+        // Rows of the local points of the interpolation P of the extended matrix, see
+        // RSDirectInterpolation()
+        void RSRestrictToLocal_(const LocalVector<int>&       CF,
+                                const LocalMatrix<ValueType>& P,
+                                LocalMatrix<ValueType>*       prolong,
+                                LocalMatrix<ValueType>* restrict,
+                                LocalVector<int>*             map) const;
+
+        // Split the interior rows into rows without and rows with entries in the ghost
+        // part, for the overlapped Apply() and ApplyAdd()
+        void SplitRows_(void) const;
+        // out = scalar*this*in, added to out if add is set, computing the rows without ghost
+        // entries while the ghost values are exchanged, returns false if the interior part
+        // is not stored in host CSR format
+        bool ApplyOverlapped_(const GlobalVector<ValueType>& in,
+                              ValueType                      scalar,
+                              bool                           add,
+                              GlobalVector<ValueType>*       out) const;
+
         IndexType2 nnz_;
 
         LocalMatrix<ValueType> matrix_interior_;
         LocalMatrix<ValueType> matrix_ghost_;
 
+        // Interior rows without entries in the ghost part, rows with entries in the ghost
+        // part and the offsets of their entries in the row sorted COO ghost part, built on
+        // first use by Apply() and reset whenever the ghost part changes
+        mutable bool             row_split_;
+        mutable LocalVector<int> inner_rows_;
+        mutable LocalVector<int> halo_rows_;
+        mutable LocalVector<int> halo_ghost_offset_;
+
         friend class GlobalVector<ValueType>;
         friend class LocalMatrix<ValueType>;
         friend class LocalVector<ValueType>;
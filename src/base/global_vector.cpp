@@ -25,6 +25,7 @@
 #include "../utils/allocate_free.hpp"
 #include "../utils/def.hpp"
 #include "../utils/log.hpp"
+#include "../utils/profiler.hpp"
 #include "local_vector.hpp"
 
 #ifdef SUPPORT_MULTINODE
@@ -37,6 +38,7 @@
 #include <limits>
 #include <math.h>
 #include <sstream>
+#include <vector>
 
 namespace rocalution
 {
@@ -59,7 +61,10 @@ namespace rocalution
 #ifdef SUPPORT_MULTINODE
         this->recv_event_ = NULL;
         this->send_event_ = NULL;
+        this->dot_event_  = NULL;
 #endif
+
+        this->dot_buffer_ = NULL;
     }
 
     template <typename ValueType>
@@ -79,7 +84,10 @@ namespace rocalution
 #ifdef SUPPORT_MULTINODE
         this->recv_event_ = new MRequest[pm.nrecv_];
         this->send_event_ = new MRequest[pm.nsend_];
+        this->dot_event_  = NULL;
 #endif
+
+        this->dot_buffer_ = NULL;
     }
 
     template <typename ValueType>
@@ -101,7 +109,18 @@ namespace rocalution
             delete[] this->send_event_;
             this->send_event_ = NULL;
         }
+
+        if(this->dot_event_ != NULL)
+        {
+            delete this->dot_event_;
+            this->dot_event_ = NULL;
+        }
 #endif
+
+        if(this->dot_buffer_ != NULL)
+        {
+            free_host(&this->dot_buffer_);
+        }
     }
 
     template <typename ValueType>
@@ -204,8 +223,12 @@ namespace rocalution
         this->vector_interior_.Allocate(interior_name, this->pm_->GetLocalSize());
         this->vector_ghost_.Allocate(ghost_name, this->pm_->GetNumReceivers());
 
-        this->vector_interior_.SetIndexArray(this->pm_->GetNumSenders(),
-                                             this->pm_->boundary_index_);
+        // Processes without neighbors have no boundary
+        if(this->pm_->GetNumSenders() > 0)
+        {
+            this->vector_interior_.SetIndexArray(this->pm_->GetNumSenders(),
+                                                 this->pm_->boundary_index_);
+        }
 
         // Allocate send and receive buffer
         allocate_host(this->pm_->GetNumReceivers(), &this->recv_boundary_);
@@ -269,8 +292,12 @@ namespace rocalution
         this->vector_interior_.SetDataPtr(ptr, interior_name, this->pm_->local_size_);
         this->vector_ghost_.Allocate(ghost_name, this->pm_->GetNumReceivers());
 
-        this->vector_interior_.SetIndexArray(this->pm_->GetNumSenders(),
-                                             this->pm_->boundary_index_);
+        // Processes without neighbors have no boundary
+        if(this->pm_->GetNumSenders() > 0)
+        {
+            this->vector_interior_.SetIndexArray(this->pm_->GetNumSenders(),
+                                                 this->pm_->boundary_index_);
+        }
 
         // Allocate send and receive buffer
         allocate_host(this->pm_->GetNumReceivers(), &this->recv_boundary_);
@@ -287,8 +314,15 @@ namespace rocalution
 
         this->vector_interior_.LeaveDataPtr(ptr);
 
-        free_host(&this->recv_boundary_);
-        free_host(&this->send_boundary_);
+        if(this->recv_boundary_ != NULL)
+        {
+            free_host(&this->recv_boundary_);
+        }
+
+        if(this->send_boundary_ != NULL)
+        {
+            free_host(&this->send_boundary_);
+        }
 
         this->vector_ghost_.Clear();
     }
@@ -319,8 +353,7 @@ namespace rocalution
 
         assert(this != &src);
         assert(this->pm_ == src.pm_);
-        assert(this->recv_boundary_ != NULL);
-        assert(this->send_boundary_ != NULL);
+        assert(this->vector_interior_.GetSize() == src.vector_interior_.GetSize());
 
         this->vector_interior_.CopyFrom(src.vector_interior_);
     }
@@ -462,8 +495,12 @@ namespace rocalution
 
         this->object_name_ = filename;
 
-        this->vector_interior_.SetIndexArray(this->pm_->GetNumSenders(),
-                                             this->pm_->boundary_index_);
+        // Processes without neighbors have no boundary
+        if(this->pm_->GetNumSenders() > 0)
+        {
+            this->vector_interior_.SetIndexArray(this->pm_->GetNumSenders(),
+                                                 this->pm_->boundary_index_);
+        }
 
         // Allocate ghost vector
         this->vector_ghost_.Allocate("ghost", this->pm_->GetNumReceivers());
@@ -558,8 +595,12 @@ namespace rocalution
 
         this->object_name_ = filename;
 
-        this->vector_interior_.SetIndexArray(this->pm_->GetNumSenders(),
-                                             this->pm_->boundary_index_);
+        // Processes without neighbors have no boundary
+        if(this->pm_->GetNumSenders() > 0)
+        {
+            this->vector_interior_.SetIndexArray(this->pm_->GetNumSenders(),
+                                                 this->pm_->boundary_index_);
+        }
 
         // Allocate ghost vector
         this->vector_ghost_.Allocate("ghost", this->pm_->GetNumReceivers());
@@ -663,6 +704,8 @@ namespace rocalution
     {
         log_debug(this, "GlobalVector::Dot()", (const void*&)x);
 
+        ProfilerRegion region("GlobalVector::Dot");
+
         ValueType local = this->vector_interior_.Dot(x.vector_interior_);
         ValueType global;
 
@@ -680,6 +723,8 @@ namespace rocalution
     {
         log_debug(this, "GlobalVector::DotNonConj()", (const void*&)x);
 
+        ProfilerRegion region("GlobalVector::DotNonConj");
+
         ValueType local = this->vector_interior_.DotNonConj(x.vector_interior_);
         ValueType global;
 
@@ -692,11 +737,153 @@ namespace rocalution
         return global;
     }
 
+    template <typename ValueType>
+    void GlobalVector<ValueType>::MDot(int                                   count,
+                                       const GlobalVector<ValueType>* const* x,
+                                       ValueType*                            result) const
+    {
+        log_debug(this, "GlobalVector::MDot()", count, x, result);
+
+        ProfilerRegion region("GlobalVector::MDot");
+
+        assert(count >= 0);
+        assert(result != NULL);
+
+        if(count == 0)
+        {
+            return;
+        }
+
+        assert(x != NULL);
+
+        std::vector<const LocalVector<ValueType>*> xv(count);
+
+        for(int i = 0; i < count; ++i)
+        {
+            assert(x[i] != NULL);
+
+            xv[i] = &x[i]->vector_interior_;
+        }
+
+#ifdef SUPPORT_MULTINODE
+        // Local partial results, reduced with a single collective
+        ValueType* local = NULL;
+        allocate_host(count, &local);
+
+        this->vector_interior_.MDot(count, xv.data(), local);
+
+        MRequest request;
+
+        communication_async_allreduce_sum(local, result, count, &request, this->pm_->comm_);
+        communication_syncall(1, &request);
+
+        free_host(&local);
+#else
+        this->vector_interior_.MDot(count, xv.data(), result);
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalVector<ValueType>::MAXPY(int                                   count,
+                                        const GlobalVector<ValueType>* const* x,
+                                        const ValueType*                      alpha)
+    {
+        log_debug(this, "GlobalVector::MAXPY()", count, x, alpha);
+
+        assert(count >= 0);
+
+        if(count == 0)
+        {
+            return;
+        }
+
+        assert(x != NULL);
+
+        std::vector<const LocalVector<ValueType>*> xv(count);
+
+        for(int i = 0; i < count; ++i)
+        {
+            assert(x[i] != NULL);
+
+            xv[i] = &x[i]->vector_interior_;
+        }
+
+        this->vector_interior_.MAXPY(count, xv.data(), alpha);
+    }
+
+    template <typename ValueType>
+    void GlobalVector<ValueType>::DotAsync(int                                   count,
+                                           const GlobalVector<ValueType>* const* x,
+                                           const GlobalVector<ValueType>* const* y,
+                                           ValueType*                            result)
+    {
+        log_debug(this, "GlobalVector::DotAsync()", count, x, y, result);
+
+        assert(count >= 0);
+        assert(x != NULL);
+        assert(y != NULL);
+        assert(result != NULL);
+
+        // Only one batch can be in flight
+        assert(this->dot_buffer_ == NULL);
+
+        if(count == 0)
+        {
+            return;
+        }
+
+        allocate_host(count, &this->dot_buffer_);
+
+        // Local partial results
+        for(int i = 0; i < count; ++i)
+        {
+            assert(x[i] != NULL);
+            assert(y[i] != NULL);
+
+            this->dot_buffer_[i] = x[i]->vector_interior_.Dot(y[i]->vector_interior_);
+        }
+
+#ifdef SUPPORT_MULTINODE
+        if(this->dot_event_ == NULL)
+        {
+            this->dot_event_ = new MRequest;
+        }
+
+        communication_async_allreduce_sum(
+            this->dot_buffer_, result, count, this->dot_event_, this->pm_->comm_);
+#else
+        for(int i = 0; i < count; ++i)
+        {
+            result[i] = this->dot_buffer_[i];
+        }
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalVector<ValueType>::DotSync(void)
+    {
+        log_debug(this, "GlobalVector::DotSync()");
+
+        // Nothing pending
+        if(this->dot_buffer_ == NULL)
+        {
+            return;
+        }
+
+#ifdef SUPPORT_MULTINODE
+        communication_syncall(1, this->dot_event_);
+#endif
+
+        free_host(&this->dot_buffer_);
+    }
+
     template <typename ValueType>
     ValueType GlobalVector<ValueType>::Norm(void) const
     {
         log_debug(this, "GlobalVector::Norm()");
 
+        ProfilerRegion region("GlobalVector::Norm");
+
         ValueType result = this->Dot(*this);
         return sqrt(result);
     }
@@ -706,6 +893,8 @@ namespace rocalution
     {
         log_debug(this, "GlobalVector::Reduce()");
 
+        ProfilerRegion region("GlobalVector::Reduce");
+
         ValueType local = this->vector_interior_.Reduce();
         ValueType global;
 
@@ -787,7 +976,10 @@ namespace rocalution
         }
 
         // prepare send buffer
-        in.vector_interior_.GetIndexValues(this->send_boundary_);
+        if(this->pm_->GetNumSenders() > 0)
+        {
+            in.vector_interior_.GetIndexValues(this->send_boundary_);
+        }
 
         // async send boundary to neighbors
         for(int i = 0; i < this->pm_->nsend_; ++i)
@@ -812,6 +1004,21 @@ namespace rocalution
         log_debug(this, "GlobalVector::UpdateGhostValuesAsync_()", "#*# end");
     }
 
+    template <typename ValueType>
+    bool GlobalVector<ValueType>::UpdateGhostValuesTest_(void)
+    {
+        log_debug(this, "GlobalVector::UpdateGhostValuesTest_()");
+
+        bool done = true;
+
+#ifdef SUPPORT_MULTINODE
+        done = communication_testall(this->pm_->nrecv_, this->recv_event_);
+        done = communication_testall(this->pm_->nsend_, this->send_event_) && done;
+#endif
+
+        return done;
+    }
+
     template <typename ValueType>
     void GlobalVector<ValueType>::UpdateGhostValuesSync_(void)
     {
@@ -822,8 +1029,11 @@ namespace rocalution
         communication_syncall(this->pm_->nrecv_, this->recv_event_);
         communication_syncall(this->pm_->nsend_, this->send_event_);
 
-        this->vector_ghost_.SetContinuousValues(
-            0, this->pm_->GetNumReceivers(), this->recv_boundary_);
+        if(this->pm_->GetNumReceivers() > 0)
+        {
+            this->vector_ghost_.SetContinuousValues(
+                0, this->pm_->GetNumReceivers(), this->recv_boundary_);
+        }
 #endif
 
         log_debug(this, "GlobalVector::UpdateGhostValuesSync_()", "#*# end");
@@ -841,12 +1051,25 @@ namespace rocalution
     void GlobalVector<ValueType>::Restriction(const GlobalVector<ValueType>& vec_fine,
                                               const LocalVector<int>&        map)
     {
+        log_debug(this, "GlobalVector::Restriction()", (const void*&)vec_fine, (const void*&)map);
+
+        assert(&vec_fine != this);
+        assert(map.GetSize() == vec_fine.GetLocalSize());
+
+        this->vector_interior_.Restriction(vec_fine.vector_interior_, map);
     }
 
     template <typename ValueType>
     void GlobalVector<ValueType>::Prolongation(const GlobalVector<ValueType>& vec_coarse,
                                                const LocalVector<int>&        map)
     {
+        log_debug(
+            this, "GlobalVector::Prolongation()", (const void*&)vec_coarse, (const void*&)map);
+
+        assert(&vec_coarse != this);
+        assert(map.GetSize() == this->GetLocalSize());
+
+        this->vector_interior_.Prolongation(vec_coarse.vector_interior_, map);
     }
 
     template <typename ValueType>
@@ -125,6 +125,10 @@ namespace rocalution
         virtual void      Scale(ValueType alpha);
         virtual ValueType Dot(const GlobalVector<ValueType>& x) const;
         virtual ValueType DotNonConj(const GlobalVector<ValueType>& x) const;
+        virtual void
+            MDot(int count, const GlobalVector<ValueType>* const* x, ValueType* result) const;
+        virtual void
+            MAXPY(int count, const GlobalVector<ValueType>* const* x, const ValueType* alpha);
         virtual ValueType Norm(void) const;
         virtual ValueType Reduce(void) const;
         virtual ValueType Asum(void) const;
@@ -135,10 +139,35 @@ namespace rocalution
 
         virtual void Power(double power);
 
-        /** \brief Restriction operator based on restriction mapping vector */
+        /** \brief Start a batch of dot products
+          * \details
+          * Computes \f$result_{i} = x_{i}^{H} y_{i}\f$, for \f$i = 0, \dots, count - 1\f$.
+          * All partial results are reduced with a single non-blocking collective, which
+          * allows overlapping the reduction with other work. The results are only valid
+          * after DotSync() has been called on this vector. Only one batch can be pending
+          * per vector at a time.
+          */
+        void DotAsync(int                                   count,
+                      const GlobalVector<ValueType>* const* x,
+                      const GlobalVector<ValueType>* const* y,
+                      ValueType*                            result);
+        /** \brief Wait for the dot products started by DotAsync() */
+        void DotSync(void);
+
+        /** \brief Restriction operator based on restriction mapping vector
+      * \details
+      * \p map assigns each point of the interior part of \p vec_fine a point of the
+      * interior part of this vector, or -1. Coarse points are local to each process, such
+      * that no communication is required.
+      */
         void Restriction(const GlobalVector<ValueType>& vec_fine, const LocalVector<int>& map);
 
-        /** \brief Prolongation operator based on restriction mapping vector */
+        /** \brief Prolongation operator based on restriction mapping vector
+      * \details
+      * \p map assigns each point of the interior part of this vector a point of the
+      * interior part of \p vec_coarse, or -1. Coarse points are local to each process,
+      * such that no communication is required.
+      */
         void Prolongation(const GlobalVector<ValueType>& vec_coarse, const LocalVector<int>& map);
 
     protected:
@@ -147,12 +176,18 @@ namespace rocalution
 
         /** \brief Update ghost values asynchronously */
         void UpdateGhostValuesAsync_(const GlobalVector<ValueType>& in);
+        /** \brief Progress the asynchronous ghost value update, returns true once all
+      * messages have been completed */
+        bool UpdateGhostValuesTest_(void);
         /** \brief Update ghost values synchronously */
         void UpdateGhostValuesSync_(void);
 
     private:
         MRequest* recv_event_;
         MRequest* send_event_;
+        MRequest* dot_event_;
+
+        ValueType* dot_buffer_;
 
         ValueType* recv_boundary_;
         ValueType* send_boundary_;
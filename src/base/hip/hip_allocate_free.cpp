@@ -38,7 +38,7 @@ namespace rocalution
 
 #ifdef ROCALUTION_HIP_PINNED_MEMORY
     template <typename DataType>
-    void allocate_host(int size, DataType** ptr)
+    void allocate_host(int64_t size, DataType** ptr)
     {
         log_debug(0, "allocate_host()", size, ptr);
 
@@ -132,16 +132,17 @@ namespace rocalution
     }
 
 #ifdef ROCALUTION_HIP_PINNED_MEMORY
-    template void allocate_host<float>(int size, float** ptr);
-    template void allocate_host<double>(int size, double** ptr);
+    template void allocate_host<float>(int64_t size, float** ptr);
+    template void allocate_host<double>(int64_t size, double** ptr);
 #ifdef SUPPORT_COMPLEX
-    template void allocate_host<std::complex<float>>(int size, std::complex<float>** ptr);
-    template void allocate_host<std::complex<double>>(int size, std::complex<double>** ptr);
+    template void allocate_host<std::complex<float>>(int64_t size, std::complex<float>** ptr);
+    template void allocate_host<std::complex<double>>(int64_t size, std::complex<double>** ptr);
 #endif
-    template void allocate_host<bool>(int size, bool** ptr);
-    template void allocate_host<int>(int size, int** ptr);
-    template void allocate_host<unsigned int>(int size, unsigned int** ptr);
-    template void allocate_host<char>(int size, char** ptr);
+    template void allocate_host<bool>(int64_t size, bool** ptr);
+    template void allocate_host<int>(int64_t size, int** ptr);
+    template void allocate_host<unsigned int>(int64_t size, unsigned int** ptr);
+    template void allocate_host<int64_t>(int64_t size, int64_t** ptr);
+    template void allocate_host<char>(int64_t size, char** ptr);
 
     template void free_host<float>(float** ptr);
     template void free_host<double>(double** ptr);
@@ -152,6 +153,7 @@ namespace rocalution
     template void free_host<bool>(bool** ptr);
     template void free_host<int>(int** ptr);
     template void free_host<unsigned int>(unsigned int** ptr);
+    template void free_host<int64_t>(int64_t** ptr);
     template void free_host<char>(char** ptr);
 #endif
 
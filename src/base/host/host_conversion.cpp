@@ -25,10 +25,13 @@
 #include "../../utils/allocate_free.hpp"
 #include "../../utils/def.hpp"
 #include "../../utils/log.hpp"
+#include "../../utils/types.hpp"
 #include "../matrix_formats.hpp"
 #include "../matrix_formats_ind.hpp"
 
+#include <algorithm>
 #include <complex>
+#include <limits>
 #include <stdlib.h>
 
 #ifdef _OPENMP
@@ -40,13 +43,13 @@
 namespace rocalution
 {
 
-    template <typename ValueType, typename IndexType>
-    bool csr_to_dense(int                                    omp_threads,
-                      IndexType                              nnz,
-                      IndexType                              nrow,
-                      IndexType                              ncol,
-                      const MatrixCSR<ValueType, IndexType>& src,
-                      MatrixDENSE<ValueType>*                dst)
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool csr_to_dense(int                                                 omp_threads,
+                      PointerType                                         nnz,
+                      IndexType                                           nrow,
+                      IndexType                                           ncol,
+                      const MatrixCSR<ValueType, IndexType, PointerType>& src,
+                      MatrixDENSE<ValueType>*                             dst)
     {
         assert(nnz > 0);
         assert(nrow > 0);
@@ -62,7 +65,7 @@ namespace rocalution
 #endif
         for(IndexType i = 0; i < nrow; ++i)
         {
-            for(IndexType j = src.row_offset[i]; j < src.row_offset[i + 1]; ++j)
+            for(PointerType j = src.row_offset[i]; j < src.row_offset[i + 1]; ++j)
             {
                 dst->val[DENSE_IND(i, src.col[j], nrow, ncol)] = src.val[j];
             }
@@ -71,13 +74,13 @@ namespace rocalution
         return true;
     }
 
-    template <typename ValueType, typename IndexType>
-    bool dense_to_csr(int                              omp_threads,
-                      IndexType                        nrow,
-                      IndexType                        ncol,
-                      const MatrixDENSE<ValueType>&    src,
-                      MatrixCSR<ValueType, IndexType>* dst,
-                      IndexType*                       nnz)
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool dense_to_csr(int                                           omp_threads,
+                      IndexType                                     nrow,
+                      IndexType                                     ncol,
+                      const MatrixDENSE<ValueType>&                 src,
+                      MatrixCSR<ValueType, IndexType, PointerType>* dst,
+                      PointerType*                                  nnz)
     {
         assert(nrow > 0);
         assert(ncol > 0);
@@ -104,7 +107,7 @@ namespace rocalution
         *nnz = 0;
         for(IndexType i = 0; i < nrow; ++i)
         {
-            IndexType tmp      = dst->row_offset[i];
+            PointerType tmp    = dst->row_offset[i];
             dst->row_offset[i] = *nnz;
             *nnz += tmp;
         }
@@ -122,7 +125,7 @@ namespace rocalution
 #endif
         for(IndexType i = 0; i < nrow; ++i)
         {
-            IndexType ind = dst->row_offset[i];
+            PointerType ind = dst->row_offset[i];
 
             for(IndexType j = 0; j < ncol; ++j)
             {
@@ -138,13 +141,13 @@ namespace rocalution
         return true;
     }
 
-    template <typename ValueType, typename IndexType>
-    bool csr_to_mcsr(int                                    omp_threads,
-                     IndexType                              nnz,
-                     IndexType                              nrow,
-                     IndexType                              ncol,
-                     const MatrixCSR<ValueType, IndexType>& src,
-                     MatrixMCSR<ValueType, IndexType>*      dst)
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool csr_to_mcsr(int                                                 omp_threads,
+                     PointerType                                         nnz,
+                     IndexType                                           nrow,
+                     IndexType                                           ncol,
+                     const MatrixCSR<ValueType, IndexType, PointerType>& src,
+                     MatrixMCSR<ValueType, IndexType>*                   dst)
     {
         assert(nnz > 0);
         assert(nrow > 0);
@@ -156,6 +159,12 @@ namespace rocalution
             return false;
         }
 
+        // Format is limited to IndexType non-zero entries
+        if(nnz > std::numeric_limits<IndexType>::max())
+        {
+            return false;
+        }
+
         omp_set_num_threads(omp_threads);
 
         // Pre-analysing step to check zero diagonal entries
@@ -163,7 +172,7 @@ namespace rocalution
 
         for(int i = 0; i < nrow; ++i)
         {
-            for(int j = src.row_offset[i]; j < src.row_offset[i + 1]; ++j)
+            for(PointerType j = src.row_offset[i]; j < src.row_offset[i + 1]; ++j)
             {
                 if(i == src.col[j])
                 {
@@ -190,7 +199,7 @@ namespace rocalution
 
         for(IndexType ai = 0; ai < nrow + 1; ++ai)
         {
-            dst->row_offset[ai] = nrow + src.row_offset[ai] - ai;
+            dst->row_offset[ai] = static_cast<IndexType>(nrow + src.row_offset[ai] - ai);
         }
 
 #ifdef _OPENMP
@@ -199,7 +208,7 @@ namespace rocalution
         for(IndexType ai = 0; ai < nrow; ++ai)
         {
             IndexType correction = ai;
-            for(IndexType aj = src.row_offset[ai]; aj < src.row_offset[ai + 1]; ++aj)
+            for(PointerType aj = src.row_offset[ai]; aj < src.row_offset[ai + 1]; ++aj)
             {
                 if(ai != src.col[aj])
                 {
@@ -226,13 +235,13 @@ namespace rocalution
         return true;
     }
 
-    template <typename ValueType, typename IndexType>
-    bool mcsr_to_csr(int                                     omp_threads,
-                     IndexType                               nnz,
-                     IndexType                               nrow,
-                     IndexType                               ncol,
-                     const MatrixMCSR<ValueType, IndexType>& src,
-                     MatrixCSR<ValueType, IndexType>*        dst)
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool mcsr_to_csr(int                                           omp_threads,
+                     PointerType                                   nnz,
+                     IndexType                                     nrow,
+                     IndexType                                     ncol,
+                     const MatrixMCSR<ValueType, IndexType>&       src,
+                     MatrixCSR<ValueType, IndexType, PointerType>* dst)
     {
         assert(nnz > 0);
         assert(nrow > 0);
@@ -293,9 +302,9 @@ namespace rocalution
 #endif
         for(IndexType i = 0; i < nrow; ++i)
         {
-            for(IndexType j = dst->row_offset[i]; j < dst->row_offset[i + 1]; ++j)
+            for(PointerType j = dst->row_offset[i]; j < dst->row_offset[i + 1]; ++j)
             {
-                for(IndexType jj = dst->row_offset[i]; jj < dst->row_offset[i + 1] - 1; ++jj)
+                for(PointerType jj = dst->row_offset[i]; jj < dst->row_offset[i + 1] - 1; ++jj)
                 {
                     if(dst->col[jj] > dst->col[jj + 1])
                     {
@@ -316,18 +325,24 @@ namespace rocalution
         return true;
     }
 
-    template <typename ValueType, typename IndexType>
-    bool csr_to_bcsr(int                                    omp_threads,
-                     IndexType                              nnz,
-                     IndexType                              nrow,
-                     IndexType                              ncol,
-                     const MatrixCSR<ValueType, IndexType>& src,
-                     MatrixBCSR<ValueType, IndexType>*      dst)
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool csr_to_bcsr(int                                                 omp_threads,
+                     PointerType                                         nnz,
+                     IndexType                                           nrow,
+                     IndexType                                           ncol,
+                     const MatrixCSR<ValueType, IndexType, PointerType>& src,
+                     MatrixBCSR<ValueType, IndexType>*                   dst)
     {
         assert(nnz > 0);
         assert(nrow > 0);
         assert(ncol > 0);
 
+        // Format is limited to IndexType non-zero entries
+        if(nnz > std::numeric_limits<IndexType>::max())
+        {
+            return false;
+        }
+
         IndexType blockdim = dst->blockdim;
 
         assert(blockdim > 1);
@@ -374,11 +389,11 @@ namespace rocalution
                         break;
                     }
 
-                    IndexType csr_row_begin = src.row_offset[csr_i + i];
-                    IndexType csr_row_end   = src.row_offset[csr_i + i + 1];
+                    PointerType csr_row_begin = src.row_offset[csr_i + i];
+                    PointerType csr_row_end   = src.row_offset[csr_i + i + 1];
 
                     // Loop over CSR columns for each of the rows in the block
-                    for(IndexType csr_j = csr_row_begin; csr_j < csr_row_end; ++csr_j)
+                    for(PointerType csr_j = csr_row_begin; csr_j < csr_row_end; ++csr_j)
                     {
                         // Block column index
                         IndexType bcsr_j = src.col[csr_j] / blockdim;
@@ -451,11 +466,11 @@ namespace rocalution
                         break;
                     }
 
-                    IndexType csr_row_begin = src.row_offset[csr_i + i];
-                    IndexType csr_row_end   = src.row_offset[csr_i + i + 1];
+                    PointerType csr_row_begin = src.row_offset[csr_i + i];
+                    PointerType csr_row_end   = src.row_offset[csr_i + i + 1];
 
                     // Loop over CSR columns for each of the rows in the block
-                    for(IndexType csr_j = csr_row_begin; csr_j < csr_row_end; ++csr_j)
+                    for(PointerType csr_j = csr_row_begin; csr_j < csr_row_end; ++csr_j)
                     {
                         // CSR column index
                         IndexType csr_col = src.col[csr_j];
@@ -525,13 +540,13 @@ namespace rocalution
         return true;
     }
 
-    template <typename ValueType, typename IndexType>
-    bool bcsr_to_csr(int                                     omp_threads,
-                     IndexType                               nnz,
-                     IndexType                               nrow,
-                     IndexType                               ncol,
-                     const MatrixBCSR<ValueType, IndexType>& src,
-                     MatrixCSR<ValueType, IndexType>*        dst)
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool bcsr_to_csr(int                                           omp_threads,
+                     PointerType                                   nnz,
+                     IndexType                                     nrow,
+                     IndexType                                     ncol,
+                     const MatrixBCSR<ValueType, IndexType>&       src,
+                     MatrixCSR<ValueType, IndexType, PointerType>* dst)
     {
         assert(nnz > 0);
         assert(nrow > 0);
@@ -545,6 +560,9 @@ namespace rocalution
 
         dst->row_offset[0] = 0;
 
+        // Number of values per block
+        IndexType blocksize = src.blockdim * src.blockdim;
+
         IndexType idx = 0;
         for(IndexType i = 0; i < src.nrowb; ++i)
         {
@@ -557,7 +575,7 @@ namespace rocalution
                     for(IndexType c = 0; c < src.blockdim; ++c)
                     {
                         dst->col[idx] = src.blockdim * src.col[k] + c;
-                        dst->val[idx] = src.val[BCSR_IND(k, c, r, src.blockdim)];
+                        dst->val[idx] = src.val[BCSR_IND(blocksize * k, r, c, src.blockdim)];
 
                         ++idx;
                     }
@@ -572,13 +590,13 @@ namespace rocalution
         return true;
     }
 
-    template <typename ValueType, typename IndexType>
-    bool csr_to_coo(int                                    omp_threads,
-                    IndexType                              nnz,
-                    IndexType                              nrow,
-                    IndexType                              ncol,
-                    const MatrixCSR<ValueType, IndexType>& src,
-                    MatrixCOO<ValueType, IndexType>*       dst)
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool csr_to_coo(int                                                 omp_threads,
+                    PointerType                                         nnz,
+                    IndexType                                           nrow,
+                    IndexType                                           ncol,
+                    const MatrixCSR<ValueType, IndexType, PointerType>& src,
+                    MatrixCOO<ValueType, IndexType>*                    dst)
     {
         assert(nnz > 0);
         assert(nrow > 0);
@@ -599,7 +617,7 @@ namespace rocalution
 #endif
         for(IndexType i = 0; i < nrow; ++i)
         {
-            for(IndexType j = src.row_offset[i]; j < src.row_offset[i + 1]; ++j)
+            for(PointerType j = src.row_offset[i]; j < src.row_offset[i + 1]; ++j)
             {
                 dst->row[j] = i;
             }
@@ -608,7 +626,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-        for(IndexType i = 0; i < nnz; ++i)
+        for(PointerType i = 0; i < nnz; ++i)
         {
             dst->col[i] = src.col[i];
         }
@@ -616,7 +634,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-        for(IndexType i = 0; i < nnz; ++i)
+        for(PointerType i = 0; i < nnz; ++i)
         {
             dst->val[i] = src.val[i];
         }
@@ -624,19 +642,25 @@ namespace rocalution
         return true;
     }
 
-    template <typename ValueType, typename IndexType>
-    bool csr_to_ell(int                                    omp_threads,
-                    IndexType                              nnz,
-                    IndexType                              nrow,
-                    IndexType                              ncol,
-                    const MatrixCSR<ValueType, IndexType>& src,
-                    MatrixELL<ValueType, IndexType>*       dst,
-                    IndexType*                             nnz_ell)
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool csr_to_ell(int                                                 omp_threads,
+                    PointerType                                         nnz,
+                    IndexType                                           nrow,
+                    IndexType                                           ncol,
+                    const MatrixCSR<ValueType, IndexType, PointerType>& src,
+                    MatrixELL<ValueType, IndexType>*                    dst,
+                    PointerType*                                        nnz_ell)
     {
         assert(nnz > 0);
         assert(nrow > 0);
         assert(ncol > 0);
 
+        // Format is limited to IndexType non-zero entries
+        if(nnz > std::numeric_limits<IndexType>::max())
+        {
+            return false;
+        }
+
         omp_set_num_threads(omp_threads);
 
         dst->max_row = 0;
@@ -650,10 +674,10 @@ namespace rocalution
             }
         }
 
-        *nnz_ell = dst->max_row * nrow;
+        *nnz_ell = static_cast<PointerType>(dst->max_row) * nrow;
 
         // Limit ELL size to 5 times CSR nnz
-        if(dst->max_row > 5 * (nnz / nrow))
+        if(dst->max_row > 5 * (nnz / nrow) || *nnz_ell > std::numeric_limits<IndexType>::max())
         {
             return false;
         }
@@ -671,7 +695,7 @@ namespace rocalution
         {
             IndexType n = 0;
 
-            for(IndexType j = src.row_offset[i]; j < src.row_offset[i + 1]; ++j)
+            for(PointerType j = src.row_offset[i]; j < src.row_offset[i + 1]; ++j)
             {
                 IndexType ind = ELL_IND(i, n, nrow, dst->max_row);
 
@@ -680,7 +704,7 @@ namespace rocalution
                 ++n;
             }
 
-            for(IndexType j = src.row_offset[i + 1] - src.row_offset[i]; j < dst->max_row; ++j)
+            for(PointerType j = src.row_offset[i + 1] - src.row_offset[i]; j < dst->max_row; ++j)
             {
                 IndexType ind = ELL_IND(i, n, nrow, dst->max_row);
 
@@ -693,14 +717,14 @@ namespace rocalution
         return true;
     }
 
-    template <typename ValueType, typename IndexType>
-    bool ell_to_csr(int                                    omp_threads,
-                    IndexType                              nnz,
-                    IndexType                              nrow,
-                    IndexType                              ncol,
-                    const MatrixELL<ValueType, IndexType>& src,
-                    MatrixCSR<ValueType, IndexType>*       dst,
-                    IndexType*                             nnz_csr)
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool ell_to_csr(int                                           omp_threads,
+                    PointerType                                   nnz,
+                    IndexType                                     nrow,
+                    IndexType                                     ncol,
+                    const MatrixELL<ValueType, IndexType>&        src,
+                    MatrixCSR<ValueType, IndexType, PointerType>* dst,
+                    PointerType*                                  nnz_csr)
     {
         assert(nnz > 0);
         assert(nrow > 0);
@@ -730,7 +754,7 @@ namespace rocalution
         *nnz_csr = 0;
         for(IndexType i = 0; i < nrow; ++i)
         {
-            IndexType tmp      = dst->row_offset[i];
+            PointerType tmp    = dst->row_offset[i];
             dst->row_offset[i] = *nnz_csr;
             *nnz_csr += tmp;
         }
@@ -748,7 +772,7 @@ namespace rocalution
 #endif
         for(IndexType ai = 0; ai < nrow; ++ai)
         {
-            IndexType ind = dst->row_offset[ai];
+            PointerType ind = dst->row_offset[ai];
 
             for(IndexType n = 0; n < src.max_row; ++n)
             {
@@ -766,16 +790,228 @@ namespace rocalution
         return true;
     }
 
-    template <typename ValueType, typename IndexType>
-    bool hyb_to_csr(int                                    omp_threads,
-                    IndexType                              nnz,
-                    IndexType                              nrow,
-                    IndexType                              ncol,
-                    IndexType                              nnz_ell,
-                    IndexType                              nnz_coo,
-                    const MatrixHYB<ValueType, IndexType>& src,
-                    MatrixCSR<ValueType, IndexType>*       dst,
-                    IndexType*                             nnz_csr)
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool csr_to_sell(int                                                 omp_threads,
+                     PointerType                                         nnz,
+                     IndexType                                           nrow,
+                     IndexType                                           ncol,
+                     IndexType                                           slice_size,
+                     IndexType                                           sigma,
+                     const MatrixCSR<ValueType, IndexType, PointerType>& src,
+                     MatrixSELL<ValueType, IndexType>*                   dst,
+                     PointerType*                                        nnz_sell)
+    {
+        assert(nnz > 0);
+        assert(nrow > 0);
+        assert(ncol > 0);
+        assert(slice_size > 0);
+        assert(sigma > 0);
+
+        // Format is limited to IndexType non-zero entries
+        if(nnz > std::numeric_limits<IndexType>::max())
+        {
+            return false;
+        }
+
+        omp_set_num_threads(omp_threads);
+
+        dst->slice_size = slice_size;
+        dst->sigma      = sigma;
+        dst->nslice     = (nrow - 1) / slice_size + 1;
+
+        allocate_host(nrow, &dst->perm);
+        allocate_host(dst->nslice + 1, &dst->slice_offset);
+
+        // Sort the rows by decreasing length within each sigma window
+        IndexType nwindow = (nrow - 1) / sigma + 1;
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(IndexType w = 0; w < nwindow; ++w)
+        {
+            IndexType begin = w * sigma;
+            IndexType end   = std::min(begin + sigma, nrow);
+
+            for(IndexType i = begin; i < end; ++i)
+            {
+                dst->perm[i] = i;
+            }
+
+            std::stable_sort(dst->perm + begin, dst->perm + end, [&](IndexType a, IndexType b) {
+                return src.row_offset[a + 1] - src.row_offset[a]
+                       > src.row_offset[b + 1] - src.row_offset[b];
+            });
+        }
+
+        // Width of each slice is the length of its longest row
+        dst->slice_offset[0] = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(IndexType s = 0; s < dst->nslice; ++s)
+        {
+            IndexType width = 0;
+            IndexType end   = std::min((s + 1) * slice_size, nrow);
+
+            for(IndexType i = s * slice_size; i < end; ++i)
+            {
+                IndexType row = dst->perm[i];
+                IndexType len = src.row_offset[row + 1] - src.row_offset[row];
+
+                width = std::max(width, len);
+            }
+
+            dst->slice_offset[s + 1] = width * slice_size;
+        }
+
+        for(IndexType s = 0; s < dst->nslice; ++s)
+        {
+            dst->slice_offset[s + 1] += dst->slice_offset[s];
+        }
+
+        *nnz_sell = dst->slice_offset[dst->nslice];
+
+        allocate_host(*nnz_sell, &dst->col);
+        allocate_host(*nnz_sell, &dst->val);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(IndexType s = 0; s < dst->nslice; ++s)
+        {
+            IndexType offset = dst->slice_offset[s];
+            IndexType width  = (dst->slice_offset[s + 1] - offset) / slice_size;
+
+            for(IndexType r = 0; r < slice_size; ++r)
+            {
+                IndexType i = s * slice_size + r;
+                IndexType n = 0;
+
+                // Rows beyond nrow (last slice) are pure padding
+                if(i < nrow)
+                {
+                    IndexType row = dst->perm[i];
+
+                    for(PointerType j = src.row_offset[row]; j < src.row_offset[row + 1]; ++j)
+                    {
+                        IndexType ind = SELL_IND(r, n, offset, slice_size);
+
+                        dst->val[ind] = src.val[j];
+                        dst->col[ind] = src.col[j];
+                        ++n;
+                    }
+                }
+
+                for(; n < width; ++n)
+                {
+                    IndexType ind = SELL_IND(r, n, offset, slice_size);
+
+                    dst->val[ind] = static_cast<ValueType>(0);
+                    dst->col[ind] = static_cast<IndexType>(-1);
+                }
+            }
+        }
+
+        return true;
+    }
+
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool sell_to_csr(int                                           omp_threads,
+                     PointerType                                   nnz,
+                     IndexType                                     nrow,
+                     IndexType                                     ncol,
+                     const MatrixSELL<ValueType, IndexType>&       src,
+                     MatrixCSR<ValueType, IndexType, PointerType>* dst,
+                     PointerType*                                  nnz_csr)
+    {
+        assert(nnz > 0);
+        assert(nrow > 0);
+        assert(ncol > 0);
+
+        omp_set_num_threads(omp_threads);
+
+        IndexType slice_size = src.slice_size;
+
+        allocate_host(nrow + 1, &dst->row_offset);
+        set_to_zero_host(nrow + 1, dst->row_offset);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(IndexType i = 0; i < nrow; ++i)
+        {
+            IndexType s      = i / slice_size;
+            IndexType r      = i % slice_size;
+            IndexType offset = src.slice_offset[s];
+            IndexType width  = (src.slice_offset[s + 1] - offset) / slice_size;
+            IndexType row    = src.perm[i];
+
+            for(IndexType n = 0; n < width; ++n)
+            {
+                IndexType aj = SELL_IND(r, n, offset, slice_size);
+
+                if((src.col[aj] >= 0) && (src.col[aj] < ncol))
+                {
+                    ++dst->row_offset[row];
+                }
+            }
+        }
+
+        *nnz_csr = 0;
+        for(IndexType i = 0; i < nrow; ++i)
+        {
+            PointerType tmp    = dst->row_offset[i];
+            dst->row_offset[i] = *nnz_csr;
+            *nnz_csr += tmp;
+        }
+
+        dst->row_offset[nrow] = *nnz_csr;
+
+        allocate_host(*nnz_csr, &dst->col);
+        allocate_host(*nnz_csr, &dst->val);
+
+        set_to_zero_host(*nnz_csr, dst->col);
+        set_to_zero_host(*nnz_csr, dst->val);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(IndexType i = 0; i < nrow; ++i)
+        {
+            IndexType   s      = i / slice_size;
+            IndexType   r      = i % slice_size;
+            IndexType   offset = src.slice_offset[s];
+            IndexType   width  = (src.slice_offset[s + 1] - offset) / slice_size;
+            PointerType ind    = dst->row_offset[src.perm[i]];
+
+            for(IndexType n = 0; n < width; ++n)
+            {
+                IndexType aj = SELL_IND(r, n, offset, slice_size);
+
+                if((src.col[aj] >= 0) && (src.col[aj] < ncol))
+                {
+                    dst->col[ind] = src.col[aj];
+                    dst->val[ind] = src.val[aj];
+                    ++ind;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool hyb_to_csr(int                                           omp_threads,
+                    PointerType                                   nnz,
+                    IndexType                                     nrow,
+                    IndexType                                     ncol,
+                    IndexType                                     nnz_ell,
+                    IndexType                                     nnz_coo,
+                    const MatrixHYB<ValueType, IndexType>&        src,
+                    MatrixCSR<ValueType, IndexType, PointerType>* dst,
+                    PointerType*                                  nnz_csr)
     {
         assert(nnz > 0);
         assert(nnz == nnz_ell + nnz_coo);
@@ -826,7 +1062,7 @@ namespace rocalution
         *nnz_csr = 0;
         for(IndexType i = 0; i < nrow; ++i)
         {
-            IndexType tmp      = dst->row_offset[i];
+            PointerType tmp    = dst->row_offset[i];
             dst->row_offset[i] = *nnz_csr;
             *nnz_csr += tmp;
         }
@@ -847,7 +1083,7 @@ namespace rocalution
         //#endif
         for(IndexType ai = 0; ai < nrow; ++ai)
         {
-            IndexType ind = dst->row_offset[ai];
+            PointerType ind = dst->row_offset[ai];
 
             // ELL
             for(IndexType n = 0; n < src.ELL.max_row; ++n)
@@ -883,13 +1119,13 @@ namespace rocalution
         return true;
     }
 
-    template <typename ValueType, typename IndexType>
-    bool coo_to_csr(int                                    omp_threads,
-                    IndexType                              nnz,
-                    IndexType                              nrow,
-                    IndexType                              ncol,
-                    const MatrixCOO<ValueType, IndexType>& src,
-                    MatrixCSR<ValueType, IndexType>*       dst)
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool coo_to_csr(int                                           omp_threads,
+                    PointerType                                   nnz,
+                    IndexType                                     nrow,
+                    IndexType                                     ncol,
+                    const MatrixCOO<ValueType, IndexType>&        src,
+                    MatrixCSR<ValueType, IndexType, PointerType>* dst)
     {
         assert(nnz > 0);
         assert(nrow > 0);
@@ -902,7 +1138,7 @@ namespace rocalution
         allocate_host(nnz, &dst->val);
 
         // COO has to be sorted by rows
-        for(IndexType i = 1; i < nnz; ++i)
+        for(PointerType i = 1; i < nnz; ++i)
         {
             assert(src.row[i] >= src.row[i - 1]);
         }
@@ -911,7 +1147,7 @@ namespace rocalution
         set_to_zero_host(nrow + 1, dst->row_offset);
 
         // Compute nnz entries per row of CSR
-        for(IndexType i = 0; i < nnz; ++i)
+        for(PointerType i = 0; i < nnz; ++i)
         {
             ++dst->row_offset[src.row[i] + 1];
         }
@@ -927,7 +1163,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-        for(IndexType i = 0; i < nnz; ++i)
+        for(PointerType i = 0; i < nnz; ++i)
         {
             dst->col[i] = src.col[i];
             dst->val[i] = src.val[i];
@@ -940,9 +1176,9 @@ namespace rocalution
 #endif
         for(IndexType i = 0; i < nrow; ++i)
         {
-            for(IndexType j = dst->row_offset[i]; j < dst->row_offset[i + 1]; ++j)
+            for(PointerType j = dst->row_offset[i]; j < dst->row_offset[i + 1]; ++j)
             {
-                for(IndexType jj = dst->row_offset[i]; jj < dst->row_offset[i + 1] - 1; ++jj)
+                for(PointerType jj = dst->row_offset[i]; jj < dst->row_offset[i + 1] - 1; ++jj)
                 {
                     if(dst->col[jj] > dst->col[jj + 1])
                     {
@@ -963,19 +1199,25 @@ namespace rocalution
         return true;
     }
 
-    template <typename ValueType, typename IndexType>
-    bool csr_to_dia(int                                    omp_threads,
-                    IndexType                              nnz,
-                    IndexType                              nrow,
-                    IndexType                              ncol,
-                    const MatrixCSR<ValueType, IndexType>& src,
-                    MatrixDIA<ValueType, IndexType>*       dst,
-                    IndexType*                             nnz_dia)
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool csr_to_dia(int                                                 omp_threads,
+                    PointerType                                         nnz,
+                    IndexType                                           nrow,
+                    IndexType                                           ncol,
+                    const MatrixCSR<ValueType, IndexType, PointerType>& src,
+                    MatrixDIA<ValueType, IndexType>*                    dst,
+                    PointerType*                                        nnz_dia)
     {
         assert(nnz > 0);
         assert(nrow > 0);
         assert(ncol > 0);
 
+        // Format is limited to IndexType non-zero entries
+        if(nnz > std::numeric_limits<IndexType>::max())
+        {
+            return false;
+        }
+
         omp_set_num_threads(omp_threads);
 
         // Determine number of populated diagonals
@@ -986,7 +1228,7 @@ namespace rocalution
         // Loop over rows and increment ndiag counter if diag offset has not been visited yet
         for(IndexType i = 0; i < nrow; ++i)
         {
-            for(IndexType j = src.row_offset[i]; j < src.row_offset[i + 1]; ++j)
+            for(PointerType j = src.row_offset[i]; j < src.row_offset[i + 1]; ++j)
             {
                 // Diagonal offset the current entry belongs to
                 IndexType offset = src.col[j] - i + nrow;
@@ -1000,10 +1242,10 @@ namespace rocalution
         }
 
         IndexType size = nrow > ncol ? nrow : ncol;
-        *nnz_dia       = size * dst->num_diag;
+        *nnz_dia       = static_cast<PointerType>(size) * dst->num_diag;
 
         // Conversion fails if DIA nnz exceeds 5 times CSR nnz
-        if(dst->num_diag > 5 * (nnz / size))
+        if(dst->num_diag > 5 * (nnz / size) || *nnz_dia > std::numeric_limits<IndexType>::max())
         {
             return false;
         }
@@ -1033,7 +1275,7 @@ namespace rocalution
 #endif
         for(IndexType i = 0; i < nrow; ++i)
         {
-            for(IndexType j = src.row_offset[i]; j < src.row_offset[i + 1]; ++j)
+            for(PointerType j = src.row_offset[i]; j < src.row_offset[i + 1]; ++j)
             {
                 // Diagonal offset the current entry belongs to
                 IndexType offset                                            = src.col[j] - i + nrow;
@@ -1044,14 +1286,14 @@ namespace rocalution
         return true;
     }
 
-    template <typename ValueType, typename IndexType>
-    bool dia_to_csr(int                                    omp_threads,
-                    IndexType                              nnz,
-                    IndexType                              nrow,
-                    IndexType                              ncol,
-                    const MatrixDIA<ValueType, IndexType>& src,
-                    MatrixCSR<ValueType, IndexType>*       dst,
-                    IndexType*                             nnz_csr)
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool dia_to_csr(int                                           omp_threads,
+                    PointerType                                   nnz,
+                    IndexType                                     nrow,
+                    IndexType                                     ncol,
+                    const MatrixDIA<ValueType, IndexType>&        src,
+                    MatrixCSR<ValueType, IndexType, PointerType>* dst,
+                    PointerType*                                  nnz_csr)
     {
         assert(nnz > 0);
         assert(nrow > 0);
@@ -1097,7 +1339,7 @@ namespace rocalution
 #endif
         for(IndexType i = 0; i < nrow; ++i)
         {
-            IndexType idx = dst->row_offset[i];
+            PointerType idx = dst->row_offset[i];
 
             for(IndexType n = 0; n < src.num_diag; ++n)
             {
@@ -1120,21 +1362,27 @@ namespace rocalution
         return true;
     }
 
-    template <typename ValueType, typename IndexType>
-    bool csr_to_hyb(int                                    omp_threads,
-                    IndexType                              nnz,
-                    IndexType                              nrow,
-                    IndexType                              ncol,
-                    const MatrixCSR<ValueType, IndexType>& src,
-                    MatrixHYB<ValueType, IndexType>*       dst,
-                    IndexType*                             nnz_hyb,
-                    IndexType*                             nnz_ell,
-                    IndexType*                             nnz_coo)
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool csr_to_hyb(int                                                 omp_threads,
+                    PointerType                                         nnz,
+                    IndexType                                           nrow,
+                    IndexType                                           ncol,
+                    const MatrixCSR<ValueType, IndexType, PointerType>& src,
+                    MatrixHYB<ValueType, IndexType>*                    dst,
+                    PointerType*                                        nnz_hyb,
+                    IndexType*                                          nnz_ell,
+                    IndexType*                                          nnz_coo)
     {
         assert(nnz > 0);
         assert(nrow > 0);
         assert(ncol > 0);
 
+        // Format is limited to IndexType non-zero entries
+        if(nnz > std::numeric_limits<IndexType>::max())
+        {
+            return false;
+        }
+
         omp_set_num_threads(omp_threads);
 
         // Determine ELL width by average nnz per row
@@ -1206,13 +1454,13 @@ namespace rocalution
 #endif
         for(IndexType i = 0; i < nrow; ++i)
         {
-            IndexType p         = 0;
-            IndexType row_begin = src.row_offset[i];
-            IndexType row_end   = src.row_offset[i + 1];
-            IndexType coo_idx   = dst->COO.row ? coo_row_ptr[i] : 0;
+            IndexType   p         = 0;
+            PointerType row_begin = src.row_offset[i];
+            PointerType row_end   = src.row_offset[i + 1];
+            IndexType   coo_idx   = dst->COO.row ? coo_row_ptr[i] : 0;
 
             // Fill HYB matrix
-            for(IndexType j = row_begin; j < row_end; ++j)
+            for(PointerType j = row_begin; j < row_end; ++j)
             {
                 if(p < dst->ELL.max_row)
                 {
@@ -1231,7 +1479,7 @@ namespace rocalution
             }
 
             // Pad remaining ELL structure
-            for(IndexType j = row_end - row_begin; j < dst->ELL.max_row; ++j)
+            for(PointerType j = row_end - row_begin; j < dst->ELL.max_row; ++j)
             {
                 IndexType idx     = ELL_IND(i, p++, nrow, dst->ELL.max_row);
                 dst->ELL.col[idx] = -1;
@@ -1244,572 +1492,648 @@ namespace rocalution
         return true;
     }
 
-    template bool csr_to_coo(int                           omp_threads,
-                             int                           nnz,
-                             int                           nrow,
-                             int                           ncol,
-                             const MatrixCSR<double, int>& src,
-                             MatrixCOO<double, int>*       dst);
+    template bool csr_to_coo(int                                    omp_threads,
+                             PtrType                                nnz,
+                             int                                    nrow,
+                             int                                    ncol,
+                             const MatrixCSR<double, int, PtrType>& src,
+                             MatrixCOO<double, int>*                dst);
 
-    template bool csr_to_coo(int                          omp_threads,
-                             int                          nnz,
-                             int                          nrow,
-                             int                          ncol,
-                             const MatrixCSR<float, int>& src,
-                             MatrixCOO<float, int>*       dst);
+    template bool csr_to_coo(int                                   omp_threads,
+                             PtrType                               nnz,
+                             int                                   nrow,
+                             int                                   ncol,
+                             const MatrixCSR<float, int, PtrType>& src,
+                             MatrixCOO<float, int>*                dst);
 
 #ifdef SUPPORT_COMPLEX
-    template bool csr_to_coo(int                                         omp_threads,
-                             int                                         nnz,
-                             int                                         nrow,
-                             int                                         ncol,
-                             const MatrixCSR<std::complex<double>, int>& src,
-                             MatrixCOO<std::complex<double>, int>*       dst);
-
-    template bool csr_to_coo(int                                        omp_threads,
-                             int                                        nnz,
-                             int                                        nrow,
-                             int                                        ncol,
-                             const MatrixCSR<std::complex<float>, int>& src,
-                             MatrixCOO<std::complex<float>, int>*       dst);
+    template bool csr_to_coo(int                                                  omp_threads,
+                             PtrType                                              nnz,
+                             int                                                  nrow,
+                             int                                                  ncol,
+                             const MatrixCSR<std::complex<double>, int, PtrType>& src,
+                             MatrixCOO<std::complex<double>, int>*                dst);
+
+    template bool csr_to_coo(int                                                 omp_threads,
+                             PtrType                                             nnz,
+                             int                                                 nrow,
+                             int                                                 ncol,
+                             const MatrixCSR<std::complex<float>, int, PtrType>& src,
+                             MatrixCOO<std::complex<float>, int>*                dst);
 #endif
 
-    template bool csr_to_coo(int                        omp_threads,
-                             int                        nnz,
-                             int                        nrow,
-                             int                        ncol,
-                             const MatrixCSR<int, int>& src,
-                             MatrixCOO<int, int>*       dst);
-
-    template bool csr_to_mcsr(int                           omp_threads,
-                              int                           nnz,
-                              int                           nrow,
-                              int                           ncol,
-                              const MatrixCSR<double, int>& src,
-                              MatrixMCSR<double, int>*      dst);
-
-    template bool csr_to_mcsr(int                          omp_threads,
-                              int                          nnz,
-                              int                          nrow,
-                              int                          ncol,
-                              const MatrixCSR<float, int>& src,
-                              MatrixMCSR<float, int>*      dst);
+    template bool csr_to_coo(int                                 omp_threads,
+                             PtrType                             nnz,
+                             int                                 nrow,
+                             int                                 ncol,
+                             const MatrixCSR<int, int, PtrType>& src,
+                             MatrixCOO<int, int>*                dst);
+
+    template bool csr_to_mcsr(int                                    omp_threads,
+                              PtrType                                nnz,
+                              int                                    nrow,
+                              int                                    ncol,
+                              const MatrixCSR<double, int, PtrType>& src,
+                              MatrixMCSR<double, int>*               dst);
+
+    template bool csr_to_mcsr(int                                   omp_threads,
+                              PtrType                               nnz,
+                              int                                   nrow,
+                              int                                   ncol,
+                              const MatrixCSR<float, int, PtrType>& src,
+                              MatrixMCSR<float, int>*               dst);
 
 #ifdef SUPPORT_COMPLEX
-    template bool csr_to_mcsr(int                                         omp_threads,
-                              int                                         nnz,
-                              int                                         nrow,
-                              int                                         ncol,
-                              const MatrixCSR<std::complex<double>, int>& src,
-                              MatrixMCSR<std::complex<double>, int>*      dst);
-
-    template bool csr_to_mcsr(int                                        omp_threads,
-                              int                                        nnz,
-                              int                                        nrow,
-                              int                                        ncol,
-                              const MatrixCSR<std::complex<float>, int>& src,
-                              MatrixMCSR<std::complex<float>, int>*      dst);
+    template bool csr_to_mcsr(int                                                  omp_threads,
+                              PtrType                                              nnz,
+                              int                                                  nrow,
+                              int                                                  ncol,
+                              const MatrixCSR<std::complex<double>, int, PtrType>& src,
+                              MatrixMCSR<std::complex<double>, int>*               dst);
+
+    template bool csr_to_mcsr(int                                                 omp_threads,
+                              PtrType                                             nnz,
+                              int                                                 nrow,
+                              int                                                 ncol,
+                              const MatrixCSR<std::complex<float>, int, PtrType>& src,
+                              MatrixMCSR<std::complex<float>, int>*               dst);
 #endif
 
-    template bool csr_to_mcsr(int                        omp_threads,
-                              int                        nnz,
-                              int                        nrow,
-                              int                        ncol,
-                              const MatrixCSR<int, int>& src,
-                              MatrixMCSR<int, int>*      dst);
+    template bool csr_to_mcsr(int                                 omp_threads,
+                              PtrType                             nnz,
+                              int                                 nrow,
+                              int                                 ncol,
+                              const MatrixCSR<int, int, PtrType>& src,
+                              MatrixMCSR<int, int>*               dst);
+
+    template bool mcsr_to_csr(int                              omp_threads,
+                              PtrType                          nnz,
+                              int                              nrow,
+                              int                              ncol,
+                              const MatrixMCSR<double, int>&   src,
+                              MatrixCSR<double, int, PtrType>* dst);
+
+    template bool mcsr_to_csr(int                             omp_threads,
+                              PtrType                         nnz,
+                              int                             nrow,
+                              int                             ncol,
+                              const MatrixMCSR<float, int>&   src,
+                              MatrixCSR<float, int, PtrType>* dst);
 
-    template bool mcsr_to_csr(int                            omp_threads,
-                              int                            nnz,
-                              int                            nrow,
-                              int                            ncol,
-                              const MatrixMCSR<double, int>& src,
-                              MatrixCSR<double, int>*        dst);
+#ifdef SUPPORT_COMPLEX
+    template bool mcsr_to_csr(int                                            omp_threads,
+                              PtrType                                        nnz,
+                              int                                            nrow,
+                              int                                            ncol,
+                              const MatrixMCSR<std::complex<double>, int>&   src,
+                              MatrixCSR<std::complex<double>, int, PtrType>* dst);
+
+    template bool mcsr_to_csr(int                                           omp_threads,
+                              PtrType                                       nnz,
+                              int                                           nrow,
+                              int                                           ncol,
+                              const MatrixMCSR<std::complex<float>, int>&   src,
+                              MatrixCSR<std::complex<float>, int, PtrType>* dst);
+#endif
 
     template bool mcsr_to_csr(int                           omp_threads,
-                              int                           nnz,
+                              PtrType                       nnz,
                               int                           nrow,
                               int                           ncol,
-                              const MatrixMCSR<float, int>& src,
-                              MatrixCSR<float, int>*        dst);
+                              const MatrixMCSR<int, int>&   src,
+                              MatrixCSR<int, int, PtrType>* dst);
+
+    template bool csr_to_bcsr(int                                    omp_threads,
+                              PtrType                                nnz,
+                              int                                    nrow,
+                              int                                    ncol,
+                              const MatrixCSR<double, int, PtrType>& src,
+                              MatrixBCSR<double, int>*               dst);
+
+    template bool csr_to_bcsr(int                                   omp_threads,
+                              PtrType                               nnz,
+                              int                                   nrow,
+                              int                                   ncol,
+                              const MatrixCSR<float, int, PtrType>& src,
+                              MatrixBCSR<float, int>*               dst);
 
 #ifdef SUPPORT_COMPLEX
-    template bool mcsr_to_csr(int                                          omp_threads,
-                              int                                          nnz,
-                              int                                          nrow,
-                              int                                          ncol,
-                              const MatrixMCSR<std::complex<double>, int>& src,
-                              MatrixCSR<std::complex<double>, int>*        dst);
-
-    template bool mcsr_to_csr(int                                         omp_threads,
-                              int                                         nnz,
-                              int                                         nrow,
-                              int                                         ncol,
-                              const MatrixMCSR<std::complex<float>, int>& src,
-                              MatrixCSR<std::complex<float>, int>*        dst);
+    template bool csr_to_bcsr(int                                                  omp_threads,
+                              PtrType                                              nnz,
+                              int                                                  nrow,
+                              int                                                  ncol,
+                              const MatrixCSR<std::complex<double>, int, PtrType>& src,
+                              MatrixBCSR<std::complex<double>, int>*               dst);
+
+    template bool csr_to_bcsr(int                                                 omp_threads,
+                              PtrType                                             nnz,
+                              int                                                 nrow,
+                              int                                                 ncol,
+                              const MatrixCSR<std::complex<float>, int, PtrType>& src,
+                              MatrixBCSR<std::complex<float>, int>*               dst);
 #endif
 
-    template bool mcsr_to_csr(int                         omp_threads,
-                              int                         nnz,
-                              int                         nrow,
-                              int                         ncol,
-                              const MatrixMCSR<int, int>& src,
-                              MatrixCSR<int, int>*        dst);
-
-    template bool csr_to_bcsr(int                           omp_threads,
-                              int                           nnz,
-                              int                           nrow,
-                              int                           ncol,
-                              const MatrixCSR<double, int>& src,
-                              MatrixBCSR<double, int>*      dst);
-
-    template bool csr_to_bcsr(int                          omp_threads,
-                              int                          nnz,
-                              int                          nrow,
-                              int                          ncol,
-                              const MatrixCSR<float, int>& src,
-                              MatrixBCSR<float, int>*      dst);
+    template bool csr_to_bcsr(int                                 omp_threads,
+                              PtrType                             nnz,
+                              int                                 nrow,
+                              int                                 ncol,
+                              const MatrixCSR<int, int, PtrType>& src,
+                              MatrixBCSR<int, int>*               dst);
+
+    template bool bcsr_to_csr(int                              omp_threads,
+                              PtrType                          nnz,
+                              int                              nrow,
+                              int                              ncol,
+                              const MatrixBCSR<double, int>&   src,
+                              MatrixCSR<double, int, PtrType>* dst);
+
+    template bool bcsr_to_csr(int                             omp_threads,
+                              PtrType                         nnz,
+                              int                             nrow,
+                              int                             ncol,
+                              const MatrixBCSR<float, int>&   src,
+                              MatrixCSR<float, int, PtrType>* dst);
 
 #ifdef SUPPORT_COMPLEX
-    template bool csr_to_bcsr(int                                         omp_threads,
-                              int                                         nnz,
-                              int                                         nrow,
-                              int                                         ncol,
-                              const MatrixCSR<std::complex<double>, int>& src,
-                              MatrixBCSR<std::complex<double>, int>*      dst);
-
-    template bool csr_to_bcsr(int                                        omp_threads,
-                              int                                        nnz,
-                              int                                        nrow,
-                              int                                        ncol,
-                              const MatrixCSR<std::complex<float>, int>& src,
-                              MatrixBCSR<std::complex<float>, int>*      dst);
+    template bool bcsr_to_csr(int                                            omp_threads,
+                              PtrType                                        nnz,
+                              int                                            nrow,
+                              int                                            ncol,
+                              const MatrixBCSR<std::complex<double>, int>&   src,
+                              MatrixCSR<std::complex<double>, int, PtrType>* dst);
+
+    template bool bcsr_to_csr(int                                           omp_threads,
+                              PtrType                                       nnz,
+                              int                                           nrow,
+                              int                                           ncol,
+                              const MatrixBCSR<std::complex<float>, int>&   src,
+                              MatrixCSR<std::complex<float>, int, PtrType>* dst);
 #endif
 
-    template bool csr_to_bcsr(int                        omp_threads,
-                              int                        nnz,
-                              int                        nrow,
-                              int                        ncol,
-                              const MatrixCSR<int, int>& src,
-                              MatrixBCSR<int, int>*      dst);
-
-    template bool bcsr_to_csr(int                            omp_threads,
-                              int                            nnz,
-                              int                            nrow,
-                              int                            ncol,
-                              const MatrixBCSR<double, int>& src,
-                              MatrixCSR<double, int>*        dst);
-
     template bool bcsr_to_csr(int                           omp_threads,
-                              int                           nnz,
+                              PtrType                       nnz,
                               int                           nrow,
                               int                           ncol,
-                              const MatrixBCSR<float, int>& src,
-                              MatrixCSR<float, int>*        dst);
+                              const MatrixBCSR<int, int>&   src,
+                              MatrixCSR<int, int, PtrType>* dst);
+
+    template bool csr_to_dia(int                                    omp_threads,
+                             PtrType                                nnz,
+                             int                                    nrow,
+                             int                                    ncol,
+                             const MatrixCSR<double, int, PtrType>& src,
+                             MatrixDIA<double, int>*                dst,
+                             PtrType*                               nnz_dia);
+
+    template bool csr_to_dia(int                                   omp_threads,
+                             PtrType                               nnz,
+                             int                                   nrow,
+                             int                                   ncol,
+                             const MatrixCSR<float, int, PtrType>& src,
+                             MatrixDIA<float, int>*                dst,
+                             PtrType*                              nnz_dia);
 
 #ifdef SUPPORT_COMPLEX
-    template bool bcsr_to_csr(int                                          omp_threads,
-                              int                                          nnz,
-                              int                                          nrow,
-                              int                                          ncol,
-                              const MatrixBCSR<std::complex<double>, int>& src,
-                              MatrixCSR<std::complex<double>, int>*        dst);
-
-    template bool bcsr_to_csr(int                                         omp_threads,
-                              int                                         nnz,
-                              int                                         nrow,
-                              int                                         ncol,
-                              const MatrixBCSR<std::complex<float>, int>& src,
-                              MatrixCSR<std::complex<float>, int>*        dst);
+    template bool csr_to_dia(int                                                  omp_threads,
+                             PtrType                                              nnz,
+                             int                                                  nrow,
+                             int                                                  ncol,
+                             const MatrixCSR<std::complex<double>, int, PtrType>& src,
+                             MatrixDIA<std::complex<double>, int>*                dst,
+                             PtrType*                                             nnz_dia);
+
+    template bool csr_to_dia(int                                                 omp_threads,
+                             PtrType                                             nnz,
+                             int                                                 nrow,
+                             int                                                 ncol,
+                             const MatrixCSR<std::complex<float>, int, PtrType>& src,
+                             MatrixDIA<std::complex<float>, int>*                dst,
+                             PtrType*                                            nnz_dia);
 #endif
 
-    template bool bcsr_to_csr(int                         omp_threads,
-                              int                         nnz,
-                              int                         nrow,
-                              int                         ncol,
-                              const MatrixBCSR<int, int>& src,
-                              MatrixCSR<int, int>*        dst);
-
-    template bool csr_to_dia(int                           omp_threads,
-                             int                           nnz,
-                             int                           nrow,
-                             int                           ncol,
-                             const MatrixCSR<double, int>& src,
-                             MatrixDIA<double, int>*       dst,
-                             int*                          nnz_dia);
-
-    template bool csr_to_dia(int                          omp_threads,
-                             int                          nnz,
-                             int                          nrow,
-                             int                          ncol,
-                             const MatrixCSR<float, int>& src,
-                             MatrixDIA<float, int>*       dst,
-                             int*                         nnz_dia);
+    template bool csr_to_dia(int                                 omp_threads,
+                             PtrType                             nnz,
+                             int                                 nrow,
+                             int                                 ncol,
+                             const MatrixCSR<int, int, PtrType>& src,
+                             MatrixDIA<int, int>*                dst,
+                             PtrType*                            nnz_dia);
+
+    template bool csr_to_sell(int                                    omp_threads,
+                              PtrType                                nnz,
+                              int                                    nrow,
+                              int                                    ncol,
+                              int                                    slice_size,
+                              int                                    sigma,
+                              const MatrixCSR<double, int, PtrType>& src,
+                              MatrixSELL<double, int>*               dst,
+                              PtrType*                               nnz_sell);
+
+    template bool csr_to_sell(int                                   omp_threads,
+                              PtrType                               nnz,
+                              int                                   nrow,
+                              int                                   ncol,
+                              int                                   slice_size,
+                              int                                   sigma,
+                              const MatrixCSR<float, int, PtrType>& src,
+                              MatrixSELL<float, int>*               dst,
+                              PtrType*                              nnz_sell);
 
 #ifdef SUPPORT_COMPLEX
-    template bool csr_to_dia(int                                         omp_threads,
-                             int                                         nnz,
-                             int                                         nrow,
-                             int                                         ncol,
-                             const MatrixCSR<std::complex<double>, int>& src,
-                             MatrixDIA<std::complex<double>, int>*       dst,
-                             int*                                        nnz_dia);
-
-    template bool csr_to_dia(int                                        omp_threads,
-                             int                                        nnz,
-                             int                                        nrow,
-                             int                                        ncol,
-                             const MatrixCSR<std::complex<float>, int>& src,
-                             MatrixDIA<std::complex<float>, int>*       dst,
-                             int*                                       nnz_dia);
+    template bool csr_to_sell(int                                                  omp_threads,
+                              PtrType                                              nnz,
+                              int                                                  nrow,
+                              int                                                  ncol,
+                              int                                                  slice_size,
+                              int                                                  sigma,
+                              const MatrixCSR<std::complex<double>, int, PtrType>& src,
+                              MatrixSELL<std::complex<double>, int>*               dst,
+                              PtrType*                                             nnz_sell);
+
+    template bool csr_to_sell(int                                                 omp_threads,
+                              PtrType                                             nnz,
+                              int                                                 nrow,
+                              int                                                 ncol,
+                              int                                                 slice_size,
+                              int                                                 sigma,
+                              const MatrixCSR<std::complex<float>, int, PtrType>& src,
+                              MatrixSELL<std::complex<float>, int>*               dst,
+                              PtrType*                                            nnz_sell);
 #endif
 
-    template bool csr_to_dia(int                        omp_threads,
-                             int                        nnz,
-                             int                        nrow,
-                             int                        ncol,
-                             const MatrixCSR<int, int>& src,
-                             MatrixDIA<int, int>*       dst,
-                             int*                       nnz_dia);
-
-    template bool csr_to_hyb(int                           omp_threads,
-                             int                           nnz,
-                             int                           nrow,
-                             int                           ncol,
-                             const MatrixCSR<double, int>& src,
-                             MatrixHYB<double, int>*       dst,
-                             int*                          nnz_hyb,
-                             int*                          nnz_ell,
-                             int*                          nnz_coo);
-
-    template bool csr_to_hyb(int                          omp_threads,
-                             int                          nnz,
-                             int                          nrow,
-                             int                          ncol,
-                             const MatrixCSR<float, int>& src,
-                             MatrixHYB<float, int>*       dst,
-                             int*                         nnz_hyb,
-                             int*                         nnz_ell,
-                             int*                         nnz_coo);
+    template bool csr_to_hyb(int                                    omp_threads,
+                             PtrType                                nnz,
+                             int                                    nrow,
+                             int                                    ncol,
+                             const MatrixCSR<double, int, PtrType>& src,
+                             MatrixHYB<double, int>*                dst,
+                             PtrType*                               nnz_hyb,
+                             int*                                   nnz_ell,
+                             int*                                   nnz_coo);
+
+    template bool csr_to_hyb(int                                   omp_threads,
+                             PtrType                               nnz,
+                             int                                   nrow,
+                             int                                   ncol,
+                             const MatrixCSR<float, int, PtrType>& src,
+                             MatrixHYB<float, int>*                dst,
+                             PtrType*                              nnz_hyb,
+                             int*                                  nnz_ell,
+                             int*                                  nnz_coo);
 
 #ifdef SUPPORT_COMPLEX
-    template bool csr_to_hyb(int                                         omp_threads,
-                             int                                         nnz,
-                             int                                         nrow,
-                             int                                         ncol,
-                             const MatrixCSR<std::complex<double>, int>& src,
-                             MatrixHYB<std::complex<double>, int>*       dst,
-                             int*                                        nnz_hyb,
-                             int*                                        nnz_ell,
-                             int*                                        nnz_coo);
-
-    template bool csr_to_hyb(int                                        omp_threads,
-                             int                                        nnz,
-                             int                                        nrow,
-                             int                                        ncol,
-                             const MatrixCSR<std::complex<float>, int>& src,
-                             MatrixHYB<std::complex<float>, int>*       dst,
-                             int*                                       nnz_hyb,
-                             int*                                       nnz_ell,
-                             int*                                       nnz_coo);
+    template bool csr_to_hyb(int                                                  omp_threads,
+                             PtrType                                              nnz,
+                             int                                                  nrow,
+                             int                                                  ncol,
+                             const MatrixCSR<std::complex<double>, int, PtrType>& src,
+                             MatrixHYB<std::complex<double>, int>*                dst,
+                             PtrType*                                             nnz_hyb,
+                             int*                                                 nnz_ell,
+                             int*                                                 nnz_coo);
+
+    template bool csr_to_hyb(int                                                 omp_threads,
+                             PtrType                                             nnz,
+                             int                                                 nrow,
+                             int                                                 ncol,
+                             const MatrixCSR<std::complex<float>, int, PtrType>& src,
+                             MatrixHYB<std::complex<float>, int>*                dst,
+                             PtrType*                                            nnz_hyb,
+                             int*                                                nnz_ell,
+                             int*                                                nnz_coo);
 #endif
 
-    template bool csr_to_hyb(int                        omp_threads,
-                             int                        nnz,
-                             int                        nrow,
-                             int                        ncol,
-                             const MatrixCSR<int, int>& src,
-                             MatrixHYB<int, int>*       dst,
-                             int*                       nnz_hyb,
-                             int*                       nnz_ell,
-                             int*                       nnz_coo);
-
-    template bool csr_to_ell(int                           omp_threads,
-                             int                           nnz,
-                             int                           nrow,
-                             int                           ncol,
-                             const MatrixCSR<double, int>& src,
-                             MatrixELL<double, int>*       dst,
-                             int*                          nnz_ell);
-
-    template bool csr_to_ell(int                          omp_threads,
-                             int                          nnz,
-                             int                          nrow,
-                             int                          ncol,
-                             const MatrixCSR<float, int>& src,
-                             MatrixELL<float, int>*       dst,
-                             int*                         nnz_ell);
+    template bool csr_to_hyb(int                                 omp_threads,
+                             PtrType                             nnz,
+                             int                                 nrow,
+                             int                                 ncol,
+                             const MatrixCSR<int, int, PtrType>& src,
+                             MatrixHYB<int, int>*                dst,
+                             PtrType*                            nnz_hyb,
+                             int*                                nnz_ell,
+                             int*                                nnz_coo);
+
+    template bool csr_to_ell(int                                    omp_threads,
+                             PtrType                                nnz,
+                             int                                    nrow,
+                             int                                    ncol,
+                             const MatrixCSR<double, int, PtrType>& src,
+                             MatrixELL<double, int>*                dst,
+                             PtrType*                               nnz_ell);
+
+    template bool csr_to_ell(int                                   omp_threads,
+                             PtrType                               nnz,
+                             int                                   nrow,
+                             int                                   ncol,
+                             const MatrixCSR<float, int, PtrType>& src,
+                             MatrixELL<float, int>*                dst,
+                             PtrType*                              nnz_ell);
 
 #ifdef SUPPORT_COMPLEX
-    template bool csr_to_ell(int                                         omp_threads,
-                             int                                         nnz,
-                             int                                         nrow,
-                             int                                         ncol,
-                             const MatrixCSR<std::complex<double>, int>& src,
-                             MatrixELL<std::complex<double>, int>*       dst,
-                             int*                                        nnz_ell);
-
-    template bool csr_to_ell(int                                        omp_threads,
-                             int                                        nnz,
-                             int                                        nrow,
-                             int                                        ncol,
-                             const MatrixCSR<std::complex<float>, int>& src,
-                             MatrixELL<std::complex<float>, int>*       dst,
-                             int*                                       nnz_ell);
+    template bool csr_to_ell(int                                                  omp_threads,
+                             PtrType                                              nnz,
+                             int                                                  nrow,
+                             int                                                  ncol,
+                             const MatrixCSR<std::complex<double>, int, PtrType>& src,
+                             MatrixELL<std::complex<double>, int>*                dst,
+                             PtrType*                                             nnz_ell);
+
+    template bool csr_to_ell(int                                                 omp_threads,
+                             PtrType                                             nnz,
+                             int                                                 nrow,
+                             int                                                 ncol,
+                             const MatrixCSR<std::complex<float>, int, PtrType>& src,
+                             MatrixELL<std::complex<float>, int>*                dst,
+                             PtrType*                                            nnz_ell);
 #endif
 
-    template bool csr_to_ell(int                        omp_threads,
-                             int                        nnz,
-                             int                        nrow,
-                             int                        ncol,
-                             const MatrixCSR<int, int>& src,
-                             MatrixELL<int, int>*       dst,
-                             int*                       nnz_ell);
+    template bool csr_to_ell(int                                 omp_threads,
+                             PtrType                             nnz,
+                             int                                 nrow,
+                             int                                 ncol,
+                             const MatrixCSR<int, int, PtrType>& src,
+                             MatrixELL<int, int>*                dst,
+                             PtrType*                            nnz_ell);
+
+    template bool csr_to_dense(int                                    omp_threads,
+                               PtrType                                nnz,
+                               int                                    nrow,
+                               int                                    ncol,
+                               const MatrixCSR<double, int, PtrType>& src,
+                               MatrixDENSE<double>*                   dst);
+
+    template bool csr_to_dense(int                                   omp_threads,
+                               PtrType                               nnz,
+                               int                                   nrow,
+                               int                                   ncol,
+                               const MatrixCSR<float, int, PtrType>& src,
+                               MatrixDENSE<float>*                   dst);
 
-    template bool csr_to_dense(int                           omp_threads,
-                               int                           nnz,
-                               int                           nrow,
-                               int                           ncol,
-                               const MatrixCSR<double, int>& src,
-                               MatrixDENSE<double>*          dst);
+#ifdef SUPPORT_COMPLEX
+    template bool csr_to_dense(int                                                  omp_threads,
+                               PtrType                                              nnz,
+                               int                                                  nrow,
+                               int                                                  ncol,
+                               const MatrixCSR<std::complex<double>, int, PtrType>& src,
+                               MatrixDENSE<std::complex<double>>*                   dst);
+
+    template bool csr_to_dense(int                                                 omp_threads,
+                               PtrType                                             nnz,
+                               int                                                 nrow,
+                               int                                                 ncol,
+                               const MatrixCSR<std::complex<float>, int, PtrType>& src,
+                               MatrixDENSE<std::complex<float>>*                   dst);
+#endif
 
-    template bool csr_to_dense(int                          omp_threads,
-                               int                          nnz,
-                               int                          nrow,
-                               int                          ncol,
-                               const MatrixCSR<float, int>& src,
-                               MatrixDENSE<float>*          dst);
+    template bool csr_to_dense(int                                 omp_threads,
+                               PtrType                             nnz,
+                               int                                 nrow,
+                               int                                 ncol,
+                               const MatrixCSR<int, int, PtrType>& src,
+                               MatrixDENSE<int>*                   dst);
+
+    template bool dense_to_csr(int                              omp_threads,
+                               int                              nrow,
+                               int                              ncol,
+                               const MatrixDENSE<double>&       src,
+                               MatrixCSR<double, int, PtrType>* dst,
+                               PtrType*                         nnz);
+
+    template bool dense_to_csr(int                             omp_threads,
+                               int                             nrow,
+                               int                             ncol,
+                               const MatrixDENSE<float>&       src,
+                               MatrixCSR<float, int, PtrType>* dst,
+                               PtrType*                        nnz);
 
 #ifdef SUPPORT_COMPLEX
-    template bool csr_to_dense(int                                         omp_threads,
-                               int                                         nnz,
-                               int                                         nrow,
-                               int                                         ncol,
-                               const MatrixCSR<std::complex<double>, int>& src,
-                               MatrixDENSE<std::complex<double>>*          dst);
-
-    template bool csr_to_dense(int                                        omp_threads,
-                               int                                        nnz,
-                               int                                        nrow,
-                               int                                        ncol,
-                               const MatrixCSR<std::complex<float>, int>& src,
-                               MatrixDENSE<std::complex<float>>*          dst);
+    template bool dense_to_csr(int                                            omp_threads,
+                               int                                            nrow,
+                               int                                            ncol,
+                               const MatrixDENSE<std::complex<double>>&       src,
+                               MatrixCSR<std::complex<double>, int, PtrType>* dst,
+                               PtrType*                                       nnz);
+
+    template bool dense_to_csr(int                                           omp_threads,
+                               int                                           nrow,
+                               int                                           ncol,
+                               const MatrixDENSE<std::complex<float>>&       src,
+                               MatrixCSR<std::complex<float>, int, PtrType>* dst,
+                               PtrType*                                      nnz);
 #endif
 
-    template bool csr_to_dense(int                        omp_threads,
-                               int                        nnz,
-                               int                        nrow,
-                               int                        ncol,
-                               const MatrixCSR<int, int>& src,
-                               MatrixDENSE<int>*          dst);
-
-    template bool dense_to_csr(int                        omp_threads,
-                               int                        nrow,
-                               int                        ncol,
-                               const MatrixDENSE<double>& src,
-                               MatrixCSR<double, int>*    dst,
-                               int*                       nnz);
-
-    template bool dense_to_csr(int                       omp_threads,
-                               int                       nrow,
-                               int                       ncol,
-                               const MatrixDENSE<float>& src,
-                               MatrixCSR<float, int>*    dst,
-                               int*                      nnz);
+    template bool dense_to_csr(int                           omp_threads,
+                               int                           nrow,
+                               int                           ncol,
+                               const MatrixDENSE<int>&       src,
+                               MatrixCSR<int, int, PtrType>* dst,
+                               PtrType*                      nnz);
+
+    template bool dia_to_csr(int                              omp_threads,
+                             PtrType                          nnz,
+                             int                              nrow,
+                             int                              ncol,
+                             const MatrixDIA<double, int>&    src,
+                             MatrixCSR<double, int, PtrType>* dst,
+                             PtrType*                         nnz_csr);
+
+    template bool dia_to_csr(int                             omp_threads,
+                             PtrType                         nnz,
+                             int                             nrow,
+                             int                             ncol,
+                             const MatrixDIA<float, int>&    src,
+                             MatrixCSR<float, int, PtrType>* dst,
+                             PtrType*                        nnz_csr);
 
 #ifdef SUPPORT_COMPLEX
-    template bool dense_to_csr(int                                      omp_threads,
-                               int                                      nrow,
-                               int                                      ncol,
-                               const MatrixDENSE<std::complex<double>>& src,
-                               MatrixCSR<std::complex<double>, int>*    dst,
-                               int*                                     nnz);
-
-    template bool dense_to_csr(int                                     omp_threads,
-                               int                                     nrow,
-                               int                                     ncol,
-                               const MatrixDENSE<std::complex<float>>& src,
-                               MatrixCSR<std::complex<float>, int>*    dst,
-                               int*                                    nnz);
+    template bool dia_to_csr(int                                            omp_threads,
+                             PtrType                                        nnz,
+                             int                                            nrow,
+                             int                                            ncol,
+                             const MatrixDIA<std::complex<double>, int>&    src,
+                             MatrixCSR<std::complex<double>, int, PtrType>* dst,
+                             PtrType*                                       nnz_csr);
+
+    template bool dia_to_csr(int                                           omp_threads,
+                             PtrType                                       nnz,
+                             int                                           nrow,
+                             int                                           ncol,
+                             const MatrixDIA<std::complex<float>, int>&    src,
+                             MatrixCSR<std::complex<float>, int, PtrType>* dst,
+                             PtrType*                                      nnz_csr);
 #endif
 
-    template bool dense_to_csr(int                     omp_threads,
-                               int                     nrow,
-                               int                     ncol,
-                               const MatrixDENSE<int>& src,
-                               MatrixCSR<int, int>*    dst,
-                               int*                    nnz);
-
     template bool dia_to_csr(int                           omp_threads,
-                             int                           nnz,
+                             PtrType                       nnz,
                              int                           nrow,
                              int                           ncol,
-                             const MatrixDIA<double, int>& src,
-                             MatrixCSR<double, int>*       dst,
-                             int*                          nnz_csr);
-
-    template bool dia_to_csr(int                          omp_threads,
-                             int                          nnz,
-                             int                          nrow,
-                             int                          ncol,
-                             const MatrixDIA<float, int>& src,
-                             MatrixCSR<float, int>*       dst,
-                             int*                         nnz_csr);
+                             const MatrixDIA<int, int>&    src,
+                             MatrixCSR<int, int, PtrType>* dst,
+                             PtrType*                      nnz_csr);
+
+    template bool ell_to_csr(int                              omp_threads,
+                             PtrType                          nnz,
+                             int                              nrow,
+                             int                              ncol,
+                             const MatrixELL<double, int>&    src,
+                             MatrixCSR<double, int, PtrType>* dst,
+                             PtrType*                         nnz_csr);
+
+    template bool ell_to_csr(int                             omp_threads,
+                             PtrType                         nnz,
+                             int                             nrow,
+                             int                             ncol,
+                             const MatrixELL<float, int>&    src,
+                             MatrixCSR<float, int, PtrType>* dst,
+                             PtrType*                        nnz_csr);
 
 #ifdef SUPPORT_COMPLEX
-    template bool dia_to_csr(int                                         omp_threads,
-                             int                                         nnz,
-                             int                                         nrow,
-                             int                                         ncol,
-                             const MatrixDIA<std::complex<double>, int>& src,
-                             MatrixCSR<std::complex<double>, int>*       dst,
-                             int*                                        nnz_csr);
-
-    template bool dia_to_csr(int                                        omp_threads,
-                             int                                        nnz,
-                             int                                        nrow,
-                             int                                        ncol,
-                             const MatrixDIA<std::complex<float>, int>& src,
-                             MatrixCSR<std::complex<float>, int>*       dst,
-                             int*                                       nnz_csr);
+    template bool ell_to_csr(int                                            omp_threads,
+                             PtrType                                        nnz,
+                             int                                            nrow,
+                             int                                            ncol,
+                             const MatrixELL<std::complex<double>, int>&    src,
+                             MatrixCSR<std::complex<double>, int, PtrType>* dst,
+                             PtrType*                                       nnz_csr);
+
+    template bool ell_to_csr(int                                           omp_threads,
+                             PtrType                                       nnz,
+                             int                                           nrow,
+                             int                                           ncol,
+                             const MatrixELL<std::complex<float>, int>&    src,
+                             MatrixCSR<std::complex<float>, int, PtrType>* dst,
+                             PtrType*                                      nnz_csr);
 #endif
 
-    template bool dia_to_csr(int                        omp_threads,
-                             int                        nnz,
-                             int                        nrow,
-                             int                        ncol,
-                             const MatrixDIA<int, int>& src,
-                             MatrixCSR<int, int>*       dst,
-                             int*                       nnz_csr);
-
     template bool ell_to_csr(int                           omp_threads,
-                             int                           nnz,
+                             PtrType                       nnz,
                              int                           nrow,
                              int                           ncol,
-                             const MatrixELL<double, int>& src,
-                             MatrixCSR<double, int>*       dst,
-                             int*                          nnz_csr);
-
-    template bool ell_to_csr(int                          omp_threads,
-                             int                          nnz,
-                             int                          nrow,
-                             int                          ncol,
-                             const MatrixELL<float, int>& src,
-                             MatrixCSR<float, int>*       dst,
-                             int*                         nnz_csr);
+                             const MatrixELL<int, int>&    src,
+                             MatrixCSR<int, int, PtrType>* dst,
+                             PtrType*                      nnz_csr);
+
+    template bool sell_to_csr(int                              omp_threads,
+                              PtrType                          nnz,
+                              int                              nrow,
+                              int                              ncol,
+                              const MatrixSELL<double, int>&   src,
+                              MatrixCSR<double, int, PtrType>* dst,
+                              PtrType*                         nnz_csr);
+
+    template bool sell_to_csr(int                             omp_threads,
+                              PtrType                         nnz,
+                              int                             nrow,
+                              int                             ncol,
+                              const MatrixSELL<float, int>&   src,
+                              MatrixCSR<float, int, PtrType>* dst,
+                              PtrType*                        nnz_csr);
 
 #ifdef SUPPORT_COMPLEX
-    template bool ell_to_csr(int                                         omp_threads,
-                             int                                         nnz,
-                             int                                         nrow,
-                             int                                         ncol,
-                             const MatrixELL<std::complex<double>, int>& src,
-                             MatrixCSR<std::complex<double>, int>*       dst,
-                             int*                                        nnz_csr);
-
-    template bool ell_to_csr(int                                        omp_threads,
-                             int                                        nnz,
-                             int                                        nrow,
-                             int                                        ncol,
-                             const MatrixELL<std::complex<float>, int>& src,
-                             MatrixCSR<std::complex<float>, int>*       dst,
-                             int*                                       nnz_csr);
+    template bool sell_to_csr(int                                            omp_threads,
+                              PtrType                                        nnz,
+                              int                                            nrow,
+                              int                                            ncol,
+                              const MatrixSELL<std::complex<double>, int>&   src,
+                              MatrixCSR<std::complex<double>, int, PtrType>* dst,
+                              PtrType*                                       nnz_csr);
+
+    template bool sell_to_csr(int                                           omp_threads,
+                              PtrType                                       nnz,
+                              int                                           nrow,
+                              int                                           ncol,
+                              const MatrixSELL<std::complex<float>, int>&   src,
+                              MatrixCSR<std::complex<float>, int, PtrType>* dst,
+                              PtrType*                                      nnz_csr);
 #endif
 
-    template bool ell_to_csr(int                        omp_threads,
-                             int                        nnz,
-                             int                        nrow,
-                             int                        ncol,
-                             const MatrixELL<int, int>& src,
-                             MatrixCSR<int, int>*       dst,
-                             int*                       nnz_csr);
+    template bool coo_to_csr(int                              omp_threads,
+                             PtrType                          nnz,
+                             int                              nrow,
+                             int                              ncol,
+                             const MatrixCOO<double, int>&    src,
+                             MatrixCSR<double, int, PtrType>* dst);
+
+    template bool coo_to_csr(int                             omp_threads,
+                             PtrType                         nnz,
+                             int                             nrow,
+                             int                             ncol,
+                             const MatrixCOO<float, int>&    src,
+                             MatrixCSR<float, int, PtrType>* dst);
+
+#ifdef SUPPORT_COMPLEX
+    template bool coo_to_csr(int                                            omp_threads,
+                             PtrType                                        nnz,
+                             int                                            nrow,
+                             int                                            ncol,
+                             const MatrixCOO<std::complex<double>, int>&    src,
+                             MatrixCSR<std::complex<double>, int, PtrType>* dst);
+
+    template bool coo_to_csr(int                                           omp_threads,
+                             PtrType                                       nnz,
+                             int                                           nrow,
+                             int                                           ncol,
+                             const MatrixCOO<std::complex<float>, int>&    src,
+                             MatrixCSR<std::complex<float>, int, PtrType>* dst);
+#endif
 
     template bool coo_to_csr(int                           omp_threads,
-                             int                           nnz,
+                             PtrType                       nnz,
                              int                           nrow,
                              int                           ncol,
-                             const MatrixCOO<double, int>& src,
-                             MatrixCSR<double, int>*       dst);
-
-    template bool coo_to_csr(int                          omp_threads,
-                             int                          nnz,
-                             int                          nrow,
-                             int                          ncol,
-                             const MatrixCOO<float, int>& src,
-                             MatrixCSR<float, int>*       dst);
+                             const MatrixCOO<int, int>&    src,
+                             MatrixCSR<int, int, PtrType>* dst);
+
+    template bool hyb_to_csr(int                              omp_threads,
+                             PtrType                          nnz,
+                             int                              nrow,
+                             int                              ncol,
+                             int                              nnz_ell,
+                             int                              nnz_coo,
+                             const MatrixHYB<double, int>&    src,
+                             MatrixCSR<double, int, PtrType>* dst,
+                             PtrType*                         nnz_csr);
+
+    template bool hyb_to_csr(int                             omp_threads,
+                             PtrType                         nnz,
+                             int                             nrow,
+                             int                             ncol,
+                             int                             nnz_ell,
+                             int                             nnz_coo,
+                             const MatrixHYB<float, int>&    src,
+                             MatrixCSR<float, int, PtrType>* dst,
+                             PtrType*                        nnz_csr);
 
 #ifdef SUPPORT_COMPLEX
-    template bool coo_to_csr(int                                         omp_threads,
-                             int                                         nnz,
-                             int                                         nrow,
-                             int                                         ncol,
-                             const MatrixCOO<std::complex<double>, int>& src,
-                             MatrixCSR<std::complex<double>, int>*       dst);
-
-    template bool coo_to_csr(int                                        omp_threads,
-                             int                                        nnz,
-                             int                                        nrow,
-                             int                                        ncol,
-                             const MatrixCOO<std::complex<float>, int>& src,
-                             MatrixCSR<std::complex<float>, int>*       dst);
+    template bool hyb_to_csr(int                                            omp_threads,
+                             PtrType                                        nnz,
+                             int                                            nrow,
+                             int                                            ncol,
+                             int                                            nnz_ell,
+                             int                                            nnz_coo,
+                             const MatrixHYB<std::complex<double>, int>&    src,
+                             MatrixCSR<std::complex<double>, int, PtrType>* dst,
+                             PtrType*                                       nnz_csr);
+
+    template bool hyb_to_csr(int                                           omp_threads,
+                             PtrType                                       nnz,
+                             int                                           nrow,
+                             int                                           ncol,
+                             int                                           nnz_ell,
+                             int                                           nnz_coo,
+                             const MatrixHYB<std::complex<float>, int>&    src,
+                             MatrixCSR<std::complex<float>, int, PtrType>* dst,
+                             PtrType*                                      nnz_csr);
 #endif
 
-    template bool coo_to_csr(int                        omp_threads,
-                             int                        nnz,
-                             int                        nrow,
-                             int                        ncol,
-                             const MatrixCOO<int, int>& src,
-                             MatrixCSR<int, int>*       dst);
-
     template bool hyb_to_csr(int                           omp_threads,
-                             int                           nnz,
+                             PtrType                       nnz,
                              int                           nrow,
                              int                           ncol,
                              int                           nnz_ell,
                              int                           nnz_coo,
-                             const MatrixHYB<double, int>& src,
-                             MatrixCSR<double, int>*       dst,
-                             int*                          nnz_csr);
-
-    template bool hyb_to_csr(int                          omp_threads,
-                             int                          nnz,
-                             int                          nrow,
-                             int                          ncol,
-                             int                          nnz_ell,
-                             int                          nnz_coo,
-                             const MatrixHYB<float, int>& src,
-                             MatrixCSR<float, int>*       dst,
-                             int*                         nnz_csr);
-
-#ifdef SUPPORT_COMPLEX
-    template bool hyb_to_csr(int                                         omp_threads,
-                             int                                         nnz,
-                             int                                         nrow,
-                             int                                         ncol,
-                             int                                         nnz_ell,
-                             int                                         nnz_coo,
-                             const MatrixHYB<std::complex<double>, int>& src,
-                             MatrixCSR<std::complex<double>, int>*       dst,
-                             int*                                        nnz_csr);
-
-    template bool hyb_to_csr(int                                        omp_threads,
-                             int                                        nnz,
-                             int                                        nrow,
-                             int                                        ncol,
-                             int                                        nnz_ell,
-                             int                                        nnz_coo,
-                             const MatrixHYB<std::complex<float>, int>& src,
-                             MatrixCSR<std::complex<float>, int>*       dst,
-                             int*                                       nnz_csr);
-#endif
-
-    template bool hyb_to_csr(int                        omp_threads,
-                             int                        nnz,
-                             int                        nrow,
-                             int                        ncol,
-                             int                        nnz_ell,
-                             int                        nnz_coo,
-                             const MatrixHYB<int, int>& src,
-                             MatrixCSR<int, int>*       dst,
-                             int*                       nnz_csr);
+                             const MatrixHYB<int, int>&    src,
+                             MatrixCSR<int, int, PtrType>* dst,
+                             PtrType*                      nnz_csr);
 
 } // namespace rocalution
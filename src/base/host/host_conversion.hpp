@@ -29,127 +29,147 @@
 namespace rocalution
 {
 
-    template <typename ValueType, typename IndexType>
-    bool csr_to_coo(int                                    omp_threads,
-                    IndexType                              nnz,
-                    IndexType                              nrow,
-                    IndexType                              ncol,
-                    const MatrixCSR<ValueType, IndexType>& src,
-                    MatrixCOO<ValueType, IndexType>*       dst);
-
-    template <typename ValueType, typename IndexType>
-    bool csr_to_mcsr(int                                    omp_threads,
-                     IndexType                              nnz,
-                     IndexType                              nrow,
-                     IndexType                              ncol,
-                     const MatrixCSR<ValueType, IndexType>& src,
-                     MatrixMCSR<ValueType, IndexType>*      dst);
-
-    template <typename ValueType, typename IndexType>
-    bool csr_to_bcsr(int                                    omp_threads,
-                     IndexType                              nnz,
-                     IndexType                              nrow,
-                     IndexType                              ncol,
-                     const MatrixCSR<ValueType, IndexType>& src,
-                     MatrixBCSR<ValueType, IndexType>*      dst);
-
-    template <typename ValueType, typename IndexType>
-    bool csr_to_dia(int                                    omp_threads,
-                    IndexType                              nnz,
-                    IndexType                              nrow,
-                    IndexType                              ncol,
-                    const MatrixCSR<ValueType, IndexType>& src,
-                    MatrixDIA<ValueType, IndexType>*       dst,
-                    IndexType*                             nnz_dia);
-
-    template <typename ValueType, typename IndexType>
-    bool csr_to_dense(int                                    omp_threads,
-                      IndexType                              nnz,
-                      IndexType                              nrow,
-                      IndexType                              ncol,
-                      const MatrixCSR<ValueType, IndexType>& src,
-                      MatrixDENSE<ValueType>*                dst);
-
-    template <typename ValueType, typename IndexType>
-    bool csr_to_ell(int                                    omp_threads,
-                    IndexType                              nnz,
-                    IndexType                              nrow,
-                    IndexType                              ncol,
-                    const MatrixCSR<ValueType, IndexType>& src,
-                    MatrixELL<ValueType, IndexType>*       dst,
-                    IndexType*                             nnz_ell);
-
-    template <typename ValueType, typename IndexType>
-    bool csr_to_hyb(int                                    omp_threads,
-                    IndexType                              nnz,
-                    IndexType                              nrow,
-                    IndexType                              ncol,
-                    const MatrixCSR<ValueType, IndexType>& src,
-                    MatrixHYB<ValueType, IndexType>*       dst,
-                    IndexType*                             nnz_hyb,
-                    IndexType*                             nnz_ell,
-                    IndexType*                             nnz_coo);
-
-    template <typename ValueType, typename IndexType>
-    bool bcsr_to_csr(int                                     omp_threads,
-                     IndexType                               nnz,
-                     IndexType                               nrow,
-                     IndexType                               ncol,
-                     const MatrixBCSR<ValueType, IndexType>& src,
-                     MatrixCSR<ValueType, IndexType>*        dst);
-
-    template <typename ValueType, typename IndexType>
-    bool dense_to_csr(int                              omp_threads,
-                      IndexType                        nrow,
-                      IndexType                        ncol,
-                      const MatrixDENSE<ValueType>&    src,
-                      MatrixCSR<ValueType, IndexType>* dst,
-                      IndexType*                       nnz);
-
-    template <typename ValueType, typename IndexType>
-    bool dia_to_csr(int                                    omp_threads,
-                    IndexType                              nnz,
-                    IndexType                              nrow,
-                    IndexType                              ncol,
-                    const MatrixDIA<ValueType, IndexType>& src,
-                    MatrixCSR<ValueType, IndexType>*       dst,
-                    IndexType*                             nnz_csr);
-
-    template <typename ValueType, typename IndexType>
-    bool ell_to_csr(int                                    omp_threads,
-                    IndexType                              nnz,
-                    IndexType                              nrow,
-                    IndexType                              ncol,
-                    const MatrixELL<ValueType, IndexType>& src,
-                    MatrixCSR<ValueType, IndexType>*       dst,
-                    IndexType*                             nnz_csr);
-
-    template <typename ValueType, typename IndexType>
-    bool coo_to_csr(int                                    omp_threads,
-                    IndexType                              nnz,
-                    IndexType                              nrow,
-                    IndexType                              ncol,
-                    const MatrixCOO<ValueType, IndexType>& src,
-                    MatrixCSR<ValueType, IndexType>*       dst);
-
-    template <typename ValueType, typename IndexType>
-    bool mcsr_to_csr(int                                     omp_threads,
-                     IndexType                               nnz,
-                     IndexType                               nrow,
-                     IndexType                               ncol,
-                     const MatrixMCSR<ValueType, IndexType>& src,
-                     MatrixCSR<ValueType, IndexType>*        dst);
-
-    template <typename ValueType, typename IndexType>
-    bool hyb_to_csr(int                                    omp_threads,
-                    IndexType                              nnz,
-                    IndexType                              nrow,
-                    IndexType                              ncol,
-                    IndexType                              nnz_ell,
-                    IndexType                              nnz_coo,
-                    const MatrixHYB<ValueType, IndexType>& src,
-                    MatrixCSR<ValueType, IndexType>*       dst,
-                    IndexType*                             nnz_csr);
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool csr_to_coo(int                                                 omp_threads,
+                    PointerType                                         nnz,
+                    IndexType                                           nrow,
+                    IndexType                                           ncol,
+                    const MatrixCSR<ValueType, IndexType, PointerType>& src,
+                    MatrixCOO<ValueType, IndexType>*                    dst);
+
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool csr_to_mcsr(int                                                 omp_threads,
+                     PointerType                                         nnz,
+                     IndexType                                           nrow,
+                     IndexType                                           ncol,
+                     const MatrixCSR<ValueType, IndexType, PointerType>& src,
+                     MatrixMCSR<ValueType, IndexType>*                   dst);
+
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool csr_to_bcsr(int                                                 omp_threads,
+                     PointerType                                         nnz,
+                     IndexType                                           nrow,
+                     IndexType                                           ncol,
+                     const MatrixCSR<ValueType, IndexType, PointerType>& src,
+                     MatrixBCSR<ValueType, IndexType>*                   dst);
+
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool csr_to_dia(int                                                 omp_threads,
+                    PointerType                                         nnz,
+                    IndexType                                           nrow,
+                    IndexType                                           ncol,
+                    const MatrixCSR<ValueType, IndexType, PointerType>& src,
+                    MatrixDIA<ValueType, IndexType>*                    dst,
+                    PointerType*                                        nnz_dia);
+
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool csr_to_dense(int                                                 omp_threads,
+                      PointerType                                         nnz,
+                      IndexType                                           nrow,
+                      IndexType                                           ncol,
+                      const MatrixCSR<ValueType, IndexType, PointerType>& src,
+                      MatrixDENSE<ValueType>*                             dst);
+
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool csr_to_ell(int                                                 omp_threads,
+                    PointerType                                         nnz,
+                    IndexType                                           nrow,
+                    IndexType                                           ncol,
+                    const MatrixCSR<ValueType, IndexType, PointerType>& src,
+                    MatrixELL<ValueType, IndexType>*                    dst,
+                    PointerType*                                        nnz_ell);
+
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool csr_to_sell(int                                                 omp_threads,
+                     PointerType                                         nnz,
+                     IndexType                                           nrow,
+                     IndexType                                           ncol,
+                     IndexType                                           slice_size,
+                     IndexType                                           sigma,
+                     const MatrixCSR<ValueType, IndexType, PointerType>& src,
+                     MatrixSELL<ValueType, IndexType>*                   dst,
+                     PointerType*                                        nnz_sell);
+
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool csr_to_hyb(int                                                 omp_threads,
+                    PointerType                                         nnz,
+                    IndexType                                           nrow,
+                    IndexType                                           ncol,
+                    const MatrixCSR<ValueType, IndexType, PointerType>& src,
+                    MatrixHYB<ValueType, IndexType>*                    dst,
+                    PointerType*                                        nnz_hyb,
+                    IndexType*                                          nnz_ell,
+                    IndexType*                                          nnz_coo);
+
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool bcsr_to_csr(int                                           omp_threads,
+                     PointerType                                   nnz,
+                     IndexType                                     nrow,
+                     IndexType                                     ncol,
+                     const MatrixBCSR<ValueType, IndexType>&       src,
+                     MatrixCSR<ValueType, IndexType, PointerType>* dst);
+
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool dense_to_csr(int                                           omp_threads,
+                      IndexType                                     nrow,
+                      IndexType                                     ncol,
+                      const MatrixDENSE<ValueType>&                 src,
+                      MatrixCSR<ValueType, IndexType, PointerType>* dst,
+                      PointerType*                                  nnz);
+
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool dia_to_csr(int                                           omp_threads,
+                    PointerType                                   nnz,
+                    IndexType                                     nrow,
+                    IndexType                                     ncol,
+                    const MatrixDIA<ValueType, IndexType>&        src,
+                    MatrixCSR<ValueType, IndexType, PointerType>* dst,
+                    PointerType*                                  nnz_csr);
+
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool ell_to_csr(int                                           omp_threads,
+                    PointerType                                   nnz,
+                    IndexType                                     nrow,
+                    IndexType                                     ncol,
+                    const MatrixELL<ValueType, IndexType>&        src,
+                    MatrixCSR<ValueType, IndexType, PointerType>* dst,
+                    PointerType*                                  nnz_csr);
+
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool sell_to_csr(int                                           omp_threads,
+                     PointerType                                   nnz,
+                     IndexType                                     nrow,
+                     IndexType                                     ncol,
+                     const MatrixSELL<ValueType, IndexType>&       src,
+                     MatrixCSR<ValueType, IndexType, PointerType>* dst,
+                     PointerType*                                  nnz_csr);
+
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool coo_to_csr(int                                           omp_threads,
+                    PointerType                                   nnz,
+                    IndexType                                     nrow,
+                    IndexType                                     ncol,
+                    const MatrixCOO<ValueType, IndexType>&        src,
+                    MatrixCSR<ValueType, IndexType, PointerType>* dst);
+
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool mcsr_to_csr(int                                           omp_threads,
+                     PointerType                                   nnz,
+                     IndexType                                     nrow,
+                     IndexType                                     ncol,
+                     const MatrixMCSR<ValueType, IndexType>&       src,
+                     MatrixCSR<ValueType, IndexType, PointerType>* dst);
+
+    template <typename ValueType, typename IndexType, typename PointerType>
+    bool hyb_to_csr(int                                           omp_threads,
+                    PointerType                                   nnz,
+                    IndexType                                     nrow,
+                    IndexType                                     ncol,
+                    IndexType                                     nnz_ell,
+                    IndexType                                     nnz_coo,
+                    const MatrixHYB<ValueType, IndexType>&        src,
+                    MatrixCSR<ValueType, IndexType, PointerType>* dst,
+                    PointerType*                                  nnz_csr);
 
 } // namespace rocalution
 
@@ -25,16 +25,28 @@
 #include "../../utils/allocate_free.hpp"
 #include "../../utils/def.hpp"
 #include "../../utils/log.hpp"
+#include "../../utils/time_functions.hpp"
+#include "../../utils/types.hpp"
 #include "rocalution/version.hpp"
 
+#include <algorithm>
 #include <complex>
 #include <fstream>
+#include <limits>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#else
+#define omp_get_max_threads() 1
+#define omp_get_thread_num() 0
+#endif
+
 namespace rocalution
 {
 
@@ -128,15 +140,18 @@ namespace rocalution
         return ValueType(real, imag);
     }
 
-    template <typename ValueType>
-    bool mm_read_coordinate(FILE*       fin,
-                            mm_banner&  b,
-                            int&        nrow,
-                            int&        ncol,
-                            int&        nnz,
-                            int**       row,
-                            int**       col,
-                            ValueType** val)
+    // Matrix Market data sections are read and parsed in blocks of this size
+    static const size_t mm_block_size = 64 * 1024 * 1024;
+
+    // Value field of a Matrix Market file
+    enum mm_field
+    {
+        mm_real,
+        mm_complex,
+        mm_pattern
+    };
+
+    bool mm_read_size(FILE* fin, int& nrow, int& ncol, long long& nnz)
     {
         char line[1025];
 
@@ -151,7 +166,7 @@ namespace rocalution
         } while(line[0] == '%');
 
         // Read m, n, nnz
-        while(sscanf(line, "%d %d %d", &nrow, &ncol, &nnz) != 3)
+        while(sscanf(line, "%d %d %lld", &nrow, &ncol, &nnz) != 3)
         {
             // Check for EOF and loop until line with 3 integer entries found
             if(!fgets(line, 1025, fin))
@@ -160,74 +175,482 @@ namespace rocalution
             }
         }
 
-        // Allocate arrays
-        allocate_host(nnz, row);
-        allocate_host(nnz, col);
-        allocate_host(nnz, val);
+        return true;
+    }
 
-        // Read data
-        if(!strncmp(b.matrix_type, "complex", 7))
+    static inline const char* mm_skip_blank(const char* p, const char* end)
+    {
+        while(p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+        {
+            ++p;
+        }
+
+        return p;
+    }
+
+    static inline const char* mm_parse_index(const char* p, const char* end, int& idx)
+    {
+        p = mm_skip_blank(p, end);
+
+        const char* begin = p;
+        long long   v     = 0;
+
+        while(p < end && *p >= '0' && *p <= '9' && v <= std::numeric_limits<int>::max())
+        {
+            v = v * 10 + (*p - '0');
+            ++p;
+        }
+
+        if(p == begin || v > std::numeric_limits<int>::max())
+        {
+            return NULL;
+        }
+
+        idx = static_cast<int>(v);
+
+        return p;
+    }
+
+    static inline const char* mm_parse_real(const char* p, const char* end, double& v)
+    {
+        // Exactly representable powers of ten
+        static const double pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                       1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                       1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+        p = mm_skip_blank(p, end);
+
+        // strtod() would skip the line break of an incomplete line
+        if(p == end || *p == '\n')
+        {
+            return NULL;
+        }
+
+        // Fast path for at most 15 significant digits and a decimal exponent of at most 22,
+        // where a single multiplication or division is correctly rounded. Further digits are
+        // only counted, such that the mantissa cannot overflow.
+        const char* q        = p;
+        bool        negative = (*q == '-');
+
+        if(*q == '-' || *q == '+')
+        {
+            ++q;
+        }
+
+        long long mantissa = 0;
+        int       digits   = 0;
+        int       exponent = 0;
+        bool      any      = false;
+
+        for(; q < end && *q >= '0' && *q <= '9'; ++q, any = true)
         {
-            double real, imag;
-            for(int i = 0; i < nnz; ++i)
+            if(mantissa != 0 || *q != '0')
             {
-                if(fscanf(fin, "%d %d %lg %lg", (*row) + i, (*col) + i, &real, &imag) != 4)
+                mantissa = (digits < 15) ? mantissa * 10 + (*q - '0') : mantissa;
+                ++digits;
+            }
+        }
+
+        if(q < end && *q == '.')
+        {
+            for(++q; q < end && *q >= '0' && *q <= '9'; ++q, any = true)
+            {
+                if(mantissa != 0 || *q != '0')
                 {
-                    return false;
+                    mantissa = (digits < 15) ? mantissa * 10 + (*q - '0') : mantissa;
+                    ++digits;
                 }
-                --(*row)[i];
-                --(*col)[i];
-                (*val)[i] = read_complex<ValueType>(real, imag);
+
+                --exponent;
             }
         }
-        else if(!strncmp(b.matrix_type, "real", 4) || !strncmp(b.matrix_type, "integer", 7))
+
+        if(any && q < end && (*q == 'e' || *q == 'E'))
         {
-            double tmp;
-            for(int i = 0; i < nnz; ++i)
+            const char* e   = q + 1;
+            bool        neg = false;
+            int         exp = 0;
+
+            if(e < end && (*e == '-' || *e == '+'))
+            {
+                neg = (*e == '-');
+                ++e;
+            }
+
+            if(e < end && *e >= '0' && *e <= '9')
             {
-                if(fscanf(fin, "%d %d %lg\n", (*row) + i, (*col) + i, &tmp) != 3)
+                for(; e < end && *e >= '0' && *e <= '9' && exp < 10000; ++e)
                 {
-                    return false;
+                    exp = exp * 10 + (*e - '0');
                 }
-                --(*row)[i];
-                --(*col)[i];
-                (*val)[i] = read_complex<ValueType>(tmp, tmp);
+
+                exponent += neg ? -exp : exp;
+                q = e;
             }
         }
-        else if(!strncmp(b.matrix_type, "pattern", 7))
+
+        if(any && digits <= 15 && exponent >= -22 && exponent <= 22
+           && (q == end || *q == ' ' || *q == '\t' || *q == '\r' || *q == '\n'))
         {
-            for(int i = 0; i < nnz; ++i)
+            double m = static_cast<double>(mantissa);
+
+            v = (exponent < 0) ? m / pow10[-exponent] : m * pow10[exponent];
+            v = negative ? -v : v;
+
+            return q;
+        }
+
+        // Everything else (long mantissas, large exponents, inf, nan) is left to strtod()
+        char* next;
+        v = strtod(p, &next);
+
+        return (next == p) ? NULL : next;
+    }
+
+    // Parse the complete lines in [begin, end) into 0-based coordinates
+    template <typename ValueType>
+    static bool mm_parse_lines(const char*             begin,
+                               const char*             end,
+                               mm_field                field,
+                               int                     nrow,
+                               int                     ncol,
+                               std::vector<int>&       row,
+                               std::vector<int>&       col,
+                               std::vector<ValueType>& val)
+    {
+        const char* p = begin;
+
+        while(p < end)
+        {
+            const char* eol = static_cast<const char*>(memchr(p, '\n', end - p));
+
+            if(eol == NULL)
+            {
+                eol = end;
+            }
+
+            const char* q = mm_skip_blank(p, eol);
+
+            // Skip empty and comment lines
+            if(q == eol || *q == '%')
+            {
+                p = eol + 1;
+                continue;
+            }
+
+            int    i;
+            int    j;
+            double real = 1.0;
+            double imag = 0.0;
+
+            q = mm_parse_index(q, eol, i);
+            q = (q != NULL) ? mm_parse_index(q, eol, j) : NULL;
+
+            if(q != NULL && field != mm_pattern)
             {
-                if(fscanf(fin, "%d %d\n", (*row) + i, (*col) + i) != 2)
+                q = mm_parse_real(q, eol, real);
+            }
+
+            if(q != NULL && field == mm_complex)
+            {
+                q = mm_parse_real(q, eol, imag);
+            }
+
+            if(q == NULL || i < 1 || i > nrow || j < 1 || j > ncol)
+            {
+                return false;
+            }
+
+            row.push_back(i - 1);
+            col.push_back(j - 1);
+            val.push_back(read_complex<ValueType>(real, imag));
+
+            p = eol + 1;
+        }
+
+        return true;
+    }
+
+    // Read the nnz entries of the data section in blocks, each block is parsed by all threads
+    template <typename ValueType>
+    static bool mm_read_entries(FILE*      fin,
+                                mm_field   field,
+                                int        nrow,
+                                int        ncol,
+                                PtrType    nnz,
+                                int*       row,
+                                int*       col,
+                                ValueType* val)
+    {
+        double tick = rocalution_time();
+
+        int nthreads = omp_get_max_threads();
+
+        std::vector<std::vector<int>>       t_row(nthreads);
+        std::vector<std::vector<int>>       t_col(nthreads);
+        std::vector<std::vector<ValueType>> t_val(nthreads);
+        std::vector<char>                   t_ok(nthreads);
+        std::vector<PtrType>                t_offset(nthreads + 1);
+
+        char* buffer = NULL;
+        allocate_host(mm_block_size + 1, &buffer);
+
+        size_t  carry = 0;
+        size_t  bytes = 0;
+        PtrType pos   = 0;
+        bool    eof   = false;
+        bool    ok    = true;
+
+        while(!eof)
+        {
+            size_t len = carry + fread(buffer + carry, 1, mm_block_size - carry, fin);
+
+            eof = (len < mm_block_size);
+
+            bytes += len - carry;
+
+            // Only parse complete lines, the remainder is carried over to the next block
+            size_t size = len;
+
+            if(!eof)
+            {
+                while(size > 0 && buffer[size - 1] != '\n')
+                {
+                    --size;
+                }
+
+                // A single line does not fit into a block
+                if(size == 0)
                 {
-                    return false;
+                    ok = false;
+                    break;
                 }
-                --(*row)[i];
-                --(*col)[i];
-                (*val)[i] = static_cast<ValueType>(1);
             }
+
+            buffer[len] = '\0';
+
+            const char* data = buffer;
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads)
+#endif
+            {
+                int tid = omp_get_thread_num();
+
+                // Split the block at line breaks
+                size_t begin = size / nthreads * tid;
+                size_t end   = (tid == nthreads - 1) ? size : size / nthreads * (tid + 1);
+
+                while(begin > 0 && begin < size && data[begin - 1] != '\n')
+                {
+                    ++begin;
+                }
+
+                while(end > 0 && end < size && data[end - 1] != '\n')
+                {
+                    ++end;
+                }
+
+                t_row[tid].clear();
+                t_col[tid].clear();
+                t_val[tid].clear();
+
+                t_ok[tid] = (begin >= end)
+                            || mm_parse_lines(data + begin,
+                                              data + end,
+                                              field,
+                                              nrow,
+                                              ncol,
+                                              t_row[tid],
+                                              t_col[tid],
+                                              t_val[tid]);
+            }
+
+            t_offset[0] = pos;
+            for(int t = 0; t < nthreads; ++t)
+            {
+                ok = ok && t_ok[t];
+
+                t_offset[t + 1] = t_offset[t] + static_cast<PtrType>(t_row[t].size());
+            }
+
+            if(!ok || t_offset[nthreads] > nnz)
+            {
+                ok = false;
+                break;
+            }
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads)
+#endif
+            for(int t = 0; t < nthreads; ++t)
+            {
+                std::copy(t_row[t].begin(), t_row[t].end(), row + t_offset[t]);
+                std::copy(t_col[t].begin(), t_col[t].end(), col + t_offset[t]);
+                std::copy(t_val[t].begin(), t_val[t].end(), val + t_offset[t]);
+            }
+
+            pos = t_offset[nthreads];
+
+            // Move the incomplete last line to the front
+            carry = len - size;
+            memmove(buffer, buffer + size, carry);
+
+            LOG_VERBOSE_INFO(2,
+                             "ReadFileMTX: " << pos << " of " << nnz << " entries, "
+                                             << bytes / 1e6 << " MB read");
+        }
+
+        free_host(&buffer);
+
+        if(!ok || pos != nnz)
+        {
+            return false;
+        }
+
+        double time = (rocalution_time() - tick) / 1e6;
+
+        LOG_INFO("ReadFileMTX: " << bytes / 1e6 << " MB parsed in " << time << " sec ("
+                                 << bytes / 1e6 / time << " MB/s)");
+
+        return true;
+    }
+
+    // Read banner and size line and check whether the entries fit into the offset type
+    static bool mm_read_header(FILE*      fin,
+                               mm_banner& b,
+                               mm_field&  field,
+                               bool&      symmetric,
+                               int&       nrow,
+                               int&       ncol,
+                               PtrType&   nnz)
+    {
+        if(mm_read_banner(fin, b) != true)
+        {
+            LOG_INFO("ReadFileMTX: invalid matrix market banner");
+            return false;
+        }
+
+        long long nnz_file;
+        if(mm_read_size(fin, nrow, ncol, nnz_file) != true)
+        {
+            LOG_INFO("ReadFileMTX: invalid matrix data");
+            return false;
+        }
+
+        if(!strncmp(b.matrix_type, "complex", 7))
+        {
+            field = mm_complex;
+        }
+        else if(!strncmp(b.matrix_type, "real", 4) || !strncmp(b.matrix_type, "integer", 7))
+        {
+            field = mm_real;
+        }
+        else if(!strncmp(b.matrix_type, "pattern", 7))
+        {
+            field = mm_pattern;
         }
         else
         {
+            LOG_INFO("ReadFileMTX: unsupported value type " << b.matrix_type);
+            return false;
+        }
+
+        symmetric = (strncmp(b.storage_type, "general", 7) != 0);
+
+        // Symmetric matrices are expanded to (up to) twice the number of entries
+        if(nnz_file * (symmetric ? 2 : 1) > std::numeric_limits<PtrType>::max())
+        {
+            LOG_INFO("ReadFileMTX: number of non-zero entries exceeds the offset type, "
+                     "rebuild with BUILD_64BIT_OFFSETS");
+            return false;
+        }
+
+        nnz = static_cast<PtrType>(nnz_file);
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool read_matrix_mtx(int&        nrow,
+                         int&        ncol,
+                         PtrType&    nnz,
+                         int**       row,
+                         int**       col,
+                         ValueType** val,
+                         const char* filename)
+    {
+        FILE* file = fopen(filename, "r");
+
+        if(!file)
+        {
+            LOG_INFO("ReadFileMTX: cannot open file " << filename);
+            return false;
+        }
+
+        mm_banner banner;
+        mm_field  field;
+        bool      symmetric;
+
+        if(mm_read_header(file, banner, field, symmetric, nrow, ncol, nnz) != true)
+        {
+            fclose(file);
+            return false;
+        }
+
+        // Allocate arrays
+        allocate_host(nnz, row);
+        allocate_host(nnz, col);
+        allocate_host(nnz, val);
+
+        if(mm_read_entries(file, field, nrow, ncol, nnz, *row, *col, *val) != true)
+        {
+            LOG_INFO("ReadFileMTX: invalid matrix data");
+
+            free_host(row);
+            free_host(col);
+            free_host(val);
+
+            fclose(file);
             return false;
         }
 
+        fclose(file);
+
         // Expand symmetric matrix
-        if(strncmp(b.storage_type, "general", 7))
+        if(symmetric)
         {
-            // Count diagonal entries
-            int ndiag = 0;
-            for(int i = 0; i < nnz; ++i)
+            int nthreads = omp_get_max_threads();
+
+            // Count off-diagonal entries of each thread's chunk
+            std::vector<PtrType> offset(nthreads + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads)
+#endif
             {
-                if((*row)[i] == (*col)[i])
+                int     tid   = omp_get_thread_num();
+                PtrType begin = nnz / nthreads * tid;
+                PtrType end   = (tid == nthreads - 1) ? nnz : nnz / nthreads * (tid + 1);
+
+                for(PtrType i = begin; i < end; ++i)
                 {
-                    ++ndiag;
+                    if((*row)[i] != (*col)[i])
+                    {
+                        ++offset[tid + 1];
+                    }
                 }
             }
 
-            int tot_nnz = (nnz - ndiag) * 2 + ndiag;
+            // Mirrored entries are appended behind the stored triangle
+            offset[0] = nnz;
+            for(int t = 0; t < nthreads; ++t)
+            {
+                offset[t + 1] += offset[t];
+            }
+
+            PtrType tot_nnz = offset[nthreads];
 
-            // Allocate memory
             int*       sym_row = *row;
             int*       sym_col = *col;
             ValueType* sym_val = *val;
@@ -240,29 +663,32 @@ namespace rocalution
             allocate_host(tot_nnz, col);
             allocate_host(tot_nnz, val);
 
-            int idx = 0;
-            for(int i = 0; i < nnz; ++i)
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads)
+#endif
             {
-                (*row)[idx] = sym_row[i];
-                (*col)[idx] = sym_col[i];
-                (*val)[idx] = sym_val[i];
-                ++idx;
+                int     tid   = omp_get_thread_num();
+                PtrType begin = nnz / nthreads * tid;
+                PtrType end   = (tid == nthreads - 1) ? nnz : nnz / nthreads * (tid + 1);
+                PtrType idx   = offset[tid];
 
-                // Do not write diagonal again
-                if(sym_row[i] != sym_col[i])
+                for(PtrType i = begin; i < end; ++i)
                 {
-                    (*row)[idx] = sym_col[i];
-                    (*col)[idx] = sym_row[i];
-                    (*val)[idx] = sym_val[i];
-                    ++idx;
+                    (*row)[i] = sym_row[i];
+                    (*col)[i] = sym_col[i];
+                    (*val)[i] = sym_val[i];
+
+                    // Do not write diagonal again
+                    if(sym_row[i] != sym_col[i])
+                    {
+                        (*row)[idx] = sym_col[i];
+                        (*col)[idx] = sym_row[i];
+                        (*val)[idx] = sym_val[i];
+                        ++idx;
+                    }
                 }
             }
 
-            if(idx != tot_nnz)
-            {
-                return false;
-            }
-
             nnz = tot_nnz;
 
             free_host(&sym_row);
@@ -274,8 +700,13 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    bool read_matrix_mtx(
-        int& nrow, int& ncol, int& nnz, int** row, int** col, ValueType** val, const char* filename)
+    bool read_matrix_mtx_csr(int&        nrow,
+                             int&        ncol,
+                             PtrType&    nnz,
+                             PtrType**   ptr,
+                             int**       col,
+                             ValueType** val,
+                             const char* filename)
     {
         FILE* file = fopen(filename, "r");
 
@@ -285,28 +716,134 @@ namespace rocalution
             return false;
         }
 
-        // read banner
         mm_banner banner;
-        if(mm_read_banner(file, banner) != true)
+        mm_field  field;
+        bool      symmetric;
+        PtrType   nnz_file;
+
+        if(mm_read_header(file, banner, field, symmetric, nrow, ncol, nnz_file) != true)
         {
-            LOG_INFO("ReadFileMTX: invalid matrix market banner");
+            fclose(file);
             return false;
         }
 
-        if(strncmp(banner.array_type, "coordinate", 10))
+        int*       coo_row = NULL;
+        int*       coo_col = NULL;
+        ValueType* coo_val = NULL;
+
+        allocate_host(nnz_file, &coo_row);
+        allocate_host(nnz_file, &coo_col);
+        allocate_host(nnz_file, &coo_val);
+
+        if(mm_read_entries(file, field, nrow, ncol, nnz_file, coo_row, coo_col, coo_val) != true)
         {
+            LOG_INFO("ReadFileMTX: invalid matrix data");
+
+            free_host(&coo_row);
+            free_host(&coo_col);
+            free_host(&coo_val);
+
+            fclose(file);
             return false;
         }
-        else
+
+        fclose(file);
+
+        // Count entries per row, including the mirrored ones of symmetric matrices
+        allocate_host(nrow + 1, ptr);
+        set_to_zero_host(nrow + 1, *ptr);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(PtrType i = 0; i < nnz_file; ++i)
         {
-            if(mm_read_coordinate(file, banner, nrow, ncol, nnz, row, col, val) != true)
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+            ++(*ptr)[coo_row[i] + 1];
+
+            if(symmetric && coo_row[i] != coo_col[i])
             {
-                LOG_INFO("ReadFileMTX: invalid matrix data");
-                return false;
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                ++(*ptr)[coo_col[i] + 1];
             }
         }
 
-        fclose(file);
+        for(int i = 0; i < nrow; ++i)
+        {
+            (*ptr)[i + 1] += (*ptr)[i];
+        }
+
+        nnz = (*ptr)[nrow];
+
+        allocate_host(nnz, col);
+        allocate_host(nnz, val);
+
+        // Scatter the entries into their rows
+        std::vector<PtrType> fill(*ptr, *ptr + nrow);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(PtrType i = 0; i < nnz_file; ++i)
+        {
+            int     r = coo_row[i];
+            int     c = coo_col[i];
+            PtrType idx;
+
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+            idx = fill[r]++;
+
+            (*col)[idx] = c;
+            (*val)[idx] = coo_val[i];
+
+            if(symmetric && r != c)
+            {
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+                idx = fill[c]++;
+
+                (*col)[idx] = r;
+                (*val)[idx] = coo_val[i];
+            }
+        }
+
+        free_host(&coo_row);
+        free_host(&coo_col);
+        free_host(&coo_val);
+
+        // Sort each row by column index
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(int i = 0; i < nrow; ++i)
+        {
+            PtrType row_begin = (*ptr)[i];
+            PtrType row_end   = (*ptr)[i + 1];
+
+            for(PtrType j = row_begin + 1; j < row_end; ++j)
+            {
+                int       c = (*col)[j];
+                ValueType v = (*val)[j];
+                PtrType   k = j;
+
+                while(k > row_begin && (*col)[k - 1] > c)
+                {
+                    (*col)[k] = (*col)[k - 1];
+                    (*val)[k] = (*val)[k - 1];
+                    --k;
+                }
+
+                (*col)[k] = c;
+                (*val)[k] = v;
+            }
+        }
 
         return true;
     }
@@ -371,7 +908,7 @@ namespace rocalution
     template <typename ValueType>
     bool write_matrix_mtx(int              nrow,
                           int              ncol,
-                          int              nnz,
+                          PtrType          nnz,
                           const int*       row,
                           const int*       col,
                           const ValueType* val,
@@ -389,9 +926,9 @@ namespace rocalution
         write_banner<ValueType>(file);
 
         // Write matrix sizes
-        fprintf(file, "%d %d %d\n", nrow, ncol, nnz);
+        fprintf(file, "%d %d %lld\n", nrow, ncol, static_cast<long long>(nnz));
 
-        for(int i = 0; i < nnz; ++i)
+        for(PtrType i = 0; i < nnz; ++i)
         {
             fprintf(file, "%d %d ", row[i] + 1, col[i] + 1);
             write_value(file, val[i]);
@@ -402,7 +939,297 @@ namespace rocalution
         return true;
     }
 
-    static inline void read_csr_values(std::ifstream& in, int nnz, float* val)
+    // Mapped binary CSR layout: a 64 byte header followed by the row offsets, column
+    // indices and values, each starting at a multiple of 64 bytes, such that the file
+    // can be memory mapped and its arrays used in place
+    static const char csr_file_magic[16] = {
+        '#', 'r', 'o', 'c', 'A', 'L', 'U', 'T', 'I', 'O', 'N', ' ', 'c', 's', 'r', '\n'};
+
+    static const int32_t csr_file_version    = 1;
+    static const int32_t csr_file_byte_order = 0x01020304;
+    static const int64_t csr_file_alignment  = 64;
+
+    struct csr_file_header
+    {
+        char    magic[16];
+        int32_t version;
+        int32_t rocalution_version;
+        int32_t byte_order;
+        int32_t value_type;
+        int32_t offset_size;
+        int32_t index_size;
+        int64_t nrow;
+        int64_t ncol;
+        int64_t nnz;
+    };
+
+    static_assert(sizeof(csr_file_header) == 64, "csr_file_header must be 64 bytes");
+
+    // On-disk value type tags
+    enum csr_file_value_type
+    {
+        csr_file_float          = 0,
+        csr_file_double         = 1,
+        csr_file_complex_float  = 2,
+        csr_file_complex_double = 3
+    };
+
+    static inline int32_t csr_file_type(const float*)
+    {
+        return csr_file_float;
+    }
+
+    static inline int32_t csr_file_type(const double*)
+    {
+        return csr_file_double;
+    }
+
+    static inline int32_t csr_file_type(const std::complex<float>*)
+    {
+        return csr_file_complex_float;
+    }
+
+    static inline int32_t csr_file_type(const std::complex<double>*)
+    {
+        return csr_file_complex_double;
+    }
+
+    static inline int64_t csr_file_align(int64_t offset)
+    {
+        return (offset + csr_file_alignment - 1) / csr_file_alignment * csr_file_alignment;
+    }
+
+    // Element conversion between on-disk and in-memory types, real and complex data
+    // cannot be converted into each other
+    template <typename DataType,
+              typename FileType,
+              typename std::enable_if<std::is_arithmetic<DataType>::value
+                                          == std::is_arithmetic<FileType>::value,
+                                      int>::type
+              = 0>
+    static bool csr_file_convert(int64_t size, const FileType* src, DataType* dst)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(int64_t i = 0; i < size; ++i)
+        {
+            dst[i] = static_cast<DataType>(src[i]);
+        }
+
+        return true;
+    }
+
+    template <typename DataType,
+              typename FileType,
+              typename std::enable_if<std::is_arithmetic<DataType>::value
+                                          != std::is_arithmetic<FileType>::value,
+                                      int>::type
+              = 0>
+    static bool csr_file_convert(int64_t size, const FileType* src, DataType* dst)
+    {
+        return false;
+    }
+
+    // Provide a section of the file as array of DataType. If the file is mapped and the
+    // types match, the array aliases the mapping, otherwise it is read and converted.
+    template <typename DataType, typename FileType>
+    static bool csr_file_section(const char*    base,
+                                 std::ifstream& in,
+                                 int64_t        offset,
+                                 int64_t        size,
+                                 DataType**     data)
+    {
+        if(size == 0)
+        {
+            return true;
+        }
+
+        if(base != NULL && std::is_same<DataType, FileType>::value)
+        {
+            *data = reinterpret_cast<DataType*>(const_cast<char*>(base) + offset);
+            alias_mapped_host(base, *data);
+
+            return true;
+        }
+
+        allocate_host(size, data);
+
+        bool success;
+
+        if(base != NULL)
+        {
+            success
+                = csr_file_convert(size, reinterpret_cast<const FileType*>(base + offset), *data);
+        }
+        else if(std::is_same<DataType, FileType>::value)
+        {
+            in.seekg(offset);
+            in.read(reinterpret_cast<char*>(*data), size * sizeof(FileType));
+
+            success = static_cast<bool>(in);
+        }
+        else
+        {
+            std::vector<FileType> tmp(size);
+
+            in.seekg(offset);
+            in.read(reinterpret_cast<char*>(tmp.data()), size * sizeof(FileType));
+
+            success = static_cast<bool>(in) && csr_file_convert(size, tmp.data(), *data);
+        }
+
+        if(!success)
+        {
+            free_host(data);
+        }
+
+        return success;
+    }
+
+    template <typename ValueType, typename FileValueType>
+    static bool read_matrix_csr_mapped(const csr_file_header& header,
+                                       const char*            base,
+                                       std::ifstream&         in,
+                                       PtrType**              ptr,
+                                       int**                  col,
+                                       ValueType**            val)
+    {
+        int64_t ptr_offset = csr_file_alignment;
+        int64_t col_offset = csr_file_align(ptr_offset + (header.nrow + 1) * header.offset_size);
+        int64_t val_offset = csr_file_align(col_offset + header.nnz * header.index_size);
+
+        bool success
+            = (header.offset_size == sizeof(int32_t))
+                  ? csr_file_section<PtrType, int32_t>(base, in, ptr_offset, header.nrow + 1, ptr)
+                  : csr_file_section<PtrType, int64_t>(base, in, ptr_offset, header.nrow + 1, ptr);
+
+        success = success && csr_file_section<int, int32_t>(base, in, col_offset, header.nnz, col);
+        success = success
+                  && csr_file_section<ValueType, FileValueType>(
+                      base, in, val_offset, header.nnz, val);
+
+        if(!success)
+        {
+            if(*ptr != NULL)
+            {
+                free_host(ptr);
+            }
+
+            if(*col != NULL)
+            {
+                free_host(col);
+            }
+        }
+
+        return success;
+    }
+
+    template <typename ValueType>
+    static bool read_matrix_csr_mapped(std::ifstream& in,
+                                       int&           nrow,
+                                       int&           ncol,
+                                       PtrType&       nnz,
+                                       PtrType**      ptr,
+                                       int**          col,
+                                       ValueType**    val,
+                                       const char*    filename)
+    {
+        double tick = rocalution_time();
+
+        csr_file_header header;
+        in.seekg(0);
+        in.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+        if(!in || header.version != csr_file_version || header.byte_order != csr_file_byte_order
+           || (header.offset_size != sizeof(int32_t) && header.offset_size != sizeof(int64_t))
+           || header.index_size != sizeof(int32_t) || header.value_type < csr_file_float
+           || header.value_type > csr_file_complex_double)
+        {
+            LOG_INFO("ReadFileCSR: unsupported rocALUTION binary csr file");
+            return false;
+        }
+
+        if(header.nrow > std::numeric_limits<int>::max()
+           || header.ncol > std::numeric_limits<int>::max()
+           || header.nnz > std::numeric_limits<PtrType>::max())
+        {
+            LOG_INFO("ReadFileCSR: matrix sizes exceed the index or offset type");
+            return false;
+        }
+
+        static const int64_t value_size[] = {sizeof(float),
+                                             sizeof(double),
+                                             sizeof(std::complex<float>),
+                                             sizeof(std::complex<double>)};
+
+        int64_t ptr_offset = csr_file_alignment;
+        int64_t col_offset = csr_file_align(ptr_offset + (header.nrow + 1) * header.offset_size);
+        int64_t val_offset = csr_file_align(col_offset + header.nnz * header.index_size);
+        int64_t file_size  = val_offset + header.nnz * value_size[header.value_type];
+
+        // Map the file, fall back to reading it if mapping is not available
+        char*   base   = NULL;
+        int64_t size   = 0;
+        bool    mapped = map_file_host(filename, &size, &base);
+
+        if(mapped == true && size < file_size)
+        {
+            free_host(&base);
+
+            LOG_INFO("ReadFileCSR: invalid matrix data");
+            return false;
+        }
+
+        *ptr = NULL;
+        *col = NULL;
+        *val = NULL;
+
+        bool success = false;
+
+        switch(header.value_type)
+        {
+        case csr_file_float:
+            success = read_matrix_csr_mapped<ValueType, float>(header, base, in, ptr, col, val);
+            break;
+        case csr_file_double:
+            success = read_matrix_csr_mapped<ValueType, double>(header, base, in, ptr, col, val);
+            break;
+        case csr_file_complex_float:
+            success = read_matrix_csr_mapped<ValueType, std::complex<float>>(
+                header, base, in, ptr, col, val);
+            break;
+        case csr_file_complex_double:
+            success = read_matrix_csr_mapped<ValueType, std::complex<double>>(
+                header, base, in, ptr, col, val);
+            break;
+        }
+
+        // Release the handle of the mapping, the arrays keep it alive
+        if(base != NULL)
+        {
+            free_host(&base);
+        }
+
+        if(!success)
+        {
+            LOG_INFO("ReadFileCSR: invalid matrix data");
+            return false;
+        }
+
+        nrow = static_cast<int>(header.nrow);
+        ncol = static_cast<int>(header.ncol);
+        nnz  = static_cast<PtrType>(header.nnz);
+
+        LOG_VERBOSE_INFO(2,
+                         "ReadFileCSR: " << (mapped ? "mapped " : "read ") << file_size / 1e6
+                                         << " MB in " << (rocalution_time() - tick) / 1e6
+                                         << " sec");
+
+        return true;
+    }
+
+    static inline void read_csr_values(std::ifstream& in, PtrType nnz, float* val)
     {
         // Temporary array to convert from double to float
         std::vector<double> tmp(nnz);
@@ -413,19 +1240,19 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-        for(int i = 0; i < nnz; ++i)
+        for(PtrType i = 0; i < nnz; ++i)
         {
             val[i] = static_cast<float>(tmp[i]);
         }
     }
 
-    static inline void read_csr_values(std::ifstream& in, int nnz, double* val)
+    static inline void read_csr_values(std::ifstream& in, PtrType nnz, double* val)
     {
         // Read double values
         in.read((char*)val, sizeof(double) * nnz);
     }
 
-    static inline void read_csr_values(std::ifstream& in, int nnz, std::complex<float>* val)
+    static inline void read_csr_values(std::ifstream& in, PtrType nnz, std::complex<float>* val)
     {
         // Temporary array to convert from complex double to complex float
         std::vector<std::complex<double>> tmp(nnz);
@@ -436,22 +1263,27 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-        for(int i = 0; i < nnz; ++i)
+        for(PtrType i = 0; i < nnz; ++i)
         {
             val[i] = std::complex<float>(static_cast<float>(tmp[i].real()),
                                          static_cast<float>(tmp[i].imag()));
         }
     }
 
-    static inline void read_csr_values(std::ifstream& in, int nnz, std::complex<double>* val)
+    static inline void read_csr_values(std::ifstream& in, PtrType nnz, std::complex<double>* val)
     {
         // Read in double complex values
         in.read((char*)val, sizeof(std::complex<double>) * nnz);
     }
 
     template <typename ValueType>
-    bool read_matrix_csr(
-        int& nrow, int& ncol, int& nnz, int** ptr, int** col, ValueType** val, const char* filename)
+    bool read_matrix_csr(int&        nrow,
+                         int&        ncol,
+                         PtrType&    nnz,
+                         PtrType**   ptr,
+                         int**       col,
+                         ValueType** val,
+                         const char* filename)
     {
         std::ifstream in(filename, std::ios::in | std::ios::binary);
 
@@ -461,6 +1293,18 @@ namespace rocalution
             return false;
         }
 
+        // Files in the mapped layout are identified by their magic
+        char magic[sizeof(csr_file_magic)];
+        in.read(magic, sizeof(magic));
+
+        if(in && memcmp(magic, csr_file_magic, sizeof(magic)) == 0)
+        {
+            return read_matrix_csr_mapped(in, nrow, ncol, nnz, ptr, col, val, filename);
+        }
+
+        in.clear();
+        in.seekg(0);
+
         // Header
         std::string header;
         std::getline(in, header);
@@ -481,10 +1325,13 @@ namespace rocalution
         //            return false;
         //        }
 
-        // Read sizes
+        // Read sizes (the file stores 32 bit row offsets)
+        int nnz_file;
         in.read((char*)&nrow, sizeof(int));
         in.read((char*)&ncol, sizeof(int));
-        in.read((char*)&nnz, sizeof(int));
+        in.read((char*)&nnz_file, sizeof(int));
+
+        nnz = nnz_file;
 
         // Allocate arrays
         allocate_host(nrow + 1, ptr);
@@ -492,7 +1339,21 @@ namespace rocalution
         allocate_host(nnz, val);
 
         // Read data
-        in.read((char*)*ptr, (nrow + 1) * sizeof(int));
+        if(sizeof(PtrType) == sizeof(int))
+        {
+            in.read((char*)*ptr, (nrow + 1) * sizeof(int));
+        }
+        else
+        {
+            std::vector<int> tmp(nrow + 1);
+            in.read((char*)tmp.data(), (nrow + 1) * sizeof(int));
+
+            for(int i = 0; i < nrow + 1; ++i)
+            {
+                (*ptr)[i] = tmp[i];
+            }
+        }
+
         in.read((char*)*col, nnz * sizeof(int));
 
         read_csr_values(in, nnz, *val);
@@ -509,7 +1370,7 @@ namespace rocalution
         return true;
     }
 
-    static inline void write_csr_values(std::ofstream& out, int nnz, const float* val)
+    static inline void write_csr_values(std::ofstream& out, PtrType nnz, const float* val)
     {
         // Temporary array to convert from float to double
         std::vector<double> tmp(nnz);
@@ -518,7 +1379,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-        for(int i = 0; i < nnz; ++i)
+        for(PtrType i = 0; i < nnz; ++i)
         {
             tmp[i] = static_cast<double>(val[i]);
         }
@@ -527,13 +1388,14 @@ namespace rocalution
         out.write((char*)tmp.data(), sizeof(double) * nnz);
     }
 
-    static inline void write_csr_values(std::ofstream& out, int nnz, const double* val)
+    static inline void write_csr_values(std::ofstream& out, PtrType nnz, const double* val)
     {
         // Write double values
         out.write((char*)val, sizeof(double) * nnz);
     }
 
-    static inline void write_csr_values(std::ofstream& out, int nnz, const std::complex<float>* val)
+    static inline void
+        write_csr_values(std::ofstream& out, PtrType nnz, const std::complex<float>* val)
     {
         // Temporary array to convert from complex float to complex double
         std::vector<std::complex<double>> tmp(nnz);
@@ -542,7 +1404,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-        for(int i = 0; i < nnz; ++i)
+        for(PtrType i = 0; i < nnz; ++i)
         {
             tmp[i] = std::complex<double>(static_cast<double>(val[i].real()),
                                           static_cast<double>(val[i].imag()));
@@ -553,7 +1415,7 @@ namespace rocalution
     }
 
     static inline void
-        write_csr_values(std::ofstream& out, int nnz, const std::complex<double>* val)
+        write_csr_values(std::ofstream& out, PtrType nnz, const std::complex<double>* val)
     {
         // Write double complex values
         out.write((char*)val, sizeof(std::complex<double>) * nnz);
@@ -562,12 +1424,19 @@ namespace rocalution
     template <typename ValueType>
     bool write_matrix_csr(int              nrow,
                           int              ncol,
-                          int              nnz,
-                          const int*       ptr,
+                          PtrType          nnz,
+                          const PtrType*   ptr,
                           const int*       col,
                           const ValueType* val,
                           const char*      filename)
     {
+        // The file stores 32 bit row offsets
+        if(nnz > std::numeric_limits<int>::max())
+        {
+            LOG_INFO("WriteFileCSR: number of non-zero entries exceeds the file format");
+            return false;
+        }
+
         std::ofstream out(filename, std::ios::out | std::ios::binary);
 
         if(!out.is_open())
@@ -584,12 +1453,22 @@ namespace rocalution
         out.write((char*)&version, sizeof(int));
 
         // Write matrix sizes
+        int nnz_file = static_cast<int>(nnz);
         out.write((char*)&nrow, sizeof(int));
         out.write((char*)&ncol, sizeof(int));
-        out.write((char*)&nnz, sizeof(int));
+        out.write((char*)&nnz_file, sizeof(int));
 
         // Write matrix data
-        out.write((char*)ptr, (nrow + 1) * sizeof(int));
+        if(sizeof(PtrType) == sizeof(int))
+        {
+            out.write((char*)ptr, (nrow + 1) * sizeof(int));
+        }
+        else
+        {
+            std::vector<int> tmp(ptr, ptr + nrow + 1);
+            out.write((char*)tmp.data(), (nrow + 1) * sizeof(int));
+        }
+
         out.write((char*)col, nnz * sizeof(int));
 
         write_csr_values(out, nnz, val);
@@ -606,37 +1485,140 @@ namespace rocalution
         return true;
     }
 
-    template bool read_matrix_mtx(
-        int& nrow, int& ncol, int& nnz, int** row, int** col, float** val, const char* filename);
-    template bool read_matrix_mtx(
-        int& nrow, int& ncol, int& nnz, int** row, int** col, double** val, const char* filename);
+    template <typename ValueType>
+    bool write_matrix_csr_mapped(int              nrow,
+                                 int              ncol,
+                                 PtrType          nnz,
+                                 const PtrType*   ptr,
+                                 const int*       col,
+                                 const ValueType* val,
+                                 const char*      filename)
+    {
+        std::ofstream out(filename, std::ios::out | std::ios::binary);
+
+        if(!out.is_open())
+        {
+            LOG_INFO("WriteFileCSR: cannot open file " << filename);
+            return false;
+        }
+
+        // Header
+        csr_file_header header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, csr_file_magic, sizeof(csr_file_magic));
+
+        header.version            = csr_file_version;
+        header.rocalution_version = __ROCALUTION_VER;
+        header.byte_order         = csr_file_byte_order;
+        header.value_type         = csr_file_type(val);
+        header.offset_size        = sizeof(PtrType);
+        header.index_size         = sizeof(int);
+        header.nrow               = nrow;
+        header.ncol               = ncol;
+        header.nnz                = nnz;
+
+        out.write((char*)&header, sizeof(header));
+
+        // Each section starts at a multiple of the alignment, gaps are zero padded
+        const char padding[csr_file_alignment] = {};
+
+        int64_t offset = sizeof(header);
+
+        out.write((char*)ptr, (nrow + 1) * sizeof(PtrType));
+        offset += (nrow + 1) * sizeof(PtrType);
+        out.write(padding, csr_file_align(offset) - offset);
+        offset = csr_file_align(offset);
+
+        out.write((char*)col, nnz * sizeof(int));
+        offset += nnz * sizeof(int);
+        out.write(padding, csr_file_align(offset) - offset);
+
+        out.write((char*)val, nnz * sizeof(ValueType));
+
+        // Check ofstream status
+        if(!out)
+        {
+            LOG_INFO("WriteFileCSR: filename=" << filename << "; could not write to file");
+            return false;
+        }
+
+        out.close();
+
+        return true;
+    }
+
+    template bool read_matrix_mtx(int&        nrow,
+                                  int&        ncol,
+                                  PtrType&    nnz,
+                                  int**       row,
+                                  int**       col,
+                                  float**     val,
+                                  const char* filename);
+    template bool read_matrix_mtx(int&        nrow,
+                                  int&        ncol,
+                                  PtrType&    nnz,
+                                  int**       row,
+                                  int**       col,
+                                  double**    val,
+                                  const char* filename);
 #ifdef SUPPORT_COMPLEX
     template bool read_matrix_mtx(int&                  nrow,
                                   int&                  ncol,
-                                  int&                  nnz,
+                                  PtrType&              nnz,
                                   int**                 row,
                                   int**                 col,
                                   std::complex<float>** val,
                                   const char*           filename);
     template bool read_matrix_mtx(int&                   nrow,
                                   int&                   ncol,
-                                  int&                   nnz,
+                                  PtrType&               nnz,
                                   int**                  row,
                                   int**                  col,
                                   std::complex<double>** val,
                                   const char*            filename);
 #endif
 
+    template bool read_matrix_mtx_csr(int&        nrow,
+                                      int&        ncol,
+                                      PtrType&    nnz,
+                                      PtrType**   ptr,
+                                      int**       col,
+                                      float**     val,
+                                      const char* filename);
+    template bool read_matrix_mtx_csr(int&        nrow,
+                                      int&        ncol,
+                                      PtrType&    nnz,
+                                      PtrType**   ptr,
+                                      int**       col,
+                                      double**    val,
+                                      const char* filename);
+#ifdef SUPPORT_COMPLEX
+    template bool read_matrix_mtx_csr(int&                  nrow,
+                                      int&                  ncol,
+                                      PtrType&              nnz,
+                                      PtrType**             ptr,
+                                      int**                 col,
+                                      std::complex<float>** val,
+                                      const char*           filename);
+    template bool read_matrix_mtx_csr(int&                   nrow,
+                                      int&                   ncol,
+                                      PtrType&               nnz,
+                                      PtrType**              ptr,
+                                      int**                  col,
+                                      std::complex<double>** val,
+                                      const char*            filename);
+#endif
+
     template bool write_matrix_mtx(int          nrow,
                                    int          ncol,
-                                   int          nnz,
+                                   PtrType      nnz,
                                    const int*   row,
                                    const int*   col,
                                    const float* val,
                                    const char*  filename);
     template bool write_matrix_mtx(int           nrow,
                                    int           ncol,
-                                   int           nnz,
+                                   PtrType       nnz,
                                    const int*    row,
                                    const int*    col,
                                    const double* val,
@@ -644,70 +1626,111 @@ namespace rocalution
 #ifdef SUPPORT_COMPLEX
     template bool write_matrix_mtx(int                        nrow,
                                    int                        ncol,
-                                   int                        nnz,
+                                   PtrType                    nnz,
                                    const int*                 row,
                                    const int*                 col,
                                    const std::complex<float>* val,
                                    const char*                filename);
     template bool write_matrix_mtx(int                         nrow,
                                    int                         ncol,
-                                   int                         nnz,
+                                   PtrType                     nnz,
                                    const int*                  row,
                                    const int*                  col,
                                    const std::complex<double>* val,
                                    const char*                 filename);
 #endif
 
-    template bool read_matrix_csr(
-        int& nrow, int& ncol, int& nnz, int** ptr, int** col, float** val, const char* filename);
-    template bool read_matrix_csr(
-        int& nrow, int& ncol, int& nnz, int** ptr, int** col, double** val, const char* filename);
+    template bool read_matrix_csr(int&        nrow,
+                                  int&        ncol,
+                                  PtrType&    nnz,
+                                  PtrType**   ptr,
+                                  int**       col,
+                                  float**     val,
+                                  const char* filename);
+    template bool read_matrix_csr(int&        nrow,
+                                  int&        ncol,
+                                  PtrType&    nnz,
+                                  PtrType**   ptr,
+                                  int**       col,
+                                  double**    val,
+                                  const char* filename);
 #ifdef SUPPORT_COMPLEX
     template bool read_matrix_csr(int&                  nrow,
                                   int&                  ncol,
-                                  int&                  nnz,
-                                  int**                 ptr,
+                                  PtrType&              nnz,
+                                  PtrType**             ptr,
                                   int**                 col,
                                   std::complex<float>** val,
                                   const char*           filename);
     template bool read_matrix_csr(int&                   nrow,
                                   int&                   ncol,
-                                  int&                   nnz,
-                                  int**                  ptr,
+                                  PtrType&               nnz,
+                                  PtrType**              ptr,
                                   int**                  col,
                                   std::complex<double>** val,
                                   const char*            filename);
 #endif
 
-    template bool write_matrix_csr(int          nrow,
-                                   int          ncol,
-                                   int          nnz,
-                                   const int*   ptr,
-                                   const int*   col,
-                                   const float* val,
-                                   const char*  filename);
-    template bool write_matrix_csr(int           nrow,
-                                   int           ncol,
-                                   int           nnz,
-                                   const int*    ptr,
-                                   const int*    col,
-                                   const double* val,
-                                   const char*   filename);
+    template bool write_matrix_csr(int            nrow,
+                                   int            ncol,
+                                   PtrType        nnz,
+                                   const PtrType* ptr,
+                                   const int*     col,
+                                   const float*   val,
+                                   const char*    filename);
+    template bool write_matrix_csr(int            nrow,
+                                   int            ncol,
+                                   PtrType        nnz,
+                                   const PtrType* ptr,
+                                   const int*     col,
+                                   const double*  val,
+                                   const char*    filename);
 #ifdef SUPPORT_COMPLEX
     template bool write_matrix_csr(int                        nrow,
                                    int                        ncol,
-                                   int                        nnz,
-                                   const int*                 ptr,
+                                   PtrType                    nnz,
+                                   const PtrType*             ptr,
                                    const int*                 col,
                                    const std::complex<float>* val,
                                    const char*                filename);
     template bool write_matrix_csr(int                         nrow,
                                    int                         ncol,
-                                   int                         nnz,
-                                   const int*                  ptr,
+                                   PtrType                     nnz,
+                                   const PtrType*              ptr,
                                    const int*                  col,
                                    const std::complex<double>* val,
                                    const char*                 filename);
 #endif
 
+    template bool write_matrix_csr_mapped(int            nrow,
+                                          int            ncol,
+                                          PtrType        nnz,
+                                          const PtrType* ptr,
+                                          const int*     col,
+                                          const float*   val,
+                                          const char*    filename);
+    template bool write_matrix_csr_mapped(int            nrow,
+                                          int            ncol,
+                                          PtrType        nnz,
+                                          const PtrType* ptr,
+                                          const int*     col,
+                                          const double*  val,
+                                          const char*    filename);
+#ifdef SUPPORT_COMPLEX
+    template bool write_matrix_csr_mapped(int                        nrow,
+                                          int                        ncol,
+                                          PtrType                    nnz,
+                                          const PtrType*             ptr,
+                                          const int*                 col,
+                                          const std::complex<float>* val,
+                                          const char*                filename);
+    template bool write_matrix_csr_mapped(int                         nrow,
+                                          int                         ncol,
+                                          PtrType                     nnz,
+                                          const PtrType*              ptr,
+                                          const int*                  col,
+                                          const std::complex<double>* val,
+                                          const char*                 filename);
+#endif
+
 } // namespace rocalution
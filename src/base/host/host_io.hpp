@@ -24,6 +24,8 @@
 #ifndef ROCALUTION_HOST_IO_HPP_
 #define ROCALUTION_HOST_IO_HPP_
 
+#include "../../utils/types.hpp"
+
 #include <string>
 
 namespace rocalution
@@ -32,16 +34,25 @@ namespace rocalution
     template <typename ValueType>
     bool read_matrix_mtx(int&        nrow,
                          int&        ncol,
-                         int&        nnz,
+                         PtrType&    nnz,
                          int**       row,
                          int**       col,
                          ValueType** val,
                          const char* filename);
 
+    template <typename ValueType>
+    bool read_matrix_mtx_csr(int&        nrow,
+                             int&        ncol,
+                             PtrType&    nnz,
+                             PtrType**   ptr,
+                             int**       col,
+                             ValueType** val,
+                             const char* filename);
+
     template <typename ValueType>
     bool write_matrix_mtx(int              nrow,
                           int              ncol,
-                          int              nnz,
+                          PtrType          nnz,
                           const int*       row,
                           const int*       col,
                           const ValueType* val,
@@ -50,8 +61,8 @@ namespace rocalution
     template <typename ValueType>
     bool read_matrix_csr(int&        nrow,
                          int&        ncol,
-                         int&        nnz,
-                         int**       ptr,
+                         PtrType&    nnz,
+                         PtrType**   ptr,
                          int**       col,
                          ValueType** val,
                          const char* filename);
@@ -59,12 +70,21 @@ namespace rocalution
     template <typename ValueType>
     bool write_matrix_csr(int              nrow,
                           int              ncol,
-                          int              nnz,
-                          const int*       ptr,
+                          PtrType          nnz,
+                          const PtrType*   ptr,
                           const int*       col,
                           const ValueType* val,
                           const char*      filename);
 
+    template <typename ValueType>
+    bool write_matrix_csr_mapped(int              nrow,
+                                 int              ncol,
+                                 PtrType          nnz,
+                                 const PtrType*   ptr,
+                                 const int*       col,
+                                 const ValueType* val,
+                                 const char*      filename);
+
 } // namespace rocalution
 
 #endif // ROCALUTION_HOST_IO_HPP_
@@ -97,7 +97,7 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void HostMatrixCOO<ValueType>::AllocateCOO(int nnz, int nrow, int ncol)
+    void HostMatrixCOO<ValueType>::AllocateCOO(PtrType nnz, int nrow, int ncol)
     {
         assert(nnz >= 0);
         assert(ncol >= 0);
@@ -126,7 +126,7 @@ namespace rocalution
 
     template <typename ValueType>
     void HostMatrixCOO<ValueType>::SetDataPtrCOO(
-        int** row, int** col, ValueType** val, int nnz, int nrow, int ncol)
+        int** row, int** col, ValueType** val, PtrType nnz, int nrow, int ncol)
     {
         assert(*row != NULL);
         assert(*col != NULL);
@@ -180,7 +180,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-            for(int i = 0; i < this->nnz_; ++i)
+            for(PtrType i = 0; i < this->nnz_; ++i)
             {
                 this->mat_.row[i] = row[i];
             }
@@ -188,7 +188,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-            for(int j = 0; j < this->nnz_; ++j)
+            for(PtrType j = 0; j < this->nnz_; ++j)
             {
                 this->mat_.col[j] = col[j];
             }
@@ -196,7 +196,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-            for(int j = 0; j < this->nnz_; ++j)
+            for(PtrType j = 0; j < this->nnz_; ++j)
             {
                 this->mat_.val[j] = val[j];
             }
@@ -216,7 +216,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-            for(int i = 0; i < this->nnz_; ++i)
+            for(PtrType i = 0; i < this->nnz_; ++i)
             {
                 row[i] = this->mat_.row[i];
             }
@@ -224,7 +224,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-            for(int j = 0; j < this->nnz_; ++j)
+            for(PtrType j = 0; j < this->nnz_; ++j)
             {
                 col[j] = this->mat_.col[j];
             }
@@ -232,7 +232,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-            for(int j = 0; j < this->nnz_; ++j)
+            for(PtrType j = 0; j < this->nnz_; ++j)
             {
                 val[j] = this->mat_.val[j];
             }
@@ -264,7 +264,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-                for(int j = 0; j < this->nnz_; ++j)
+                for(PtrType j = 0; j < this->nnz_; ++j)
                 {
                     this->mat_.row[j] = cast_mat->mat_.row[j];
                 }
@@ -272,7 +272,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-                for(int j = 0; j < this->nnz_; ++j)
+                for(PtrType j = 0; j < this->nnz_; ++j)
                 {
                     this->mat_.col[j] = cast_mat->mat_.col[j];
                 }
@@ -280,7 +280,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-                for(int j = 0; j < this->nnz_; ++j)
+                for(PtrType j = 0; j < this->nnz_; ++j)
                 {
                     this->mat_.val[j] = cast_mat->mat_.val[j];
                 }
@@ -345,9 +345,9 @@ namespace rocalution
     template <typename ValueType>
     bool HostMatrixCOO<ValueType>::ReadFileMTX(const std::string& filename)
     {
-        int nrow;
-        int ncol;
-        int nnz;
+        int     nrow;
+        int     ncol;
+        PtrType nnz;
 
         int*       row = NULL;
         int*       col = NULL;
@@ -407,7 +407,7 @@ namespace rocalution
             cast_out->vec_[i] = static_cast<ValueType>(0);
         }
 
-        for(int i = 0; i < this->nnz_; ++i)
+        for(PtrType i = 0; i < this->nnz_; ++i)
         {
             cast_out->vec_[this->mat_.row[i]]
                 += this->mat_.val[i] * cast_in->vec_[this->mat_.col[i]];
@@ -432,7 +432,7 @@ namespace rocalution
             assert(cast_in != NULL);
             assert(cast_out != NULL);
 
-            for(int i = 0; i < this->nnz_; ++i)
+            for(PtrType i = 0; i < this->nnz_; ++i)
             {
                 cast_out->vec_[this->mat_.row[i]]
                     += scalar * this->mat_.val[i] * cast_in->vec_[this->mat_.col[i]];
@@ -446,11 +446,11 @@ namespace rocalution
         if(this->nnz_ > 0)
         {
             // Sort by row and column index
-            std::vector<int> perm(this->nnz_);
+            std::vector<PtrType> perm(this->nnz_);
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-            for(int i = 0; i < this->nnz_; ++i)
+            for(PtrType i = 0; i < this->nnz_; ++i)
             {
                 perm[i] = i;
             }
@@ -468,7 +468,7 @@ namespace rocalution
             allocate_host(this->nnz_, &this->mat_.val);
 
             // Compare function object to sort by row first, then by column
-            std::sort(perm.begin(), perm.end(), [&](const int& a, const int& b) {
+            std::sort(perm.begin(), perm.end(), [&](const PtrType& a, const PtrType& b) {
                 if(row[a] < row[b])
                     return true;
                 if(row[a] == row[b])
@@ -479,7 +479,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-            for(int i = 0; i < this->nnz_; ++i)
+            for(PtrType i = 0; i < this->nnz_; ++i)
             {
                 this->mat_.row[i] = row[perm[i]];
                 this->mat_.col[i] = col[perm[i]];
@@ -512,7 +512,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-        for(int i = 0; i < this->nnz_; ++i)
+        for(PtrType i = 0; i < this->nnz_; ++i)
         {
             this->mat_.row[i] = cast_perm->vec_[src.mat_.row[i]];
             this->mat_.col[i] = cast_perm->vec_[src.mat_.col[i]];
@@ -552,7 +552,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-        for(int i = 0; i < this->nnz_; ++i)
+        for(PtrType i = 0; i < this->nnz_; ++i)
         {
             this->mat_.row[i] = pb[src.mat_.row[i]];
             this->mat_.col[i] = pb[src.mat_.col[i]];
@@ -571,7 +571,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-        for(int i = 0; i < this->nnz_; ++i)
+        for(PtrType i = 0; i < this->nnz_; ++i)
         {
             this->mat_.val[i] *= alpha;
         }
@@ -587,7 +587,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-        for(int i = 0; i < this->nnz_; ++i)
+        for(PtrType i = 0; i < this->nnz_; ++i)
         {
             if(this->mat_.row[i] == this->mat_.col[i])
             {
@@ -606,7 +606,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-        for(int i = 0; i < this->nnz_; ++i)
+        for(PtrType i = 0; i < this->nnz_; ++i)
         {
             if(this->mat_.row[i] != this->mat_.col[i])
             {
@@ -625,7 +625,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-        for(int i = 0; i < this->nnz_; ++i)
+        for(PtrType i = 0; i < this->nnz_; ++i)
         {
             this->mat_.val[i] += alpha;
         }
@@ -641,7 +641,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-        for(int i = 0; i < this->nnz_; ++i)
+        for(PtrType i = 0; i < this->nnz_; ++i)
         {
             if(this->mat_.row[i] == this->mat_.col[i])
             {
@@ -660,7 +660,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-        for(int i = 0; i < this->nnz_; ++i)
+        for(PtrType i = 0; i < this->nnz_; ++i)
         {
             if(this->mat_.row[i] != this->mat_.col[i])
             {
@@ -46,10 +46,10 @@ namespace rocalution
         }
 
         virtual void Clear(void);
-        virtual void AllocateCOO(int nnz, int nrow, int ncol);
+        virtual void AllocateCOO(PtrType nnz, int nrow, int ncol);
 
         virtual void
-            SetDataPtrCOO(int** row, int** col, ValueType** val, int nnz, int nrow, int ncol);
+            SetDataPtrCOO(int** row, int** col, ValueType** val, PtrType nnz, int nrow, int ncol);
         virtual void LeaveDataPtrCOO(int** row, int** col, ValueType** val);
 
         virtual bool Scale(ValueType alpha);
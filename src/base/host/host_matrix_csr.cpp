@@ -37,12 +37,15 @@
 #include "host_matrix_ell.hpp"
 #include "host_matrix_hyb.hpp"
 #include "host_matrix_mcsr.hpp"
+#include "host_matrix_sell.hpp"
+#include "host_simd.hpp"
 #include "host_vector.hpp"
 
 #include <algorithm>
 #include <complex>
 #include <limits>
 #include <map>
+#include <set>
 #include <math.h>
 #include <string.h>
 #include <unordered_set>
@@ -61,6 +64,229 @@
 namespace rocalution
 {
 
+    // Computes the level sets of a sparse triangular solve. Row ai depends on all rows
+    // that are referenced by its strictly lower (lower == true) or strictly upper
+    // (lower == false) entries. All rows of the same level are independent of each
+    // other and can be processed in parallel, once all previous levels are done.
+    // Rows are stored in processing order, with level_offset pointing to the first
+    // row of each level.
+    static void host_csr_level_analysis(int            nrow,
+                                        const PtrType* row_offset,
+                                        const int*     col,
+                                        bool           lower,
+                                        int*           nlevel,
+                                        int**          level_offset,
+                                        int**          level_row)
+    {
+        assert(nrow > 0);
+        assert(*level_offset == NULL);
+        assert(*level_row == NULL);
+
+        int* level = NULL;
+        allocate_host(nrow, &level);
+
+        int max_level = 0;
+
+        // Level of each row is one above the highest level of its dependencies
+        for(int i = 0; i < nrow; ++i)
+        {
+            int ai  = (lower == true) ? i : nrow - 1 - i;
+            int lev = 0;
+
+            for(PtrType aj = row_offset[ai]; aj < row_offset[ai + 1]; ++aj)
+            {
+                int col_j = col[aj];
+
+                if((lower == true && col_j < ai) || (lower == false && col_j > ai))
+                {
+                    lev = std::max(lev, level[col_j] + 1);
+                }
+            }
+
+            level[ai] = lev;
+            max_level = std::max(max_level, lev);
+        }
+
+        *nlevel = max_level + 1;
+
+        allocate_host(*nlevel + 1, level_offset);
+        allocate_host(nrow, level_row);
+
+        set_to_zero_host(*nlevel + 1, *level_offset);
+
+        // Number of rows per level
+        for(int ai = 0; ai < nrow; ++ai)
+        {
+            ++(*level_offset)[level[ai] + 1];
+        }
+
+        for(int l = 0; l < *nlevel; ++l)
+        {
+            (*level_offset)[l + 1] += (*level_offset)[l];
+        }
+
+        // Bucket the rows into their levels
+        for(int i = 0; i < nrow; ++i)
+        {
+            int ai = (lower == true) ? i : nrow - 1 - i;
+
+            (*level_row)[(*level_offset)[level[ai]]++] = ai;
+        }
+
+        // Shift back the level offsets
+        for(int l = *nlevel; l > 0; --l)
+        {
+            (*level_offset)[l] = (*level_offset)[l - 1];
+        }
+
+        (*level_offset)[0] = 0;
+
+        free_host(&level);
+    }
+
+    // Residual and (optionally) damped Jacobi update for rows [row_begin, row_end)
+    // out = rhs - A * in                                   (inv_diag == NULL)
+    // out = in + omega * inv_diag * (rhs - A * in)         (inv_diag != NULL)
+    // Rows are processed in small blocks, such that the residual of a block is still
+    // in cache when the update is applied
+    template <typename ValueType>
+    static void host_csr_residual_update(int              row_begin,
+                                         int              row_end,
+                                         const PtrType*   row_offset,
+                                         const int*       col,
+                                         const ValueType* val,
+                                         const ValueType* rhs,
+                                         const ValueType* inv_diag,
+                                         ValueType        omega,
+                                         const ValueType* in,
+                                         ValueType*       out)
+    {
+        const int block_size = 512;
+
+        for(int block_begin = row_begin; block_begin < row_end; block_begin += block_size)
+        {
+            int block_end = std::min(block_begin + block_size, row_end);
+
+            for(int ai = block_begin; ai < block_end; ++ai)
+            {
+                out[ai] = rhs[ai];
+            }
+
+            host_csrmv(block_begin,
+                       block_end,
+                       row_offset,
+                       col,
+                       val,
+                       static_cast<ValueType>(-1),
+                       in,
+                       true,
+                       out);
+
+            if(inv_diag != NULL)
+            {
+                for(int ai = block_begin; ai < block_end; ++ai)
+                {
+                    out[ai] = in[ai] + omega * inv_diag[ai] * out[ai];
+                }
+            }
+        }
+    }
+
+    // Scatter the rows [row_begin, row_end) of out = this^T * in into out, which holds the
+    // entries of the columns starting at col_begin
+    template <typename ValueType>
+    static void host_csr_scatter_transpose(int              row_begin,
+                                           int              row_end,
+                                           const PtrType*   row_offset,
+                                           const int*       col,
+                                           const ValueType* val,
+                                           const ValueType* in,
+                                           int              col_begin,
+                                           ValueType*       out)
+    {
+        for(int ai = row_begin; ai < row_end; ++ai)
+        {
+            ValueType x = in[ai];
+
+            for(PtrType aj = row_offset[ai]; aj < row_offset[ai + 1]; ++aj)
+            {
+                out[col[aj] - col_begin] += val[aj] * x;
+            }
+        }
+    }
+
+    // Integer hash to generate the pseudo random vertex weights of the coarsening and
+    // aggregation kernels. Weights only depend on the vertex index, such that the
+    // resulting hierarchy does not depend on the number of threads.
+    static inline unsigned int host_amg_hash(unsigned int hash)
+    {
+        hash = ((hash >> 16) ^ hash) * 0x45d9f3b;
+        hash = ((hash >> 16) ^ hash) * 0x45d9f3b;
+
+        return (hash >> 16) ^ hash;
+    }
+
+    // Pseudo random weight in [0, 1) of vertex i
+    static inline float host_amg_weight(unsigned long long seed, int i)
+    {
+        unsigned int hash = static_cast<unsigned int>(seed) ^ static_cast<unsigned int>(seed >> 32);
+
+        hash = host_amg_hash(host_amg_hash(hash) ^ static_cast<unsigned int>(i));
+
+        // 24 bits are exactly representable in single precision
+        return static_cast<float>(hash >> 8) / 16777216.0f;
+    }
+
+    // In-place exclusive scan of data, returns the total sum. Each thread scans a
+    // contiguous block, the block offsets are added afterwards.
+    static int host_exclusive_scan(int size, int* data)
+    {
+        std::vector<int> offset(omp_get_max_threads() + 1, 0);
+
+        int sum = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            int nthreads = omp_get_num_threads();
+            int tid      = omp_get_thread_num();
+
+            int begin = static_cast<int>(static_cast<int64_t>(size) * tid / nthreads);
+            int end   = static_cast<int>(static_cast<int64_t>(size) * (tid + 1) / nthreads);
+
+            int block_sum = 0;
+            for(int i = begin; i < end; ++i)
+            {
+                int temp = data[i];
+                data[i]  = block_sum;
+                block_sum += temp;
+            }
+
+            offset[tid + 1] = block_sum;
+
+#ifdef _OPENMP
+#pragma omp barrier
+#pragma omp single
+#endif
+            {
+                for(int t = 0; t < nthreads; ++t)
+                {
+                    offset[t + 1] += offset[t];
+                }
+
+                sum = offset[nthreads];
+            }
+
+            for(int i = begin; i < end; ++i)
+            {
+                data[i] += offset[tid];
+            }
+        }
+
+        return sum;
+    }
+
     template <typename ValueType>
     HostMatrixCSR<ValueType>::HostMatrixCSR()
     {
@@ -81,6 +307,24 @@ namespace rocalution
 
         this->L_diag_unit_ = false;
         this->U_diag_unit_ = false;
+
+        this->L_nlevel_       = 0;
+        this->L_level_offset_ = NULL;
+        this->L_level_row_    = NULL;
+
+        this->U_nlevel_       = 0;
+        this->U_level_offset_ = NULL;
+        this->U_level_row_    = NULL;
+
+        this->LT_row_offset_ = NULL;
+        this->LT_col_        = NULL;
+        this->LT_val_idx_    = NULL;
+
+        this->part_nparts_     = 0;
+        this->part_nrow_       = 0;
+        this->part_nnz_        = 0;
+        this->part_row_offset_ = NULL;
+        this->part_row_        = NULL;
     }
 
     template <typename ValueType>
@@ -94,16 +338,28 @@ namespace rocalution
     template <typename ValueType>
     void HostMatrixCSR<ValueType>::Clear()
     {
+        // Level scheduling is bound to the structure of the matrix
+        this->ClearLevelSchedule_(true, true);
+
+        if(this->part_row_ != NULL)
+        {
+            free_host(&this->part_row_);
+        }
+
+        this->part_nparts_     = 0;
+        this->part_row_offset_ = NULL;
+
         if(this->nnz_ > 0)
         {
             free_host(&this->mat_.row_offset);
             free_host(&this->mat_.col);
             free_host(&this->mat_.val);
-
-            this->nrow_ = 0;
-            this->ncol_ = 0;
-            this->nnz_  = 0;
         }
+
+        // Also matrices without entries, that carry their dimensions only
+        this->nrow_ = 0;
+        this->ncol_ = 0;
+        this->nnz_  = 0;
     }
 
     template <typename ValueType>
@@ -161,7 +417,7 @@ namespace rocalution
 
             for(int ai = 0; ai < this->nrow_ + 1; ++ai)
             {
-                int row = this->mat_.row_offset[ai];
+                PtrType row = this->mat_.row_offset[ai];
                 if((row < 0) || (row > this->nnz_))
                 {
                     LOG_VERBOSE_INFO(
@@ -175,7 +431,8 @@ namespace rocalution
             {
                 int s = this->mat_.col[this->mat_.row_offset[ai]];
 
-                for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+                for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1];
+                    ++aj)
                 {
                     int col = this->mat_.col[aj];
 
@@ -224,7 +481,7 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void HostMatrixCSR<ValueType>::AllocateCSR(int nnz, int nrow, int ncol)
+    void HostMatrixCSR<ValueType>::AllocateCSR(PtrType nnz, int nrow, int ncol)
     {
         assert(nnz >= 0);
         assert(ncol >= 0);
@@ -245,15 +502,17 @@ namespace rocalution
             set_to_zero_host(nnz, mat_.col);
             set_to_zero_host(nnz, mat_.val);
 
-            this->nrow_ = nrow;
-            this->ncol_ = ncol;
-            this->nnz_  = nnz;
+            this->nnz_ = nnz;
         }
+
+        // A matrix without entries keeps its dimensions, but no arrays
+        this->nrow_ = nrow;
+        this->ncol_ = ncol;
     }
 
     template <typename ValueType>
     void HostMatrixCSR<ValueType>::SetDataPtrCSR(
-        int** row_offset, int** col, ValueType** val, int nnz, int nrow, int ncol)
+        PtrType** row_offset, int** col, ValueType** val, PtrType nnz, int nrow, int ncol)
     {
         assert(*row_offset != NULL);
         assert(*col != NULL);
@@ -274,7 +533,7 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void HostMatrixCSR<ValueType>::LeaveDataPtrCSR(int** row_offset, int** col, ValueType** val)
+    void HostMatrixCSR<ValueType>::LeaveDataPtrCSR(PtrType** row_offset, int** col, ValueType** val)
     {
         assert(this->nrow_ > 0);
         assert(this->ncol_ > 0);
@@ -295,7 +554,7 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void HostMatrixCSR<ValueType>::CopyFromCSR(const int*       row_offsets,
+    void HostMatrixCSR<ValueType>::CopyFromCSR(const PtrType*   row_offsets,
                                                const int*       col,
                                                const ValueType* val)
     {
@@ -317,7 +576,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-            for(int j = 0; j < this->nnz_; ++j)
+            for(PtrType j = 0; j < this->nnz_; ++j)
             {
                 this->mat_.col[j] = col[j];
                 this->mat_.val[j] = val[j];
@@ -326,7 +585,7 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void HostMatrixCSR<ValueType>::CopyToCSR(int* row_offsets, int* col, ValueType* val) const
+    void HostMatrixCSR<ValueType>::CopyToCSR(PtrType* row_offsets, int* col, ValueType* val) const
     {
         if(this->nnz_ > 0)
         {
@@ -346,7 +605,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-            for(int j = 0; j < this->nnz_; ++j)
+            for(PtrType j = 0; j < this->nnz_; ++j)
             {
                 col[j] = this->mat_.col[j];
                 val[j] = this->mat_.val[j];
@@ -387,7 +646,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-                for(int j = 0; j < this->nnz_; ++j)
+                for(PtrType j = 0; j < this->nnz_; ++j)
                 {
                     this->mat_.col[j] = cast_mat->mat_.col[j];
                     this->mat_.val[j] = cast_mat->mat_.val[j];
@@ -408,14 +667,36 @@ namespace rocalution
         mat->CopyFrom(*this);
     }
 
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ReadFileMTX(const std::string& filename)
+    {
+        int     nrow;
+        int     ncol;
+        PtrType nnz;
+
+        PtrType*   ptr = NULL;
+        int*       col = NULL;
+        ValueType* val = NULL;
+
+        if(read_matrix_mtx_csr(nrow, ncol, nnz, &ptr, &col, &val, filename.c_str()) != true)
+        {
+            return false;
+        }
+
+        this->Clear();
+        this->SetDataPtrCSR(&ptr, &col, &val, nnz, nrow, ncol);
+
+        return true;
+    }
+
     template <typename ValueType>
     bool HostMatrixCSR<ValueType>::ReadFileCSR(const std::string& filename)
     {
-        int nrow;
-        int ncol;
-        int nnz;
+        int     nrow;
+        int     ncol;
+        PtrType nnz;
 
-        int*       ptr = NULL;
+        PtrType*   ptr = NULL;
         int*       col = NULL;
         ValueType* val = NULL;
 
@@ -431,8 +712,12 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void HostMatrixCSR<ValueType>::CopyFromHostCSR(
-        const int* row_offset, const int* col, const ValueType* val, int nnz, int nrow, int ncol)
+    void HostMatrixCSR<ValueType>::CopyFromHostCSR(const PtrType*   row_offset,
+                                                   const int*       col,
+                                                   const ValueType* val,
+                                                   PtrType          nnz,
+                                                   int              nrow,
+                                                   int              ncol)
     {
         assert(nnz >= 0);
         assert(ncol >= 0);
@@ -470,7 +755,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-            for(int j = 0; j < this->nnz_; ++j)
+            for(PtrType j = 0; j < this->nnz_; ++j)
             {
                 this->mat_.col[j] = col[j];
                 this->mat_.val[j] = val[j];
@@ -479,8 +764,20 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    bool HostMatrixCSR<ValueType>::WriteFileCSR(const std::string& filename) const
+    bool HostMatrixCSR<ValueType>::WriteFileCSR(const std::string& filename,
+                                                unsigned int       format) const
     {
+        if(format == CSRFileMapped)
+        {
+            return write_matrix_csr_mapped(this->nrow_,
+                                           this->ncol_,
+                                           this->nnz_,
+                                           this->mat_.row_offset,
+                                           this->mat_.col,
+                                           this->mat_.val,
+                                           filename.c_str());
+        }
+
         if(write_matrix_csr(this->nrow_,
                             this->ncol_,
                             this->nnz_,
@@ -519,9 +816,10 @@ namespace rocalution
         {
             this->Clear();
 
-            int nrow = cast_mat->mat_.nrowb * cast_mat->mat_.blockdim;
-            int ncol = cast_mat->mat_.ncolb * cast_mat->mat_.blockdim;
-            int nnz  = cast_mat->mat_.nnzb * cast_mat->mat_.blockdim * cast_mat->mat_.blockdim;
+            int     nrow = cast_mat->mat_.nrowb * cast_mat->mat_.blockdim;
+            int     ncol = cast_mat->mat_.ncolb * cast_mat->mat_.blockdim;
+            PtrType nnz  = static_cast<PtrType>(cast_mat->mat_.nnzb) * cast_mat->mat_.blockdim
+                          * cast_mat->mat_.blockdim;
 
             if(bcsr_to_csr(this->local_backend_.OpenMP_threads,
                            nnz,
@@ -564,7 +862,7 @@ namespace rocalution
            = dynamic_cast<const HostMatrixDENSE<ValueType>*>(&mat))
         {
             this->Clear();
-            int nnz = 0;
+            PtrType nnz = 0;
 
             if(dense_to_csr(this->local_backend_.OpenMP_threads,
                             cast_mat->nrow_,
@@ -586,7 +884,7 @@ namespace rocalution
            = dynamic_cast<const HostMatrixDIA<ValueType>*>(&mat))
         {
             this->Clear();
-            int nnz;
+            PtrType nnz;
 
             if(dia_to_csr(this->local_backend_.OpenMP_threads,
                           cast_mat->nnz_,
@@ -609,7 +907,7 @@ namespace rocalution
            = dynamic_cast<const HostMatrixELL<ValueType>*>(&mat))
         {
             this->Clear();
-            int nnz;
+            PtrType nnz;
 
             if(ell_to_csr(this->local_backend_.OpenMP_threads,
                           cast_mat->nnz_,
@@ -628,6 +926,29 @@ namespace rocalution
             }
         }
 
+        if(const HostMatrixSELL<ValueType>* cast_mat
+           = dynamic_cast<const HostMatrixSELL<ValueType>*>(&mat))
+        {
+            this->Clear();
+            PtrType nnz;
+
+            if(sell_to_csr(this->local_backend_.OpenMP_threads,
+                           cast_mat->nnz_,
+                           cast_mat->nrow_,
+                           cast_mat->ncol_,
+                           cast_mat->mat_,
+                           &this->mat_,
+                           &nnz)
+               == true)
+            {
+                this->nrow_ = cast_mat->nrow_;
+                this->ncol_ = cast_mat->ncol_;
+                this->nnz_  = nnz;
+
+                return true;
+            }
+        }
+
         if(const HostMatrixMCSR<ValueType>* cast_mat
            = dynamic_cast<const HostMatrixMCSR<ValueType>*>(&mat))
         {
@@ -653,7 +974,7 @@ namespace rocalution
            = dynamic_cast<const HostMatrixHYB<ValueType>*>(&mat))
         {
             this->Clear();
-            int nnz;
+            PtrType nnz;
 
             if(hyb_to_csr(this->local_backend_.OpenMP_threads,
                           cast_mat->nnz_,
@@ -692,23 +1013,34 @@ namespace rocalution
         assert(cast_in != NULL);
         assert(cast_out != NULL);
 
+        if(this->nnz_ == 0)
+        {
+            cast_out->Zeros();
+
+            return;
+        }
+
         _set_omp_backend_threads(this->local_backend_, this->nrow_);
 
+        // Each thread always processes the same chunk of rows, such that the matrix
+        // and output vector pages stay local to the thread that first touched them
+        int        nparts = omp_get_max_threads();
+        const int* part   = this->ApplyPartition_(nparts);
+
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for schedule(static, 1)
 #endif
-        for(int ai = 0; ai < this->nrow_; ++ai)
-        {
-            ValueType sum     = static_cast<ValueType>(0);
-            int       row_beg = this->mat_.row_offset[ai];
-            int       row_end = this->mat_.row_offset[ai + 1];
-
-            for(int aj = row_beg; aj < row_end; ++aj)
-            {
-                sum += this->mat_.val[aj] * cast_in->vec_[this->mat_.col[aj]];
-            }
-
-            cast_out->vec_[ai] = sum;
+        for(int p = 0; p < nparts; ++p)
+        {
+            host_csrmv(part[p],
+                       part[p + 1],
+                       this->mat_.row_offset,
+                       this->mat_.col,
+                       this->mat_.val,
+                       static_cast<ValueType>(1),
+                       cast_in->vec_,
+                       false,
+                       cast_out->vec_);
         }
     }
 
@@ -732,98 +1064,525 @@ namespace rocalution
 
             _set_omp_backend_threads(this->local_backend_, this->nrow_);
 
+            int        nparts = omp_get_max_threads();
+            const int* part   = this->ApplyPartition_(nparts);
+
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for schedule(static, 1)
 #endif
-            for(int ai = 0; ai < this->nrow_; ++ai)
+            for(int p = 0; p < nparts; ++p)
             {
-                for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
-                {
-                    cast_out->vec_[ai]
-                        += scalar * this->mat_.val[aj] * cast_in->vec_[this->mat_.col[aj]];
-                }
+                host_csrmv(part[p],
+                           part[p + 1],
+                           this->mat_.row_offset,
+                           this->mat_.col,
+                           this->mat_.val,
+                           scalar,
+                           cast_in->vec_,
+                           true,
+                           cast_out->vec_);
             }
         }
     }
 
     template <typename ValueType>
-    bool HostMatrixCSR<ValueType>::ExtractDiagonal(BaseVector<ValueType>* vec_diag) const
+    bool HostMatrixCSR<ValueType>::ApplyTranspose(const BaseVector<ValueType>& in,
+                                                  BaseVector<ValueType>*       out) const
     {
-        assert(vec_diag != NULL);
-        assert(vec_diag->GetSize() == this->nrow_);
+        assert(out != NULL);
+        assert(&in != out);
+        assert(in.GetSize() == this->nrow_);
+        assert(out->GetSize() == this->ncol_);
 
-        HostVector<ValueType>* cast_vec_diag = dynamic_cast<HostVector<ValueType>*>(vec_diag);
+        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+        assert(cast_in != NULL);
+        assert(cast_out != NULL);
+
+        cast_out->Zeros();
+
+        if(this->nnz_ == 0)
+        {
+            return true;
+        }
 
         _set_omp_backend_threads(this->local_backend_, this->nrow_);
 
+        int nparts = omp_get_max_threads();
+
+        if(nparts == 1)
+        {
+            host_csr_scatter_transpose(0,
+                                       this->nrow_,
+                                       this->mat_.row_offset,
+                                       this->mat_.col,
+                                       this->mat_.val,
+                                       cast_in->vec_,
+                                       0,
+                                       cast_out->vec_);
+
+            return true;
+        }
+
+        // Each thread scatters its chunk of rows into a private buffer, which only covers
+        // the range of columns the chunk refers to. The buffers are summed up in a fixed
+        // order afterwards, such that the result does not depend on the thread timing.
+        const int* part = this->ApplyPartition_(nparts);
+
+        std::vector<int>     col_begin(nparts, 0);
+        std::vector<int>     col_end(nparts, 0);
+        std::vector<int64_t> offset(nparts + 1, 0);
+
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for schedule(static, 1)
 #endif
-        for(int ai = 0; ai < this->nrow_; ++ai)
+        for(int p = 0; p < nparts; ++p)
         {
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            PtrType begin = this->mat_.row_offset[part[p]];
+            PtrType end   = this->mat_.row_offset[part[p + 1]];
+
+            if(begin == end)
             {
-                if(ai == this->mat_.col[aj])
-                {
-                    cast_vec_diag->vec_[ai] = this->mat_.val[aj];
-                    break;
-                }
+                continue;
+            }
+
+            int cmin = this->ncol_;
+            int cmax = -1;
+
+            for(PtrType aj = begin; aj < end; ++aj)
+            {
+                cmin = std::min(cmin, this->mat_.col[aj]);
+                cmax = std::max(cmax, this->mat_.col[aj]);
             }
+
+            col_begin[p] = cmin;
+            col_end[p]   = cmax + 1;
         }
 
-        return true;
-    }
+        for(int p = 0; p < nparts; ++p)
+        {
+            offset[p + 1] = offset[p] + (col_end[p] - col_begin[p]);
+        }
 
-    template <typename ValueType>
-    bool HostMatrixCSR<ValueType>::ExtractInverseDiagonal(BaseVector<ValueType>* vec_inv_diag) const
-    {
-        assert(vec_inv_diag != NULL);
-        assert(vec_inv_diag->GetSize() == this->nrow_);
+        ValueType* buffer = NULL;
+        allocate_host(offset[nparts], &buffer);
 
-        HostVector<ValueType>* cast_vec_inv_diag
-            = dynamic_cast<HostVector<ValueType>*>(vec_inv_diag);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+        for(int p = 0; p < nparts; ++p)
+        {
+            ValueType* buf = buffer + offset[p];
 
-        int detect_zero_diag = 0;
+            for(int64_t j = 0; j < offset[p + 1] - offset[p]; ++j)
+            {
+                buf[j] = static_cast<ValueType>(0);
+            }
 
-        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+            host_csr_scatter_transpose(part[p],
+                                       part[p + 1],
+                                       this->mat_.row_offset,
+                                       this->mat_.col,
+                                       this->mat_.val,
+                                       cast_in->vec_,
+                                       col_begin[p],
+                                       buf);
+        }
+
+        _set_omp_backend_threads(this->local_backend_, this->ncol_);
 
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-        for(int ai = 0; ai < this->nrow_; ++ai)
+        for(int aj = 0; aj < this->ncol_; ++aj)
         {
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            ValueType sum = static_cast<ValueType>(0);
+
+            for(int p = 0; p < nparts; ++p)
             {
-                if(ai == this->mat_.col[aj])
+                if(aj >= col_begin[p] && aj < col_end[p])
                 {
-                    if(this->mat_.val[aj] != static_cast<ValueType>(0))
-                    {
-                        cast_vec_inv_diag->vec_[ai]
-                            = static_cast<ValueType>(1) / this->mat_.val[aj];
-                    }
-                    else
-                    {
-                        cast_vec_inv_diag->vec_[ai] = static_cast<ValueType>(1);
-                        detect_zero_diag            = 1;
-                    }
-
-                    break;
+                    sum += buffer[offset[p] + aj - col_begin[p]];
                 }
             }
-        }
 
-        if(detect_zero_diag == 1)
-        {
-            LOG_VERBOSE_INFO(
-                2,
-                "*** warning: in HostMatrixCSR::ExtractInverseDiagonal() a zero has been detected "
-                "on the diagonal. It has been replaced with one to avoid inf");
+            cast_out->vec_[aj] = sum;
         }
+
+        free_host(&buffer);
+
         return true;
     }
 
     template <typename ValueType>
-    bool HostMatrixCSR<ValueType>::ExtractSubMatrix(int                    row_offset,
+    bool HostMatrixCSR<ValueType>::Residual(const BaseVector<ValueType>& rhs,
+                                            const BaseVector<ValueType>& in,
+                                            BaseVector<ValueType>*       res) const
+    {
+        assert(res != NULL);
+        assert(&in != res);
+        assert(in.GetSize() == this->ncol_);
+        assert(rhs.GetSize() == this->nrow_);
+        assert(res->GetSize() == this->nrow_);
+
+        const HostVector<ValueType>* cast_rhs = dynamic_cast<const HostVector<ValueType>*>(&rhs);
+        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+        HostVector<ValueType>*       cast_res = dynamic_cast<HostVector<ValueType>*>(res);
+
+        assert(cast_rhs != NULL);
+        assert(cast_in != NULL);
+        assert(cast_res != NULL);
+
+        if(this->nrow_ == 0)
+        {
+            return true;
+        }
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        int        nparts = omp_get_max_threads();
+        const int* part   = this->ApplyPartition_(nparts);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+        for(int p = 0; p < nparts; ++p)
+        {
+            host_csr_residual_update(part[p],
+                                     part[p + 1],
+                                     this->mat_.row_offset,
+                                     this->mat_.col,
+                                     this->mat_.val,
+                                     cast_rhs->vec_,
+                                     (const ValueType*)NULL,
+                                     static_cast<ValueType>(0),
+                                     cast_in->vec_,
+                                     cast_res->vec_);
+        }
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::JacobiSweep(const BaseVector<ValueType>& inv_diag,
+                                               const BaseVector<ValueType>& rhs,
+                                               ValueType                    omega,
+                                               const BaseVector<ValueType>& in,
+                                               BaseVector<ValueType>*       out) const
+    {
+        assert(out != NULL);
+        assert(&in != out);
+        assert(this->nrow_ == this->ncol_);
+        assert(in.GetSize() == this->ncol_);
+        assert(rhs.GetSize() == this->nrow_);
+        assert(inv_diag.GetSize() == this->nrow_);
+        assert(out->GetSize() == this->nrow_);
+
+        const HostVector<ValueType>* cast_diag
+            = dynamic_cast<const HostVector<ValueType>*>(&inv_diag);
+        const HostVector<ValueType>* cast_rhs = dynamic_cast<const HostVector<ValueType>*>(&rhs);
+        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+        assert(cast_diag != NULL);
+        assert(cast_rhs != NULL);
+        assert(cast_in != NULL);
+        assert(cast_out != NULL);
+
+        if(this->nrow_ == 0)
+        {
+            return true;
+        }
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        int        nparts = omp_get_max_threads();
+        const int* part   = this->ApplyPartition_(nparts);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+        for(int p = 0; p < nparts; ++p)
+        {
+            host_csr_residual_update(part[p],
+                                     part[p + 1],
+                                     this->mat_.row_offset,
+                                     this->mat_.col,
+                                     this->mat_.val,
+                                     cast_rhs->vec_,
+                                     cast_diag->vec_,
+                                     omega,
+                                     cast_in->vec_,
+                                     cast_out->vec_);
+        }
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ApplyRows(const BaseVector<int>&       rows,
+                                             int                          start,
+                                             int                          end,
+                                             const BaseVector<ValueType>& in,
+                                             ValueType                    scalar,
+                                             bool                         add,
+                                             BaseVector<ValueType>*       out) const
+    {
+        assert(out != NULL);
+        assert(&in != out);
+        assert(start >= 0);
+        assert(end <= rows.GetSize());
+        assert(in.GetSize() == this->ncol_);
+        assert(out->GetSize() == this->nrow_);
+
+        const HostVector<int>*       cast_rows = dynamic_cast<const HostVector<int>*>(&rows);
+        const HostVector<ValueType>* cast_in   = dynamic_cast<const HostVector<ValueType>*>(&in);
+        HostVector<ValueType>*       cast_out  = dynamic_cast<HostVector<ValueType>*>(out);
+
+        assert(cast_rows != NULL);
+        assert(cast_in != NULL);
+        assert(cast_out != NULL);
+
+        if(end <= start)
+        {
+            return true;
+        }
+
+        // The rows are processed in blocks, the number of threads is determined by the
+        // whole matrix, such that all blocks run with the threads of a full Apply()
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        int nparts = omp_get_max_threads();
+        int nrows  = end - start;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+        for(int p = 0; p < nparts; ++p)
+        {
+            int first = start + static_cast<int>(static_cast<int64_t>(nrows) * p / nparts);
+            int last  = start + static_cast<int>(static_cast<int64_t>(nrows) * (p + 1) / nparts);
+
+            // Consecutive rows of the list are computed as one range by host_csrmv()
+            while(first < last)
+            {
+                int row_begin = cast_rows->vec_[first];
+                int row_end   = row_begin + 1;
+
+                ++first;
+
+                while((first < last) && (cast_rows->vec_[first] == row_end))
+                {
+                    ++first;
+                    ++row_end;
+                }
+
+                host_csrmv(row_begin,
+                           row_end,
+                           this->mat_.row_offset,
+                           this->mat_.col,
+                           this->mat_.val,
+                           scalar,
+                           cast_in->vec_,
+                           add,
+                           cast_out->vec_);
+            }
+        }
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ApplyRowsGhost(const BaseVector<int>&       rows,
+                                                  const BaseVector<int>&       ghost_offset,
+                                                  const BaseMatrix<ValueType>& ghost,
+                                                  const BaseVector<ValueType>& in,
+                                                  const BaseVector<ValueType>& ghost_in,
+                                                  ValueType                    scalar,
+                                                  bool                         add,
+                                                  BaseVector<ValueType>*       out) const
+    {
+        assert(out != NULL);
+        assert(&in != out);
+        assert(&ghost_in != out);
+        assert(ghost_offset.GetSize() == rows.GetSize() + 1);
+        assert(in.GetSize() == this->ncol_);
+        assert(out->GetSize() == this->nrow_);
+        assert(ghost.GetM() == this->nrow_);
+        assert(ghost_in.GetSize() == ghost.GetN());
+
+        const HostMatrixCOO<ValueType>* cast_ghost
+            = dynamic_cast<const HostMatrixCOO<ValueType>*>(&ghost);
+
+        if(cast_ghost == NULL)
+        {
+            return false;
+        }
+
+        const HostVector<int>* cast_rows   = dynamic_cast<const HostVector<int>*>(&rows);
+        const HostVector<int>* cast_offset = dynamic_cast<const HostVector<int>*>(&ghost_offset);
+        const HostVector<ValueType>* cast_in = dynamic_cast<const HostVector<ValueType>*>(&in);
+        const HostVector<ValueType>* cast_gin
+            = dynamic_cast<const HostVector<ValueType>*>(&ghost_in);
+        HostVector<ValueType>* cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+        assert(cast_rows != NULL);
+        assert(cast_offset != NULL);
+        assert(cast_in != NULL);
+        assert(cast_gin != NULL);
+        assert(cast_out != NULL);
+
+        int nrows = rows.GetSize();
+
+        if(nrows == 0)
+        {
+            return true;
+        }
+
+        // Same number of threads as for the rows without ghost entries
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int i = 0; i < nrows; ++i)
+        {
+            int       row = cast_rows->vec_[i];
+            ValueType sum = static_cast<ValueType>(0);
+
+            for(PtrType j = this->mat_.row_offset[row]; j < this->mat_.row_offset[row + 1]; ++j)
+            {
+                sum += this->mat_.val[j] * cast_in->vec_[this->mat_.col[j]];
+            }
+
+            // Entries of the ghost part in the same row
+            for(int j = cast_offset->vec_[i]; j < cast_offset->vec_[i + 1]; ++j)
+            {
+                sum += cast_ghost->mat_.val[j] * cast_gin->vec_[cast_ghost->mat_.col[j]];
+            }
+
+            if(add == true)
+            {
+                cast_out->vec_[row] += scalar * sum;
+            }
+            else
+            {
+                cast_out->vec_[row] = scalar * sum;
+            }
+        }
+
+        return true;
+    }
+
+    template <typename ValueType>
+    const int* HostMatrixCSR<ValueType>::ApplyPartition_(int nparts) const
+    {
+        assert(nparts > 0);
+
+        // Re-use the partition as long as the matrix structure did not change
+        if(this->part_row_ != NULL && this->part_nparts_ == nparts
+           && this->part_nrow_ == this->nrow_ && this->part_nnz_ == this->nnz_
+           && this->part_row_offset_ == this->mat_.row_offset)
+        {
+            return this->part_row_;
+        }
+
+        if(this->part_row_ != NULL)
+        {
+            free_host(&this->part_row_);
+        }
+
+        allocate_host(nparts + 1, &this->part_row_);
+
+        host_csr_partition(this->nrow_, this->mat_.row_offset, nparts, this->part_row_);
+
+        this->part_nparts_     = nparts;
+        this->part_nrow_       = this->nrow_;
+        this->part_nnz_        = this->nnz_;
+        this->part_row_offset_ = this->mat_.row_offset;
+
+        return this->part_row_;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ExtractDiagonal(BaseVector<ValueType>* vec_diag) const
+    {
+        assert(vec_diag != NULL);
+        assert(vec_diag->GetSize() == this->nrow_);
+
+        HostVector<ValueType>* cast_vec_diag = dynamic_cast<HostVector<ValueType>*>(vec_diag);
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            {
+                if(ai == this->mat_.col[aj])
+                {
+                    cast_vec_diag->vec_[ai] = this->mat_.val[aj];
+                    break;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ExtractInverseDiagonal(BaseVector<ValueType>* vec_inv_diag) const
+    {
+        assert(vec_inv_diag != NULL);
+        assert(vec_inv_diag->GetSize() == this->nrow_);
+
+        HostVector<ValueType>* cast_vec_inv_diag
+            = dynamic_cast<HostVector<ValueType>*>(vec_inv_diag);
+
+        int detect_zero_diag = 0;
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            {
+                if(ai == this->mat_.col[aj])
+                {
+                    if(this->mat_.val[aj] != static_cast<ValueType>(0))
+                    {
+                        cast_vec_inv_diag->vec_[ai]
+                            = static_cast<ValueType>(1) / this->mat_.val[aj];
+                    }
+                    else
+                    {
+                        cast_vec_inv_diag->vec_[ai] = static_cast<ValueType>(1);
+                        detect_zero_diag            = 1;
+                    }
+
+                    break;
+                }
+            }
+        }
+
+        if(detect_zero_diag == 1)
+        {
+            LOG_VERBOSE_INFO(
+                2,
+                "*** warning: in HostMatrixCSR::ExtractInverseDiagonal() a zero has been detected "
+                "on the diagonal. It has been replaced with one to avoid inf");
+        }
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ExtractSubMatrix(int                    row_offset,
                                                     int                    col_offset,
                                                     int                    row_size,
                                                     int                    col_size,
@@ -851,7 +1610,7 @@ namespace rocalution
         //#endif
         for(int ai = row_offset; ai < row_offset + row_size; ++ai)
         {
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if((this->mat_.col[aj] >= col_offset)
                    && (this->mat_.col[aj] < col_offset + col_size))
@@ -871,7 +1630,8 @@ namespace rocalution
 
             for(int ai = row_offset; ai < row_offset + row_size; ++ai)
             {
-                for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+                for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1];
+                    ++aj)
                 {
                     if((this->mat_.col[aj] >= col_offset)
                        && (this->mat_.col[aj] < col_offset + col_size))
@@ -905,13 +1665,13 @@ namespace rocalution
         assert(cast_U != NULL);
 
         // count nnz of upper triangular part
-        int nnz_U = 0;
+        PtrType nnz_U = 0;
 #ifdef _OPENMP
 #pragma omp parallel for reduction(+ : nnz_U)
 #endif
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if(this->mat_.col[aj] > ai)
                 {
@@ -921,7 +1681,7 @@ namespace rocalution
         }
 
         // allocate upper triangular part structure
-        int*       row_offset = NULL;
+        PtrType*   row_offset = NULL;
         int*       col        = NULL;
         ValueType* val        = NULL;
 
@@ -930,11 +1690,11 @@ namespace rocalution
         allocate_host(nnz_U, &val);
 
         // fill upper triangular part
-        int nnz       = 0;
+        PtrType nnz   = 0;
         row_offset[0] = 0;
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if(this->mat_.col[aj] > ai)
                 {
@@ -966,13 +1726,13 @@ namespace rocalution
         assert(cast_U != NULL);
 
         // count nnz of upper triangular part
-        int nnz_U = 0;
+        PtrType nnz_U = 0;
 #ifdef _OPENMP
 #pragma omp parallel for reduction(+ : nnz_U)
 #endif
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if(this->mat_.col[aj] >= ai)
                 {
@@ -982,7 +1742,7 @@ namespace rocalution
         }
 
         // allocate upper triangular part structure
-        int*       row_offset = NULL;
+        PtrType*   row_offset = NULL;
         int*       col        = NULL;
         ValueType* val        = NULL;
 
@@ -991,11 +1751,11 @@ namespace rocalution
         allocate_host(nnz_U, &val);
 
         // fill upper triangular part
-        int nnz       = 0;
+        PtrType nnz   = 0;
         row_offset[0] = 0;
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if(this->mat_.col[aj] >= ai)
                 {
@@ -1027,13 +1787,13 @@ namespace rocalution
         assert(cast_L != NULL);
 
         // count nnz of lower triangular part
-        int nnz_L = 0;
+        PtrType nnz_L = 0;
 #ifdef _OPENMP
 #pragma omp parallel for reduction(+ : nnz_L)
 #endif
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if(this->mat_.col[aj] < ai)
                 {
@@ -1043,7 +1803,7 @@ namespace rocalution
         }
 
         // allocate lower triangular part structure
-        int*       row_offset = NULL;
+        PtrType*   row_offset = NULL;
         int*       col        = NULL;
         ValueType* val        = NULL;
 
@@ -1052,11 +1812,11 @@ namespace rocalution
         allocate_host(nnz_L, &val);
 
         // fill lower triangular part
-        int nnz       = 0;
+        PtrType nnz   = 0;
         row_offset[0] = 0;
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if(this->mat_.col[aj] < ai)
                 {
@@ -1088,13 +1848,13 @@ namespace rocalution
         assert(cast_L != NULL);
 
         // count nnz of lower triangular part
-        int nnz_L = 0;
+        PtrType nnz_L = 0;
 #ifdef _OPENMP
 #pragma omp parallel for reduction(+ : nnz_L)
 #endif
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if(this->mat_.col[aj] <= ai)
                 {
@@ -1104,7 +1864,7 @@ namespace rocalution
         }
 
         // allocate lower triangular part structure
-        int*       row_offset = NULL;
+        PtrType*   row_offset = NULL;
         int*       col        = NULL;
         ValueType* val        = NULL;
 
@@ -1113,11 +1873,11 @@ namespace rocalution
         allocate_host(nnz_L, &val);
 
         // fill lower triangular part
-        int nnz       = 0;
+        PtrType nnz   = 0;
         row_offset[0] = 0;
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if(this->mat_.col[aj] <= ai)
                 {
@@ -1137,47 +1897,323 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    bool HostMatrixCSR<ValueType>::LUSolve(const BaseVector<ValueType>& in,
-                                           BaseVector<ValueType>*       out) const
+    bool HostMatrixCSR<ValueType>::ExtractL1BlockDiagonal(int                          block_size,
+                                                          const BaseMatrix<ValueType>* ghost,
+                                                          BaseMatrix<ValueType>*       mat) const
     {
-        assert(in.GetSize() >= 0);
-        assert(out->GetSize() >= 0);
-        assert(in.GetSize() == this->ncol_);
-        assert(out->GetSize() == this->nrow_);
+        assert(mat != NULL);
+        assert(block_size > 0);
 
-        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
-        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+        assert(this->nrow_ > 0);
+        assert(this->ncol_ > 0);
+        assert(this->nrow_ == this->ncol_);
 
-        assert(cast_in != NULL);
-        assert(cast_out != NULL);
+        HostMatrixCSR<ValueType>*       cast_mat   = dynamic_cast<HostMatrixCSR<ValueType>*>(mat);
+        const HostMatrixCSR<ValueType>* cast_ghost = NULL;
 
-        // Solve L
-        for(int ai = 0; ai < this->nrow_; ++ai)
+        assert(cast_mat != NULL);
+
+        if(ghost != NULL)
         {
-            cast_out->vec_[ai] = cast_in->vec_[ai];
+            cast_ghost = dynamic_cast<const HostMatrixCSR<ValueType>*>(ghost);
 
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            if(cast_ghost == NULL)
             {
-                if(this->mat_.col[aj] < ai)
-                {
-                    // under the diagonal
-                    cast_out->vec_[ai] -= this->mat_.val[aj] * cast_out->vec_[this->mat_.col[aj]];
-                }
-                else
-                {
-                    // CSR should be sorted
-                    break;
-                }
+                return false;
             }
+
+            assert(cast_ghost->nrow_ == this->nrow_);
         }
 
-        // last elements should be the diagonal one (last)
-        int diag_aj = this->nnz_ - 1;
+        PtrType*   row_offset = NULL;
+        int*       col        = NULL;
+        ValueType* val        = NULL;
 
-        // Solve U
-        for(int ai = this->nrow_ - 1; ai >= 0; --ai)
-        {
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+        allocate_host(this->nrow_ + 1, &row_offset);
+
+        // Count the entries of each row that stay inside the row block, the
+        // diagonal is always kept
+        row_offset[0] = 0;
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            int block_begin = (ai / block_size) * block_size;
+            int block_end   = std::min(block_begin + block_size, this->nrow_);
+
+            PtrType nnz_row = 1;
+
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            {
+                int ca = this->mat_.col[aj];
+
+                if(ca != ai && ca >= block_begin && ca < block_end)
+                {
+                    ++nnz_row;
+                }
+            }
+
+            row_offset[ai + 1] = nnz_row;
+        }
+
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            row_offset[ai + 1] += row_offset[ai];
+        }
+
+        PtrType nnz = row_offset[this->nrow_];
+
+        allocate_host(nnz, &col);
+        allocate_host(nnz, &val);
+
+        // Fill the block diagonal part and lump the absolute values of all
+        // entries outside of the row block (including the ghost part) onto
+        // the diagonal
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            int block_begin = (ai / block_size) * block_size;
+            int block_end   = std::min(block_begin + block_size, this->nrow_);
+
+            ValueType diag = static_cast<ValueType>(0);
+
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            {
+                int ca = this->mat_.col[aj];
+
+                if(ca == ai)
+                {
+                    diag += this->mat_.val[aj];
+                }
+                else if(ca < block_begin || ca >= block_end)
+                {
+                    diag += static_cast<ValueType>(std::abs(this->mat_.val[aj]));
+                }
+            }
+
+            if(cast_ghost != NULL)
+            {
+                for(PtrType aj = cast_ghost->mat_.row_offset[ai];
+                    aj < cast_ghost->mat_.row_offset[ai + 1];
+                    ++aj)
+                {
+                    diag += static_cast<ValueType>(std::abs(cast_ghost->mat_.val[aj]));
+                }
+            }
+
+            PtrType idx      = row_offset[ai];
+            bool    has_diag = false;
+
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            {
+                int ca = this->mat_.col[aj];
+
+                if(ca < block_begin || ca >= block_end || ca == ai)
+                {
+                    continue;
+                }
+
+                // Keep the diagonal in sorted position
+                if(has_diag == false && ca > ai)
+                {
+                    col[idx] = ai;
+                    val[idx] = diag;
+                    ++idx;
+
+                    has_diag = true;
+                }
+
+                col[idx] = ca;
+                val[idx] = this->mat_.val[aj];
+                ++idx;
+            }
+
+            if(has_diag == false)
+            {
+                col[idx] = ai;
+                val[idx] = diag;
+            }
+        }
+
+        cast_mat->Clear();
+        cast_mat->SetDataPtrCSR(&row_offset, &col, &val, nnz, this->nrow_, this->ncol_);
+
+        return true;
+    }
+
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::ClearLevelSchedule_(bool lower, bool upper)
+    {
+        if(lower == true)
+        {
+            if(this->L_level_offset_ != NULL)
+            {
+                free_host(&this->L_level_offset_);
+            }
+
+            if(this->L_level_row_ != NULL)
+            {
+                free_host(&this->L_level_row_);
+            }
+
+            this->L_nlevel_ = 0;
+        }
+
+        if(upper == true)
+        {
+            if(this->U_level_offset_ != NULL)
+            {
+                free_host(&this->U_level_offset_);
+            }
+
+            if(this->U_level_row_ != NULL)
+            {
+                free_host(&this->U_level_row_);
+            }
+
+            if(this->LT_row_offset_ != NULL)
+            {
+                free_host(&this->LT_row_offset_);
+            }
+
+            if(this->LT_col_ != NULL)
+            {
+                free_host(&this->LT_col_);
+            }
+
+            if(this->LT_val_idx_ != NULL)
+            {
+                free_host(&this->LT_val_idx_);
+            }
+
+            this->U_nlevel_ = 0;
+        }
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::LUSolve(const BaseVector<ValueType>& in,
+                                           BaseVector<ValueType>*       out) const
+    {
+        assert(in.GetSize() >= 0);
+        assert(out->GetSize() >= 0);
+        assert(in.GetSize() == this->ncol_);
+        assert(out->GetSize() == this->nrow_);
+
+        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+        assert(cast_in != NULL);
+        assert(cast_out != NULL);
+
+        // Level scheduled solve, if LUAnalyse() has been performed
+        if(this->L_nlevel_ > 0 && this->U_nlevel_ > 0)
+        {
+            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            {
+                // Solve L
+                for(int l = 0; l < this->L_nlevel_; ++l)
+                {
+#ifdef _OPENMP
+#pragma omp for
+#endif
+                    for(int k = this->L_level_offset_[l]; k < this->L_level_offset_[l + 1]; ++k)
+                    {
+                        int       ai  = this->L_level_row_[k];
+                        ValueType sum = cast_in->vec_[ai];
+
+                        for(PtrType aj = this->mat_.row_offset[ai];
+                            aj < this->mat_.row_offset[ai + 1];
+                            ++aj)
+                        {
+                            if(this->mat_.col[aj] < ai)
+                            {
+                                // under the diagonal
+                                sum -= this->mat_.val[aj] * cast_out->vec_[this->mat_.col[aj]];
+                            }
+                            else
+                            {
+                                // CSR should be sorted
+                                break;
+                            }
+                        }
+
+                        cast_out->vec_[ai] = sum;
+                    }
+                }
+
+                // Solve U
+                for(int l = 0; l < this->U_nlevel_; ++l)
+                {
+#ifdef _OPENMP
+#pragma omp for
+#endif
+                    for(int k = this->U_level_offset_[l]; k < this->U_level_offset_[l + 1]; ++k)
+                    {
+                        int       ai      = this->U_level_row_[k];
+                        PtrType   diag_aj = this->mat_.row_offset[ai + 1] - 1;
+                        ValueType sum     = cast_out->vec_[ai];
+
+                        for(PtrType aj = this->mat_.row_offset[ai];
+                            aj < this->mat_.row_offset[ai + 1];
+                            ++aj)
+                        {
+                            if(this->mat_.col[aj] > ai)
+                            {
+                                // above the diagonal
+                                sum -= this->mat_.val[aj] * cast_out->vec_[this->mat_.col[aj]];
+                            }
+
+                            if(this->mat_.col[aj] == ai)
+                            {
+                                diag_aj = aj;
+                            }
+                        }
+
+                        cast_out->vec_[ai] = sum / this->mat_.val[diag_aj];
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        // Solve L
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            cast_out->vec_[ai] = cast_in->vec_[ai];
+
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            {
+                if(this->mat_.col[aj] < ai)
+                {
+                    // under the diagonal
+                    cast_out->vec_[ai] -= this->mat_.val[aj] * cast_out->vec_[this->mat_.col[aj]];
+                }
+                else
+                {
+                    // CSR should be sorted
+                    break;
+                }
+            }
+        }
+
+        // last elements should be the diagonal one (last)
+        PtrType diag_aj = this->nnz_ - 1;
+
+        // Solve U
+        for(int ai = this->nrow_ - 1; ai >= 0; --ai)
+        {
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if(this->mat_.col[aj] > ai)
                 {
@@ -1200,25 +2236,116 @@ namespace rocalution
     template <typename ValueType>
     void HostMatrixCSR<ValueType>::LLAnalyse(void)
     {
-        // do nothing
+        this->ClearLevelSchedule_(true, true);
+
+        if(this->nrow_ > 0)
+        {
+            // Levels of L
+            host_csr_level_analysis(this->nrow_,
+                                    this->mat_.row_offset,
+                                    this->mat_.col,
+                                    true,
+                                    &this->L_nlevel_,
+                                    &this->L_level_offset_,
+                                    &this->L_level_row_);
+
+            // Structure of L^T (without the diagonal), the solve with L^T can then be
+            // performed row-wise instead of scattering into the solution vector
+            allocate_host(this->nrow_ + 1, &this->LT_row_offset_);
+            set_to_zero_host(this->nrow_ + 1, this->LT_row_offset_);
+
+            for(int ai = 0; ai < this->nrow_; ++ai)
+            {
+                for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1];
+                    ++aj)
+                {
+                    if(this->mat_.col[aj] < ai)
+                    {
+                        ++this->LT_row_offset_[this->mat_.col[aj] + 1];
+                    }
+                }
+            }
+
+            for(int ai = 0; ai < this->nrow_; ++ai)
+            {
+                this->LT_row_offset_[ai + 1] += this->LT_row_offset_[ai];
+            }
+
+            PtrType nnz_lt = this->LT_row_offset_[this->nrow_];
+
+            allocate_host(nnz_lt, &this->LT_col_);
+            allocate_host(nnz_lt, &this->LT_val_idx_);
+
+            for(int ai = 0; ai < this->nrow_; ++ai)
+            {
+                for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1];
+                    ++aj)
+                {
+                    int col_j = this->mat_.col[aj];
+
+                    if(col_j < ai)
+                    {
+                        PtrType idx = this->LT_row_offset_[col_j]++;
+
+                        this->LT_col_[idx]     = ai;
+                        this->LT_val_idx_[idx] = aj;
+                    }
+                }
+            }
+
+            for(int ai = this->nrow_; ai > 0; --ai)
+            {
+                this->LT_row_offset_[ai] = this->LT_row_offset_[ai - 1];
+            }
+
+            this->LT_row_offset_[0] = 0;
+
+            // Levels of L^T
+            host_csr_level_analysis(this->nrow_,
+                                    this->LT_row_offset_,
+                                    this->LT_col_,
+                                    false,
+                                    &this->U_nlevel_,
+                                    &this->U_level_offset_,
+                                    &this->U_level_row_);
+        }
     }
 
     template <typename ValueType>
     void HostMatrixCSR<ValueType>::LLAnalyseClear(void)
     {
-        // do nothing
+        this->ClearLevelSchedule_(true, true);
     }
 
     template <typename ValueType>
     void HostMatrixCSR<ValueType>::LUAnalyse(void)
     {
-        // do nothing
+        this->ClearLevelSchedule_(true, true);
+
+        if(this->nrow_ > 0)
+        {
+            host_csr_level_analysis(this->nrow_,
+                                    this->mat_.row_offset,
+                                    this->mat_.col,
+                                    true,
+                                    &this->L_nlevel_,
+                                    &this->L_level_offset_,
+                                    &this->L_level_row_);
+
+            host_csr_level_analysis(this->nrow_,
+                                    this->mat_.row_offset,
+                                    this->mat_.col,
+                                    false,
+                                    &this->U_nlevel_,
+                                    &this->U_level_offset_,
+                                    &this->U_level_row_);
+        }
     }
 
     template <typename ValueType>
     void HostMatrixCSR<ValueType>::LUAnalyseClear(void)
     {
-        // do nothing
+        this->ClearLevelSchedule_(true, true);
     }
 
     template <typename ValueType>
@@ -1236,13 +2363,71 @@ namespace rocalution
         assert(cast_in != NULL);
         assert(cast_out != NULL);
 
+        // Level scheduled solve, if LLAnalyse() has been performed
+        if(this->L_nlevel_ > 0 && this->U_nlevel_ > 0 && this->LT_row_offset_ != NULL)
+        {
+            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            {
+                // Solve L
+                for(int l = 0; l < this->L_nlevel_; ++l)
+                {
+#ifdef _OPENMP
+#pragma omp for
+#endif
+                    for(int k = this->L_level_offset_[l]; k < this->L_level_offset_[l + 1]; ++k)
+                    {
+                        int       ai       = this->L_level_row_[k];
+                        ValueType value    = cast_in->vec_[ai];
+                        PtrType   diag_idx = this->mat_.row_offset[ai + 1] - 1;
+
+                        for(PtrType aj = this->mat_.row_offset[ai]; aj < diag_idx; ++aj)
+                        {
+                            value -= this->mat_.val[aj] * cast_out->vec_[this->mat_.col[aj]];
+                        }
+
+                        cast_out->vec_[ai] = value / this->mat_.val[diag_idx];
+                    }
+                }
+
+                // Solve L^T
+                for(int l = 0; l < this->U_nlevel_; ++l)
+                {
+#ifdef _OPENMP
+#pragma omp for
+#endif
+                    for(int k = this->U_level_offset_[l]; k < this->U_level_offset_[l + 1]; ++k)
+                    {
+                        int       ai    = this->U_level_row_[k];
+                        ValueType value = cast_out->vec_[ai];
+
+                        for(PtrType aj = this->LT_row_offset_[ai];
+                            aj < this->LT_row_offset_[ai + 1];
+                            ++aj)
+                        {
+                            value -= this->mat_.val[this->LT_val_idx_[aj]]
+                                     * cast_out->vec_[this->LT_col_[aj]];
+                        }
+
+                        cast_out->vec_[ai]
+                            = value / this->mat_.val[this->mat_.row_offset[ai + 1] - 1];
+                    }
+                }
+            }
+
+            return true;
+        }
+
         // Solve L
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
             ValueType value    = cast_in->vec_[ai];
-            int       diag_idx = this->mat_.row_offset[ai + 1] - 1;
+            PtrType   diag_idx = this->mat_.row_offset[ai + 1] - 1;
 
-            for(int aj = this->mat_.row_offset[ai]; aj < diag_idx; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < diag_idx; ++aj)
             {
                 value -= this->mat_.val[aj] * cast_out->vec_[this->mat_.col[aj]];
             }
@@ -1253,10 +2438,10 @@ namespace rocalution
         // Solve L^T
         for(int ai = this->nrow_ - 1; ai >= 0; --ai)
         {
-            int       diag_idx = this->mat_.row_offset[ai + 1] - 1;
+            PtrType   diag_idx = this->mat_.row_offset[ai + 1] - 1;
             ValueType value    = cast_out->vec_[ai] / this->mat_.val[diag_idx];
 
-            for(int aj = this->mat_.row_offset[ai]; aj < diag_idx; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < diag_idx; ++aj)
             {
                 cast_out->vec_[this->mat_.col[aj]] -= value * this->mat_.val[aj];
             }
@@ -1286,13 +2471,70 @@ namespace rocalution
         assert(cast_in != NULL);
         assert(cast_out != NULL);
 
+        // Level scheduled solve, if LLAnalyse() has been performed
+        if(this->L_nlevel_ > 0 && this->U_nlevel_ > 0 && this->LT_row_offset_ != NULL)
+        {
+            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            {
+                // Solve L
+                for(int l = 0; l < this->L_nlevel_; ++l)
+                {
+#ifdef _OPENMP
+#pragma omp for
+#endif
+                    for(int k = this->L_level_offset_[l]; k < this->L_level_offset_[l + 1]; ++k)
+                    {
+                        int       ai       = this->L_level_row_[k];
+                        ValueType value    = cast_in->vec_[ai];
+                        PtrType   diag_idx = this->mat_.row_offset[ai + 1] - 1;
+
+                        for(PtrType aj = this->mat_.row_offset[ai]; aj < diag_idx; ++aj)
+                        {
+                            value -= this->mat_.val[aj] * cast_out->vec_[this->mat_.col[aj]];
+                        }
+
+                        cast_out->vec_[ai] = value * cast_diag->vec_[ai];
+                    }
+                }
+
+                // Solve L^T
+                for(int l = 0; l < this->U_nlevel_; ++l)
+                {
+#ifdef _OPENMP
+#pragma omp for
+#endif
+                    for(int k = this->U_level_offset_[l]; k < this->U_level_offset_[l + 1]; ++k)
+                    {
+                        int       ai    = this->U_level_row_[k];
+                        ValueType value = cast_out->vec_[ai];
+
+                        for(PtrType aj = this->LT_row_offset_[ai];
+                            aj < this->LT_row_offset_[ai + 1];
+                            ++aj)
+                        {
+                            value -= this->mat_.val[this->LT_val_idx_[aj]]
+                                     * cast_out->vec_[this->LT_col_[aj]];
+                        }
+
+                        cast_out->vec_[ai] = value * cast_diag->vec_[ai];
+                    }
+                }
+            }
+
+            return true;
+        }
+
         // Solve L
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
             ValueType value    = cast_in->vec_[ai];
-            int       diag_idx = this->mat_.row_offset[ai + 1] - 1;
+            PtrType   diag_idx = this->mat_.row_offset[ai + 1] - 1;
 
-            for(int aj = this->mat_.row_offset[ai]; aj < diag_idx; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < diag_idx; ++aj)
             {
                 value -= this->mat_.val[aj] * cast_out->vec_[this->mat_.col[aj]];
             }
@@ -1303,10 +2545,10 @@ namespace rocalution
         // Solve L^T
         for(int ai = this->nrow_ - 1; ai >= 0; --ai)
         {
-            int       diag_idx = this->mat_.row_offset[ai + 1] - 1;
+            PtrType   diag_idx = this->mat_.row_offset[ai + 1] - 1;
             ValueType value    = cast_out->vec_[ai] * cast_diag->vec_[ai];
 
-            for(int aj = this->mat_.row_offset[ai]; aj < diag_idx; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < diag_idx; ++aj)
             {
                 cast_out->vec_[this->mat_.col[aj]] -= value * this->mat_.val[aj];
             }
@@ -1321,12 +2563,26 @@ namespace rocalution
     void HostMatrixCSR<ValueType>::LAnalyse(bool diag_unit)
     {
         this->L_diag_unit_ = diag_unit;
+
+        this->ClearLevelSchedule_(true, false);
+
+        if(this->nrow_ > 0)
+        {
+            host_csr_level_analysis(this->nrow_,
+                                    this->mat_.row_offset,
+                                    this->mat_.col,
+                                    true,
+                                    &this->L_nlevel_,
+                                    &this->L_level_offset_,
+                                    &this->L_level_row_);
+        }
     }
 
     template <typename ValueType>
     void HostMatrixCSR<ValueType>::LAnalyseClear(void)
     {
-        // do nothing
+        this->ClearLevelSchedule_(true, false);
+
         this->L_diag_unit_ = true;
     }
 
@@ -1345,14 +2601,65 @@ namespace rocalution
         assert(cast_in != NULL);
         assert(cast_out != NULL);
 
-        int diag_aj = 0;
+        // Level scheduled solve, if LAnalyse() has been performed
+        if(this->L_nlevel_ > 0)
+        {
+            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            for(int l = 0; l < this->L_nlevel_; ++l)
+            {
+#ifdef _OPENMP
+#pragma omp for
+#endif
+                for(int k = this->L_level_offset_[l]; k < this->L_level_offset_[l + 1]; ++k)
+                {
+                    int       ai      = this->L_level_row_[k];
+                    PtrType   diag_aj = 0;
+                    ValueType sum     = cast_in->vec_[ai];
+
+                    for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1];
+                        ++aj)
+                    {
+                        if(this->mat_.col[aj] < ai)
+                        {
+                            // under the diagonal
+                            sum -= this->mat_.val[aj] * cast_out->vec_[this->mat_.col[aj]];
+                        }
+                        else
+                        {
+                            // CSR should be sorted
+                            if(this->L_diag_unit_ == false)
+                            {
+                                assert(this->mat_.col[aj] == ai);
+                                diag_aj = aj;
+                            }
+                            break;
+                        }
+                    }
+
+                    if(this->L_diag_unit_ == false)
+                    {
+                        sum /= this->mat_.val[diag_aj];
+                    }
+
+                    cast_out->vec_[ai] = sum;
+                }
+            }
+
+            return true;
+        }
+
+        PtrType diag_aj = 0;
 
         // Solve L
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
             cast_out->vec_[ai] = cast_in->vec_[ai];
 
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if(this->mat_.col[aj] < ai)
                 {
@@ -1384,39 +2691,99 @@ namespace rocalution
     void HostMatrixCSR<ValueType>::UAnalyse(bool diag_unit)
     {
         this->U_diag_unit_ = diag_unit;
+
+        this->ClearLevelSchedule_(false, true);
+
+        if(this->nrow_ > 0)
+        {
+            host_csr_level_analysis(this->nrow_,
+                                    this->mat_.row_offset,
+                                    this->mat_.col,
+                                    false,
+                                    &this->U_nlevel_,
+                                    &this->U_level_offset_,
+                                    &this->U_level_row_);
+        }
     }
 
     template <typename ValueType>
     void HostMatrixCSR<ValueType>::UAnalyseClear(void)
     {
-        // do nothing
+        this->ClearLevelSchedule_(false, true);
+
         this->U_diag_unit_ = false;
     }
 
-    template <typename ValueType>
-    bool HostMatrixCSR<ValueType>::USolve(const BaseVector<ValueType>& in,
-                                          BaseVector<ValueType>*       out) const
-    {
-        assert(in.GetSize() >= 0);
-        assert(out->GetSize() >= 0);
-        assert(in.GetSize() == this->ncol_);
-        assert(out->GetSize() == this->nrow_);
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::USolve(const BaseVector<ValueType>& in,
+                                          BaseVector<ValueType>*       out) const
+    {
+        assert(in.GetSize() >= 0);
+        assert(out->GetSize() >= 0);
+        assert(in.GetSize() == this->ncol_);
+        assert(out->GetSize() == this->nrow_);
+
+        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+        assert(cast_in != NULL);
+        assert(cast_out != NULL);
+
+        // Level scheduled solve, if UAnalyse() has been performed
+        if(this->U_nlevel_ > 0)
+        {
+            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            for(int l = 0; l < this->U_nlevel_; ++l)
+            {
+#ifdef _OPENMP
+#pragma omp for
+#endif
+                for(int k = this->U_level_offset_[l]; k < this->U_level_offset_[l + 1]; ++k)
+                {
+                    int       ai      = this->U_level_row_[k];
+                    PtrType   diag_aj = this->mat_.row_offset[ai + 1] - 1;
+                    ValueType sum     = cast_in->vec_[ai];
+
+                    for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1];
+                        ++aj)
+                    {
+                        if(this->mat_.col[aj] > ai)
+                        {
+                            // above the diagonal
+                            sum -= this->mat_.val[aj] * cast_out->vec_[this->mat_.col[aj]];
+                        }
+
+                        if(this->mat_.col[aj] == ai)
+                        {
+                            diag_aj = aj;
+                        }
+                    }
 
-        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
-        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+                    if(this->U_diag_unit_ == false)
+                    {
+                        sum /= this->mat_.val[diag_aj];
+                    }
 
-        assert(cast_in != NULL);
-        assert(cast_out != NULL);
+                    cast_out->vec_[ai] = sum;
+                }
+            }
+
+            return true;
+        }
 
         // last elements should the diagonal one (last)
-        int diag_aj = this->nnz_ - 1;
+        PtrType diag_aj = this->nnz_ - 1;
 
         // Solve U
         for(int ai = this->nrow_ - 1; ai >= 0; --ai)
         {
             cast_out->vec_[ai] = cast_in->vec_[ai];
 
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if(this->mat_.col[aj] > ai)
                 {
@@ -1424,7 +2791,7 @@ namespace rocalution
                     cast_out->vec_[ai] -= this->mat_.val[aj] * cast_out->vec_[this->mat_.col[aj]];
                 }
 
-                if(this->L_diag_unit_ == false)
+                if(this->U_diag_unit_ == false)
                 {
                     if(this->mat_.col[aj] == ai)
                     {
@@ -1433,7 +2800,7 @@ namespace rocalution
                 }
             }
 
-            if(this->L_diag_unit_ == false)
+            if(this->U_diag_unit_ == false)
             {
                 cast_out->vec_[ai] /= this->mat_.val[diag_aj];
             }
@@ -1444,6 +2811,9 @@ namespace rocalution
 
     // Algorithm for ILU factorization is based on
     // Y. Saad, Iterative methods for sparse linear systems, 2nd edition, SIAM
+    // Rows are factorized level by level (see host_csr_level_analysis), each row
+    // only depends on the upper part of rows of previous levels. The factors are
+    // identical to the ones of the sequential algorithm.
     template <typename ValueType>
     bool HostMatrixCSR<ValueType>::ILU0Factorize(void)
     {
@@ -1451,75 +2821,295 @@ namespace rocalution
         assert(this->nnz_ > 0);
 
         // pointer of upper part of each row
-        int* diag_offset = NULL;
-        int* nnz_entries = NULL;
+        PtrType* diag_offset = NULL;
+
+        // level scheduling of the lower part
+        int  nlevel       = 0;
+        int* level_offset = NULL;
+        int* level_row    = NULL;
 
         allocate_host(this->nrow_, &diag_offset);
-        allocate_host(this->nrow_, &nnz_entries);
 
-        for(int i = 0; i < this->nrow_; ++i)
+        host_csr_level_analysis(this->nrow_,
+                                this->mat_.row_offset,
+                                this->mat_.col,
+                                true,
+                                &nlevel,
+                                &level_offset,
+                                &level_row);
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for(int l = 0; l < nlevel; ++l)
+        {
+#ifdef _OPENMP
+#pragma omp for
+#endif
+            for(int i = level_offset[l]; i < level_offset[l + 1]; ++i)
+            {
+                int ai = level_row[i];
+
+                // ai-th row entries
+                PtrType row_start = this->mat_.row_offset[ai];
+                PtrType row_end   = this->mat_.row_offset[ai + 1];
+                PtrType j;
+
+                // loop over ai-th row nnz entries
+                for(j = row_start; j < row_end; ++j)
+                {
+                    // if nnz entry is in lower matrix
+                    if(this->mat_.col[j] < ai)
+                    {
+                        int     col_j  = this->mat_.col[j];
+                        PtrType diag_j = diag_offset[col_j];
+
+                        if(this->mat_.val[diag_j] != static_cast<ValueType>(0))
+                        {
+                            // multiplication factor
+                            this->mat_.val[j] = this->mat_.val[j] / this->mat_.val[diag_j];
+
+                            // position in ai-th row, both rows are sorted
+                            PtrType idx = j + 1;
+
+                            // loop over upper offset pointer and do linear combination
+                            // for nnz entry
+                            for(PtrType k = diag_j + 1; k < this->mat_.row_offset[col_j + 1];
+                                ++k)
+                            {
+                                int col_k = this->mat_.col[k];
+
+                                while(idx < row_end && this->mat_.col[idx] < col_k)
+                                {
+                                    ++idx;
+                                }
+
+                                if(idx == row_end)
+                                {
+                                    break;
+                                }
+
+                                // if nnz at this position do linear combination
+                                if(this->mat_.col[idx] == col_k)
+                                {
+                                    this->mat_.val[idx] -= this->mat_.val[j] * this->mat_.val[k];
+                                }
+                            }
+                        }
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
+
+                // set diagonal pointer to diagonal element
+                diag_offset[ai] = j;
+            }
+        }
+
+        free_host(&diag_offset);
+        free_host(&level_offset);
+        free_host(&level_row);
+
+        return true;
+    }
+
+    // Fine-grained iterative ILU(0) factorization, based on
+    // E. Chow, A. Patel, Fine-grained parallel incomplete LU factorization,
+    // SIAM J. Sci. Comput. 37(2), 2015
+    // Each sweep updates all entries of L and U from the values of the previous sweep
+    // (Jacobi-type), such that the factors do not depend on the number of threads.
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ItILU0Factorize(int sweeps)
+    {
+        assert(this->nrow_ == this->ncol_);
+        assert(this->nnz_ > 0);
+        assert(sweeps > 0);
+
+        PtrType*   diag_offset = NULL;
+        PtrType*   col_offset  = NULL;
+        int*       csc_row     = NULL;
+        PtrType*   csc_pos     = NULL;
+        ValueType* val_A       = NULL;
+        ValueType* val_new     = NULL;
+
+        allocate_host(this->nrow_, &diag_offset);
+        allocate_host(this->ncol_ + 1, &col_offset);
+        allocate_host(this->nnz_, &csc_row);
+        allocate_host(this->nnz_, &csc_pos);
+        allocate_host(this->nnz_, &val_A);
+        allocate_host(this->nnz_, &val_new);
+
+        set_to_zero_host(this->ncol_ + 1, col_offset);
+
+        // Column access to the pattern (rows are sorted within each column)
+        for(PtrType i = 0; i < this->nnz_; ++i)
         {
-            nnz_entries[i] = 0;
+            ++col_offset[this->mat_.col[i] + 1];
         }
 
-        // ai = 0 to N loop over all rows
+        for(int i = 0; i < this->ncol_; ++i)
+        {
+            col_offset[i + 1] += col_offset[i];
+        }
+
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            {
+                PtrType idx = col_offset[this->mat_.col[aj]]++;
+
+                csc_row[idx] = ai;
+                csc_pos[idx] = aj;
+            }
+        }
+
+        for(int i = this->ncol_; i > 0; --i)
+        {
+            col_offset[i] = col_offset[i - 1];
+        }
+
+        col_offset[0] = 0;
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        // Diagonal positions
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
-            // ai-th row entries
-            int row_start = this->mat_.row_offset[ai];
-            int row_end   = this->mat_.row_offset[ai + 1];
-            int j;
+            diag_offset[ai] = -1;
+
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            {
+                if(this->mat_.col[aj] == ai)
+                {
+                    diag_offset[ai] = aj;
+                    break;
+                }
+            }
+        }
 
-            // nnz position of ai-th row in mat_.val array
-            for(j = row_start; j < row_end; ++j)
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            if(diag_offset[ai] == -1)
             {
-                nnz_entries[this->mat_.col[j]] = j;
+                LOG_INFO("ILU breakdown: structural zero diagonal");
+                FATAL_ERROR(__FILE__, __LINE__);
             }
+        }
 
-            // loop over ai-th row nnz entries
-            for(j = row_start; j < row_end; ++j)
+        // Initial guess, L = lower(A) D^-1 and U = upper(A)
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
-                // if nnz entry is in lower matrix
-                if(this->mat_.col[j] < ai)
+                int col_j = this->mat_.col[aj];
+
+                val_A[aj] = this->mat_.val[aj];
+
+                if(col_j < ai)
                 {
-                    int col_j  = this->mat_.col[j];
-                    int diag_j = diag_offset[col_j];
+                    ValueType diag = this->mat_.val[diag_offset[col_j]];
 
-                    if(this->mat_.val[diag_j] != static_cast<ValueType>(0))
+                    if(diag != static_cast<ValueType>(0))
                     {
-                        // multiplication factor
-                        this->mat_.val[j] = this->mat_.val[j] / this->mat_.val[diag_j];
-
-                        // loop over upper offset pointer and do linear combination for nnz entry
-                        for(int k = diag_j + 1; k < this->mat_.row_offset[col_j + 1]; ++k)
-                        {
-                            // if nnz at this position do linear combination
-                            if(nnz_entries[this->mat_.col[k]] != 0)
-                            {
-                                this->mat_.val[nnz_entries[this->mat_.col[k]]]
-                                    -= this->mat_.val[j] * this->mat_.val[k];
-                            }
-                        }
+                        val_new[aj] = this->mat_.val[aj] / diag;
+                    }
+                    else
+                    {
+                        val_new[aj] = this->mat_.val[aj];
                     }
                 }
                 else
                 {
-                    break;
+                    val_new[aj] = this->mat_.val[aj];
                 }
             }
+        }
 
-            // set diagonal pointer to diagonal element
-            diag_offset[ai] = j;
+        for(int sweep = 0; sweep < sweeps; ++sweep)
+        {
+            // Values of the previous sweep are in mat_.val
+            ValueType* tmp = this->mat_.val;
+            this->mat_.val = val_new;
+            val_new        = tmp;
+
+            const ValueType* val_old = this->mat_.val;
 
-            // clear nnz entries
-            for(j = row_start; j < row_end; ++j)
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int ai = 0; ai < this->nrow_; ++ai)
             {
-                nnz_entries[this->mat_.col[j]] = 0;
+                PtrType row_start = this->mat_.row_offset[ai];
+                PtrType row_end   = this->mat_.row_offset[ai + 1];
+
+                for(PtrType aj = row_start; aj < row_end; ++aj)
+                {
+                    int col_j = this->mat_.col[aj];
+                    int kmax  = (col_j < ai) ? col_j : ai;
+
+                    // sum_{k < min(ai, col_j)} l_ai,k * u_k,col_j
+                    ValueType sum = val_A[aj];
+
+                    PtrType idx = row_start;
+
+                    for(PtrType k = col_offset[col_j]; k < col_offset[col_j + 1]; ++k)
+                    {
+                        int row_k = csc_row[k];
+
+                        if(row_k >= kmax)
+                        {
+                            break;
+                        }
+
+                        while(idx < row_end && this->mat_.col[idx] < row_k)
+                        {
+                            ++idx;
+                        }
+
+                        if(idx == row_end || this->mat_.col[idx] >= kmax)
+                        {
+                            break;
+                        }
+
+                        if(this->mat_.col[idx] == row_k)
+                        {
+                            sum -= val_old[idx] * val_old[csc_pos[k]];
+                        }
+                    }
+
+                    if(col_j < ai)
+                    {
+                        ValueType diag = val_old[diag_offset[col_j]];
+
+                        val_new[aj] = (diag != static_cast<ValueType>(0)) ? sum / diag : sum;
+                    }
+                    else
+                    {
+                        val_new[aj] = sum;
+                    }
+                }
             }
         }
 
+        // Final values are in val_new, the buffer of mat_.val is released
+        free_host(&this->mat_.val);
+        this->mat_.val = val_new;
+
         free_host(&diag_offset);
-        free_host(&nnz_entries);
+        free_host(&col_offset);
+        free_host(&csc_row);
+        free_host(&csc_pos);
+        free_host(&val_A);
 
         return true;
     }
@@ -1535,8 +3125,8 @@ namespace rocalution
         int nrow = this->nrow_;
         int ncol = this->ncol_;
 
-        int*       row_offset  = NULL;
-        int*       diag_offset = NULL;
+        PtrType*   row_offset  = NULL;
+        PtrType*   diag_offset = NULL;
         int*       nnz_entries = NULL;
         bool*      nnz_pos     = (bool*)malloc(nrow * sizeof(bool));
         ValueType* w           = NULL;
@@ -1555,27 +3145,27 @@ namespace rocalution
         }
 
         // pre-allocate 1.5x nnz arrays for preconditioner matrix
-        int        nnzA       = this->nnz_;
-        int        alloc_size = int(nnzA * 1.5);
+        PtrType    nnzA       = this->nnz_;
+        PtrType    alloc_size = PtrType(nnzA * 1.5);
         int*       col        = (int*)malloc(alloc_size * sizeof(int));
         ValueType* val        = (ValueType*)malloc(alloc_size * sizeof(ValueType));
 
         // initialize row_offset
         row_offset[0] = 0;
-        int nnz       = 0;
+        PtrType nnz   = 0;
 
         // loop over all rows
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
             row_offset[ai + 1] = row_offset[ai];
 
-            int    row_begin = this->mat_.row_offset[ai];
-            int    row_end   = this->mat_.row_offset[ai + 1];
-            double row_norm  = 0.0;
+            PtrType row_begin = this->mat_.row_offset[ai];
+            PtrType row_end   = this->mat_.row_offset[ai + 1];
+            double  row_norm  = 0.0;
 
             // fill working array with ai-th row
             int m = 0;
-            for(int aj = row_begin; aj < row_end; ++aj)
+            for(PtrType aj = row_begin; aj < row_end; ++aj)
             {
                 int idx        = this->mat_.col[aj];
                 w[idx]         = this->mat_.val[aj];
@@ -1637,7 +3227,7 @@ namespace rocalution
                     w[aj] /= val[diag_offset[aj]];
 
                     // do linear combination with previous row
-                    for(int l = diag_offset[aj] + 1; l < row_offset[aj + 1]; ++l)
+                    for(PtrType l = diag_offset[aj] + 1; l < row_offset[aj + 1]; ++l)
                     {
                         int       idx    = col[l];
                         ValueType fillin = w[aj] * val[l];
@@ -1719,7 +3309,7 @@ namespace rocalution
             // resize preconditioner matrix if needed
             if(alloc_size < nnz + 2 * maxrow + 1)
             {
-                alloc_size += int(nnzA * 1.5);
+                alloc_size += PtrType(nnzA * 1.5);
                 int*       col_tmp = (int*)realloc(col, alloc_size * sizeof(int));
                 ValueType* val_tmp = (ValueType*)realloc(val, alloc_size * sizeof(ValueType));
 
@@ -1751,26 +3341,180 @@ namespace rocalution
         allocate_host(nnz, &p_col);
         allocate_host(nnz, &p_val);
 
-        for(int i = 0; i < nnz; ++i)
+        for(PtrType i = 0; i < nnz; ++i)
         {
             p_col[i] = col[i];
             p_val[i] = val[i];
         }
 
-        free(col);
-        free(val);
-
-        this->Clear();
-        this->SetDataPtrCSR(&row_offset, &p_col, &p_val, nnz, nrow, ncol);
+        free(col);
+        free(val);
+
+        this->Clear();
+        this->SetDataPtrCSR(&row_offset, &p_col, &p_val, nnz, nrow, ncol);
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ICFactorize(BaseVector<ValueType>* inv_diag)
+    {
+        assert(this->nrow_ == this->ncol_);
+        assert(this->nnz_ > 0);
+
+        assert(inv_diag != NULL);
+        HostVector<ValueType>* cast_diag = dynamic_cast<HostVector<ValueType>*>(inv_diag);
+        assert(cast_diag != NULL);
+
+        cast_diag->Allocate(this->nrow_);
+
+        PtrType* diag_offset = NULL;
+
+        // level scheduling of the lower part
+        int  nlevel       = 0;
+        int* level_offset = NULL;
+        int* level_row    = NULL;
+
+        allocate_host(this->nrow_, &diag_offset);
+
+        host_csr_level_analysis(this->nrow_,
+                                this->mat_.row_offset,
+                                this->mat_.col,
+                                true,
+                                &nlevel,
+                                &level_offset,
+                                &level_row);
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        // Rows are factorized level by level, the factors are identical to the ones
+        // of the sequential algorithm
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for(int l = 0; l < nlevel; ++l)
+        {
+#ifdef _OPENMP
+#pragma omp for
+#endif
+            for(int li = level_offset[l]; li < level_offset[l + 1]; ++li)
+            {
+                int i = level_row[li];
+
+                PtrType row_begin = this->mat_.row_offset[i];
+                PtrType row_end   = this->mat_.row_offset[i + 1];
+
+                ValueType sum = static_cast<ValueType>(0);
+
+                bool has_diag = false;
+
+                // j=0,..i
+                PtrType j;
+                for(j = row_begin; j < row_end; ++j)
+                {
+                    int       col_j = this->mat_.col[j];
+                    ValueType val_j = this->mat_.val[j];
+
+                    // Mark diagonal and skip row
+                    if(col_j == i)
+                    {
+                        has_diag = true;
+                        break;
+                    }
+
+                    // Skip upper triangular
+                    if(col_j > i)
+                    {
+                        break;
+                    }
+
+                    PtrType row_begin_j = this->mat_.row_offset[col_j];
+                    PtrType row_diag_j  = diag_offset[col_j];
+
+                    ValueType local_sum = static_cast<ValueType>(0);
+                    ValueType inv_diag  = this->mat_.val[row_diag_j];
+
+                    // Check for numeric zero
+                    if(inv_diag == static_cast<ValueType>(0))
+                    {
+                        LOG_INFO("IC breakdown: division by zero");
+                        FATAL_ERROR(__FILE__, __LINE__);
+                    }
+
+                    inv_diag = static_cast<ValueType>(1) / inv_diag;
+
+                    // position in i-th row, both rows are sorted
+                    PtrType idx = row_begin;
+
+                    for(PtrType k = row_begin_j; k < row_diag_j; ++k)
+                    {
+                        int col_k = this->mat_.col[k];
+
+                        while(idx < j && this->mat_.col[idx] < col_k)
+                        {
+                            ++idx;
+                        }
+
+                        if(idx == j)
+                        {
+                            break;
+                        }
+
+                        if(this->mat_.col[idx] == col_k)
+                        {
+                            local_sum += this->mat_.val[k] * this->mat_.val[idx];
+                        }
+                    }
+
+                    val_j = (val_j - local_sum) * inv_diag;
+                    sum += val_j * val_j;
+
+                    this->mat_.val[j] = val_j;
+                }
+
+                if(!has_diag)
+                {
+                    // Structural zero
+                    LOG_INFO("IC breakdown: structural zero diagonal");
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                // Process diagonal entry
+                ValueType diag_entry = std::sqrt(std::abs(this->mat_.val[j] - sum));
+                this->mat_.val[j]    = diag_entry;
+
+                // Check for numerical zero
+                if(diag_entry == static_cast<ValueType>(0))
+                {
+                    LOG_INFO("IC breakdown: division by zero");
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                // Store inverse diagonal entry
+                cast_diag->vec_[i] = static_cast<ValueType>(1) / diag_entry;
+
+                // Store diagonal offset
+                diag_offset[i] = j;
+            }
+        }
+
+        // Free temporary storage
+        free_host(&diag_offset);
+        free_host(&level_offset);
+        free_host(&level_row);
 
         return true;
     }
 
+    // Fine-grained iterative IC(0) factorization, see ItILU0Factorize()
+    // The matrix is expected to hold the lower triangular part only, with the
+    // diagonal entry being the last entry of each row.
     template <typename ValueType>
-    bool HostMatrixCSR<ValueType>::ICFactorize(BaseVector<ValueType>* inv_diag)
+    bool HostMatrixCSR<ValueType>::ItICFactorize(BaseVector<ValueType>* inv_diag, int sweeps)
     {
         assert(this->nrow_ == this->ncol_);
         assert(this->nnz_ > 0);
+        assert(sweeps > 0);
 
         assert(inv_diag != NULL);
         HostVector<ValueType>* cast_diag = dynamic_cast<HostVector<ValueType>*>(inv_diag);
@@ -1778,94 +3522,124 @@ namespace rocalution
 
         cast_diag->Allocate(this->nrow_);
 
-        int* diag_offset = NULL;
-        int* nnz_entries = NULL;
-
-        allocate_host(this->nrow_, &diag_offset);
-        allocate_host(this->nrow_, &nnz_entries);
-
-        for(int i = 0; i < this->nrow_; ++i)
-        {
-            nnz_entries[i] = 0;
-        }
-
-        // i=0,..n
-        for(int i = 0; i < this->nrow_; ++i)
+        for(int ai = 0; ai < this->nrow_; ++ai)
         {
-            int row_begin = this->mat_.row_offset[i];
-            int row_end   = this->mat_.row_offset[i + 1];
+            PtrType row_end = this->mat_.row_offset[ai + 1];
 
-            for(int j = row_begin; j < row_end; ++j)
+            if(row_end == this->mat_.row_offset[ai] || this->mat_.col[row_end - 1] != ai)
             {
-                nnz_entries[this->mat_.col[j]] = j;
+                // Structural zero
+                LOG_INFO("IC breakdown: structural zero diagonal");
+                FATAL_ERROR(__FILE__, __LINE__);
             }
+        }
 
-            ValueType sum = static_cast<ValueType>(0);
+        ValueType* val_A   = NULL;
+        ValueType* val_new = NULL;
 
-            bool has_diag = false;
+        allocate_host(this->nnz_, &val_A);
+        allocate_host(this->nnz_, &val_new);
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
 
-            // j=0,..i
-            int j;
-            for(j = row_begin; j < row_end; ++j)
+        // Initial guess, L = lower(A) D^-1/2
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
-                int       col_j = this->mat_.col[j];
-                ValueType val_j = this->mat_.val[j];
+                int col_j = this->mat_.col[aj];
 
-                // Mark diagonal and skip row
-                if(col_j == i)
+                val_A[aj] = this->mat_.val[aj];
+
+                ValueType diag
+                    = std::sqrt(std::abs(this->mat_.val[this->mat_.row_offset[col_j + 1] - 1]));
+
+                if(col_j == ai)
                 {
-                    has_diag = true;
-                    break;
+                    val_new[aj] = diag;
                 }
-
-                // Skip upper triangular
-                if(col_j > i)
+                else
                 {
-                    break;
+                    val_new[aj] = (diag != static_cast<ValueType>(0)) ? this->mat_.val[aj] / diag
+                                                                      : this->mat_.val[aj];
                 }
+            }
+        }
+
+        for(int sweep = 0; sweep < sweeps; ++sweep)
+        {
+            // Values of the previous sweep are in mat_.val
+            ValueType* tmp = this->mat_.val;
+            this->mat_.val = val_new;
+            val_new        = tmp;
 
-                int row_begin_j = this->mat_.row_offset[col_j];
-                int row_diag_j  = diag_offset[col_j];
+            const ValueType* val_old = this->mat_.val;
 
-                ValueType local_sum = static_cast<ValueType>(0);
-                ValueType inv_diag  = this->mat_.val[row_diag_j];
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int ai = 0; ai < this->nrow_; ++ai)
+            {
+                PtrType row_start = this->mat_.row_offset[ai];
+                PtrType row_end   = this->mat_.row_offset[ai + 1];
 
-                // Check for numeric zero
-                if(inv_diag == static_cast<ValueType>(0))
+                for(PtrType aj = row_start; aj < row_end; ++aj)
                 {
-                    LOG_INFO("IC breakdown: division by zero");
-                    FATAL_ERROR(__FILE__, __LINE__);
-                }
+                    int col_j = this->mat_.col[aj];
 
-                inv_diag = static_cast<ValueType>(1) / inv_diag;
+                    // sum_{k < col_j} l_ai,k * l_col_j,k
+                    ValueType sum = val_A[aj];
 
-                for(int k = row_begin_j; k < row_diag_j; ++k)
-                {
-                    int col_k = this->mat_.col[k];
+                    PtrType idx       = row_start;
+                    PtrType row_end_j = this->mat_.row_offset[col_j + 1] - 1;
 
-                    if(nnz_entries[col_k] != 0)
+                    for(PtrType k = this->mat_.row_offset[col_j]; k < row_end_j; ++k)
                     {
-                        int idx = nnz_entries[col_k];
-                        local_sum += this->mat_.val[k] * this->mat_.val[idx];
+                        int col_k = this->mat_.col[k];
+
+                        while(idx < aj && this->mat_.col[idx] < col_k)
+                        {
+                            ++idx;
+                        }
+
+                        if(idx == aj)
+                        {
+                            break;
+                        }
+
+                        if(this->mat_.col[idx] == col_k)
+                        {
+                            sum -= val_old[idx] * val_old[k];
+                        }
                     }
-                }
 
-                val_j = (val_j - local_sum) * inv_diag;
-                sum += val_j * val_j;
+                    if(col_j == ai)
+                    {
+                        val_new[aj] = std::sqrt(std::abs(sum));
+                    }
+                    else
+                    {
+                        ValueType diag = val_old[row_end_j];
 
-                this->mat_.val[j] = val_j;
+                        val_new[aj] = (diag != static_cast<ValueType>(0)) ? sum / diag : sum;
+                    }
+                }
             }
+        }
 
-            if(!has_diag)
-            {
-                // Structural zero
-                LOG_INFO("IC breakdown: structural zero diagonal");
-                FATAL_ERROR(__FILE__, __LINE__);
-            }
+        // Final values are in val_new, the buffer of mat_.val is released
+        free_host(&this->mat_.val);
+        this->mat_.val = val_new;
+
+        free_host(&val_A);
 
-            // Process diagonal entry
-            ValueType diag_entry = std::sqrt(std::abs(this->mat_.val[j] - sum));
-            this->mat_.val[j]    = diag_entry;
+        // Store inverse diagonal entries
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            ValueType diag_entry = this->mat_.val[this->mat_.row_offset[ai + 1] - 1];
 
             // Check for numerical zero
             if(diag_entry == static_cast<ValueType>(0))
@@ -1874,23 +3648,9 @@ namespace rocalution
                 FATAL_ERROR(__FILE__, __LINE__);
             }
 
-            // Store inverse diagonal entry
-            cast_diag->vec_[i] = static_cast<ValueType>(1) / diag_entry;
-
-            // Store diagonal offset
-            diag_offset[i] = j;
-
-            // Clear nnz entries
-            for(j = row_begin; j < row_end; ++j)
-            {
-                nnz_entries[this->mat_.col[j]] = 0;
-            }
+            cast_diag->vec_[ai] = static_cast<ValueType>(1) / diag_entry;
         }
 
-        // Free temporary storage
-        free_host(&diag_offset);
-        free_host(&nnz_entries);
-
         return true;
     }
 
@@ -1919,7 +3679,7 @@ namespace rocalution
             row_col.reserve(num_colors + 2);
             row_col.assign(num_colors + 2, false);
 
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if(ai != this->mat_.col[aj])
                 {
@@ -1927,7 +3687,7 @@ namespace rocalution
                 }
             }
 
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if(row_col[color[ai]] == true)
                 {
@@ -2000,7 +3760,8 @@ namespace rocalution
                 ++size;
 
                 // remove all nbh nodes (without diagonal)
-                for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+                for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1];
+                    ++aj)
                 {
                     if(ai != this->mat_.col[aj])
                     {
@@ -2053,7 +3814,7 @@ namespace rocalution
 
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if(ai == this->mat_.col[aj])
                 {
@@ -2069,7 +3830,7 @@ namespace rocalution
         {
             bool hit = false;
 
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if(ai == this->mat_.col[aj])
                 {
@@ -2099,8 +3860,8 @@ namespace rocalution
         assert(cast_mat != NULL);
         assert(this->ncol_ == cast_mat->nrow_);
 
-        std::vector<int>  row_offset;
-        std::vector<int>* new_col = new std::vector<int>[this->nrow_];
+        std::vector<PtrType> row_offset;
+        std::vector<int>*    new_col = new std::vector<int>[this->nrow_];
 
         row_offset.resize(this->nrow_ + 1);
 
@@ -2114,12 +3875,13 @@ namespace rocalution
         for(int i = 0; i < this->nrow_; ++i)
         {
             // loop over the row
-            for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
             {
                 int ii = this->mat_.col[j];
 
                 // loop corresponding row
-                for(int k = cast_mat->mat_.row_offset[ii]; k < cast_mat->mat_.row_offset[ii + 1];
+                for(PtrType k = cast_mat->mat_.row_offset[ii];
+                    k < cast_mat->mat_.row_offset[ii + 1];
                     ++k)
                 {
                     new_col[i].push_back(cast_mat->mat_.col[k]);
@@ -2129,7 +3891,7 @@ namespace rocalution
             std::sort(new_col[i].begin(), new_col[i].end());
             new_col[i].erase(std::unique(new_col[i].begin(), new_col[i].end()), new_col[i].end());
 
-            row_offset[i + 1] = int(new_col[i].size());
+            row_offset[i + 1] = static_cast<PtrType>(new_col[i].size());
         }
 
         for(int i = 0; i < this->nrow_; ++i)
@@ -2153,7 +3915,7 @@ namespace rocalution
         for(int i = 0; i < this->nrow_; ++i)
         {
             int jj = 0;
-            for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
             {
                 this->mat_.col[j] = new_col[i][jj];
                 ++jj;
@@ -2205,7 +3967,7 @@ namespace rocalution
         int n = cast_mat_A->nrow_;
         int m = cast_mat_B->ncol_;
 
-        int* row_offset = NULL;
+        PtrType* row_offset = NULL;
         allocate_host(n + 1, &row_offset);
         int*       col = NULL;
         ValueType* val = NULL;
@@ -2219,7 +3981,7 @@ namespace rocalution
 #pragma omp parallel
 #endif
         {
-            std::vector<int> marker(m, -1);
+            std::vector<PtrType> marker(m, -1);
 
 #ifdef _OPENMP
             int nt  = omp_get_num_threads();
@@ -2235,13 +3997,13 @@ namespace rocalution
 
             for(int ia = chunk_start; ia < chunk_end; ++ia)
             {
-                for(int ja = cast_mat_A->mat_.row_offset[ia],
+                for(PtrType ja = cast_mat_A->mat_.row_offset[ia],
                         ea = cast_mat_A->mat_.row_offset[ia + 1];
                     ja < ea;
                     ++ja)
                 {
                     int ca = cast_mat_A->mat_.col[ja];
-                    for(int jb = cast_mat_B->mat_.row_offset[ca],
+                    for(PtrType jb = cast_mat_B->mat_.row_offset[ca],
                             eb = cast_mat_B->mat_.row_offset[ca + 1];
                         jb < eb;
                         ++jb)
@@ -2277,10 +4039,10 @@ namespace rocalution
 
             for(int ia = chunk_start; ia < chunk_end; ++ia)
             {
-                int row_begin = row_offset[ia];
-                int row_end   = row_begin;
+                PtrType row_begin = row_offset[ia];
+                PtrType row_end   = row_begin;
 
-                for(int ja = cast_mat_A->mat_.row_offset[ia],
+                for(PtrType ja = cast_mat_A->mat_.row_offset[ia],
                         ea = cast_mat_A->mat_.row_offset[ia + 1];
                     ja < ea;
                     ++ja)
@@ -2288,7 +4050,7 @@ namespace rocalution
                     int       ca = cast_mat_A->mat_.col[ja];
                     ValueType va = cast_mat_A->mat_.val[ja];
 
-                    for(int jb = cast_mat_B->mat_.row_offset[ca],
+                    for(PtrType jb = cast_mat_B->mat_.row_offset[ca],
                             eb = cast_mat_B->mat_.row_offset[ca + 1];
                         jb < eb;
                         ++jb)
@@ -2323,9 +4085,10 @@ namespace rocalution
 #endif
         for(int i = 0; i < this->nrow_; ++i)
         {
-            for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
             {
-                for(int jj = this->mat_.row_offset[i]; jj < this->mat_.row_offset[i + 1] - 1; ++jj)
+                for(PtrType jj = this->mat_.row_offset[i]; jj < this->mat_.row_offset[i + 1] - 1;
+                    ++jj)
                 {
                     if(this->mat_.col[jj] > this->mat_.col[jj + 1])
                     {
@@ -2361,8 +4124,8 @@ namespace rocalution
         assert(cast_mat_B != NULL);
         assert(cast_mat_A->ncol_ == cast_mat_B->nrow_);
 
-        std::vector<int>  row_offset;
-        std::vector<int>* new_col = new std::vector<int>[cast_mat_A->nrow_];
+        std::vector<PtrType> row_offset;
+        std::vector<int>*    new_col = new std::vector<int>[cast_mat_A->nrow_];
 
         row_offset.resize(cast_mat_A->nrow_ + 1);
 
@@ -2376,13 +4139,14 @@ namespace rocalution
         for(int i = 0; i < cast_mat_A->nrow_; ++i)
         {
             // loop over the row
-            for(int j = cast_mat_A->mat_.row_offset[i]; j < cast_mat_A->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = cast_mat_A->mat_.row_offset[i]; j < cast_mat_A->mat_.row_offset[i + 1];
+                ++j)
             {
                 int ii = cast_mat_A->mat_.col[j];
                 //      new_col[i].push_back(ii);
 
                 // loop corresponding row
-                for(int k = cast_mat_B->mat_.row_offset[ii];
+                for(PtrType k = cast_mat_B->mat_.row_offset[ii];
                     k < cast_mat_B->mat_.row_offset[ii + 1];
                     ++k)
                 {
@@ -2393,7 +4157,7 @@ namespace rocalution
             std::sort(new_col[i].begin(), new_col[i].end());
             new_col[i].erase(std::unique(new_col[i].begin(), new_col[i].end()), new_col[i].end());
 
-            row_offset[i + 1] = int(new_col[i].size());
+            row_offset[i + 1] = static_cast<PtrType>(new_col[i].size());
         }
 
         for(int i = 0; i < cast_mat_A->nrow_; ++i)
@@ -2417,7 +4181,7 @@ namespace rocalution
         for(int i = 0; i < cast_mat_A->nrow_; ++i)
         {
             int jj = 0;
-            for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
             {
                 this->mat_.col[j] = new_col[i][jj];
                 ++jj;
@@ -2458,28 +4222,325 @@ namespace rocalution
         for(int i = 0; i < cast_mat_A->nrow_; ++i)
         {
             // loop over the row
-            for(int j = cast_mat_A->mat_.row_offset[i]; j < cast_mat_A->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = cast_mat_A->mat_.row_offset[i]; j < cast_mat_A->mat_.row_offset[i + 1];
+                ++j)
             {
                 int ii = cast_mat_A->mat_.col[j];
 
-                // loop corresponding row
-                for(int k = cast_mat_B->mat_.row_offset[ii];
-                    k < cast_mat_B->mat_.row_offset[ii + 1];
-                    ++k)
+                // loop corresponding row
+                for(PtrType k = cast_mat_B->mat_.row_offset[ii];
+                    k < cast_mat_B->mat_.row_offset[ii + 1];
+                    ++k)
+                {
+                    for(PtrType p = this->mat_.row_offset[i]; p < this->mat_.row_offset[i + 1]; ++p)
+                    {
+                        if(cast_mat_B->mat_.col[k] == this->mat_.col[p])
+                        {
+                            this->mat_.val[p] += cast_mat_B->mat_.val[k] * cast_mat_A->mat_.val[j];
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::TripleMatMult(const BaseMatrix<ValueType>& R,
+                                                 const BaseMatrix<ValueType>& A,
+                                                 const BaseMatrix<ValueType>& P)
+    {
+        const HostMatrixCSR<ValueType>* cast_mat_R
+            = dynamic_cast<const HostMatrixCSR<ValueType>*>(&R);
+        const HostMatrixCSR<ValueType>* cast_mat_A
+            = dynamic_cast<const HostMatrixCSR<ValueType>*>(&A);
+        const HostMatrixCSR<ValueType>* cast_mat_P
+            = dynamic_cast<const HostMatrixCSR<ValueType>*>(&P);
+
+        if(cast_mat_R == NULL || cast_mat_A == NULL || cast_mat_P == NULL)
+        {
+            return false;
+        }
+
+        assert(cast_mat_R->ncol_ == cast_mat_A->nrow_);
+        assert(cast_mat_A->ncol_ == cast_mat_P->nrow_);
+
+        int n = cast_mat_R->nrow_;
+        int m = cast_mat_P->ncol_;
+
+        PtrType* row_offset = NULL;
+        allocate_host(n + 1, &row_offset);
+        int*       col = NULL;
+        ValueType* val = NULL;
+
+        for(int i = 0; i < n + 1; ++i)
+        {
+            row_offset[i] = 0;
+        }
+
+        // Rows of R*A are formed one at a time in a thread local accumulator and are
+        // multiplied by P right away, R*A is never stored
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            std::vector<int>       ra_marker(cast_mat_A->ncol_, -1);
+            std::vector<int>       ra_col;
+            std::vector<ValueType> ra_val;
+            std::vector<PtrType>   marker(m, -1);
+
+#ifdef _OPENMP
+            int nt  = omp_get_num_threads();
+            int tid = omp_get_thread_num();
+
+            int chunk_size  = (n + nt - 1) / nt;
+            int chunk_start = tid * chunk_size;
+            int chunk_end   = std::min(n, chunk_start + chunk_size);
+#else
+            int chunk_start = 0;
+            int chunk_end   = n;
+#endif
+
+            // Form the row of R*A, with values only if requested
+            auto ra_row = [&](int i, bool values) {
+                ra_col.clear();
+                ra_val.clear();
+
+                for(PtrType jr = cast_mat_R->mat_.row_offset[i],
+                        er = cast_mat_R->mat_.row_offset[i + 1];
+                    jr < er;
+                    ++jr)
+                {
+                    int       cr = cast_mat_R->mat_.col[jr];
+                    ValueType vr = cast_mat_R->mat_.val[jr];
+
+                    for(PtrType ja = cast_mat_A->mat_.row_offset[cr],
+                            ea = cast_mat_A->mat_.row_offset[cr + 1];
+                        ja < ea;
+                        ++ja)
+                    {
+                        int ca = cast_mat_A->mat_.col[ja];
+
+                        if(ra_marker[ca] == -1)
+                        {
+                            ra_marker[ca] = static_cast<int>(ra_col.size());
+                            ra_col.push_back(ca);
+
+                            if(values == true)
+                            {
+                                ra_val.push_back(vr * cast_mat_A->mat_.val[ja]);
+                            }
+                        }
+                        else if(values == true)
+                        {
+                            ra_val[ra_marker[ca]] += vr * cast_mat_A->mat_.val[ja];
+                        }
+                    }
+                }
+
+                for(size_t t = 0; t < ra_col.size(); ++t)
+                {
+                    ra_marker[ra_col[t]] = -1;
+                }
+            };
+
+            // Determine the number of entries per row
+            for(int i = chunk_start; i < chunk_end; ++i)
+            {
+                ra_row(i, false);
+
+                for(size_t t = 0; t < ra_col.size(); ++t)
+                {
+                    int c = ra_col[t];
+
+                    for(PtrType jp = cast_mat_P->mat_.row_offset[c],
+                            ep = cast_mat_P->mat_.row_offset[c + 1];
+                        jp < ep;
+                        ++jp)
+                    {
+                        int cp = cast_mat_P->mat_.col[jp];
+
+                        if(marker[cp] != i)
+                        {
+                            marker[cp] = i;
+                            ++row_offset[i + 1];
+                        }
+                    }
+                }
+            }
+
+            std::fill(marker.begin(), marker.end(), -1);
+
+#ifdef _OPENMP
+#pragma omp barrier
+#endif
+#ifdef _OPENMP
+#pragma omp single
+#endif
+            {
+                for(int i = 1; i < n + 1; ++i)
+                {
+                    row_offset[i] += row_offset[i - 1];
+                }
+
+                allocate_host(row_offset[n], &col);
+                allocate_host(row_offset[n], &val);
+            }
+
+            // Compute the entries
+            for(int i = chunk_start; i < chunk_end; ++i)
+            {
+                PtrType row_begin = row_offset[i];
+                PtrType row_end   = row_begin;
+
+                ra_row(i, true);
+
+                for(size_t t = 0; t < ra_col.size(); ++t)
+                {
+                    int       c = ra_col[t];
+                    ValueType v = ra_val[t];
+
+                    for(PtrType jp = cast_mat_P->mat_.row_offset[c],
+                            ep = cast_mat_P->mat_.row_offset[c + 1];
+                        jp < ep;
+                        ++jp)
+                    {
+                        int cp = cast_mat_P->mat_.col[jp];
+
+                        if(marker[cp] < row_begin)
+                        {
+                            marker[cp]   = row_end;
+                            col[row_end] = cp;
+                            val[row_end] = v * cast_mat_P->mat_.val[jp];
+                            ++row_end;
+                        }
+                        else
+                        {
+                            val[marker[cp]] += v * cast_mat_P->mat_.val[jp];
+                        }
+                    }
+                }
+            }
+        }
+
+        this->SetDataPtrCSR(&row_offset, &col, &val, row_offset[n], n, m);
+
+        // Sorting the col (per row)
+        this->Sort();
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::NumericTripleMatMult(const BaseMatrix<ValueType>& R,
+                                                        const BaseMatrix<ValueType>& A,
+                                                        const BaseMatrix<ValueType>& P)
+    {
+        const HostMatrixCSR<ValueType>* cast_mat_R
+            = dynamic_cast<const HostMatrixCSR<ValueType>*>(&R);
+        const HostMatrixCSR<ValueType>* cast_mat_A
+            = dynamic_cast<const HostMatrixCSR<ValueType>*>(&A);
+        const HostMatrixCSR<ValueType>* cast_mat_P
+            = dynamic_cast<const HostMatrixCSR<ValueType>*>(&P);
+
+        if(cast_mat_R == NULL || cast_mat_A == NULL || cast_mat_P == NULL)
+        {
+            return false;
+        }
+
+        assert(cast_mat_R->ncol_ == cast_mat_A->nrow_);
+        assert(cast_mat_A->ncol_ == cast_mat_P->nrow_);
+        assert(this->nrow_ == cast_mat_R->nrow_);
+        assert(this->ncol_ == cast_mat_P->ncol_);
+
+        // Set if a product does not fit into the structure of this matrix
+        bool missing = false;
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            // Row of R*A, compressed by a marker over the columns of A
+            std::vector<int>       ra_marker(cast_mat_A->ncol_, -1);
+            std::vector<int>       ra_col;
+            std::vector<ValueType> ra_val;
+
+            // Position of each column in the current row of this matrix
+            std::vector<PtrType> marker(this->ncol_, -1);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 256) reduction(|| : missing)
+#endif
+            for(int i = 0; i < this->nrow_; ++i)
+            {
+                ra_col.clear();
+                ra_val.clear();
+
+                for(PtrType j = cast_mat_R->mat_.row_offset[i];
+                    j < cast_mat_R->mat_.row_offset[i + 1];
+                    ++j)
+                {
+                    int       k   = cast_mat_R->mat_.col[j];
+                    ValueType val = cast_mat_R->mat_.val[j];
+
+                    for(PtrType l = cast_mat_A->mat_.row_offset[k];
+                        l < cast_mat_A->mat_.row_offset[k + 1];
+                        ++l)
+                    {
+                        int c = cast_mat_A->mat_.col[l];
+
+                        if(ra_marker[c] == -1)
+                        {
+                            ra_marker[c] = static_cast<int>(ra_col.size());
+                            ra_col.push_back(c);
+                            ra_val.push_back(val * cast_mat_A->mat_.val[l]);
+                        }
+                        else
+                        {
+                            ra_val[ra_marker[c]] += val * cast_mat_A->mat_.val[l];
+                        }
+                    }
+                }
+
+                PtrType row_begin = this->mat_.row_offset[i];
+                PtrType row_end   = this->mat_.row_offset[i + 1];
+
+                for(PtrType j = row_begin; j < row_end; ++j)
+                {
+                    marker[this->mat_.col[j]] = j;
+                    this->mat_.val[j]         = static_cast<ValueType>(0);
+                }
+
+                for(size_t t = 0; t < ra_col.size(); ++t)
                 {
-                    for(int p = this->mat_.row_offset[i]; p < this->mat_.row_offset[i + 1]; ++p)
+                    int c = ra_col[t];
+
+                    ra_marker[c] = -1;
+
+                    for(PtrType l = cast_mat_P->mat_.row_offset[c];
+                        l < cast_mat_P->mat_.row_offset[c + 1];
+                        ++l)
                     {
-                        if(cast_mat_B->mat_.col[k] == this->mat_.col[p])
+                        PtrType pos = marker[cast_mat_P->mat_.col[l]];
+
+                        // Markers of previous rows are out of range
+                        if(pos < row_begin || pos >= row_end)
                         {
-                            this->mat_.val[p] += cast_mat_B->mat_.val[k] * cast_mat_A->mat_.val[j];
-                            break;
+                            missing = true;
+                            continue;
                         }
+
+                        this->mat_.val[pos] += ra_val[t] * cast_mat_P->mat_.val[l];
                     }
                 }
             }
         }
 
-        return true;
+        return !missing;
     }
 
     template <typename ValueType>
@@ -2558,6 +4619,262 @@ namespace rocalution
         return true;
     }
 
+    // Symbolic LU factorization, based on the elimination tree of the structure of
+    // A + A^T, see T. A. Davis, Direct methods for sparse linear systems, SIAM, 2006.
+    // The structure is extended by the fill-in of the complete factorization (explicit
+    // zero entries), such that ILU0Factorize() on the result computes the exact factors.
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::SymbolicLU(void)
+    {
+        assert(this->nrow_ == this->ncol_);
+        assert(this->nnz_ > 0);
+
+        int n = this->nrow_;
+
+        // Strict lower part of the structure of A + A^T (rows may contain duplicates)
+        PtrType* low_offset = NULL;
+        int*     low_col    = NULL;
+
+        allocate_host(n + 1, &low_offset);
+        set_to_zero_host(n + 1, low_offset);
+
+        for(int ai = 0; ai < n; ++ai)
+        {
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            {
+                int col_j = this->mat_.col[aj];
+
+                if(col_j < ai)
+                {
+                    ++low_offset[ai + 1];
+                }
+                else if(col_j > ai)
+                {
+                    ++low_offset[col_j + 1];
+                }
+            }
+        }
+
+        for(int i = 0; i < n; ++i)
+        {
+            low_offset[i + 1] += low_offset[i];
+        }
+
+        allocate_host(low_offset[n], &low_col);
+
+        for(int ai = 0; ai < n; ++ai)
+        {
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            {
+                int col_j = this->mat_.col[aj];
+
+                if(col_j < ai)
+                {
+                    low_col[low_offset[ai]++] = col_j;
+                }
+                else if(col_j > ai)
+                {
+                    low_col[low_offset[col_j]++] = ai;
+                }
+            }
+        }
+
+        for(int i = n; i > 0; --i)
+        {
+            low_offset[i] = low_offset[i - 1];
+        }
+
+        low_offset[0] = 0;
+
+        // Elimination tree (with path compression)
+        int* parent   = NULL;
+        int* ancestor = NULL;
+
+        allocate_host(n, &parent);
+        allocate_host(n, &ancestor);
+
+        for(int i = 0; i < n; ++i)
+        {
+            parent[i]   = -1;
+            ancestor[i] = -1;
+
+            for(PtrType j = low_offset[i]; j < low_offset[i + 1]; ++j)
+            {
+                int next = -1;
+
+                for(int k = low_col[j]; k != -1 && k < i; k = next)
+                {
+                    next        = ancestor[k];
+                    ancestor[k] = i;
+
+                    if(next == -1)
+                    {
+                        parent[k] = i;
+                    }
+                }
+            }
+        }
+
+        free_host(&ancestor);
+
+        // The structure of row i of L is the subtree of the elimination tree, that is
+        // reached from the entries of the strict lower part of row i
+        PtrType* l_offset = NULL;
+        int*     l_col    = NULL;
+
+        allocate_host(n + 1, &l_offset);
+
+        l_offset[0] = 0;
+
+        _set_omp_backend_threads(this->local_backend_, n);
+
+        for(int pass = 0; pass < 2; ++pass)
+        {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            {
+                std::vector<int> marker(n, -1);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 256)
+#endif
+                for(int i = 0; i < n; ++i)
+                {
+                    PtrType idx = (pass == 0) ? 0 : l_offset[i];
+
+                    marker[i] = i;
+
+                    for(PtrType j = low_offset[i]; j < low_offset[i + 1]; ++j)
+                    {
+                        for(int k = low_col[j]; marker[k] != i; k = parent[k])
+                        {
+                            marker[k] = i;
+
+                            if(pass == 1)
+                            {
+                                l_col[idx] = k;
+                            }
+
+                            ++idx;
+                        }
+                    }
+
+                    if(pass == 0)
+                    {
+                        l_offset[i + 1] = idx;
+                    }
+                    else
+                    {
+                        std::sort(l_col + l_offset[i], l_col + idx);
+                    }
+                }
+            }
+
+            if(pass == 0)
+            {
+                for(int i = 0; i < n; ++i)
+                {
+                    l_offset[i + 1] += l_offset[i];
+                }
+
+                allocate_host(l_offset[n], &l_col);
+            }
+        }
+
+        free_host(&low_offset);
+        free_host(&low_col);
+        free_host(&parent);
+
+        // Structure of L + U, where U has the transposed structure of L
+        PtrType*   row_offset = NULL;
+        int*       col        = NULL;
+        ValueType* val        = NULL;
+
+        allocate_host(n + 1, &row_offset);
+        set_to_zero_host(n + 1, row_offset);
+
+        for(int i = 0; i < n; ++i)
+        {
+            row_offset[i + 1] += l_offset[i + 1] - l_offset[i] + 1;
+
+            for(PtrType j = l_offset[i]; j < l_offset[i + 1]; ++j)
+            {
+                ++row_offset[l_col[j] + 1];
+            }
+        }
+
+        for(int i = 0; i < n; ++i)
+        {
+            row_offset[i + 1] += row_offset[i];
+        }
+
+        PtrType nnz = row_offset[n];
+
+        allocate_host(nnz, &col);
+        allocate_host(nnz, &val);
+
+        // Position of the next upper entry in each row
+        PtrType* u_pos = NULL;
+        allocate_host(n, &u_pos);
+
+        for(int i = 0; i < n; ++i)
+        {
+            PtrType idx = row_offset[i];
+
+            for(PtrType j = l_offset[i]; j < l_offset[i + 1]; ++j)
+            {
+                col[idx++] = l_col[j];
+            }
+
+            col[idx] = i;
+            u_pos[i] = idx + 1;
+        }
+
+        // Rows are visited in ascending order, such that the upper parts are sorted
+        for(int i = 0; i < n; ++i)
+        {
+            for(PtrType j = l_offset[i]; j < l_offset[i + 1]; ++j)
+            {
+                col[u_pos[l_col[j]]++] = i;
+            }
+        }
+
+        free_host(&u_pos);
+        free_host(&l_offset);
+        free_host(&l_col);
+
+        // Copy the values of the matrix into the new structure
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            std::vector<PtrType> pos(n, -1);
+
+#ifdef _OPENMP
+#pragma omp for
+#endif
+            for(int i = 0; i < n; ++i)
+            {
+                for(PtrType j = row_offset[i]; j < row_offset[i + 1]; ++j)
+                {
+                    pos[col[j]] = j;
+                    val[j]      = static_cast<ValueType>(0);
+                }
+
+                for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+                {
+                    val[pos[this->mat_.col[j]]] += this->mat_.val[j];
+                }
+            }
+        }
+
+        this->Clear();
+        this->SetDataPtrCSR(&row_offset, &col, &val, nnz, n, n);
+
+        return true;
+    }
+
     template <typename ValueType>
     bool HostMatrixCSR<ValueType>::ILUpFactorizeNumeric(int p, const BaseMatrix<ValueType>& mat)
     {
@@ -2570,8 +4887,8 @@ namespace rocalution
         assert(this->nnz_ > 0);
         assert(cast_mat->nnz_ > 0);
 
-        int*       row_offset = NULL;
-        int*       ind_diag   = NULL;
+        PtrType*   row_offset = NULL;
+        PtrType*   ind_diag   = NULL;
         int*       levels     = NULL;
         ValueType* val        = NULL;
 
@@ -2580,8 +4897,8 @@ namespace rocalution
         allocate_host(cast_mat->nnz_, &levels);
         allocate_host(cast_mat->nnz_, &val);
 
-        int inf_level = 99999;
-        int nnz       = 0;
+        int     inf_level = 99999;
+        PtrType nnz       = 0;
 
         _set_omp_backend_threads(this->local_backend_, this->nrow_);
 
@@ -2591,7 +4908,7 @@ namespace rocalution
 #endif
         for(int ai = 0; ai < cast_mat->nrow_; ++ai)
         {
-            for(int aj = cast_mat->mat_.row_offset[ai]; aj < cast_mat->mat_.row_offset[ai + 1];
+            for(PtrType aj = cast_mat->mat_.row_offset[ai]; aj < cast_mat->mat_.row_offset[ai + 1];
                 ++aj)
             {
                 if(ai == cast_mat->mat_.col[aj])
@@ -2615,7 +4932,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-        for(int i = 0; i < cast_mat->nnz_; ++i)
+        for(PtrType i = 0; i < cast_mat->nnz_; ++i)
         {
             levels[i] = inf_level;
         }
@@ -2623,7 +4940,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-        for(int i = 0; i < cast_mat->nnz_; ++i)
+        for(PtrType i = 0; i < cast_mat->nnz_; ++i)
         {
             val[i] = static_cast<ValueType>(0);
         }
@@ -2634,10 +4951,11 @@ namespace rocalution
 #endif
         for(int ai = 0; ai < cast_mat->nrow_; ++ai)
         {
-            for(int aj = cast_mat->mat_.row_offset[ai]; aj < cast_mat->mat_.row_offset[ai + 1];
+            for(PtrType aj = cast_mat->mat_.row_offset[ai]; aj < cast_mat->mat_.row_offset[ai + 1];
                 ++aj)
             {
-                for(int ajj = this->mat_.row_offset[ai]; ajj < this->mat_.row_offset[ai + 1]; ++ajj)
+                for(PtrType ajj = this->mat_.row_offset[ai]; ajj < this->mat_.row_offset[ai + 1];
+                    ++ajj)
                 {
                     if(cast_mat->mat_.col[aj] == this->mat_.col[ajj])
                     {
@@ -2653,20 +4971,20 @@ namespace rocalution
         for(int ai = 1; ai < cast_mat->nrow_; ++ai)
         {
             // ak = 1 to ai-1
-            for(int ak = cast_mat->mat_.row_offset[ai]; ai > cast_mat->mat_.col[ak]; ++ak)
+            for(PtrType ak = cast_mat->mat_.row_offset[ai]; ai > cast_mat->mat_.col[ak]; ++ak)
             {
                 if(levels[ak] <= p)
                 {
                     val[ak] /= val[ind_diag[cast_mat->mat_.col[ak]]];
 
                     // aj = ak+1 to N
-                    for(int aj = ak + 1; aj < cast_mat->mat_.row_offset[ai + 1]; ++aj)
+                    for(PtrType aj = ak + 1; aj < cast_mat->mat_.row_offset[ai + 1]; ++aj)
                     {
                         ValueType val_kj   = static_cast<ValueType>(0);
                         int       level_kj = inf_level;
 
                         // find a_k,j
-                        for(int kj = cast_mat->mat_.row_offset[cast_mat->mat_.col[ak]];
+                        for(PtrType kj = cast_mat->mat_.row_offset[cast_mat->mat_.col[ak]];
                             kj < cast_mat->mat_.row_offset[cast_mat->mat_.col[ak] + 1];
                             ++kj)
                         {
@@ -2691,7 +5009,7 @@ namespace rocalution
                 }
             }
 
-            for(int ak = cast_mat->mat_.row_offset[ai]; ak < cast_mat->mat_.row_offset[ai + 1];
+            for(PtrType ak = cast_mat->mat_.row_offset[ai]; ak < cast_mat->mat_.row_offset[ai + 1];
                 ++ak)
             {
                 if(levels[ak] > p)
@@ -2718,10 +5036,10 @@ namespace rocalution
 
         this->AllocateCSR(nnz, cast_mat->nrow_, cast_mat->ncol_);
 
-        int jj = 0;
+        PtrType jj = 0;
         for(int i = 0; i < cast_mat->nrow_; ++i)
         {
-            for(int j = cast_mat->mat_.row_offset[i]; j < cast_mat->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = cast_mat->mat_.row_offset[i]; j < cast_mat->mat_.row_offset[i + 1]; ++j)
             {
                 if(levels[j] <= p)
                 {
@@ -2776,11 +5094,12 @@ namespace rocalution
 #endif
             for(int ai = 0; ai < cast_mat->nrow_; ++ai)
             {
-                int first_col = cast_mat->mat_.row_offset[ai];
+                PtrType first_col = cast_mat->mat_.row_offset[ai];
 
-                for(int ajj = this->mat_.row_offset[ai]; ajj < this->mat_.row_offset[ai + 1]; ++ajj)
+                for(PtrType ajj = this->mat_.row_offset[ai]; ajj < this->mat_.row_offset[ai + 1];
+                    ++ajj)
                 {
-                    for(int aj = first_col; aj < cast_mat->mat_.row_offset[ai + 1]; ++aj)
+                    for(PtrType aj = first_col; aj < cast_mat->mat_.row_offset[ai + 1]; ++aj)
                     {
                         if(cast_mat->mat_.col[aj] == this->mat_.col[ajj])
                         {
@@ -2795,8 +5114,8 @@ namespace rocalution
         }
         else
         {
-            std::vector<int>  row_offset;
-            std::vector<int>* new_col = new std::vector<int>[this->nrow_];
+            std::vector<PtrType> row_offset;
+            std::vector<int>*    new_col = new std::vector<int>[this->nrow_];
 
             HostMatrixCSR<ValueType> tmp(this->local_backend_);
 
@@ -2811,12 +5130,13 @@ namespace rocalution
 #endif
             for(int i = 0; i < this->nrow_; ++i)
             {
-                for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+                for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
                 {
                     new_col[i].push_back(this->mat_.col[j]);
                 }
 
-                for(int k = cast_mat->mat_.row_offset[i]; k < cast_mat->mat_.row_offset[i + 1]; ++k)
+                for(PtrType k = cast_mat->mat_.row_offset[i]; k < cast_mat->mat_.row_offset[i + 1];
+                    ++k)
                 {
                     new_col[i].push_back(cast_mat->mat_.col[k]);
                 }
@@ -2825,7 +5145,7 @@ namespace rocalution
                 new_col[i].erase(std::unique(new_col[i].begin(), new_col[i].end()),
                                  new_col[i].end());
 
-                row_offset[i + 1] = int(new_col[i].size());
+                row_offset[i + 1] = static_cast<PtrType>(new_col[i].size());
             }
 
             for(int i = 0; i < this->nrow_; ++i)
@@ -2850,7 +5170,7 @@ namespace rocalution
             for(int i = 0; i < this->nrow_; ++i)
             {
                 int jj = 0;
-                for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+                for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
                 {
                     this->mat_.col[j] = new_col[i][jj];
                     ++jj;
@@ -2863,12 +5183,12 @@ namespace rocalution
 #endif
             for(int i = 0; i < this->nrow_; ++i)
             {
-                int Aj = tmp.mat_.row_offset[i];
-                int Bj = cast_mat->mat_.row_offset[i];
+                PtrType Aj = tmp.mat_.row_offset[i];
+                PtrType Bj = cast_mat->mat_.row_offset[i];
 
-                for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+                for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
                 {
-                    for(int jj = Aj; jj < tmp.mat_.row_offset[i + 1]; ++jj)
+                    for(PtrType jj = Aj; jj < tmp.mat_.row_offset[i + 1]; ++jj)
                     {
                         if(this->mat_.col[j] == tmp.mat_.col[jj])
                         {
@@ -2878,7 +5198,7 @@ namespace rocalution
                         }
                     }
 
-                    for(int jj = Bj; jj < cast_mat->mat_.row_offset[i + 1]; ++jj)
+                    for(PtrType jj = Bj; jj < cast_mat->mat_.row_offset[i + 1]; ++jj)
                     {
                         if(this->mat_.col[j] == cast_mat->mat_.col[jj])
                         {
@@ -2913,7 +5233,7 @@ namespace rocalution
             ValueType sum  = static_cast<ValueType>(0);
             ValueType diag = static_cast<ValueType>(0);
 
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if(ai != this->mat_.col[aj])
                 {
@@ -2947,7 +5267,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-        for(int ai = 0; ai < this->nnz_; ++ai)
+        for(PtrType ai = 0; ai < this->nnz_; ++ai)
         {
             this->mat_.val[ai] *= alpha;
         }
@@ -2965,7 +5285,7 @@ namespace rocalution
 #endif
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if(ai == this->mat_.col[aj])
                 {
@@ -2988,7 +5308,7 @@ namespace rocalution
 #endif
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if(ai != this->mat_.col[aj])
                 {
@@ -3008,7 +5328,7 @@ namespace rocalution
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-        for(int ai = 0; ai < this->nnz_; ++ai)
+        for(PtrType ai = 0; ai < this->nnz_; ++ai)
         {
             this->mat_.val[ai] += alpha;
         }
@@ -3026,7 +5346,7 @@ namespace rocalution
 #endif
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if(ai == this->mat_.col[aj])
                 {
@@ -3049,7 +5369,7 @@ namespace rocalution
 #endif
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 if(ai != this->mat_.col[aj])
                 {
@@ -3076,7 +5396,7 @@ namespace rocalution
 #endif
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 this->mat_.val[aj] *= cast_diag->vec_[this->mat_.col[aj]];
             }
@@ -3100,7 +5420,7 @@ namespace rocalution
 #endif
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
             {
                 this->mat_.val[aj] *= cast_diag->vec_[ai];
             }
@@ -3114,7 +5434,7 @@ namespace rocalution
     {
         if(this->nnz_ > 0)
         {
-            std::vector<int> row_offset;
+            std::vector<PtrType> row_offset;
 
             HostMatrixCSR<ValueType> tmp(this->local_backend_);
 
@@ -3133,7 +5453,7 @@ namespace rocalution
             {
                 row_offset[i + 1] = 0;
 
-                for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+                for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
                 {
                     if((std::abs(this->mat_.val[j]) > drop_off) || (this->mat_.col[j] == i))
                     {
@@ -3162,9 +5482,9 @@ namespace rocalution
 #endif
             for(int i = 0; i < this->nrow_; ++i)
             {
-                int jj = this->mat_.row_offset[i];
+                PtrType jj = this->mat_.row_offset[i];
 
-                for(int j = tmp.mat_.row_offset[i]; j < tmp.mat_.row_offset[i + 1]; ++j)
+                for(PtrType j = tmp.mat_.row_offset[i]; j < tmp.mat_.row_offset[i + 1]; ++j)
                 {
                     if((std::abs(tmp.mat_.val[j]) > drop_off) || (tmp.mat_.col[j] == i))
                     {
@@ -3189,6 +5509,10 @@ namespace rocalution
             tmp.CopyFrom(*this);
             tmp.Transpose(this);
         }
+        else
+        {
+            std::swap(this->nrow_, this->ncol_);
+        }
 
         return true;
     }
@@ -3202,12 +5526,17 @@ namespace rocalution
 
         assert(cast_T != NULL);
 
+        cast_T->Clear();
+
+        // Without entries, the transpose is an empty ncol x nrow matrix
+        cast_T->nrow_ = this->ncol_;
+        cast_T->ncol_ = this->nrow_;
+
         if(this->nnz_ > 0)
         {
-            cast_T->Clear();
             cast_T->AllocateCSR(this->nnz_, this->ncol_, this->nrow_);
 
-            for(int i = 0; i < cast_T->nnz_; ++i)
+            for(PtrType i = 0; i < cast_T->nnz_; ++i)
             {
                 cast_T->mat_.row_offset[this->mat_.col[i] + 1] += 1;
             }
@@ -3219,10 +5548,11 @@ namespace rocalution
 
             for(int ai = 0; ai < cast_T->ncol_; ++ai)
             {
-                for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+                for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1];
+                    ++aj)
                 {
-                    int ind_col = this->mat_.col[aj];
-                    int ind     = cast_T->mat_.row_offset[ind_col];
+                    int     ind_col = this->mat_.col[aj];
+                    PtrType ind     = cast_T->mat_.row_offset[ind_col];
 
                     cast_T->mat_.col[ind] = ai;
                     cast_T->mat_.val[ind] = this->mat_.val[aj];
@@ -3231,10 +5561,10 @@ namespace rocalution
                 }
             }
 
-            int shift = 0;
+            PtrType shift = 0;
             for(int i = 0; i < cast_T->nrow_; ++i)
             {
-                int tmp                    = cast_T->mat_.row_offset[i];
+                PtrType tmp                = cast_T->mat_.row_offset[i];
                 cast_T->mat_.row_offset[i] = shift;
                 shift                      = tmp;
             }
@@ -3250,6 +5580,9 @@ namespace rocalution
     template <typename ValueType>
     bool HostMatrixCSR<ValueType>::Sort(void)
     {
+        // The structure changes in place, the level schedule is not valid anymore
+        this->ClearLevelSchedule_(true, true);
+
         if(this->nnz_ > 0)
         {
 #ifdef _OPENMP
@@ -3257,24 +5590,25 @@ namespace rocalution
 #endif
             for(int i = 0; i < this->nrow_; ++i)
             {
-                for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
-                {
-                    for(int jj = this->mat_.row_offset[i]; jj < this->mat_.row_offset[i + 1] - 1;
-                        ++jj)
-                    {
-                        if(this->mat_.col[jj] > this->mat_.col[jj + 1])
-                        {
-                            // swap elements
-                            int       ind = this->mat_.col[jj];
-                            ValueType val = this->mat_.val[jj];
+                PtrType row_begin = this->mat_.row_offset[i];
+                PtrType row_end   = this->mat_.row_offset[i + 1];
 
-                            this->mat_.col[jj] = this->mat_.col[jj + 1];
-                            this->mat_.val[jj] = this->mat_.val[jj + 1];
+                // Insertion sort, linear for rows that are already sorted
+                for(PtrType j = row_begin + 1; j < row_end; ++j)
+                {
+                    int       ind = this->mat_.col[j];
+                    ValueType val = this->mat_.val[j];
+                    PtrType   k   = j;
 
-                            this->mat_.col[jj + 1] = ind;
-                            this->mat_.val[jj + 1] = val;
-                        }
+                    while(k > row_begin && this->mat_.col[k - 1] > ind)
+                    {
+                        this->mat_.col[k] = this->mat_.col[k - 1];
+                        this->mat_.val[k] = this->mat_.val[k - 1];
+                        --k;
                     }
+
+                    this->mat_.col[k] = ind;
+                    this->mat_.val[k] = val;
                 }
             }
         }
@@ -3287,6 +5621,9 @@ namespace rocalution
     {
         assert((permutation.GetSize() == this->nrow_) && (permutation.GetSize() == this->ncol_));
 
+        // The structure changes in place, the level schedule is not valid anymore
+        this->ClearLevelSchedule_(true, true);
+
         if(this->nnz_ > 0)
         {
             const HostVector<int>* cast_perm = dynamic_cast<const HostVector<int>*>(&permutation);
@@ -3303,7 +5640,8 @@ namespace rocalution
 #endif
             for(int i = 0; i < this->nrow_; ++i)
             {
-                row_nnz[i] = this->mat_.row_offset[i + 1] - this->mat_.row_offset[i];
+                row_nnz[i]
+                    = static_cast<int>(this->mat_.row_offset[i + 1] - this->mat_.row_offset[i]);
             }
 
             // Permute vector of nnz per row
@@ -3319,9 +5657,9 @@ namespace rocalution
             }
 
             // Calculate new nnz
-            int* perm_nnz = NULL;
-            allocate_host<int>(this->nrow_ + 1, &perm_nnz);
-            int sum = 0;
+            PtrType* perm_nnz = NULL;
+            allocate_host<PtrType>(this->nrow_ + 1, &perm_nnz);
+            PtrType sum = 0;
 
             for(int i = 0; i < this->nrow_; ++i)
             {
@@ -3342,8 +5680,8 @@ namespace rocalution
 #endif
             for(int i = 0; i < this->nrow_; ++i)
             {
-                int permIndex = perm_nnz[cast_perm->vec_[i]];
-                int prevIndex = this->mat_.row_offset[i];
+                PtrType permIndex = perm_nnz[cast_perm->vec_[i]];
+                PtrType prevIndex = this->mat_.row_offset[i];
 
                 for(int j = 0; j < row_nnz[i]; ++j)
                 {
@@ -3358,7 +5696,7 @@ namespace rocalution
 #endif
             for(int i = 0; i < this->nrow_; ++i)
             {
-                int row_index = perm_nnz[i];
+                PtrType row_index = perm_nnz[i];
 
                 for(int j = 0; j < perm_row_nnz[i]; ++j)
                 {
@@ -3383,7 +5721,7 @@ namespace rocalution
                 }
             }
 
-            free_host<int>(&this->mat_.row_offset);
+            free_host<PtrType>(&this->mat_.row_offset);
             this->mat_.row_offset = perm_nnz;
             free_host<int>(&col);
             free_host<ValueType>(&val);
@@ -3427,7 +5765,7 @@ namespace rocalution
         for(int k = 0; k < this->nrow_; ++k)
         {
             marker[k] = 0;
-            nd[k]     = this->mat_.row_offset[k + 1] - this->mat_.row_offset[k] - 1;
+            nd[k]     = static_cast<int>(this->mat_.row_offset[k + 1] - this->mat_.row_offset[k] - 1);
 
             if(nd[k] > maxdeg)
             {
@@ -3449,7 +5787,8 @@ namespace rocalution
             {
                 head = levset[h];
 
-                for(int k = this->mat_.row_offset[head]; k < this->mat_.row_offset[head + 1]; ++k)
+                for(PtrType k = this->mat_.row_offset[head]; k < this->mat_.row_offset[head + 1];
+                    ++k)
                 {
                     tmp = this->mat_.col[k];
 
@@ -3559,6 +5898,111 @@ namespace rocalution
         return true;
     }
 
+    // Minimum degree ordering on the elimination graph of the structure of A + A^T.
+    // The node of smallest degree (smallest index on ties) is eliminated next and its
+    // neighbours are connected to each other. The elimination graph is stored
+    // explicitly, which is well suited for small to medium sized (e.g. coarse grid)
+    // operators.
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::MinimumDegree(BaseVector<int>* permutation) const
+    {
+        assert(this->nrow_ == this->ncol_);
+        assert(permutation != NULL);
+
+        HostVector<int>* cast_perm = dynamic_cast<HostVector<int>*>(permutation);
+        assert(cast_perm != NULL);
+
+        cast_perm->Clear();
+        cast_perm->Allocate(this->nrow_);
+
+        // Adjacency of A + A^T without the diagonal
+        std::vector<std::vector<int>> adj(this->nrow_);
+
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            {
+                int col_j = this->mat_.col[aj];
+
+                if(col_j != ai)
+                {
+                    adj[ai].push_back(col_j);
+                    adj[col_j].push_back(ai);
+                }
+            }
+        }
+
+        std::set<std::pair<int, int>> queue;
+
+        for(int i = 0; i < this->nrow_; ++i)
+        {
+            std::sort(adj[i].begin(), adj[i].end());
+            adj[i].erase(std::unique(adj[i].begin(), adj[i].end()), adj[i].end());
+
+            queue.insert(std::make_pair(static_cast<int>(adj[i].size()), i));
+        }
+
+        std::vector<int> merged;
+
+        for(int k = 0; k < this->nrow_; ++k)
+        {
+            int p = queue.begin()->second;
+            queue.erase(queue.begin());
+
+            cast_perm->vec_[p] = k;
+
+            const std::vector<int>& nbr = adj[p];
+
+            // Eliminate p, its neighbours form a clique
+            for(size_t n = 0; n < nbr.size(); ++n)
+            {
+                int u = nbr[n];
+
+                std::vector<int>& adj_u = adj[u];
+
+                queue.erase(std::make_pair(static_cast<int>(adj_u.size()), u));
+
+                merged.clear();
+
+                size_t a = 0;
+                size_t b = 0;
+
+                // Both lists are sorted
+                while(a < adj_u.size() || b < nbr.size())
+                {
+                    int v;
+
+                    if(b == nbr.size() || (a < adj_u.size() && adj_u[a] < nbr[b]))
+                    {
+                        v = adj_u[a++];
+                    }
+                    else if(a == adj_u.size() || nbr[b] < adj_u[a])
+                    {
+                        v = nbr[b++];
+                    }
+                    else
+                    {
+                        v = adj_u[a++];
+                        ++b;
+                    }
+
+                    if(v != u && v != p)
+                    {
+                        merged.push_back(v);
+                    }
+                }
+
+                adj_u.swap(merged);
+
+                queue.insert(std::make_pair(static_cast<int>(adj_u.size()), u));
+            }
+
+            std::vector<int>().swap(adj[p]);
+        }
+
+        return true;
+    }
+
     template <typename ValueType>
     bool HostMatrixCSR<ValueType>::CreateFromMap(const BaseVector<int>& map, int n, int m)
     {
@@ -3568,10 +6012,10 @@ namespace rocalution
 
         assert(cast_map != NULL);
 
-        int* row_nnz    = NULL;
-        int* row_buffer = NULL;
+        int*     row_nnz    = NULL;
+        PtrType* row_buffer = NULL;
         allocate_host<int>(m, &row_nnz);
-        allocate_host<int>(m + 1, &row_buffer);
+        allocate_host<PtrType>(m + 1, &row_buffer);
 
         set_to_zero_host(m, row_nnz);
 
@@ -3617,7 +6061,7 @@ namespace rocalution
         assert(this->mat_.row_offset[m] == nnz);
 
         free_host<int>(&row_nnz);
-        free_host<int>(&row_buffer);
+        free_host<PtrType>(&row_buffer);
 
         return true;
     }
@@ -3640,13 +6084,13 @@ namespace rocalution
         // Build restriction operator
         this->CreateFromMap(map, n, m);
 
-        int nnz = this->GetNnz();
+        PtrType nnz = this->GetNnz();
 
         // Build prolongation operator
         cast_pro->Clear();
         cast_pro->AllocateCSR(nnz, n, m);
 
-        int k = 0;
+        PtrType k = 0;
 
         for(int i = 0; i < n; ++i)
         {
@@ -3689,7 +6133,9 @@ namespace rocalution
         assert(cast_conn != NULL);
 
         cast_conn->Clear();
-        cast_conn->Allocate(this->nnz_);
+        // Vectors are int-indexed, one connection flag per entry needs nnz to fit into int
+        assert(this->nnz_ <= std::numeric_limits<int>::max());
+        cast_conn->Allocate(static_cast<int>(this->nnz_));
 
         ValueType eps2 = eps * eps;
 
@@ -3704,7 +6150,7 @@ namespace rocalution
         {
             ValueType eps_dia_i = eps2 * vec_diag.vec_[i];
 
-            for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
             {
                 int       c = this->mat_.col[j];
                 ValueType v = this->mat_.val[j];
@@ -3747,12 +6193,16 @@ namespace rocalution
 
         // Remove nodes without neighbours
         int max_neib = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024) reduction(max : max_neib)
+#endif
         for(int i = 0; i < this->nrow_; ++i)
         {
-            int j = this->mat_.row_offset[i];
-            int e = this->mat_.row_offset[i + 1];
+            PtrType j = this->mat_.row_offset[i];
+            PtrType e = this->mat_.row_offset[i + 1];
 
-            max_neib = std::max(e - j, max_neib);
+            max_neib = std::max(static_cast<int>(e - j), max_neib);
 
             int state = removed;
             for(; j < e; ++j)
@@ -3787,7 +6237,7 @@ namespace rocalution
             neib.clear();
 
             // Include its neighbors as well.
-            for(int j = this->mat_.row_offset[i], e = this->mat_.row_offset[i + 1]; j < e; ++j)
+            for(PtrType j = this->mat_.row_offset[i], e = this->mat_.row_offset[i + 1]; j < e; ++j)
             {
                 int c = this->mat_.col[j];
                 if(cast_conn->vec_[j] && cast_agg->vec_[c] != removed)
@@ -3802,7 +6252,8 @@ namespace rocalution
             // stay here.
             for(typename std::vector<int>::const_iterator nb = neib.begin(); nb != neib.end(); ++nb)
             {
-                for(int j = this->mat_.row_offset[*nb], e = this->mat_.row_offset[*nb + 1]; j < e;
+                for(PtrType j = this->mat_.row_offset[*nb], e = this->mat_.row_offset[*nb + 1];
+                    j < e;
                     ++j)
                 {
                     if(cast_conn->vec_[j] && cast_agg->vec_[this->mat_.col[j]] == undefined)
@@ -3842,9 +6293,9 @@ namespace rocalution
         {
             int state = -2;
 
-            int row_start = this->mat_.row_offset[i];
-            int row_end   = this->mat_.row_offset[i + 1];
-            for(int j = row_start; j < row_end; j++)
+            PtrType row_start = this->mat_.row_offset[i];
+            PtrType row_end   = this->mat_.row_offset[i + 1];
+            for(PtrType j = row_start; j < row_end; j++)
             {
                 if(cast_conn->vec_[j] == 1)
                 {
@@ -3853,13 +6304,8 @@ namespace rocalution
                 }
             }
 
-            unsigned int hash = i;
-            hash              = ((hash >> 16) ^ hash) * 0x45d9f3b;
-            hash              = ((hash >> 16) ^ hash) * 0x45d9f3b;
-            hash              = (hash >> 16) ^ hash;
-
             tuples[i].s = state;
-            tuples[i].v = hash;
+            tuples[i].v = host_amg_hash(i);
             tuples[i].i = i;
         }
 
@@ -3885,9 +6331,9 @@ namespace rocalution
                 {
                     mis_tuple t_max = max_tuples[i];
 
-                    int row_start = this->mat_.row_offset[t_max.i];
-                    int row_end   = this->mat_.row_offset[t_max.i + 1];
-                    for(int j = row_start; j < row_end; j++)
+                    PtrType row_start = this->mat_.row_offset[t_max.i];
+                    PtrType row_end   = this->mat_.row_offset[t_max.i + 1];
+                    for(PtrType j = row_start; j < row_end; j++)
                     {
                         if(cast_conn->vec_[j] == 1)
                         {
@@ -3914,7 +6360,7 @@ namespace rocalution
 
             // Update tuples
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel for schedule(dynamic, 1024) reduction(&& : done)
 #endif
             for(int i = 0; i < this->nrow_; ++i)
             {
@@ -3947,18 +6393,12 @@ namespace rocalution
                     2,
                     "*** warning: HostMatrixCSR::AMGPMISAggregate() Current number of iterations: "
                         << iter);
-            }
-        }
-
-        // exclusive scan on aggregates array
-        int sum = 0;
-        for(int i = 0; i < this->nrow_; ++i)
-        {
-            int temp          = cast_agg->vec_[i];
-            cast_agg->vec_[i] = sum;
-            sum += temp;
+            }
         }
 
+        // exclusive scan on aggregates array
+        host_exclusive_scan(this->nrow_, cast_agg->vec_);
+
         for(int k = 0; k < 2; k++)
         {
 #ifdef _OPENMP
@@ -3980,10 +6420,10 @@ namespace rocalution
 
                 if(t.s == -1)
                 {
-                    int row_start = this->mat_.row_offset[i];
-                    int row_end   = this->mat_.row_offset[i + 1];
+                    PtrType row_start = this->mat_.row_offset[i];
+                    PtrType row_end   = this->mat_.row_offset[i + 1];
 
-                    for(int j = row_start; j < row_end; j++)
+                    for(PtrType j = row_start; j < row_end; j++)
                     {
                         if(cast_conn->vec_[j] == 1)
                         {
@@ -4060,7 +6500,7 @@ namespace rocalution
 #pragma omp parallel
 #endif
         {
-            std::vector<int> marker(ncol, -1);
+            std::vector<PtrType> marker(ncol, -1);
 
 #ifdef _OPENMP
             int nt  = omp_get_num_threads();
@@ -4077,7 +6517,8 @@ namespace rocalution
             // Count number of entries in prolong
             for(int i = chunk_start; i < chunk_end; ++i)
             {
-                for(int j = this->mat_.row_offset[i], e = this->mat_.row_offset[i + 1]; j < e; ++j)
+                for(PtrType j = this->mat_.row_offset[i], e = this->mat_.row_offset[i + 1]; j < e;
+                    ++j)
                 {
                     int c = this->mat_.col[j];
 
@@ -4103,14 +6544,14 @@ namespace rocalution
 #pragma omp single
 #endif
             {
-                int* row_offset = NULL;
+                PtrType* row_offset = NULL;
                 allocate_host(cast_prolong->nrow_ + 1, &row_offset);
 
                 int*       col = NULL;
                 ValueType* val = NULL;
 
-                int nnz  = 0;
-                int nrow = cast_prolong->nrow_;
+                PtrType nnz  = 0;
+                int     nrow = cast_prolong->nrow_;
 
                 row_offset[0] = 0;
                 for(int i = 1; i < nrow + 1; ++i)
@@ -4133,7 +6574,8 @@ namespace rocalution
                 // Diagonal of the filtered matrix is original matrix diagonal plus (lumping_strat = 0) or
                 // minus (lumping_strat = 1) its weak connections.
                 ValueType dia = static_cast<ValueType>(0);
-                for(int j = this->mat_.row_offset[i], e = this->mat_.row_offset[i + 1]; j < e; ++j)
+                for(PtrType j = this->mat_.row_offset[i], e = this->mat_.row_offset[i + 1]; j < e;
+                    ++j)
                 {
                     if(this->mat_.col[j] == i)
                     {
@@ -4154,10 +6596,11 @@ namespace rocalution
 
                 dia = static_cast<ValueType>(1) / dia;
 
-                int row_begin = cast_prolong->mat_.row_offset[i];
-                int row_end   = row_begin;
+                PtrType row_begin = cast_prolong->mat_.row_offset[i];
+                PtrType row_end   = row_begin;
 
-                for(int j = this->mat_.row_offset[i], e = this->mat_.row_offset[i + 1]; j < e; ++j)
+                for(PtrType j = this->mat_.row_offset[i], e = this->mat_.row_offset[i + 1]; j < e;
+                    ++j)
                 {
                     int c = this->mat_.col[j];
 
@@ -4237,7 +6680,7 @@ namespace rocalution
 
         ++ncol;
 
-        int* row_offset = NULL;
+        PtrType* row_offset = NULL;
         allocate_host(this->nrow_ + 1, &row_offset);
 
         int*       col = NULL;
@@ -4259,7 +6702,7 @@ namespace rocalution
         allocate_host(row_offset[this->nrow_], &col);
         allocate_host(row_offset[this->nrow_], &val);
 
-        for(int i = 0, j = 0; i < this->nrow_; ++i)
+        for(PtrType i = 0, j = 0; i < this->nrow_; ++i)
         {
             if(cast_agg->vec_[i] >= 0)
             {
@@ -4304,10 +6747,10 @@ namespace rocalution
             this->ExtractLDiagonal(&L);
         }
 
-        int        nnz        = L.nnz_;
+        PtrType    nnz        = L.nnz_;
         int        nrow       = L.nrow_;
         int        ncol       = L.ncol_;
-        int*       row_offset = NULL;
+        PtrType*   row_offset = NULL;
         int*       col        = NULL;
         ValueType* val        = NULL;
 
@@ -4319,11 +6762,11 @@ namespace rocalution
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
             // entries of ai-th row
-            int nnz_row = row_offset[ai + 1] - row_offset[ai];
+            int nnz_row = static_cast<int>(row_offset[ai + 1] - row_offset[ai]);
 
             if(nnz_row == 1)
             {
-                int aj = this->mat_.row_offset[ai];
+                PtrType aj = this->mat_.row_offset[ai];
                 if(this->mat_.col[aj] == ai)
                 {
                     val[row_offset[ai]] = static_cast<ValueType>(1) / this->mat_.val[aj];
@@ -4336,10 +6779,10 @@ namespace rocalution
 
                 for(int k = 0; k < nnz_row; ++k)
                 {
-                    int row_begin = this->mat_.row_offset[col[row_offset[ai] + k]];
-                    int row_end   = this->mat_.row_offset[col[row_offset[ai] + k] + 1];
+                    PtrType row_begin = this->mat_.row_offset[col[row_offset[ai] + k]];
+                    PtrType row_end   = this->mat_.row_offset[col[row_offset[ai] + k] + 1];
 
-                    for(int aj = row_begin; aj < row_end; ++aj)
+                    for(PtrType aj = row_begin; aj < row_end; ++aj)
                     {
                         for(int j = 0; j < nnz_row; ++j)
                         {
@@ -4393,7 +6836,7 @@ namespace rocalution
                 }
 
                 // update the preconditioner matrix with mk
-                for(int aj = row_offset[ai], k = 0; aj < row_offset[ai + 1]; ++aj, ++k)
+                for(PtrType aj = row_offset[ai], k = 0; aj < row_offset[ai + 1]; ++aj, ++k)
                 {
                     val[aj] = mk[k];
                 }
@@ -4408,7 +6851,7 @@ namespace rocalution
         {
             ValueType fac = sqrt(static_cast<ValueType>(1) / std::abs(val[row_offset[ai + 1] - 1]));
 
-            for(int aj = row_offset[ai]; aj < row_offset[ai + 1]; ++aj)
+            for(PtrType aj = row_offset[ai]; aj < row_offset[ai + 1]; ++aj)
             {
                 val[aj] *= fac;
             }
@@ -4423,8 +6866,8 @@ namespace rocalution
     template <typename ValueType>
     bool HostMatrixCSR<ValueType>::SPAI(void)
     {
-        int nrow = this->nrow_;
-        int nnz  = this->nnz_;
+        int     nrow = this->nrow_;
+        PtrType nnz  = this->nnz_;
 
         ValueType* val = NULL;
         allocate_host(nnz, &val);
@@ -4439,13 +6882,13 @@ namespace rocalution
 #endif
         for(int i = 0; i < nrow; ++i)
         {
-            int* J     = NULL;
-            int  Jsize = this->mat_.row_offset[i + 1] - this->mat_.row_offset[i];
+            int*    J     = NULL;
+            PtrType Jsize = this->mat_.row_offset[i + 1] - this->mat_.row_offset[i];
             allocate_host(Jsize, &J);
             std::vector<int> I;
 
             // Setup J = {j | m(j) != 0}
-            for(int j = this->mat_.row_offset[i], idx = 0; j < this->mat_.row_offset[i + 1];
+            for(PtrType j = this->mat_.row_offset[i], idx = 0; j < this->mat_.row_offset[i + 1];
                 ++j, ++idx)
             {
                 J[idx] = this->mat_.col[j];
@@ -4454,7 +6897,8 @@ namespace rocalution
             // Setup I = {i | row A(i,J) != 0}
             for(int idx = 0; idx < Jsize; ++idx)
             {
-                for(int j = this->mat_.row_offset[J[idx]]; j < this->mat_.row_offset[J[idx] + 1];
+                for(PtrType j = this->mat_.row_offset[J[idx]];
+                    j < this->mat_.row_offset[J[idx] + 1];
                     ++j)
                 {
                     if(std::find(I.begin(), I.end(), this->mat_.col[j]) == I.end())
@@ -4466,11 +6910,11 @@ namespace rocalution
 
             // Build dense matrix
             HostMatrixDENSE<ValueType> Asub(this->local_backend_);
-            Asub.AllocateDENSE(int(I.size()), Jsize);
+            Asub.AllocateDENSE(int(I.size()), static_cast<int>(Jsize));
 
             for(int k = 0; k < Asub.nrow_; ++k)
             {
-                for(int aj = T.mat_.row_offset[I[k]]; aj < T.mat_.row_offset[I[k] + 1]; ++aj)
+                for(PtrType aj = T.mat_.row_offset[I[k]]; aj < T.mat_.row_offset[I[k] + 1]; ++aj)
                 {
                     for(int j = 0; j < Jsize; ++j)
                     {
@@ -4572,7 +7016,8 @@ namespace rocalution
         // fully non-positive off-diagonal entries.
 
         cast_S->Clear();
-        cast_S->Allocate(this->nnz_);
+        assert(this->nnz_ <= std::numeric_limits<int>::max());
+        cast_S->Allocate(static_cast<int>(this->nnz_));
 
         // Initialize S to false (no dependencies)
         cast_S->Zeros();
@@ -4594,14 +7039,14 @@ namespace rocalution
             ValueType min_a_ik = static_cast<ValueType>(0);
             ValueType max_a_ik = static_cast<ValueType>(0);
 
-            int row_begin = this->mat_.row_offset[i];
-            int row_end   = this->mat_.row_offset[i + 1];
+            PtrType row_begin = this->mat_.row_offset[i];
+            PtrType row_end   = this->mat_.row_offset[i + 1];
 
             // True, if the diagonal element is negative
             bool sign = false;
 
             // Determine diagonal sign and min/max
-            for(int j = row_begin; j < row_end; ++j)
+            for(PtrType j = row_begin; j < row_end; ++j)
             {
                 int       col = this->mat_.col[j];
                 ValueType val = this->mat_.val[j];
@@ -4623,7 +7068,7 @@ namespace rocalution
             ValueType cond = (sign ? max_a_ik : min_a_ik) * static_cast<ValueType>(eps);
 
             // Fill S
-            for(int j = row_begin; j < row_end; ++j)
+            for(PtrType j = row_begin; j < row_end; ++j)
             {
                 int       col = this->mat_.col[j];
                 ValueType val = this->mat_.val[j];
@@ -4639,10 +7084,16 @@ namespace rocalution
         }
 
         // Transpose S
-        for(int i = 0; i < this->nnz_; ++i)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(PtrType i = 0; i < this->nnz_; ++i)
         {
             if(cast_S->vec_[i])
             {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
                 S_row_offset[this->mat_.col[i] + 1]++;
             }
         }
@@ -4656,7 +7107,7 @@ namespace rocalution
 
         for(int i = 0; i < this->nrow_; ++i)
         {
-            for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
             {
                 if(cast_S->vec_[j])
                 {
@@ -4675,10 +7126,13 @@ namespace rocalution
         // Split into C and F
         std::vector<int> lambda(this->nrow_);
 
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
         for(int i = 0; i < this->nrow_; ++i)
         {
             int temp = 0;
-            for(int j = S_row_offset[i]; j < S_row_offset[i + 1]; ++j)
+            for(PtrType j = S_row_offset[i]; j < S_row_offset[i + 1]; ++j)
             {
                 temp += (cast_cf->vec_[S_col[j]] == 0 ? 1 : 2);
             }
@@ -4738,7 +7192,7 @@ namespace rocalution
 
             cast_cf->vec_[i] = 1;
 
-            for(int j = S_row_offset[i]; j < S_row_offset[i + 1]; ++j)
+            for(PtrType j = S_row_offset[i]; j < S_row_offset[i + 1]; ++j)
             {
                 int c = S_col[j];
 
@@ -4749,7 +7203,7 @@ namespace rocalution
 
                 cast_cf->vec_[c] = 2;
 
-                for(int jj = this->mat_.row_offset[c]; jj < this->mat_.row_offset[c + 1]; ++jj)
+                for(PtrType jj = this->mat_.row_offset[c]; jj < this->mat_.row_offset[c + 1]; ++jj)
                 {
                     if(!cast_S->vec_[jj])
                     {
@@ -4780,7 +7234,7 @@ namespace rocalution
                 }
             }
 
-            for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
             {
                 if(!cast_S->vec_[j])
                 {
@@ -4844,15 +7298,23 @@ namespace rocalution
         // fully non-positive off-diagonal entries.
 
         cast_S->Clear();
-        cast_S->Allocate(this->nnz_);
+        assert(this->nnz_ <= std::numeric_limits<int>::max());
+        cast_S->Allocate(static_cast<int>(this->nnz_));
 
         // Initialize S to false (no dependencies)
         cast_S->Zeros();
 
-        // Sample rng
+        // Hashed random weights
         HostVector<float> omega(this->local_backend_);
         omega.Allocate(this->nrow_);
-        omega.SetRandomUniform(1234ULL, 0, 1);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(int i = 0; i < this->nrow_; ++i)
+        {
+            omega.vec_[i] = host_amg_weight(1234ULL, i);
+        }
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
@@ -4864,14 +7326,14 @@ namespace rocalution
             ValueType min_a_ik = static_cast<ValueType>(0);
             ValueType max_a_ik = static_cast<ValueType>(0);
 
-            int row_begin = this->mat_.row_offset[i];
-            int row_end   = this->mat_.row_offset[i + 1];
+            PtrType row_begin = this->mat_.row_offset[i];
+            PtrType row_end   = this->mat_.row_offset[i + 1];
 
             // True, if the diagonal element is negative
             bool sign = false;
 
             // Determine diagonal sign and min/max
-            for(int j = row_begin; j < row_end; ++j)
+            for(PtrType j = row_begin; j < row_end; ++j)
             {
                 int       col = this->mat_.col[j];
                 ValueType val = this->mat_.val[j];
@@ -4893,7 +7355,7 @@ namespace rocalution
             ValueType cond = (sign ? max_a_ik : min_a_ik) * static_cast<ValueType>(eps);
 
             // Fill S
-            for(int j = row_begin; j < row_end; ++j)
+            for(PtrType j = row_begin; j < row_end; ++j)
             {
                 int       col = this->mat_.col[j];
                 ValueType val = this->mat_.val[j];
@@ -4965,8 +7427,8 @@ namespace rocalution
             // Now, correct previously marked vertices with respect to omega
             for(int i = 0; i < this->nrow_; ++i)
             {
-                int row_begin = this->mat_.row_offset[i];
-                int row_end   = this->mat_.row_offset[i + 1];
+                PtrType row_begin = this->mat_.row_offset[i];
+                PtrType row_end   = this->mat_.row_offset[i + 1];
 
                 // If this vertex has been marked coarse in the current iteration,
                 // process it for further checks
@@ -4977,7 +7439,7 @@ namespace rocalution
 
                     // Loop over the full row to compare weights of other vertices that
                     // have been marked coarse in the current iteration
-                    for(int j = row_begin; j < row_end; ++j)
+                    for(PtrType j = row_begin; j < row_end; ++j)
                     {
                         // Process only vertices that are strongly connected
                         if(cast_S->vec_[j])
@@ -4991,95 +7453,444 @@ namespace rocalution
                                 // Get the weight of the current vertex for comparison
                                 float omega_col = omega.vec_[col];
 
-                                if(omega_row > omega_col)
-                                {
-                                    // The diagonal entry has more edges and will remain
-                                    // a coarse point, whereas this vertex gets reverted
-                                    // back to undecided, for further processing.
-                                    cast_cf->vec_[col] = 0;
-                                }
-                                else if(omega_row < omega_col)
-                                {
-                                    // The diagonal entry has fewer edges and gets
-                                    // reverted back to undecided for further processing,
-                                    // whereas this vertex stays
-                                    // a coarse one.
-                                    cast_cf->vec_[i] = 0;
-                                }
-                            }
-                        }
+                                if(omega_row > omega_col)
+                                {
+                                    // The diagonal entry has more edges and will remain
+                                    // a coarse point, whereas this vertex gets reverted
+                                    // back to undecided, for further processing.
+                                    cast_cf->vec_[col] = 0;
+                                }
+                                else if(omega_row < omega_col)
+                                {
+                                    // The diagonal entry has fewer edges and gets
+                                    // reverted back to undecided for further processing,
+                                    // whereas this vertex stays
+                                    // a coarse one.
+                                    cast_cf->vec_[i] = 0;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+            // Mark remaining edges of a coarse point to fine
+            for(int i = 0; i < this->nrow_; ++i)
+            {
+                // Process only undecided vertices
+                if(cast_cf->vec_[i] == 0)
+                {
+                    PtrType row_begin = this->mat_.row_offset[i];
+                    PtrType row_end   = this->mat_.row_offset[i + 1];
+
+                    // Loop over all edges of this undecided vertex
+                    // and check, if there is a coarse point connected
+                    for(PtrType j = row_begin; j < row_end; ++j)
+                    {
+                        // Check, whether this edge is strongly connected to the vertex
+                        if(cast_S->vec_[j])
+                        {
+                            int col = this->mat_.col[j];
+
+                            // If this edge is coarse, our vertex must be fine
+                            if(cast_cf->vec_[col] == 1)
+                            {
+                                cast_cf->vec_[i] = 2;
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+
+            // Now, we need to check whether we have vertices left that are marked
+            // undecided, in order to restart the loop
+            bool undecided = false;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024) reduction(|| : undecided)
+#endif
+            for(int i = 0; i < this->nrow_; ++i)
+            {
+                // Check whether this vertex is undecided or not
+                if(cast_cf->vec_[i] == 0)
+                {
+                    undecided = true;
+                }
+            }
+
+            // If no more undecided vertices are left, we are done
+            if(undecided == false)
+            {
+                break;
+            }
+
+            ++iter;
+
+            // Print some warning if number of iteration is getting huge
+            if(iter > 20)
+            {
+                LOG_VERBOSE_INFO(2,
+                                 "*** warning: HostMatrixCSR::RSPMISCoarsening() Current "
+                                 "number of iterations: "
+                                     << iter);
+            }
+        }
+
+        free_host(&workspace);
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::RSPMISStrongInfluences(float                        eps,
+                                                          BaseVector<bool>*            S,
+                                                          BaseVector<float>*           omega,
+                                                          unsigned long long           seed,
+                                                          const BaseMatrix<ValueType>& ghost) const
+    {
+        assert(S != NULL);
+        assert(omega != NULL);
+
+        HostVector<bool>*               cast_S   = dynamic_cast<HostVector<bool>*>(S);
+        HostVector<float>*              cast_w   = dynamic_cast<HostVector<float>*>(omega);
+        const HostMatrixCSR<ValueType>* cast_gst
+            = dynamic_cast<const HostMatrixCSR<ValueType>*>(&ghost);
+
+        assert(cast_S != NULL);
+        assert(cast_w != NULL);
+
+        if(cast_gst == NULL)
+        {
+            return false;
+        }
+
+        // The ghost part might be empty
+        bool gst = cast_gst->nnz_ > 0;
+
+        assert(gst == false || cast_gst->nrow_ == this->nrow_);
+
+        // S holds the strong influences of the local part, followed by those of the ghost
+        // part. omega holds the weights of the local vertices, followed by the number of
+        // strong influences on the ghost vertices, which have to be added up by their owners.
+        assert(cast_S->size_ == this->nnz_ + cast_gst->nnz_);
+        assert(cast_w->size_ >= this->nrow_ + cast_gst->ncol_);
+
+        cast_S->Zeros();
+
+        // Hashed random weights of the local vertices
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(int i = 0; i < cast_w->size_; ++i)
+        {
+            cast_w->vec_[i] = (i < this->nrow_) ? host_amg_weight(seed, i) : 0.0f;
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        // Determine strong influences in the matrix
+        for(int i = 0; i < this->nrow_; ++i)
+        {
+            // Determine minimum and maximum off-diagonal of the current row
+            ValueType min_a_ik = static_cast<ValueType>(0);
+            ValueType max_a_ik = static_cast<ValueType>(0);
+
+            // True, if the diagonal element is negative
+            bool sign = false;
+
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            {
+                int       col = this->mat_.col[j];
+                ValueType val = this->mat_.val[j];
+
+                if(col == i)
+                {
+                    sign = val < static_cast<ValueType>(0);
+                }
+                else
+                {
+                    min_a_ik = (min_a_ik < val) ? min_a_ik : val;
+                    max_a_ik = (max_a_ik > val) ? max_a_ik : val;
+                }
+            }
+
+            // Ghost entries are off-diagonal entries
+            if(gst == true)
+            {
+                for(PtrType j = cast_gst->mat_.row_offset[i]; j < cast_gst->mat_.row_offset[i + 1];
+                    ++j)
+                {
+                    ValueType val = cast_gst->mat_.val[j];
+
+                    min_a_ik = (min_a_ik < val) ? min_a_ik : val;
+                    max_a_ik = (max_a_ik > val) ? max_a_ik : val;
+                }
+            }
+
+            // Threshold to check for strength of connection
+            ValueType cond = (sign ? max_a_ik : min_a_ik) * static_cast<ValueType>(eps);
+
+            // Fill S and count the strong influences of each vertex
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            {
+                int       col = this->mat_.col[j];
+                ValueType val = this->mat_.val[j];
+
+                if(col != i && val < cond)
+                {
+                    cast_S->vec_[j] = true;
+
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                    cast_w->vec_[col] += 1.0f;
+                }
+            }
+
+            if(gst == true)
+            {
+                for(PtrType j = cast_gst->mat_.row_offset[i]; j < cast_gst->mat_.row_offset[i + 1];
+                    ++j)
+                {
+                    int       col = cast_gst->mat_.col[j];
+                    ValueType val = cast_gst->mat_.val[j];
+
+                    if(val < cond)
+                    {
+                        cast_S->vec_[this->nnz_ + j] = true;
+
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                        cast_w->vec_[this->nrow_ + col] += 1.0f;
+                    }
+                }
+            }
+        }
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::RSPMISUnassignedToCoarse(BaseVector<int>*         CFmap,
+                                                            BaseVector<bool>*        marked,
+                                                            const BaseVector<float>& omega) const
+    {
+        assert(CFmap != NULL);
+        assert(marked != NULL);
+
+        HostVector<int>*         cast_cf = dynamic_cast<HostVector<int>*>(CFmap);
+        HostVector<bool>*        cast_m  = dynamic_cast<HostVector<bool>*>(marked);
+        const HostVector<float>* cast_w  = dynamic_cast<const HostVector<float>*>(&omega);
+
+        assert(cast_cf != NULL);
+        assert(cast_m != NULL);
+        assert(cast_w != NULL);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(int i = 0; i < this->nrow_; ++i)
+        {
+            // marked keeps track, whether a vertex has been marked coarse during the current
+            // iteration, or not
+            cast_m->vec_[i] = false;
+
+            if(cast_cf->vec_[i] == 0)
+            {
+                // Vertices that influence other vertices might be coarse, all others are fine
+                if(cast_w->vec_[i] >= 1.0f)
+                {
+                    cast_cf->vec_[i] = 1;
+                    cast_m->vec_[i]  = true;
+                }
+                else
+                {
+                    cast_cf->vec_[i] = 2;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::RSPMISCorrectCoarse(BaseVector<int>*             CFmap,
+                                                       const BaseVector<bool>&      S,
+                                                       const BaseVector<bool>&      marked,
+                                                       const BaseVector<float>&     omega,
+                                                       const BaseMatrix<ValueType>& ghost) const
+    {
+        assert(CFmap != NULL);
+
+        HostVector<int>*                cast_cf  = dynamic_cast<HostVector<int>*>(CFmap);
+        const HostVector<bool>*         cast_S   = dynamic_cast<const HostVector<bool>*>(&S);
+        const HostVector<bool>*         cast_m   = dynamic_cast<const HostVector<bool>*>(&marked);
+        const HostVector<float>*        cast_w   = dynamic_cast<const HostVector<float>*>(&omega);
+        const HostMatrixCSR<ValueType>* cast_gst
+            = dynamic_cast<const HostMatrixCSR<ValueType>*>(&ghost);
+
+        assert(cast_cf != NULL);
+        assert(cast_S != NULL);
+        assert(cast_m != NULL);
+        assert(cast_w != NULL);
+
+        if(cast_gst == NULL)
+        {
+            return false;
+        }
+
+        bool gst = cast_gst->nnz_ > 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(int i = 0; i < this->nrow_; ++i)
+        {
+            // Only vertices that have been marked coarse in the current iteration compete
+            if(cast_m->vec_[i] == false)
+            {
+                continue;
+            }
+
+            float omega_row = cast_w->vec_[i];
+
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            {
+                int col = this->mat_.col[j];
+
+                if(cast_S->vec_[j] && cast_m->vec_[col])
+                {
+                    // The vertex with fewer edges gets reverted back to undecided
+                    float omega_col = cast_w->vec_[col];
+
+                    if(omega_row > omega_col)
+                    {
+                        cast_cf->vec_[col] = 0;
+                    }
+                    else if(omega_row < omega_col)
+                    {
+                        cast_cf->vec_[i] = 0;
                     }
                 }
             }
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-            // Mark remaining edges of a coarse point to fine
-            for(int i = 0; i < this->nrow_; ++i)
+            if(gst == true)
             {
-                // Process only undecided vertices
-                if(cast_cf->vec_[i] == 0)
+                for(PtrType j = cast_gst->mat_.row_offset[i]; j < cast_gst->mat_.row_offset[i + 1];
+                    ++j)
                 {
-                    int row_begin = this->mat_.row_offset[i];
-                    int row_end   = this->mat_.row_offset[i + 1];
+                    int col = this->nrow_ + cast_gst->mat_.col[j];
 
-                    // Loop over all edges of this undecided vertex
-                    // and check, if there is a coarse point connected
-                    for(int j = row_begin; j < row_end; ++j)
+                    if(cast_S->vec_[this->nnz_ + j] && cast_m->vec_[col])
                     {
-                        // Check, whether this edge is strongly connected to the vertex
-                        if(cast_S->vec_[j])
-                        {
-                            int col = this->mat_.col[j];
+                        // Reverted ghost vertices have to be sent back to their owners
+                        float omega_col = cast_w->vec_[col];
 
-                            // If this edge is coarse, our vertex must be fine
-                            if(cast_cf->vec_[col] == 1)
-                            {
-                                cast_cf->vec_[i] = 2;
-                                break;
-                            }
+                        if(omega_row > omega_col)
+                        {
+                            cast_cf->vec_[col] = 0;
+                        }
+                        else if(omega_row < omega_col)
+                        {
+                            cast_cf->vec_[i] = 0;
                         }
                     }
                 }
             }
+        }
 
-            // Now, we need to check whether we have vertices left that are marked
-            // undecided, in order to restart the loop
-            bool undecided = false;
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::RSPMISCoarseEdgesToFine(BaseVector<int>*             CFmap,
+                                                           const BaseVector<bool>&      S,
+                                                           const BaseMatrix<ValueType>& ghost) const
+    {
+        assert(CFmap != NULL);
+
+        HostVector<int>*                cast_cf  = dynamic_cast<HostVector<int>*>(CFmap);
+        const HostVector<bool>*         cast_S   = dynamic_cast<const HostVector<bool>*>(&S);
+        const HostMatrixCSR<ValueType>* cast_gst
+            = dynamic_cast<const HostMatrixCSR<ValueType>*>(&ghost);
+
+        assert(cast_cf != NULL);
+        assert(cast_S != NULL);
+
+        if(cast_gst == NULL)
+        {
+            return false;
+        }
+
+        bool gst = cast_gst->nnz_ > 0;
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-            for(int i = 0; i < this->nrow_; ++i)
+        for(int i = 0; i < this->nrow_; ++i)
+        {
+            // Process only undecided vertices
+            if(cast_cf->vec_[i] != 0)
             {
-                // Check whether this vertex is undecided or not
-                if(cast_cf->vec_[i] == 0)
+                continue;
+            }
+
+            // If a strongly connected vertex is coarse, this vertex must be fine
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            {
+                if(cast_S->vec_[j] && cast_cf->vec_[this->mat_.col[j]] == 1)
                 {
-                    undecided = true;
-                    i         = this->nrow_;
+                    cast_cf->vec_[i] = 2;
+                    break;
                 }
             }
 
-            // If no more undecided vertices are left, we are done
-            if(undecided == false)
+            if(gst == true && cast_cf->vec_[i] == 0)
             {
-                break;
+                for(PtrType j = cast_gst->mat_.row_offset[i]; j < cast_gst->mat_.row_offset[i + 1];
+                    ++j)
+                {
+                    if(cast_S->vec_[this->nnz_ + j]
+                       && cast_cf->vec_[this->nrow_ + cast_gst->mat_.col[j]] == 1)
+                    {
+                        cast_cf->vec_[i] = 2;
+                        break;
+                    }
+                }
             }
+        }
 
-            ++iter;
+        return true;
+    }
 
-            // Print some warning if number of iteration is getting huge
-            if(iter > 20)
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::RSPMISCheckUndecided(bool&                  undecided,
+                                                        const BaseVector<int>& CFmap) const
+    {
+        const HostVector<int>* cast_cf = dynamic_cast<const HostVector<int>*>(&CFmap);
+
+        assert(cast_cf != NULL);
+
+        bool found = false;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024) reduction(|| : found)
+#endif
+        for(int i = 0; i < this->nrow_; ++i)
+        {
+            if(cast_cf->vec_[i] == 0)
             {
-                LOG_VERBOSE_INFO(2,
-                                 "*** warning: HostMatrixCSR::RSPMISCoarsening() Current "
-                                 "number of iterations: "
-                                     << iter);
+                found = true;
             }
         }
 
-        free_host(&workspace);
+        undecided = found;
 
         return true;
     }
@@ -5157,7 +7968,7 @@ namespace rocalution
             ValueType amin = static_cast<ValueType>(0);
             ValueType amax = static_cast<ValueType>(0);
 
-            for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
             {
                 if(!cast_S->vec_[j] || cast_cf->vec_[this->mat_.col[j]] != 1)
                 {
@@ -5171,7 +7982,7 @@ namespace rocalution
             Amin[i] = amin = amin * static_cast<ValueType>(0.2);
             Amax[i] = amax = amax * static_cast<ValueType>(0.2);
 
-            for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
             {
                 if(!cast_S->vec_[j] || cast_cf->vec_[this->mat_.col[j]] != 1)
                 {
@@ -5190,7 +8001,7 @@ namespace rocalution
             cast_prolong->mat_.row_offset[i + 1] += cast_prolong->mat_.row_offset[i];
         }
 
-        int nnz_prolong = cast_prolong->mat_.row_offset[this->nrow_];
+        PtrType nnz_prolong = cast_prolong->mat_.row_offset[this->nrow_];
 
         allocate_host(nnz_prolong, &cast_prolong->mat_.col);
         allocate_host(nnz_prolong, &cast_prolong->mat_.val);
@@ -5203,7 +8014,7 @@ namespace rocalution
 #endif
         for(int i = 0; i < this->nrow_; ++i)
         {
-            int row_head = cast_prolong->mat_.row_offset[i];
+            PtrType row_head = cast_prolong->mat_.row_offset[i];
 
             if(cast_cf->vec_[i] == 1)
             {
@@ -5217,7 +8028,7 @@ namespace rocalution
             ValueType b_num = static_cast<ValueType>(0), b_den = static_cast<ValueType>(0);
             ValueType d_neg = static_cast<ValueType>(0), d_pos = static_cast<ValueType>(0);
 
-            for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
             {
                 int       c = this->mat_.col[j];
                 ValueType v = this->mat_.val[j];
@@ -5277,7 +8088,7 @@ namespace rocalution
             ValueType beta  = std::abs(b_den) > 1e-32 ? -cf_pos * b_num / (diag * b_den)
                                                       : static_cast<ValueType>(0);
 
-            for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
             {
                 int       c = this->mat_.col[j];
                 ValueType v = this->mat_.val[j];
@@ -5304,10 +8115,11 @@ namespace rocalution
 #endif
         for(int i = 0; i < cast_prolong->GetM(); ++i)
         {
-            for(int j = cast_prolong->mat_.row_offset[i]; j < cast_prolong->mat_.row_offset[i + 1];
+            for(PtrType j = cast_prolong->mat_.row_offset[i];
+                j < cast_prolong->mat_.row_offset[i + 1];
                 ++j)
             {
-                for(int jj = cast_prolong->mat_.row_offset[i];
+                for(PtrType jj = cast_prolong->mat_.row_offset[i];
                     jj < cast_prolong->mat_.row_offset[i + 1] - 1;
                     ++jj)
                 {
@@ -5327,6 +8139,12 @@ namespace rocalution
             }
         }
 
+        // Without coarse points, P is an empty nrow x 0 matrix
+        if(cast_prolong->nnz_ == 0)
+        {
+            free_host(&cast_prolong->mat_.row_offset);
+        }
+
         cast_prolong->Transpose(cast_restrict);
 
         return true;
@@ -5388,11 +8206,11 @@ namespace rocalution
             std::unordered_set<int> set;
 
             // Row entry and exit points
-            int row_begin = this->mat_.row_offset[i];
-            int row_end   = this->mat_.row_offset[i + 1];
+            PtrType row_begin = this->mat_.row_offset[i];
+            PtrType row_end   = this->mat_.row_offset[i + 1];
 
             // Loop over all columns of the i-th row, whereas each lane processes a column
-            for(int j = row_begin; j < row_end; ++j)
+            for(PtrType j = row_begin; j < row_end; ++j)
             {
                 // Skip points that do not influence the current point
                 if(cast_S->vec_[j] == false)
@@ -5421,11 +8239,11 @@ namespace rocalution
                     // This is a fine point, check for strongly connected coarse points
 
                     // Row entry and exit of this fine point
-                    int row_begin_j = this->mat_.row_offset[col_j];
-                    int row_end_j   = this->mat_.row_offset[col_j + 1];
+                    PtrType row_begin_j = this->mat_.row_offset[col_j];
+                    PtrType row_end_j   = this->mat_.row_offset[col_j + 1];
 
                     // Loop over all columns of the fine point
-                    for(int k = row_begin_j; k < row_end_j; ++k)
+                    for(PtrType k = row_begin_j; k < row_end_j; ++k)
                     {
                         // Skip points that do not influence the fine point
                         if(cast_S->vec_[k] == false)
@@ -5496,7 +8314,7 @@ namespace rocalution
             if(cast_cf->vec_[i] == 1)
             {
                 // Get index into P
-                int idx = cast_prolong->mat_.row_offset[i];
+                PtrType idx = cast_prolong->mat_.row_offset[i];
 
                 // Single entry in thie row (coarse point)
                 cast_prolong->mat_.col[idx] = workspace[i];
@@ -5512,11 +8330,11 @@ namespace rocalution
             // This is identical to the nnz per row part
 
             // Row entry and exit points
-            int row_begin = this->mat_.row_offset[i];
-            int row_end   = this->mat_.row_offset[i + 1];
+            PtrType row_begin = this->mat_.row_offset[i];
+            PtrType row_end   = this->mat_.row_offset[i + 1];
 
             // Loop over all columns of the i-th row, whereas each lane processes a column
-            for(int k = row_begin; k < row_end; ++k)
+            for(PtrType k = row_begin; k < row_end; ++k)
             {
                 // Skip points that do not influence the current point
                 if(cast_S->vec_[k] == false)
@@ -5544,11 +8362,11 @@ namespace rocalution
                     // This is a fine point, check for strongly connected coarse points
 
                     // Row entry and exit of this fine point
-                    int row_begin_k = this->mat_.row_offset[col_ik];
-                    int row_end_k   = this->mat_.row_offset[col_ik + 1];
+                    PtrType row_begin_k = this->mat_.row_offset[col_ik];
+                    PtrType row_end_k   = this->mat_.row_offset[col_ik + 1];
 
                     // Loop over all columns of the fine point
-                    for(int l = row_begin_k; l < row_end_k; ++l)
+                    for(PtrType l = row_begin_k; l < row_end_k; ++l)
                     {
                         // Skip points that do not influence the fine point
                         if(cast_S->vec_[l] == false)
@@ -5594,7 +8412,7 @@ namespace rocalution
             ValueType sum_n = zero;
 
             // Loop over all columns of the i-th row, whereas each lane processes a column
-            for(int k = row_begin; k < row_end; ++k)
+            for(PtrType k = row_begin; k < row_end; ++k)
             {
                 // Get the column index
                 int col_ik = this->mat_.col[k];
@@ -5622,11 +8440,11 @@ namespace rocalution
                     ValueType val_ki = zero;
 
                     // Row entry and exit of this fine point
-                    int row_begin_k = this->mat_.row_offset[col_ik];
-                    int row_end_k   = this->mat_.row_offset[col_ik + 1];
+                    PtrType row_begin_k = this->mat_.row_offset[col_ik];
+                    PtrType row_end_k   = this->mat_.row_offset[col_ik + 1];
 
                     // Loop over all columns of the fine point
-                    for(int l = row_begin_k; l < row_end_k; ++l)
+                    for(PtrType l = row_begin_k; l < row_end_k; ++l)
                     {
                         // Get the column index
                         int col_kl = this->mat_.col[l];
@@ -5677,7 +8495,7 @@ namespace rocalution
 
                     // Additionally, for eq19 we need to add all coarse points in row k,
                     // if they have different sign than the diagonal a_kk
-                    for(int l = row_begin_k; l < row_end_k; ++l)
+                    for(PtrType l = row_begin_k; l < row_end_k; ++l)
                     {
                         // Get the column index
                         int col_kl = this->mat_.col[l];
@@ -5741,7 +8559,7 @@ namespace rocalution
             ValueType a_ii_tilde = -one / (val_ii + sum_n + sum_k);
 
             // Entry point into P
-            int idx = cast_prolong->mat_.row_offset[i];
+            PtrType idx = cast_prolong->mat_.row_offset[i];
 
             // Finally, extract the numerical values from the hash table and fill P such
             // that the resulting matrix is sorted by columns
@@ -5756,6 +8574,12 @@ namespace rocalution
         // Free temporary buffer
         free_host(&workspace);
 
+        // Without coarse points, P is an empty nrow x 0 matrix
+        if(cast_prolong->nnz_ == 0)
+        {
+            free_host(&cast_prolong->mat_.row_offset);
+        }
+
         // Transpose P to obtain R
         cast_prolong->Transpose(cast_restrict);
 
@@ -5795,21 +8619,27 @@ namespace rocalution
         assert(cast_G != NULL);
 
         // Initialize G
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
         for(int i = 0; i < cast_G->size_; ++i)
         {
             cast_G->vec_[i] = -2;
         }
 
         int  Usize    = 0;
-        int* ind_diag = NULL;
+        PtrType* ind_diag = NULL;
         allocate_host(this->nrow_, &ind_diag);
 
         // Build U
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024) reduction(+ : Usize)
+#endif
         for(int i = 0; i < this->nrow_; ++i)
         {
             ValueType sum = static_cast<ValueType>(0);
 
-            for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
             {
                 if(i != this->mat_.col[j])
                 {
@@ -5835,6 +8665,9 @@ namespace rocalution
         rGsize = this->nrow_ - Usize;
         allocate_host(Gsize * rGsize, rG);
 
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
         for(int i = 0; i < Gsize * rGsize; ++i)
         {
             (*rG)[i] = -1;
@@ -5905,14 +8738,14 @@ namespace rocalution
             // Determine minimum and maximum offdiagonal entry and j index
             ValueType min_a_ij = static_cast<ValueType>(0);
             ValueType max_a_ij = static_cast<ValueType>(0);
-            int       min_j    = -1;
+            PtrType   min_j    = -1;
             bool      neg      = false;
             if(this->mat_.val[ind_diag[i]] < static_cast<ValueType>(0))
             {
                 neg = true;
             }
 
-            for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
             {
                 int       col_j = this->mat_.col[j];
                 ValueType val_j = this->mat_.val[j];
@@ -5998,21 +8831,27 @@ namespace rocalution
         assert(cast_mat != NULL);
 
         // Initialize G
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
         for(int i = 0; i < cast_G->size_; ++i)
         {
             cast_G->vec_[i] = -2;
         }
 
         int  Usize    = 0;
-        int* ind_diag = NULL;
+        PtrType* ind_diag = NULL;
         allocate_host(this->nrow_, &ind_diag);
 
         // Build U
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024) reduction(+ : Usize)
+#endif
         for(int i = 0; i < this->nrow_; ++i)
         {
             ValueType sum = static_cast<ValueType>(0);
 
-            for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
             {
                 if(i != this->mat_.col[j])
                 {
@@ -6024,9 +8863,13 @@ namespace rocalution
                 }
             }
 
-            for(int j = cast_mat->mat_.row_offset[i]; j < cast_mat->mat_.row_offset[i + 1]; ++j)
+            if(cast_mat->nnz_ > 0)
             {
-                sum += std::abs(cast_mat->mat_.val[j]);
+                for(PtrType j = cast_mat->mat_.row_offset[i]; j < cast_mat->mat_.row_offset[i + 1];
+                    ++j)
+                {
+                    sum += std::abs(cast_mat->mat_.val[j]);
+                }
             }
 
             sum *= static_cast<ValueType>(5);
@@ -6043,6 +8886,9 @@ namespace rocalution
         rGsize = this->nrow_ - Usize;
         allocate_host(Gsize * rGsize, rG);
 
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
         for(int i = 0; i < Gsize * rGsize; ++i)
         {
             (*rG)[i] = -1;
@@ -6120,7 +8966,7 @@ namespace rocalution
                 neg = true;
             }
 
-            for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
             {
                 int       col_j = this->mat_.col[j];
                 ValueType val_j = this->mat_.val[j];
@@ -6157,18 +9003,22 @@ namespace rocalution
                 }
             }
 
-            for(int j = cast_mat->mat_.row_offset[i]; j < cast_mat->mat_.row_offset[i + 1]; ++j)
+            if(cast_mat->nnz_ > 0)
             {
-                ValueType val_j = cast_mat->mat_.val[j];
-
-                if(neg == true)
+                for(PtrType j = cast_mat->mat_.row_offset[i]; j < cast_mat->mat_.row_offset[i + 1];
+                    ++j)
                 {
-                    val_j *= static_cast<ValueType>(-1);
-                }
+                    ValueType val_j = cast_mat->mat_.val[j];
 
-                if(val_j > max_a_ij)
-                {
-                    max_a_ij = val_j;
+                    if(neg == true)
+                    {
+                        val_j *= static_cast<ValueType>(-1);
+                    }
+
+                    if(val_j > max_a_ij)
+                    {
+                        max_a_ij = val_j;
+                    }
                 }
             }
 
@@ -6177,7 +9027,7 @@ namespace rocalution
             {
                 max_a_ij *= betam;
 
-                for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+                for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
                 {
                     int       col_j = this->mat_.col[j];
                     ValueType val_j = this->mat_.val[j];
@@ -6239,11 +9089,17 @@ namespace rocalution
         int* rGc     = NULL;
         allocate_host(Gsize * rGsizec, &rGc);
 
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
         for(int i = 0; i < Gsize * rGsizec; ++i)
         {
             rGc[i] = -1;
         }
 
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
         for(int i = 0; i < cast_G->size_; ++i)
         {
             cast_G->vec_[i] = -1;
@@ -6326,7 +9182,7 @@ namespace rocalution
 
             // Get sign
             bool neg = false;
-            for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
             {
                 if(i == this->mat_.col[j])
                 {
@@ -6342,9 +9198,9 @@ namespace rocalution
             // Determine minimum and maximum offdiagonal entry and j index
             ValueType min_a_ij = static_cast<ValueType>(0);
             ValueType max_a_ij = static_cast<ValueType>(0);
-            int       min_j    = -1;
+            PtrType   min_j    = -1;
 
-            for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
             {
                 int       col_j = this->mat_.col[j];
                 ValueType val_j = this->mat_.val[j];
@@ -6449,11 +9305,17 @@ namespace rocalution
         int* rGc     = NULL;
         allocate_host(Gsize * rGsizec, &rGc);
 
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
         for(int i = 0; i < Gsize * rGsizec; ++i)
         {
             rGc[i] = -1;
         }
 
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
         for(int i = 0; i < cast_G->size_; ++i)
         {
             cast_G->vec_[i] = -1;
@@ -6536,7 +9398,7 @@ namespace rocalution
 
             // Get sign
             bool neg = false;
-            for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
             {
                 if(i == this->mat_.col[j])
                 {
@@ -6554,7 +9416,7 @@ namespace rocalution
             ValueType max_a_ij = static_cast<ValueType>(0);
             int       min_j    = -1;
 
-            for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
             {
                 int       col_j = this->mat_.col[j];
                 ValueType val_j = this->mat_.val[j];
@@ -6591,18 +9453,22 @@ namespace rocalution
                 }
             }
 
-            for(int j = cast_mat->mat_.row_offset[i]; j < cast_mat->mat_.row_offset[i + 1]; ++j)
+            if(cast_mat->nnz_ > 0)
             {
-                ValueType val_j = cast_mat->mat_.val[j];
-
-                if(neg == true)
+                for(PtrType j = cast_mat->mat_.row_offset[i]; j < cast_mat->mat_.row_offset[i + 1];
+                    ++j)
                 {
-                    val_j *= static_cast<ValueType>(-1);
-                }
+                    ValueType val_j = cast_mat->mat_.val[j];
 
-                if(val_j > max_a_ij)
-                {
-                    max_a_ij = val_j;
+                    if(neg == true)
+                    {
+                        val_j *= static_cast<ValueType>(-1);
+                    }
+
+                    if(val_j > max_a_ij)
+                    {
+                        max_a_ij = val_j;
+                    }
                 }
             }
 
@@ -6611,7 +9477,7 @@ namespace rocalution
             {
                 max_a_ij *= betam;
 
-                for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+                for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
                 {
                     int       col_j = this->mat_.col[j];
                     ValueType val_j = this->mat_.val[j];
@@ -6687,7 +9553,7 @@ namespace rocalution
         // Allocate
         cast_Ac->Clear();
 
-        int*       row_offset = NULL;
+        PtrType*   row_offset = NULL;
         int*       col        = NULL;
         ValueType* val        = NULL;
 
@@ -6698,9 +9564,9 @@ namespace rocalution
         // Create P_ij: if i in G_j -> 1, else 0
         // (Ac)_kl = sum i in G_k (sum j in G_l (a_ij))) with k,l=1,...,nrow
 
-        int* reverse_col = NULL;
-        int* Gl          = NULL;
-        int* erase       = NULL;
+        PtrType* reverse_col = NULL;
+        int*     Gl          = NULL;
+        int*     erase       = NULL;
 
         int size = (nrow > ncol) ? nrow : ncol;
 
@@ -6732,7 +9598,7 @@ namespace rocalution
                     continue;
                 }
 
-                for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+                for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
                 {
                     int l = cast_G->vec_[this->mat_.col[j]];
 
@@ -6769,7 +9635,7 @@ namespace rocalution
         free_host(&Gl);
         free_host(&erase);
 
-        int nnz = row_offset[nrow];
+        PtrType nnz = row_offset[nrow];
 
         int*       col_resized = NULL;
         ValueType* val_resized = NULL;
@@ -6778,7 +9644,7 @@ namespace rocalution
         allocate_host(nnz, &val_resized);
 
         // Resize
-        for(int i = 0; i < nnz; ++i)
+        for(PtrType i = 0; i < nnz; ++i)
         {
             col_resized[i] = col[i];
             val_resized[i] = val[i];
@@ -6825,12 +9691,12 @@ namespace rocalution
             row_key += row_sign * row_tmp * (row_mask & this->mat_.row_offset[ai]);
             row_key  = row_key ^ (row_key >> 16);
             row_sign = sgn(row_tmp - (row_mask & this->mat_.row_offset[ai]));
-            row_tmp  = row_mask & this->mat_.row_offset[ai];
+            row_tmp  = static_cast<int>(row_mask & this->mat_.row_offset[ai]);
 
-            int row_beg = this->mat_.row_offset[ai];
-            int row_end = this->mat_.row_offset[ai + 1];
+            PtrType row_beg = this->mat_.row_offset[ai];
+            PtrType row_end = this->mat_.row_offset[ai + 1];
 
-            for(int aj = row_beg; aj < row_end; ++aj)
+            for(PtrType aj = row_beg; aj < row_end; ++aj)
             {
                 col_key += col_sign * col_tmp * (col_mask | this->mat_.col[aj]);
                 col_key  = col_key ^ (col_key >> 16);
@@ -6857,8 +9723,147 @@ namespace rocalution
                 }
 
                 val_sign = sgn(val_tmp - (long int)(val_mask | val));
-                val_tmp  = val_mask | val;
+                val_tmp  = static_cast<int>(val_mask | val);
+            }
+        }
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::StructureStats(MatrixStructureStats* stats) const
+    {
+        assert(stats != NULL);
+
+        int nrow = this->nrow_;
+        int ncol = this->ncol_;
+
+        stats->nrow        = nrow;
+        stats->ncol        = ncol;
+        stats->nnz         = this->nnz_;
+        stats->max_row_nnz = 0;
+        stats->ndiag       = 0;
+        stats->hyb_coo_nnz = 0;
+
+        for(int k = 0; k < 32; ++k)
+        {
+            stats->row_hist[k] = 0;
+        }
+
+        for(int b = 0; b < 3; ++b)
+        {
+            stats->nnzb[b] = 0;
+        }
+
+        if(this->nnz_ == 0)
+        {
+            return true;
+        }
+
+        // ELL width of the HYB format
+        int64_t ell_width = (this->nnz_ - 1) / nrow + 1;
+
+        int64_t max_row = 0;
+        int64_t hyb_coo = 0;
+
+        // Row lengths
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            int64_t hist[32] = {0};
+
+#ifdef _OPENMP
+#pragma omp for reduction(max : max_row) reduction(+ : hyb_coo)
+#endif
+            for(int i = 0; i < nrow; ++i)
+            {
+                int64_t row_nnz = this->mat_.row_offset[i + 1] - this->mat_.row_offset[i];
+
+                max_row = std::max(max_row, row_nnz);
+                hyb_coo += std::max(row_nnz - ell_width, static_cast<int64_t>(0));
+
+                int k = 0;
+                while(k < 31 && (static_cast<int64_t>(1) << k) <= row_nnz)
+                {
+                    ++k;
+                }
+
+                ++hist[k];
+            }
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+            for(int k = 0; k < 32; ++k)
+            {
+                stats->row_hist[k] += hist[k];
+            }
+        }
+
+        stats->max_row_nnz = max_row;
+        stats->hyb_coo_nnz = hyb_coo;
+
+        // Populated diagonals
+        std::vector<char> diag(nrow + ncol, 0);
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            {
+                int offset = this->mat_.col[j] - i + nrow;
+
+                if(diag[offset] == 0)
+                {
+                    diag[offset] = 1;
+                    ++stats->ndiag;
+                }
+            }
+        }
+
+        // Non-zero blocks of BCSR with block dimension 2, 3 and 4
+        for(int b = 0; b < 3; ++b)
+        {
+            int blockdim = b + 2;
+
+            if(nrow % blockdim != 0 || ncol % blockdim != 0)
+            {
+                continue;
+            }
+
+            int     mb   = nrow / blockdim;
+            int     nb   = ncol / blockdim;
+            int64_t nnzb = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            {
+                // Last block row, each block column has been counted for
+                std::vector<int> marker(nb, -1);
+
+#ifdef _OPENMP
+#pragma omp for reduction(+ : nnzb)
+#endif
+                for(int bi = 0; bi < mb; ++bi)
+                {
+                    PtrType row_begin = this->mat_.row_offset[bi * blockdim];
+                    PtrType row_end   = this->mat_.row_offset[(bi + 1) * blockdim];
+
+                    for(PtrType j = row_begin; j < row_end; ++j)
+                    {
+                        int bj = this->mat_.col[j] / blockdim;
+
+                        if(marker[bj] != bi)
+                        {
+                            marker[bj] = bi;
+                            ++nnzb;
+                        }
+                    }
+                }
             }
+
+            stats->nnzb[b] = nnzb;
         }
 
         return true;
@@ -6875,7 +9880,7 @@ namespace rocalution
                 = dynamic_cast<const HostVector<ValueType>*>(&vec);
             assert(cast_vec != NULL);
 
-            int*       row_offset = NULL;
+            PtrType*   row_offset = NULL;
             int*       col        = NULL;
             ValueType* val        = NULL;
 
@@ -6894,7 +9899,7 @@ namespace rocalution
 
                 row_offset[i + 1] = this->mat_.row_offset[i + 1] - this->mat_.row_offset[i];
 
-                for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+                for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
                 {
                     if(this->mat_.col[j] == idx)
                     {
@@ -6919,7 +9924,7 @@ namespace rocalution
                 row_offset[i + 1] += row_offset[i];
             }
 
-            int nnz = row_offset[nrow];
+            PtrType nnz = row_offset[nrow];
 
             allocate_host(nnz, &col);
             allocate_host(nnz, &val);
@@ -6930,8 +9935,8 @@ namespace rocalution
 #endif
             for(int i = 0; i < nrow; ++i)
             {
-                int k = row_offset[i];
-                int j = this->mat_.row_offset[i];
+                PtrType k = row_offset[i];
+                PtrType j = this->mat_.row_offset[i];
 
                 for(; j < this->mat_.row_offset[i + 1]; ++j)
                 {
@@ -6994,7 +9999,8 @@ namespace rocalution
                 // Initialize with zero
                 cast_vec->vec_[ai] = static_cast<ValueType>(0);
 
-                for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+                for(PtrType aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1];
+                    ++aj)
                 {
                     if(idx == this->mat_.col[aj])
                     {
@@ -7019,7 +10025,7 @@ namespace rocalution
                 = dynamic_cast<const HostVector<ValueType>*>(&vec);
             assert(cast_vec != NULL);
 
-            int*       row_offset = NULL;
+            PtrType*   row_offset = NULL;
             int*       col        = NULL;
             ValueType* val        = NULL;
 
@@ -7041,7 +10047,7 @@ namespace rocalution
             }
 
             // Fill row_offset
-            int shift = nnz_idx - this->mat_.row_offset[idx + 1] + this->mat_.row_offset[idx];
+            PtrType shift = nnz_idx - this->mat_.row_offset[idx + 1] + this->mat_.row_offset[idx];
 
 #ifdef _OPENMP
 #pragma omp parallel for
@@ -7058,7 +10064,7 @@ namespace rocalution
                 }
             }
 
-            int nnz = row_offset[nrow];
+            PtrType nnz = row_offset[nrow];
 
             // Fill col and val
             allocate_host(nnz, &col);
@@ -7072,7 +10078,7 @@ namespace rocalution
                 // Rows before idx
                 if(i < idx)
                 {
-                    for(int j = row_offset[i]; j < row_offset[i + 1]; ++j)
+                    for(PtrType j = row_offset[i]; j < row_offset[i + 1]; ++j)
                     {
                         col[j] = this->mat_.col[j];
                         val[j] = this->mat_.val[j];
@@ -7082,7 +10088,7 @@ namespace rocalution
                 }
                 else if(i == idx)
                 {
-                    int k = row_offset[i];
+                    PtrType k = row_offset[i];
 
                     for(int j = 0; j < ncol; ++j)
                     {
@@ -7098,9 +10104,9 @@ namespace rocalution
                 }
                 else if(i > idx)
                 {
-                    int k = row_offset[i];
+                    PtrType k = row_offset[i];
 
-                    for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+                    for(PtrType j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
                     {
                         col[k] = this->mat_.col[j];
                         val[k] = this->mat_.val[j];
@@ -7131,7 +10137,7 @@ namespace rocalution
 
             cast_vec->Zeros();
 
-            for(int aj = this->mat_.row_offset[idx]; aj < this->mat_.row_offset[idx + 1]; ++aj)
+            for(PtrType aj = this->mat_.row_offset[idx]; aj < this->mat_.row_offset[idx + 1]; ++aj)
             {
                 cast_vec->vec_[this->mat_.col[aj]] = this->mat_.val[aj];
             }
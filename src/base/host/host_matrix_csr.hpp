@@ -46,10 +46,10 @@ namespace rocalution
         }
 
         virtual bool Check(void) const;
-        virtual void AllocateCSR(int nnz, int nrow, int ncol);
+        virtual void AllocateCSR(PtrType nnz, int nrow, int ncol);
         virtual void SetDataPtrCSR(
-            int** row_offset, int** col, ValueType** val, int nnz, int nrow, int ncol);
-        virtual void LeaveDataPtrCSR(int** row_offset, int** col, ValueType** val);
+            PtrType** row_offset, int** col, ValueType** val, PtrType nnz, int nrow, int ncol);
+        virtual void LeaveDataPtrCSR(PtrType** row_offset, int** col, ValueType** val);
 
         virtual void Clear(void);
         virtual bool Zeros(void);
@@ -73,6 +73,9 @@ namespace rocalution
         virtual bool ExtractUDiagonal(BaseMatrix<ValueType>* U) const;
         virtual bool ExtractL(BaseMatrix<ValueType>* L) const;
         virtual bool ExtractLDiagonal(BaseMatrix<ValueType>* L) const;
+        virtual bool ExtractL1BlockDiagonal(int                          block_size,
+                                            const BaseMatrix<ValueType>* ghost,
+                                            BaseMatrix<ValueType>*       mat) const;
 
         virtual bool
             MultiColoring(int& num_colors, int** size_colors, BaseVector<int>* permutation) const;
@@ -82,6 +85,7 @@ namespace rocalution
         virtual bool ZeroBlockPermutation(int& size, BaseVector<int>* permutation) const;
 
         virtual bool SymbolicPower(int p);
+        virtual bool SymbolicLU(void);
 
         virtual bool SymbolicMatMatMult(const BaseMatrix<ValueType>& src);
         virtual bool MatMatMult(const BaseMatrix<ValueType>& A, const BaseMatrix<ValueType>& B);
@@ -89,6 +93,12 @@ namespace rocalution
                                         const BaseMatrix<ValueType>& B);
         virtual bool NumericMatMatMult(const BaseMatrix<ValueType>& A,
                                        const BaseMatrix<ValueType>& B);
+        virtual bool TripleMatMult(const BaseMatrix<ValueType>& R,
+                                   const BaseMatrix<ValueType>& A,
+                                   const BaseMatrix<ValueType>& P);
+        virtual bool NumericTripleMatMult(const BaseMatrix<ValueType>& R,
+                                          const BaseMatrix<ValueType>& A,
+                                          const BaseMatrix<ValueType>& P);
 
         virtual bool DiagonalMatrixMultR(const BaseVector<ValueType>& diag);
         virtual bool DiagonalMatrixMultL(const BaseVector<ValueType>& diag);
@@ -103,33 +113,37 @@ namespace rocalution
         virtual bool CMK(BaseVector<int>* permutation) const;
         virtual bool RCMK(BaseVector<int>* permutation) const;
         virtual bool ConnectivityOrder(BaseVector<int>* permutation) const;
+        virtual bool MinimumDegree(BaseVector<int>* permutation) const;
 
         virtual bool ConvertFrom(const BaseMatrix<ValueType>& mat);
 
         virtual void CopyFrom(const BaseMatrix<ValueType>& mat);
 
-        virtual void CopyFromCSR(const int* row_offsets, const int* col, const ValueType* val);
-        virtual void CopyToCSR(int* row_offsets, int* col, ValueType* val) const;
+        virtual void CopyFromCSR(const PtrType* row_offsets, const int* col, const ValueType* val);
+        virtual void CopyToCSR(PtrType* row_offsets, int* col, ValueType* val) const;
 
         virtual void CopyTo(BaseMatrix<ValueType>* mat) const;
 
-        virtual void CopyFromHostCSR(const int*       row_offset,
+        virtual void CopyFromHostCSR(const PtrType*   row_offset,
                                      const int*       col,
                                      const ValueType* val,
-                                     int              nnz,
+                                     PtrType          nnz,
                                      int              nrow,
                                      int              ncol);
 
+        virtual bool ReadFileMTX(const std::string& filename);
         virtual bool ReadFileCSR(const std::string& filename);
-        virtual bool WriteFileCSR(const std::string& filename) const;
+        virtual bool WriteFileCSR(const std::string& filename, unsigned int format) const;
 
         virtual bool CreateFromMap(const BaseVector<int>& map, int n, int m);
         virtual bool
             CreateFromMap(const BaseVector<int>& map, int n, int m, BaseMatrix<ValueType>* pro);
 
         virtual bool ICFactorize(BaseVector<ValueType>* inv_diag);
+        virtual bool ItICFactorize(BaseVector<ValueType>* inv_diag, int sweeps);
 
         virtual bool ILU0Factorize(void);
+        virtual bool ItILU0Factorize(int sweeps);
         virtual bool ILUpFactorizeNumeric(int p, const BaseMatrix<ValueType>& mat);
         virtual bool ILUTFactorize(double t, int maxrow);
 
@@ -158,12 +172,38 @@ namespace rocalution
         virtual void ApplyAdd(const BaseVector<ValueType>& in,
                               ValueType                    scalar,
                               BaseVector<ValueType>*       out) const;
+        virtual bool ApplyTranspose(const BaseVector<ValueType>& in,
+                                    BaseVector<ValueType>*       out) const;
+        virtual bool Residual(const BaseVector<ValueType>& rhs,
+                              const BaseVector<ValueType>& in,
+                              BaseVector<ValueType>*       res) const;
+        virtual bool JacobiSweep(const BaseVector<ValueType>& inv_diag,
+                                 const BaseVector<ValueType>& rhs,
+                                 ValueType                    omega,
+                                 const BaseVector<ValueType>& in,
+                                 BaseVector<ValueType>*       out) const;
+        virtual bool ApplyRows(const BaseVector<int>&       rows,
+                               int                          start,
+                               int                          end,
+                               const BaseVector<ValueType>& in,
+                               ValueType                    scalar,
+                               bool                         add,
+                               BaseVector<ValueType>*       out) const;
+        virtual bool ApplyRowsGhost(const BaseVector<int>&       rows,
+                                    const BaseVector<int>&       ghost_offset,
+                                    const BaseMatrix<ValueType>& ghost,
+                                    const BaseVector<ValueType>& in,
+                                    const BaseVector<ValueType>& ghost_in,
+                                    ValueType                    scalar,
+                                    bool                         add,
+                                    BaseVector<ValueType>*       out) const;
 
         virtual bool Compress(double drop_off);
         virtual bool Transpose(void);
         virtual bool Transpose(BaseMatrix<ValueType>* T) const;
         virtual bool Sort(void);
         virtual bool Key(long int& row_key, long int& col_key, long int& val_key) const;
+        virtual bool StructureStats(MatrixStructureStats* stats) const;
 
         virtual bool ReplaceColumnVector(int idx, const BaseVector<ValueType>& vec);
         virtual bool ExtractColumnVector(int idx, BaseVector<ValueType>* vec) const;
@@ -188,6 +228,23 @@ namespace rocalution
 
         virtual bool RSCoarsening(float eps, BaseVector<int>* CFmap, BaseVector<bool>* S) const;
         virtual bool RSPMISCoarsening(float eps, BaseVector<int>* CFmap, BaseVector<bool>* S) const;
+        virtual bool RSPMISStrongInfluences(float                        eps,
+                                            BaseVector<bool>*            S,
+                                            BaseVector<float>*           omega,
+                                            unsigned long long           seed,
+                                            const BaseMatrix<ValueType>& ghost) const;
+        virtual bool RSPMISUnassignedToCoarse(BaseVector<int>*         CFmap,
+                                              BaseVector<bool>*        marked,
+                                              const BaseVector<float>& omega) const;
+        virtual bool RSPMISCorrectCoarse(BaseVector<int>*             CFmap,
+                                         const BaseVector<bool>&      S,
+                                         const BaseVector<bool>&      marked,
+                                         const BaseVector<float>&     omega,
+                                         const BaseMatrix<ValueType>& ghost) const;
+        virtual bool RSPMISCoarseEdgesToFine(BaseVector<int>*             CFmap,
+                                             const BaseVector<bool>&      S,
+                                             const BaseMatrix<ValueType>& ghost) const;
+        virtual bool RSPMISCheckUndecided(bool& undecided, const BaseVector<int>& CFmap) const;
         virtual bool RSDirectInterpolation(const BaseVector<int>&  CFmap,
                                            const BaseVector<bool>& S,
                                            BaseMatrix<ValueType>*  prolong,
@@ -245,7 +302,14 @@ namespace rocalution
                                      int                    rGsize) const;
 
     private:
-        MatrixCSR<ValueType, int> mat_;
+        // Free the level scheduling of the lower and/or upper triangular part
+        void ClearLevelSchedule_(bool lower, bool upper);
+
+        // Row partition of the matrix into nparts chunks of balanced work, which is
+        // computed once and kept until the structure of the matrix changes
+        const int* ApplyPartition_(int nparts) const;
+
+        MatrixCSR<ValueType, int, PtrType> mat_;
 
         friend class BaseVector<ValueType>;
         friend class HostVector<ValueType>;
@@ -256,11 +320,34 @@ namespace rocalution
         friend class HostMatrixDENSE<ValueType>;
         friend class HostMatrixMCSR<ValueType>;
         friend class HostMatrixBCSR<ValueType>;
+        friend class HostMatrixSELL<ValueType>;
 
         friend class HIPAcceleratorMatrixCSR<ValueType>;
 
         bool L_diag_unit_;
         bool U_diag_unit_;
+
+        // Level scheduling of the lower triangular part (LUAnalyse, LLAnalyse, LAnalyse)
+        int  L_nlevel_;
+        int* L_level_offset_;
+        int* L_level_row_;
+
+        // Level scheduling of the upper triangular part (LUAnalyse, LLAnalyse, UAnalyse)
+        int  U_nlevel_;
+        int* U_level_offset_;
+        int* U_level_row_;
+
+        // Transposed lower triangular structure for LLSolve, values are taken from mat_.val
+        PtrType* LT_row_offset_;
+        int*     LT_col_;
+        PtrType* LT_val_idx_;
+
+        // Cached row partition for Apply and ApplyAdd (ApplyPartition_)
+        mutable int            part_nparts_;
+        mutable int            part_nrow_;
+        mutable PtrType        part_nnz_;
+        mutable const PtrType* part_row_offset_;
+        mutable int*           part_row_;
     };
 
 } // namespace rocalution
@@ -252,7 +252,7 @@ namespace rocalution
            = dynamic_cast<const HostMatrixCSR<ValueType>*>(&mat))
         {
             this->Clear();
-            int nnz = 0;
+            PtrType nnz = 0;
 
             if(csr_to_dia(this->local_backend_.OpenMP_threads,
                           cast_mat->nnz_,
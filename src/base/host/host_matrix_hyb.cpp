@@ -256,9 +256,9 @@ namespace rocalution
         {
             this->Clear();
 
-            int nnz     = 0;
-            int coo_nnz = 0;
-            int ell_nnz = 0;
+            PtrType nnz     = 0;
+            int     coo_nnz = 0;
+            int     ell_nnz = 0;
 
             if(csr_to_hyb(this->local_backend_.OpenMP_threads,
                           cast_mat->nnz_,
@@ -0,0 +1,354 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "host_matrix_sell.hpp"
+#include "../../utils/allocate_free.hpp"
+#include "../../utils/def.hpp"
+#include "../../utils/log.hpp"
+#include "host_conversion.hpp"
+#include "host_matrix_csr.hpp"
+#include "host_simd.hpp"
+#include "host_vector.hpp"
+
+#include <algorithm>
+#include <complex>
+
+#ifdef _OPENMP
+#include <omp.h>
+#else
+#define omp_set_num_threads(num) ;
+#endif
+
+namespace rocalution
+{
+
+    template <typename ValueType>
+    HostMatrixSELL<ValueType>::HostMatrixSELL()
+    {
+        // no default constructors
+        LOG_INFO("no default constructor");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    HostMatrixSELL<ValueType>::HostMatrixSELL(const Rocalution_Backend_Descriptor& local_backend)
+    {
+        log_debug(this, "HostMatrixSELL::HostMatrixSELL()", "constructor with local_backend");
+
+        this->mat_.slice_size   = 0;
+        this->mat_.sigma        = 0;
+        this->mat_.nslice       = 0;
+        this->mat_.slice_offset = NULL;
+        this->mat_.perm         = NULL;
+        this->mat_.col          = NULL;
+        this->mat_.val          = NULL;
+
+        this->set_backend(local_backend);
+    }
+
+    template <typename ValueType>
+    HostMatrixSELL<ValueType>::~HostMatrixSELL()
+    {
+        log_debug(this, "HostMatrixSELL::~HostMatrixSELL()", "destructor");
+
+        this->Clear();
+    }
+
+    template <typename ValueType>
+    void HostMatrixSELL<ValueType>::Info(void) const
+    {
+        LOG_INFO("HostMatrixSELL<ValueType>, C=" << this->mat_.slice_size
+                                                 << " sigma=" << this->mat_.sigma);
+    }
+
+    template <typename ValueType>
+    void HostMatrixSELL<ValueType>::Clear()
+    {
+        if(this->nnz_ > 0)
+        {
+            free_host(&this->mat_.slice_offset);
+            free_host(&this->mat_.perm);
+            free_host(&this->mat_.col);
+            free_host(&this->mat_.val);
+
+            this->mat_.slice_size = 0;
+            this->mat_.sigma      = 0;
+            this->mat_.nslice     = 0;
+
+            this->nrow_ = 0;
+            this->ncol_ = 0;
+            this->nnz_  = 0;
+        }
+    }
+
+    template <typename ValueType>
+    void HostMatrixSELL<ValueType>::AllocateSELL(
+        PtrType nnz, int nrow, int ncol, int slice_size, int sigma)
+    {
+        assert(nnz >= 0);
+        assert(ncol >= 0);
+        assert(nrow >= 0);
+        assert(slice_size > 0);
+        assert(sigma > 0);
+
+        if(this->nnz_ > 0)
+        {
+            this->Clear();
+        }
+
+        if(nnz > 0)
+        {
+            assert(nrow > 0);
+            assert(nnz % slice_size == 0);
+
+            int nslice = (nrow - 1) / slice_size + 1;
+
+            allocate_host(nslice + 1, &this->mat_.slice_offset);
+            allocate_host(nrow, &this->mat_.perm);
+            allocate_host(nnz, &this->mat_.col);
+            allocate_host(nnz, &this->mat_.val);
+
+            set_to_zero_host(nslice + 1, this->mat_.slice_offset);
+            set_to_zero_host(nrow, this->mat_.perm);
+            set_to_zero_host(nnz, this->mat_.col);
+            set_to_zero_host(nnz, this->mat_.val);
+
+            this->mat_.slice_size = slice_size;
+            this->mat_.sigma      = sigma;
+            this->mat_.nslice     = nslice;
+
+            this->nrow_ = nrow;
+            this->ncol_ = ncol;
+            this->nnz_  = nnz;
+        }
+    }
+
+    template <typename ValueType>
+    void HostMatrixSELL<ValueType>::CopyFrom(const BaseMatrix<ValueType>& mat)
+    {
+        // copy only in the same format
+        assert(this->GetMatFormat() == mat.GetMatFormat());
+        assert(this->GetMatBlockDimension() == mat.GetMatBlockDimension());
+
+        if(const HostMatrixSELL<ValueType>* cast_mat
+           = dynamic_cast<const HostMatrixSELL<ValueType>*>(&mat))
+        {
+            this->AllocateSELL(cast_mat->nnz_,
+                               cast_mat->nrow_,
+                               cast_mat->ncol_,
+                               cast_mat->mat_.slice_size,
+                               cast_mat->mat_.sigma);
+
+            assert((this->nnz_ == cast_mat->nnz_) && (this->nrow_ == cast_mat->nrow_)
+                   && (this->ncol_ == cast_mat->ncol_));
+
+            if(this->nnz_ > 0)
+            {
+                _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+                PtrType nnz = this->nnz_;
+
+                for(int i = 0; i < this->mat_.nslice + 1; ++i)
+                {
+                    this->mat_.slice_offset[i] = cast_mat->mat_.slice_offset[i];
+                }
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+                for(int i = 0; i < this->nrow_; ++i)
+                {
+                    this->mat_.perm[i] = cast_mat->mat_.perm[i];
+                }
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+                for(PtrType i = 0; i < nnz; ++i)
+                {
+                    this->mat_.val[i] = cast_mat->mat_.val[i];
+                }
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+                for(PtrType i = 0; i < nnz; ++i)
+                {
+                    this->mat_.col[i] = cast_mat->mat_.col[i];
+                }
+            }
+        }
+        else
+        {
+            // Host matrix knows only host matrices
+            // -> dispatching
+            mat.CopyTo(this);
+        }
+    }
+
+    template <typename ValueType>
+    void HostMatrixSELL<ValueType>::CopyTo(BaseMatrix<ValueType>* mat) const
+    {
+        mat->CopyFrom(*this);
+    }
+
+    template <typename ValueType>
+    bool HostMatrixSELL<ValueType>::ConvertFrom(const BaseMatrix<ValueType>& mat)
+    {
+        this->Clear();
+
+        // empty matrix is empty matrix
+        if(mat.GetNnz() == 0)
+        {
+            return true;
+        }
+
+        if(const HostMatrixSELL<ValueType>* cast_mat
+           = dynamic_cast<const HostMatrixSELL<ValueType>*>(&mat))
+        {
+            this->CopyFrom(*cast_mat);
+            return true;
+        }
+
+        if(const HostMatrixCSR<ValueType>* cast_mat
+           = dynamic_cast<const HostMatrixCSR<ValueType>*>(&mat))
+        {
+            this->Clear();
+            PtrType nnz = 0;
+
+            // A slice holds (at least) one SIMD register of rows, rows are
+            // sorted within 32 slices to keep the padding low
+            int slice_size = std::max(host_simd_width(sizeof(ValueType)), 4);
+            int sigma      = 32 * slice_size;
+
+            if(csr_to_sell(this->local_backend_.OpenMP_threads,
+                           cast_mat->nnz_,
+                           cast_mat->nrow_,
+                           cast_mat->ncol_,
+                           slice_size,
+                           sigma,
+                           cast_mat->mat_,
+                           &this->mat_,
+                           &nnz)
+               == true)
+            {
+                this->nrow_ = cast_mat->nrow_;
+                this->ncol_ = cast_mat->ncol_;
+                this->nnz_  = nnz;
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    template <typename ValueType>
+    void HostMatrixSELL<ValueType>::Apply(const BaseVector<ValueType>& in,
+                                          BaseVector<ValueType>*       out) const
+    {
+        if(this->nnz_ > 0)
+        {
+            assert(in.GetSize() >= 0);
+            assert(out->GetSize() >= 0);
+            assert(in.GetSize() == this->ncol_);
+            assert(out->GetSize() == this->nrow_);
+
+            const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+            HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+            assert(cast_in != NULL);
+            assert(cast_out != NULL);
+
+            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int s = 0; s < this->mat_.nslice; ++s)
+            {
+                host_sellmv(s,
+                            s + 1,
+                            this->nrow_,
+                            this->mat_.slice_size,
+                            this->mat_.slice_offset,
+                            this->mat_.perm,
+                            this->mat_.col,
+                            this->mat_.val,
+                            static_cast<ValueType>(1),
+                            cast_in->vec_,
+                            false,
+                            cast_out->vec_);
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void HostMatrixSELL<ValueType>::ApplyAdd(const BaseVector<ValueType>& in,
+                                             ValueType                    scalar,
+                                             BaseVector<ValueType>*       out) const
+    {
+        if(this->nnz_ > 0)
+        {
+            assert(in.GetSize() >= 0);
+            assert(out->GetSize() >= 0);
+            assert(in.GetSize() == this->ncol_);
+            assert(out->GetSize() == this->nrow_);
+
+            const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+            HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+            assert(cast_in != NULL);
+            assert(cast_out != NULL);
+
+            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int s = 0; s < this->mat_.nslice; ++s)
+            {
+                host_sellmv(s,
+                            s + 1,
+                            this->nrow_,
+                            this->mat_.slice_size,
+                            this->mat_.slice_offset,
+                            this->mat_.perm,
+                            this->mat_.col,
+                            this->mat_.val,
+                            scalar,
+                            cast_in->vec_,
+                            true,
+                            cast_out->vec_);
+            }
+        }
+    }
+
+    template class HostMatrixSELL<double>;
+    template class HostMatrixSELL<float>;
+#ifdef SUPPORT_COMPLEX
+    template class HostMatrixSELL<std::complex<double>>;
+    template class HostMatrixSELL<std::complex<float>>;
+#endif
+
+} // namespace rocalution
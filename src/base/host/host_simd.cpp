@@ -0,0 +1,996 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "host_simd.hpp"
+#include "../../utils/def.hpp"
+#include "../matrix_formats_ind.hpp"
+
+#include <algorithm>
+#include <complex>
+
+#if(defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define ROCALUTION_HOST_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace rocalution
+{
+
+    static int host_simd_detect(void)
+    {
+#ifdef ROCALUTION_HOST_SIMD_X86
+        __builtin_cpu_init();
+
+        if(__builtin_cpu_supports("avx512f"))
+        {
+            return HOST_SIMD_AVX512;
+        }
+
+        if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        {
+            return HOST_SIMD_AVX2;
+        }
+#endif
+
+        return HOST_SIMD_NONE;
+    }
+
+    int host_simd_support(void)
+    {
+        static const int simd = host_simd_detect();
+
+        return simd;
+    }
+
+    int host_simd_width(int value_size)
+    {
+        assert(value_size > 0);
+
+        int bytes = 16;
+
+        switch(host_simd_support())
+        {
+        case HOST_SIMD_AVX512:
+            bytes = 64;
+            break;
+        case HOST_SIMD_AVX2:
+            bytes = 32;
+            break;
+        default:
+            break;
+        }
+
+        return std::max(bytes / value_size, 1);
+    }
+
+    void host_csr_partition(int nrow, const PtrType* row_offset, int nparts, int* part)
+    {
+        assert(nrow >= 0);
+        assert(nparts > 0);
+        assert(part != NULL);
+
+        // Each row counts as one item, in addition to its non-zeros
+        long long total = static_cast<long long>(nrow) + row_offset[nrow] - row_offset[0];
+
+        part[0]      = 0;
+        part[nparts] = nrow;
+
+        for(int p = 1; p < nparts; ++p)
+        {
+            long long target = total * p / nparts;
+
+            // First row with row + nnz(0:row) >= target
+            int lo = part[p - 1];
+            int hi = nrow;
+
+            while(lo < hi)
+            {
+                int mid = lo + (hi - lo) / 2;
+
+                if(static_cast<long long>(mid) + row_offset[mid] - row_offset[0] < target)
+                {
+                    lo = mid + 1;
+                }
+                else
+                {
+                    hi = mid;
+                }
+            }
+
+            part[p] = lo;
+        }
+    }
+
+    template <typename ValueType>
+    static void host_csrmv_scalar(int              row_begin,
+                                  int              row_end,
+                                  const PtrType*   row_offset,
+                                  const int*       col,
+                                  const ValueType* val,
+                                  ValueType        alpha,
+                                  const ValueType* x,
+                                  bool             add,
+                                  ValueType*       y)
+    {
+        for(int ai = row_begin; ai < row_end; ++ai)
+        {
+            ValueType sum = static_cast<ValueType>(0);
+
+            for(PtrType aj = row_offset[ai]; aj < row_offset[ai + 1]; ++aj)
+            {
+                sum += val[aj] * x[col[aj]];
+            }
+
+            y[ai] = (add == true) ? y[ai] + alpha * sum : alpha * sum;
+        }
+    }
+
+    template <typename ValueType>
+    static void host_sellmv_scalar(int              slice_begin,
+                                   int              slice_end,
+                                   int              nrow,
+                                   int              slice_size,
+                                   const int*       slice_offset,
+                                   const int*       perm,
+                                   const int*       col,
+                                   const ValueType* val,
+                                   ValueType        alpha,
+                                   const ValueType* x,
+                                   bool             add,
+                                   ValueType*       y)
+    {
+        for(int s = slice_begin; s < slice_end; ++s)
+        {
+            int offset = slice_offset[s];
+            int width  = (slice_offset[s + 1] - offset) / slice_size;
+
+            for(int r = 0; r < slice_size; ++r)
+            {
+                int i = s * slice_size + r;
+
+                if(i >= nrow)
+                {
+                    break;
+                }
+
+                ValueType sum = static_cast<ValueType>(0);
+
+                for(int n = 0; n < width; ++n)
+                {
+                    int aj     = SELL_IND(r, n, offset, slice_size);
+                    int col_aj = col[aj];
+
+                    // Padding is always at the end of a row
+                    if(col_aj < 0)
+                    {
+                        break;
+                    }
+
+                    sum += val[aj] * x[col_aj];
+                }
+
+                int row = perm[i];
+
+                y[row] = (add == true) ? y[row] + alpha * sum : alpha * sum;
+            }
+        }
+    }
+
+    // Scatter the results of lanes consecutive (sorted) rows starting at row i
+    template <typename ValueType>
+    static inline void host_sell_store(int              i,
+                                       int              lanes,
+                                       int              nrow,
+                                       const int*       perm,
+                                       const ValueType* sum,
+                                       ValueType        alpha,
+                                       bool             add,
+                                       ValueType*       y)
+    {
+        int end = std::min(i + lanes, nrow);
+
+        for(int l = 0; i < end; ++i, ++l)
+        {
+            int row = perm[i];
+
+            y[row] = (add == true) ? y[row] + alpha * sum[l] : alpha * sum[l];
+        }
+    }
+
+#ifdef ROCALUTION_HOST_SIMD_X86
+    // Horizontal sums of the AVX512 registers, going through memory avoids the undefined
+    // upper halves that _mm512_reduce_add_*() extracts from
+    __attribute__((target("avx512f"))) static inline double host_avx512_sum(__m512d v)
+    {
+        double tmp[8];
+        _mm512_storeu_pd(tmp, v);
+
+        return ((tmp[0] + tmp[1]) + (tmp[2] + tmp[3])) + ((tmp[4] + tmp[5]) + (tmp[6] + tmp[7]));
+    }
+
+    __attribute__((target("avx512f"))) static inline float host_avx512_sum(__m512 v)
+    {
+        float tmp[16];
+        _mm512_storeu_ps(tmp, v);
+
+        float sum = 0.0f;
+        for(int l = 0; l < 16; ++l)
+        {
+            sum += tmp[l];
+        }
+
+        return sum;
+    }
+
+    // The kernels below compute rows with less entries than one SIMD register in the
+    // scalar loop only, and the gathers use a zero source with a full mask
+    __attribute__((target("avx2,fma"))) static void host_csrmv_avx2(int            row_begin,
+                                                                    int            row_end,
+                                                                    const PtrType* row_offset,
+                                                                    const int*     col,
+                                                                    const double*  val,
+                                                                    double         alpha,
+                                                                    const double*  x,
+                                                                    bool           add,
+                                                                    double*        y)
+    {
+        const __m256d vall = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+
+        for(int ai = row_begin; ai < row_end; ++ai)
+        {
+            PtrType aj     = row_offset[ai];
+            PtrType aj_end = row_offset[ai + 1];
+
+            double sum = 0.0;
+
+            if(aj + 4 <= aj_end)
+            {
+                __m256d vsum = _mm256_setzero_pd();
+
+                for(; aj + 4 <= aj_end; aj += 4)
+                {
+                    __m128i vcol = _mm_loadu_si128(reinterpret_cast<const __m128i*>(col + aj));
+                    __m256d vx
+                        = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), x, vcol, vall, 8);
+
+                    vsum = _mm256_fmadd_pd(_mm256_loadu_pd(val + aj), vx, vsum);
+                }
+
+                __m128d vsum2 = _mm256_extractf128_pd(vsum, 1);
+                vsum2         = _mm_add_pd(_mm256_castpd256_pd128(vsum), vsum2);
+                sum           = _mm_cvtsd_f64(_mm_add_sd(vsum2, _mm_unpackhi_pd(vsum2, vsum2)));
+            }
+
+            for(; aj < aj_end; ++aj)
+            {
+                sum += val[aj] * x[col[aj]];
+            }
+
+            y[ai] = (add == true) ? y[ai] + alpha * sum : alpha * sum;
+        }
+    }
+
+    __attribute__((target("avx2,fma"))) static void host_csrmv_avx2(int            row_begin,
+                                                                    int            row_end,
+                                                                    const PtrType* row_offset,
+                                                                    const int*     col,
+                                                                    const float*   val,
+                                                                    float          alpha,
+                                                                    const float*   x,
+                                                                    bool           add,
+                                                                    float*         y)
+    {
+        const __m256 vall = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+        for(int ai = row_begin; ai < row_end; ++ai)
+        {
+            PtrType aj     = row_offset[ai];
+            PtrType aj_end = row_offset[ai + 1];
+
+            float sum = 0.0f;
+
+            if(aj + 8 <= aj_end)
+            {
+                __m256 vsum = _mm256_setzero_ps();
+
+                for(; aj + 8 <= aj_end; aj += 8)
+                {
+                    __m256i vcol = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(col + aj));
+                    __m256  vx   = _mm256_mask_i32gather_ps(_mm256_setzero_ps(), x, vcol, vall, 4);
+
+                    vsum = _mm256_fmadd_ps(_mm256_loadu_ps(val + aj), vx, vsum);
+                }
+
+                __m128 vsum4
+                    = _mm_add_ps(_mm256_castps256_ps128(vsum), _mm256_extractf128_ps(vsum, 1));
+                vsum4 = _mm_add_ps(vsum4, _mm_movehl_ps(vsum4, vsum4));
+                vsum4 = _mm_add_ss(vsum4, _mm_shuffle_ps(vsum4, vsum4, 1));
+                sum   = _mm_cvtss_f32(vsum4);
+            }
+
+            for(; aj < aj_end; ++aj)
+            {
+                sum += val[aj] * x[col[aj]];
+            }
+
+            y[ai] = (add == true) ? y[ai] + alpha * sum : alpha * sum;
+        }
+    }
+
+    __attribute__((target("avx512f"))) static void host_csrmv_avx512(int            row_begin,
+                                                                     int            row_end,
+                                                                     const PtrType* row_offset,
+                                                                     const int*     col,
+                                                                     const double*  val,
+                                                                     double         alpha,
+                                                                     const double*  x,
+                                                                     bool           add,
+                                                                     double*        y)
+    {
+        for(int ai = row_begin; ai < row_end; ++ai)
+        {
+            PtrType aj     = row_offset[ai];
+            PtrType aj_end = row_offset[ai + 1];
+
+            double sum = 0.0;
+
+            if(aj + 8 <= aj_end)
+            {
+                __m512d vsum = _mm512_setzero_pd();
+
+                for(; aj + 8 <= aj_end; aj += 8)
+                {
+                    __m256i vcol = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(col + aj));
+                    __m512d vx   = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), 0xFF, vcol, x, 8);
+
+                    vsum = _mm512_fmadd_pd(_mm512_loadu_pd(val + aj), vx, vsum);
+                }
+
+                sum = host_avx512_sum(vsum);
+            }
+
+            for(; aj < aj_end; ++aj)
+            {
+                sum += val[aj] * x[col[aj]];
+            }
+
+            y[ai] = (add == true) ? y[ai] + alpha * sum : alpha * sum;
+        }
+    }
+
+    __attribute__((target("avx512f"))) static void host_csrmv_avx512(int            row_begin,
+                                                                     int            row_end,
+                                                                     const PtrType* row_offset,
+                                                                     const int*     col,
+                                                                     const float*   val,
+                                                                     float          alpha,
+                                                                     const float*   x,
+                                                                     bool           add,
+                                                                     float*         y)
+    {
+        for(int ai = row_begin; ai < row_end; ++ai)
+        {
+            PtrType aj     = row_offset[ai];
+            PtrType aj_end = row_offset[ai + 1];
+
+            float sum = 0.0f;
+
+            if(aj + 16 <= aj_end)
+            {
+                __m512 vsum = _mm512_setzero_ps();
+
+                for(; aj + 16 <= aj_end; aj += 16)
+                {
+                    __m512i vcol = _mm512_loadu_si512(col + aj);
+                    __m512  vx
+                        = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), 0xFFFF, vcol, x, 4);
+
+                    vsum = _mm512_fmadd_ps(_mm512_loadu_ps(val + aj), vx, vsum);
+                }
+
+                sum = host_avx512_sum(vsum);
+            }
+
+            for(; aj < aj_end; ++aj)
+            {
+                sum += val[aj] * x[col[aj]];
+            }
+
+            y[ai] = (add == true) ? y[ai] + alpha * sum : alpha * sum;
+        }
+    }
+
+    __attribute__((target("avx2,fma"))) static void host_sellmv_avx2(int           slice_begin,
+                                                                     int           slice_end,
+                                                                     int           nrow,
+                                                                     int           slice_size,
+                                                                     const int*    slice_offset,
+                                                                     const int*    perm,
+                                                                     const int*    col,
+                                                                     const double* val,
+                                                                     double        alpha,
+                                                                     const double* x,
+                                                                     bool          add,
+                                                                     double*       y)
+    {
+        for(int s = slice_begin; s < slice_end; ++s)
+        {
+            int offset = slice_offset[s];
+            int width  = (slice_offset[s + 1] - offset) / slice_size;
+
+            for(int r = 0; r < slice_size; r += 4)
+            {
+                if(s * slice_size + r >= nrow)
+                {
+                    break;
+                }
+
+                __m256d vsum = _mm256_setzero_pd();
+
+                for(int n = 0; n < width; ++n)
+                {
+                    int aj = SELL_IND(r, n, offset, slice_size);
+
+                    __m128i vcol  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(col + aj));
+                    __m128i vcmp  = _mm_cmpgt_epi32(vcol, _mm_set1_epi32(-1));
+                    __m256d vmask = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(vcmp));
+                    __m256d vx
+                        = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), x, vcol, vmask, 8);
+
+                    vsum = _mm256_fmadd_pd(_mm256_loadu_pd(val + aj), vx, vsum);
+                }
+
+                double sum[4];
+                _mm256_storeu_pd(sum, vsum);
+
+                host_sell_store(s * slice_size + r, 4, nrow, perm, sum, alpha, add, y);
+            }
+        }
+    }
+
+    __attribute__((target("avx2,fma"))) static void host_sellmv_avx2(int          slice_begin,
+                                                                     int          slice_end,
+                                                                     int          nrow,
+                                                                     int          slice_size,
+                                                                     const int*   slice_offset,
+                                                                     const int*   perm,
+                                                                     const int*   col,
+                                                                     const float* val,
+                                                                     float        alpha,
+                                                                     const float* x,
+                                                                     bool         add,
+                                                                     float*       y)
+    {
+        for(int s = slice_begin; s < slice_end; ++s)
+        {
+            int offset = slice_offset[s];
+            int width  = (slice_offset[s + 1] - offset) / slice_size;
+
+            for(int r = 0; r < slice_size; r += 8)
+            {
+                if(s * slice_size + r >= nrow)
+                {
+                    break;
+                }
+
+                __m256 vsum = _mm256_setzero_ps();
+
+                for(int n = 0; n < width; ++n)
+                {
+                    int aj = SELL_IND(r, n, offset, slice_size);
+
+                    __m256i vcol  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(col + aj));
+                    __m256i vmask = _mm256_cmpgt_epi32(vcol, _mm256_set1_epi32(-1));
+                    __m256  vx    = _mm256_mask_i32gather_ps(
+                        _mm256_setzero_ps(), x, vcol, _mm256_castsi256_ps(vmask), 4);
+
+                    vsum = _mm256_fmadd_ps(_mm256_loadu_ps(val + aj), vx, vsum);
+                }
+
+                float sum[8];
+                _mm256_storeu_ps(sum, vsum);
+
+                host_sell_store(s * slice_size + r, 8, nrow, perm, sum, alpha, add, y);
+            }
+        }
+    }
+
+    __attribute__((target("avx512f"))) static void host_sellmv_avx512(int           slice_begin,
+                                                                      int           slice_end,
+                                                                      int           nrow,
+                                                                      int           slice_size,
+                                                                      const int*    slice_offset,
+                                                                      const int*    perm,
+                                                                      const int*    col,
+                                                                      const double* val,
+                                                                      double        alpha,
+                                                                      const double* x,
+                                                                      bool          add,
+                                                                      double*       y)
+    {
+        for(int s = slice_begin; s < slice_end; ++s)
+        {
+            int offset = slice_offset[s];
+            int width  = (slice_offset[s + 1] - offset) / slice_size;
+
+            for(int r = 0; r < slice_size; r += 8)
+            {
+                if(s * slice_size + r >= nrow)
+                {
+                    break;
+                }
+
+                __m512d vsum = _mm512_setzero_pd();
+
+                for(int n = 0; n < width; ++n)
+                {
+                    int aj = SELL_IND(r, n, offset, slice_size);
+
+                    __m256i  vcol  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(col + aj));
+                    __m256i  vcmp  = _mm256_cmpgt_epi32(vcol, _mm256_set1_epi32(-1));
+                    __mmask8 vmask = _mm256_movemask_ps(_mm256_castsi256_ps(vcmp));
+                    __m512d  vx
+                        = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), vmask, vcol, x, 8);
+
+                    vsum = _mm512_fmadd_pd(_mm512_loadu_pd(val + aj), vx, vsum);
+                }
+
+                double sum[8];
+                _mm512_storeu_pd(sum, vsum);
+
+                host_sell_store(s * slice_size + r, 8, nrow, perm, sum, alpha, add, y);
+            }
+        }
+    }
+
+    __attribute__((target("avx512f"))) static void host_sellmv_avx512(int          slice_begin,
+                                                                      int          slice_end,
+                                                                      int          nrow,
+                                                                      int          slice_size,
+                                                                      const int*   slice_offset,
+                                                                      const int*   perm,
+                                                                      const int*   col,
+                                                                      const float* val,
+                                                                      float        alpha,
+                                                                      const float* x,
+                                                                      bool         add,
+                                                                      float*       y)
+    {
+        for(int s = slice_begin; s < slice_end; ++s)
+        {
+            int offset = slice_offset[s];
+            int width  = (slice_offset[s + 1] - offset) / slice_size;
+
+            for(int r = 0; r < slice_size; r += 16)
+            {
+                if(s * slice_size + r >= nrow)
+                {
+                    break;
+                }
+
+                __m512 vsum = _mm512_setzero_ps();
+
+                for(int n = 0; n < width; ++n)
+                {
+                    int aj = SELL_IND(r, n, offset, slice_size);
+
+                    __m512i   vcol  = _mm512_loadu_si512(col + aj);
+                    __mmask16 vmask = _mm512_cmpgt_epi32_mask(vcol, _mm512_set1_epi32(-1));
+                    __m512    vx
+                        = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), vmask, vcol, x, 4);
+
+                    vsum = _mm512_fmadd_ps(_mm512_loadu_ps(val + aj), vx, vsum);
+                }
+
+                float sum[16];
+                _mm512_storeu_ps(sum, vsum);
+
+                host_sell_store(s * slice_size + r, 16, nrow, perm, sum, alpha, add, y);
+            }
+        }
+    }
+#endif
+
+    // Generic types fall back to the scalar kernel
+    template <typename ValueType>
+    static void host_csrmv_dispatch(int              row_begin,
+                                    int              row_end,
+                                    const PtrType*   row_offset,
+                                    const int*       col,
+                                    const ValueType* val,
+                                    ValueType        alpha,
+                                    const ValueType* x,
+                                    bool             add,
+                                    ValueType*       y)
+    {
+        host_csrmv_scalar(row_begin, row_end, row_offset, col, val, alpha, x, add, y);
+    }
+
+    static void host_csrmv_dispatch(int            row_begin,
+                                    int            row_end,
+                                    const PtrType* row_offset,
+                                    const int*     col,
+                                    const double*  val,
+                                    double         alpha,
+                                    const double*  x,
+                                    bool           add,
+                                    double*        y)
+    {
+#ifdef ROCALUTION_HOST_SIMD_X86
+        switch(host_simd_support())
+        {
+        case HOST_SIMD_AVX512:
+            host_csrmv_avx512(row_begin, row_end, row_offset, col, val, alpha, x, add, y);
+            return;
+        case HOST_SIMD_AVX2:
+            host_csrmv_avx2(row_begin, row_end, row_offset, col, val, alpha, x, add, y);
+            return;
+        default:
+            break;
+        }
+#endif
+
+        host_csrmv_scalar(row_begin, row_end, row_offset, col, val, alpha, x, add, y);
+    }
+
+    static void host_csrmv_dispatch(int            row_begin,
+                                    int            row_end,
+                                    const PtrType* row_offset,
+                                    const int*     col,
+                                    const float*   val,
+                                    float          alpha,
+                                    const float*   x,
+                                    bool           add,
+                                    float*         y)
+    {
+#ifdef ROCALUTION_HOST_SIMD_X86
+        switch(host_simd_support())
+        {
+        case HOST_SIMD_AVX512:
+            host_csrmv_avx512(row_begin, row_end, row_offset, col, val, alpha, x, add, y);
+            return;
+        case HOST_SIMD_AVX2:
+            host_csrmv_avx2(row_begin, row_end, row_offset, col, val, alpha, x, add, y);
+            return;
+        default:
+            break;
+        }
+#endif
+
+        host_csrmv_scalar(row_begin, row_end, row_offset, col, val, alpha, x, add, y);
+    }
+
+    template <typename ValueType>
+    void host_csrmv(int              row_begin,
+                    int              row_end,
+                    const PtrType*   row_offset,
+                    const int*       col,
+                    const ValueType* val,
+                    ValueType        alpha,
+                    const ValueType* x,
+                    bool             add,
+                    ValueType*       y)
+    {
+        // The kernel is chosen for the whole matrix and short rows take the scalar loop of
+        // the vector kernels, such that the result of a row does not depend on the range
+        // it is computed in, and thus not on the number of threads
+        host_csrmv_dispatch(row_begin, row_end, row_offset, col, val, alpha, x, add, y);
+    }
+
+    template void host_csrmv(int            row_begin,
+                             int            row_end,
+                             const PtrType* row_offset,
+                             const int*     col,
+                             const double*  val,
+                             double         alpha,
+                             const double*  x,
+                             bool           add,
+                             double*        y);
+
+    template void host_csrmv(int            row_begin,
+                             int            row_end,
+                             const PtrType* row_offset,
+                             const int*     col,
+                             const float*   val,
+                             float          alpha,
+                             const float*   x,
+                             bool           add,
+                             float*         y);
+
+#ifdef SUPPORT_COMPLEX
+    template void host_csrmv(int                         row_begin,
+                             int                         row_end,
+                             const PtrType*              row_offset,
+                             const int*                  col,
+                             const std::complex<double>* val,
+                             std::complex<double>        alpha,
+                             const std::complex<double>* x,
+                             bool                        add,
+                             std::complex<double>*       y);
+
+    template void host_csrmv(int                        row_begin,
+                             int                        row_end,
+                             const PtrType*             row_offset,
+                             const int*                 col,
+                             const std::complex<float>* val,
+                             std::complex<float>        alpha,
+                             const std::complex<float>* x,
+                             bool                       add,
+                             std::complex<float>*       y);
+#endif
+
+    template <typename ValueType>
+    static void host_sellmv_dispatch(int              slice_begin,
+                                     int              slice_end,
+                                     int              nrow,
+                                     int              slice_size,
+                                     const int*       slice_offset,
+                                     const int*       perm,
+                                     const int*       col,
+                                     const ValueType* val,
+                                     ValueType        alpha,
+                                     const ValueType* x,
+                                     bool             add,
+                                     ValueType*       y)
+    {
+        host_sellmv_scalar(slice_begin,
+                           slice_end,
+                           nrow,
+                           slice_size,
+                           slice_offset,
+                           perm,
+                           col,
+                           val,
+                           alpha,
+                           x,
+                           add,
+                           y);
+    }
+
+    static void host_sellmv_dispatch(int           slice_begin,
+                                     int           slice_end,
+                                     int           nrow,
+                                     int           slice_size,
+                                     const int*    slice_offset,
+                                     const int*    perm,
+                                     const int*    col,
+                                     const double* val,
+                                     double        alpha,
+                                     const double* x,
+                                     bool          add,
+                                     double*       y)
+    {
+        // The vector kernels process one SIMD register of rows at once
+#ifdef ROCALUTION_HOST_SIMD_X86
+        switch(host_simd_support())
+        {
+        case HOST_SIMD_AVX512:
+            if(slice_size % 8 == 0)
+            {
+                host_sellmv_avx512(slice_begin,
+                                   slice_end,
+                                   nrow,
+                                   slice_size,
+                                   slice_offset,
+                                   perm,
+                                   col,
+                                   val,
+                                   alpha,
+                                   x,
+                                   add,
+                                   y);
+                return;
+            }
+            break;
+        case HOST_SIMD_AVX2:
+            if(slice_size % 4 == 0)
+            {
+                host_sellmv_avx2(slice_begin,
+                                 slice_end,
+                                 nrow,
+                                 slice_size,
+                                 slice_offset,
+                                 perm,
+                                 col,
+                                 val,
+                                 alpha,
+                                 x,
+                                 add,
+                                 y);
+                return;
+            }
+            break;
+        default:
+            break;
+        }
+#endif
+
+        host_sellmv_scalar(slice_begin,
+                           slice_end,
+                           nrow,
+                           slice_size,
+                           slice_offset,
+                           perm,
+                           col,
+                           val,
+                           alpha,
+                           x,
+                           add,
+                           y);
+    }
+
+    static void host_sellmv_dispatch(int          slice_begin,
+                                     int          slice_end,
+                                     int          nrow,
+                                     int          slice_size,
+                                     const int*   slice_offset,
+                                     const int*   perm,
+                                     const int*   col,
+                                     const float* val,
+                                     float        alpha,
+                                     const float* x,
+                                     bool         add,
+                                     float*       y)
+    {
+        // The vector kernels process one SIMD register of rows at once
+#ifdef ROCALUTION_HOST_SIMD_X86
+        switch(host_simd_support())
+        {
+        case HOST_SIMD_AVX512:
+            if(slice_size % 16 == 0)
+            {
+                host_sellmv_avx512(slice_begin,
+                                   slice_end,
+                                   nrow,
+                                   slice_size,
+                                   slice_offset,
+                                   perm,
+                                   col,
+                                   val,
+                                   alpha,
+                                   x,
+                                   add,
+                                   y);
+                return;
+            }
+            break;
+        case HOST_SIMD_AVX2:
+            if(slice_size % 8 == 0)
+            {
+                host_sellmv_avx2(slice_begin,
+                                 slice_end,
+                                 nrow,
+                                 slice_size,
+                                 slice_offset,
+                                 perm,
+                                 col,
+                                 val,
+                                 alpha,
+                                 x,
+                                 add,
+                                 y);
+                return;
+            }
+            break;
+        default:
+            break;
+        }
+#endif
+
+        host_sellmv_scalar(slice_begin,
+                           slice_end,
+                           nrow,
+                           slice_size,
+                           slice_offset,
+                           perm,
+                           col,
+                           val,
+                           alpha,
+                           x,
+                           add,
+                           y);
+    }
+
+    template <typename ValueType>
+    void host_sellmv(int              slice_begin,
+                     int              slice_end,
+                     int              nrow,
+                     int              slice_size,
+                     const int*       slice_offset,
+                     const int*       perm,
+                     const int*       col,
+                     const ValueType* val,
+                     ValueType        alpha,
+                     const ValueType* x,
+                     bool             add,
+                     ValueType*       y)
+    {
+        host_sellmv_dispatch(slice_begin,
+                             slice_end,
+                             nrow,
+                             slice_size,
+                             slice_offset,
+                             perm,
+                             col,
+                             val,
+                             alpha,
+                             x,
+                             add,
+                             y);
+    }
+
+    template void host_sellmv(int           slice_begin,
+                              int           slice_end,
+                              int           nrow,
+                              int           slice_size,
+                              const int*    slice_offset,
+                              const int*    perm,
+                              const int*    col,
+                              const double* val,
+                              double        alpha,
+                              const double* x,
+                              bool          add,
+                              double*       y);
+
+    template void host_sellmv(int          slice_begin,
+                              int          slice_end,
+                              int          nrow,
+                              int          slice_size,
+                              const int*   slice_offset,
+                              const int*   perm,
+                              const int*   col,
+                              const float* val,
+                              float        alpha,
+                              const float* x,
+                              bool         add,
+                              float*       y);
+
+#ifdef SUPPORT_COMPLEX
+    template void host_sellmv(int                         slice_begin,
+                              int                         slice_end,
+                              int                         nrow,
+                              int                         slice_size,
+                              const int*                  slice_offset,
+                              const int*                  perm,
+                              const int*                  col,
+                              const std::complex<double>* val,
+                              std::complex<double>        alpha,
+                              const std::complex<double>* x,
+                              bool                        add,
+                              std::complex<double>*       y);
+
+    template void host_sellmv(int                        slice_begin,
+                              int                        slice_end,
+                              int                        nrow,
+                              int                        slice_size,
+                              const int*                 slice_offset,
+                              const int*                 perm,
+                              const int*                 col,
+                              const std::complex<float>* val,
+                              std::complex<float>        alpha,
+                              const std::complex<float>* x,
+                              bool                       add,
+                              std::complex<float>*       y);
+#endif
+
+} // namespace rocalution
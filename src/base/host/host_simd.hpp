@@ -0,0 +1,84 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_HOST_HOST_SIMD_HPP_
+#define ROCALUTION_HOST_HOST_SIMD_HPP_
+
+#include "../../utils/types.hpp"
+
+namespace rocalution
+{
+
+    // SIMD instruction sets used by the host kernels
+    enum _host_simd
+    {
+        HOST_SIMD_NONE   = 0,
+        HOST_SIMD_AVX2   = 1,
+        HOST_SIMD_AVX512 = 2
+    };
+
+    // Widest SIMD instruction set supported by the host CPU (detected once at runtime)
+    int host_simd_support(void);
+
+    // Number of values of the given size that fit into one SIMD register
+    int host_simd_width(int value_size);
+
+    // Split the rows of a CSR matrix into nparts contiguous chunks with (approximately)
+    // the same number of rows plus non-zeros each (merge-path decomposition, without
+    // splitting rows). part has to be of size nparts + 1.
+    void host_csr_partition(int nrow, const PtrType* row_offset, int nparts, int* part);
+
+    // CSR matrix-vector product for rows [row_begin, row_end)
+    // y = alpha * A * x        (add == false)
+    // y = y + alpha * A * x    (add == true)
+    template <typename ValueType>
+    void host_csrmv(int              row_begin,
+                    int              row_end,
+                    const PtrType*   row_offset,
+                    const int*       col,
+                    const ValueType* val,
+                    ValueType        alpha,
+                    const ValueType* x,
+                    bool             add,
+                    ValueType*       y);
+
+    // SELL matrix-vector product for slices [slice_begin, slice_end)
+    // y = alpha * A * x        (add == false)
+    // y = y + alpha * A * x    (add == true)
+    template <typename ValueType>
+    void host_sellmv(int              slice_begin,
+                     int              slice_end,
+                     int              nrow,
+                     int              slice_size,
+                     const int*       slice_offset,
+                     const int*       perm,
+                     const int*       col,
+                     const ValueType* val,
+                     ValueType        alpha,
+                     const ValueType* x,
+                     bool             add,
+                     ValueType*       y);
+
+} // namespace rocalution
+
+#endif // ROCALUTION_HOST_HOST_SIMD_HPP_
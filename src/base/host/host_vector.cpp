@@ -32,12 +32,14 @@
 #include "../base_vector.hpp"
 #include "rocalution/version.hpp"
 
+#include <algorithm>
 #include <complex>
 #include <fstream>
 #include <limits>
 #include <math.h>
 #include <typeindex>
 #include <typeinfo>
+#include <vector>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -977,6 +979,140 @@ namespace rocalution
         return std::complex<double>(asum_real, asum_imag);
     }
 
+    template <typename ValueType>
+    void HostVector<ValueType>::MDot(int                                 count,
+                                     const BaseVector<ValueType>* const* x,
+                                     ValueType*                          result) const
+    {
+        assert(count >= 0);
+        assert(result != NULL);
+
+        if(count == 0)
+        {
+            return;
+        }
+
+        assert(x != NULL);
+
+        std::vector<const ValueType*> xv(count);
+
+        for(int k = 0; k < count; ++k)
+        {
+            const HostVector<ValueType>* cast_x = dynamic_cast<const HostVector<ValueType>*>(x[k]);
+
+            assert(cast_x != NULL);
+            assert(this->size_ == cast_x->size_);
+
+            xv[k] = cast_x->vec_;
+        }
+
+        _set_omp_backend_threads(this->local_backend_, this->size_);
+
+        // Partial results of each thread, accumulated in thread order afterwards
+        int nthreads = omp_get_max_threads();
+
+        ValueType* partial = NULL;
+        allocate_host(nthreads * count, &partial);
+        set_to_zero_host(nthreads * count, partial);
+
+        // Block size, such that a block of this stays in cache while it is multiplied
+        // with all x[k] and this is read from memory only once
+        const int block = 2048;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            ValueType* dot = partial + omp_get_thread_num() * count;
+
+#ifdef _OPENMP
+#pragma omp for
+#endif
+            for(int ib = 0; ib < this->size_; ib += block)
+            {
+                int ie = std::min(ib + block, this->size_);
+
+                for(int k = 0; k < count; ++k)
+                {
+                    const ValueType* xk  = xv[k];
+                    ValueType        sum = static_cast<ValueType>(0);
+
+                    for(int i = ib; i < ie; ++i)
+                    {
+                        sum += rocalution_conj(xk[i]) * this->vec_[i];
+                    }
+
+                    dot[k] += sum;
+                }
+            }
+        }
+
+        for(int k = 0; k < count; ++k)
+        {
+            result[k] = static_cast<ValueType>(0);
+
+            for(int t = 0; t < nthreads; ++t)
+            {
+                result[k] += partial[t * count + k];
+            }
+        }
+
+        free_host(&partial);
+    }
+
+    template <typename ValueType>
+    void HostVector<ValueType>::MAXPY(int                                 count,
+                                      const BaseVector<ValueType>* const* x,
+                                      const ValueType*                    alpha)
+    {
+        assert(count >= 0);
+
+        if(count == 0)
+        {
+            return;
+        }
+
+        assert(x != NULL);
+        assert(alpha != NULL);
+
+        std::vector<const ValueType*> xv(count);
+
+        for(int k = 0; k < count; ++k)
+        {
+            const HostVector<ValueType>* cast_x = dynamic_cast<const HostVector<ValueType>*>(x[k]);
+
+            assert(cast_x != NULL);
+            assert(this->size_ == cast_x->size_);
+
+            xv[k] = cast_x->vec_;
+        }
+
+        _set_omp_backend_threads(this->local_backend_, this->size_);
+
+        // Block size, such that a block of this stays in cache while all updates are
+        // applied and this is read and written only once
+        const int block = 2048;
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int ib = 0; ib < this->size_; ib += block)
+        {
+            int ie = std::min(ib + block, this->size_);
+
+            for(int k = 0; k < count; ++k)
+            {
+                const ValueType* xk = xv[k];
+                ValueType        ak = alpha[k];
+
+                for(int i = ib; i < ie; ++i)
+                {
+                    this->vec_[i] += ak * xk[i];
+                }
+            }
+        }
+    }
+
     template <typename ValueType>
     int HostVector<ValueType>::Amax(ValueType& value) const
     {
@@ -112,6 +112,11 @@ namespace rocalution
         virtual ValueType Dot(const BaseVector<ValueType>& x) const;
         // this^T x
         virtual ValueType DotNonConj(const BaseVector<ValueType>& x) const;
+        // x[i]^H this, for all i
+        virtual void
+            MDot(int count, const BaseVector<ValueType>* const* x, ValueType* result) const;
+        // this = this + sum(alpha[i]*x[i])
+        virtual void MAXPY(int count, const BaseVector<ValueType>* const* x, const ValueType* alpha);
         // srqt(this^T this)
         virtual ValueType Norm(void) const;
         // reduce vector
@@ -166,6 +171,7 @@ namespace rocalution
         friend class HostMatrixDENSE<ValueType>;
         friend class HostMatrixMCSR<ValueType>;
         friend class HostMatrixBCSR<ValueType>;
+        friend class HostMatrixSELL<ValueType>;
 
         friend class HostMatrixCOO<float>;
         friend class HostMatrixCOO<double>;
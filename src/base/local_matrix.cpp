@@ -26,6 +26,8 @@
 #include "../utils/def.hpp"
 #include "../utils/log.hpp"
 #include "../utils/math_functions.hpp"
+#include "../utils/profiler.hpp"
+#include "../utils/time_functions.hpp"
 #include "backend_manager.hpp"
 #include "base_matrix.hpp"
 #include "base_vector.hpp"
@@ -36,8 +38,12 @@
 
 #include <algorithm>
 #include <complex>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <string.h>
+#include <tuple>
+#include <vector>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -46,6 +52,171 @@
 namespace rocalution
 {
 
+    // Estimated bytes moved by a product with the matrix, plus nvec additional vectors of
+    // the row dimension. The estimate is only computed while the profiler records regions.
+    template <typename ValueType>
+    static double local_matrix_spmv_bytes(const LocalMatrix<ValueType>& mat, int nvec)
+    {
+        if(_rocalution_profiler_active() == false)
+        {
+            return 0.0;
+        }
+
+        return _rocalution_profiler_spmv_bytes(mat.GetFormat(),
+                                               mat.GetM(),
+                                               mat.GetN(),
+                                               mat.GetNnz(),
+                                               mat.GetBlockDimension(),
+                                               sizeof(ValueType))
+               + static_cast<double>(nvec) * static_cast<double>(mat.GetM()) * sizeof(ValueType);
+    }
+
+    // Candidate storage format of LocalMatrix::ConvertToBest(), with the number of stored
+    // entries including padding and, for HYB, the entries of the COO part
+    struct local_matrix_format
+    {
+        unsigned int format;
+        int          blockdim;
+        int64_t      nnz;
+        int64_t      nnz_coo;
+    };
+
+    // Formats selected by LocalMatrix::ConvertToBest(), keyed by the row and column keys, the
+    // sizes, the precision, the backend and the selection parameters
+    typedef std::tuple<long int, long int, int64_t, int64_t, int64_t, size_t, bool, bool, double>
+        local_matrix_best_key;
+
+    static std::map<local_matrix_best_key, std::pair<unsigned int, int>> local_matrix_best_cache;
+    static std::mutex                                                    local_matrix_best_mutex;
+
+    // Estimated memory of a candidate format, which is also the traffic of a matrix-vector
+    // product without the vectors
+    static double local_matrix_format_bytes(const local_matrix_format&  fmt,
+                                            const MatrixStructureStats& stats,
+                                            size_t                      value_size)
+    {
+        double vec_bytes = static_cast<double>((stats.nrow + stats.ncol) * value_size);
+
+        if(fmt.format == HYB)
+        {
+            return _rocalution_profiler_spmv_bytes(
+                       ELL, stats.nrow, stats.ncol, fmt.nnz - fmt.nnz_coo, 1, value_size)
+                   + _rocalution_profiler_spmv_bytes(
+                       COO, stats.nrow, stats.ncol, fmt.nnz_coo, 1, value_size)
+                   - 2.0 * vec_bytes;
+        }
+
+        return _rocalution_profiler_spmv_bytes(
+                   fmt.format, stats.nrow, stats.ncol, fmt.nnz, fmt.blockdim, value_size)
+               - vec_bytes;
+    }
+
+    // Cost per byte of a matrix-vector product in a candidate format, relative to CSR. The
+    // accelerator kernels are memory bound for all formats. The host DIA, ELL, HYB and BCSR
+    // kernels are 1.2 to 5 times slower than CSR on Laplacian and random matrices, although
+    // they move less data, which is compensated by these factors.
+    static double local_matrix_format_cost(unsigned int format, bool host)
+    {
+        if(host == false)
+        {
+            return 1.0;
+        }
+
+        switch(format)
+        {
+        case BCSR:
+        case DIA:
+            return 4.0;
+        case ELL:
+        case HYB:
+            return 3.0;
+        default:
+            return 1.0;
+        }
+    }
+
+    // Formats the matrix can be converted to, following the limits of the host conversions
+    static std::vector<local_matrix_format>
+        local_matrix_best_candidates(const MatrixStructureStats& stats, bool host, bool benchmark)
+    {
+        std::vector<local_matrix_format> candidates;
+
+        local_matrix_format csr = {CSR, 1, stats.nnz, 0};
+        candidates.push_back(csr);
+
+        if(stats.nrow == stats.ncol)
+        {
+            local_matrix_format mcsr = {MCSR, 1, stats.nnz, 0};
+            candidates.push_back(mcsr);
+        }
+
+        for(int b = 0; b < 3; ++b)
+        {
+            int blockdim = b + 2;
+
+            if(stats.nnzb[b] > 0)
+            {
+                local_matrix_format bcsr = {BCSR, blockdim, stats.nnzb[b] * blockdim * blockdim, 0};
+                candidates.push_back(bcsr);
+            }
+        }
+
+        int64_t size = std::max(stats.nrow, stats.ncol);
+
+        if(stats.ndiag <= 5 * (stats.nnz / size))
+        {
+            local_matrix_format dia = {DIA, 1, stats.ndiag * size, 0};
+            candidates.push_back(dia);
+        }
+
+        if(stats.max_row_nnz <= 5 * (stats.nnz / stats.nrow))
+        {
+            local_matrix_format ell = {ELL, 1, stats.max_row_nnz * stats.nrow, 0};
+            candidates.push_back(ell);
+        }
+
+        int64_t ell_width = (stats.nnz - 1) / stats.nrow + 1;
+
+        local_matrix_format hyb
+            = {HYB, 1, ell_width * stats.nrow + stats.hyb_coo_nnz, stats.hyb_coo_nnz};
+        candidates.push_back(hyb);
+
+        // The padding of SELL depends on the slice size, it is only considered when timed
+        if(host == true && benchmark == true)
+        {
+            local_matrix_format sell = {SELL, 1, stats.nnz, 0};
+            candidates.push_back(sell);
+        }
+
+        return candidates;
+    }
+
+    // Minimum time of a few matrix-vector products, after a warm up product
+    template <typename ValueType>
+    static double local_matrix_time_spmv(const LocalMatrix<ValueType>& mat,
+                                         const LocalVector<ValueType>& in,
+                                         LocalVector<ValueType>*       out)
+    {
+        mat.Apply(in, out);
+
+        double best = 0.0;
+
+        for(int i = 0; i < 5; ++i)
+        {
+            _rocalution_sync();
+            double tick = rocalution_time();
+
+            mat.Apply(in, out);
+
+            _rocalution_sync();
+            double time = rocalution_time() - tick;
+
+            best = (i == 0 || time < best) ? time : best;
+        }
+
+        return best;
+    }
+
     template <typename ValueType>
     LocalMatrix<ValueType>::LocalMatrix()
     {
@@ -166,7 +337,8 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::AllocateCSR(const std::string& name, int nnz, int nrow, int ncol)
+    void LocalMatrix<ValueType>::AllocateCSR(
+        const std::string& name, PtrType nnz, int nrow, int ncol)
     {
         log_debug(this, "LocalMatrix::AllocateCSR()", name, nnz, nrow, ncol);
 
@@ -265,7 +437,8 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::AllocateCOO(const std::string& name, int nnz, int nrow, int ncol)
+    void LocalMatrix<ValueType>::AllocateCOO(
+        const std::string& name, PtrType nnz, int nrow, int ncol)
     {
         log_debug(this, "LocalMatrix::AllocateCOO()", name, nnz, nrow, ncol);
 
@@ -604,7 +777,7 @@ namespace rocalution
 
     template <typename ValueType>
     void LocalMatrix<ValueType>::SetDataPtrCOO(
-        int** row, int** col, ValueType** val, std::string name, int nnz, int nrow, int ncol)
+        int** row, int** col, ValueType** val, std::string name, PtrType nnz, int nrow, int ncol)
     {
         log_debug(this, "LocalMatrix::SetDataPtrCOO()", row, col, val, name, nnz, nrow, ncol);
 
@@ -659,8 +832,13 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::SetDataPtrCSR(
-        int** row_offset, int** col, ValueType** val, std::string name, int nnz, int nrow, int ncol)
+    void LocalMatrix<ValueType>::SetDataPtrCSR(PtrType**   row_offset,
+                                               int**       col,
+                                               ValueType** val,
+                                               std::string name,
+                                               PtrType     nnz,
+                                               int         nrow,
+                                               int         ncol)
     {
         log_debug(
             this, "LocalMatrix::SetDataPtrCSR()", row_offset, col, val, name, nnz, nrow, ncol);
@@ -694,7 +872,7 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::LeaveDataPtrCSR(int** row_offset, int** col, ValueType** val)
+    void LocalMatrix<ValueType>::LeaveDataPtrCSR(PtrType** row_offset, int** col, ValueType** val)
     {
         log_debug(this, "LocalMatrix::LeaveDataPtrCSR()", row_offset, col, val);
 
@@ -1017,7 +1195,7 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::CopyFromCSR(const int*       row_offsets,
+    void LocalMatrix<ValueType>::CopyFromCSR(const PtrType*   row_offsets,
                                              const int*       col,
                                              const ValueType* val)
     {
@@ -1041,7 +1219,7 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::CopyToCSR(int* row_offsets, int* col, ValueType* val) const
+    void LocalMatrix<ValueType>::CopyToCSR(PtrType* row_offsets, int* col, ValueType* val) const
     {
         log_debug(this, "LocalMatrix::CopyToCSR()", row_offsets, col, val);
 
@@ -1103,11 +1281,11 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::CopyFromHostCSR(const int*         row_offset,
+    void LocalMatrix<ValueType>::CopyFromHostCSR(const PtrType*     row_offset,
                                                  const int*         col,
                                                  const ValueType*   val,
                                                  const std::string& name,
-                                                 int                nnz,
+                                                 PtrType            nnz,
                                                  int                nrow,
                                                  int                ncol)
     {
@@ -1314,9 +1492,10 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::WriteFileCSR(const std::string& filename) const
+    void LocalMatrix<ValueType>::WriteFileCSR(const std::string& filename,
+                                              unsigned int       format) const
     {
-        log_debug(this, "LocalMatrix::WriteFileCSR()", filename);
+        log_debug(this, "LocalMatrix::WriteFileCSR()", filename, format);
 
         LOG_INFO("WriteFileCSR: filename=" << filename << "; writing...");
 
@@ -1324,7 +1503,7 @@ namespace rocalution
         this->Check();
 #endif
 
-        bool err = this->matrix_->WriteFileCSR(filename);
+        bool err = this->matrix_->WriteFileCSR(filename, format);
 
         if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
         {
@@ -1343,7 +1522,7 @@ namespace rocalution
             // Convert to CSR
             mat_host.ConvertToCSR();
 
-            if(mat_host.matrix_->WriteFileCSR(filename) == false)
+            if(mat_host.matrix_->WriteFileCSR(filename, format) == false)
             {
                 LOG_INFO("Execution of LocalMatrix::WriteFileCSR() failed");
                 mat_host.Info();
@@ -1447,7 +1626,7 @@ namespace rocalution
         bool is_accel = this->is_accel_();
         this->MoveToHost();
 
-        int*       mat_row_offset = NULL;
+        PtrType*   mat_row_offset = NULL;
         int*       mat_col        = NULL;
         ValueType* mat_val        = NULL;
 
@@ -1547,6 +1726,16 @@ namespace rocalution
 
         if((_rocalution_available_accelerator()) && (this->matrix_ == this->matrix_host_))
         {
+            // SELL is a host-only format
+            if(this->GetFormat() == SELL)
+            {
+                LOG_VERBOSE_INFO(2,
+                                 "*** warning: LocalMatrix::MoveToAccelerator() SELL is not "
+                                 "supported on the accelerator, converting to CSR");
+
+                this->ConvertToCSR();
+            }
+
             this->matrix_accel_ = _rocalution_init_base_backend_matrix<ValueType>(
                 this->local_backend_, this->GetFormat(), this->GetBlockDimension());
             this->matrix_accel_->CopyFrom(*this->matrix_host_);
@@ -1605,6 +1794,16 @@ namespace rocalution
 
         if((_rocalution_available_accelerator()) && (this->matrix_ == this->matrix_host_))
         {
+            // SELL is a host-only format
+            if(this->GetFormat() == SELL)
+            {
+                LOG_VERBOSE_INFO(2,
+                                 "*** warning: LocalMatrix::MoveToAcceleratorAsync() SELL is not "
+                                 "supported on the accelerator, converting to CSR");
+
+                this->ConvertToCSR();
+            }
+
             this->matrix_accel_ = _rocalution_init_base_backend_matrix<ValueType>(
                 this->local_backend_, this->GetFormat(), this->GetBlockDimension());
             this->matrix_accel_->CopyFromAsync(*this->matrix_host_);
@@ -1735,6 +1934,12 @@ namespace rocalution
         this->ConvertTo(HYB);
     }
 
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ConvertToSELL(void)
+    {
+        this->ConvertTo(SELL);
+    }
+
     template <typename ValueType>
     void LocalMatrix<ValueType>::ConvertToDENSE(void)
     {
@@ -1748,7 +1953,7 @@ namespace rocalution
 
         assert((matrix_format == DENSE) || (matrix_format == CSR) || (matrix_format == MCSR)
                || (matrix_format == BCSR) || (matrix_format == COO) || (matrix_format == DIA)
-               || (matrix_format == ELL) || (matrix_format == HYB));
+               || (matrix_format == ELL) || (matrix_format == HYB) || (matrix_format == SELL));
 
         LOG_VERBOSE_INFO(5,
                          "Converting " << _matrix_format_names[matrix_format] << " <- "
@@ -1802,6 +2007,16 @@ namespace rocalution
                 // Accelerator Matrix
                 assert(this->matrix_accel_ != NULL);
 
+                // SELL is a host-only format, keep the matrix in CSR format
+                if(matrix_format == SELL)
+                {
+                    LOG_VERBOSE_INFO(2,
+                                     "*** warning: LocalMatrix::ConvertTo() SELL is not supported "
+                                     "on the accelerator, keeping CSR format");
+
+                    return;
+                }
+
                 AcceleratorMatrix<ValueType>* new_mat;
                 new_mat = _rocalution_init_base_backend_matrix<ValueType>(
                     this->local_backend_, matrix_format, blockdim);
@@ -1831,12 +2046,193 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ConvertToBest(bool benchmark, double memory_budget)
+    {
+        log_debug(this, "LocalMatrix::ConvertToBest()", benchmark, memory_budget);
+
+        assert(memory_budget >= 1.0);
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() == 0)
+        {
+            return;
+        }
+
+        ProfilerRegion region("LocalMatrix::ConvertToBest");
+
+        // Matrices with the same sparsity pattern share the decision
+        long int row_key;
+        long int col_key;
+        long int val_key;
+
+        this->Key(row_key, col_key, val_key);
+
+        local_matrix_best_key key(row_key,
+                                  col_key,
+                                  this->GetM(),
+                                  this->GetN(),
+                                  this->GetNnz(),
+                                  sizeof(ValueType),
+                                  this->is_accel_(),
+                                  benchmark,
+                                  memory_budget);
+
+        unsigned int format   = CSR;
+        int          blockdim = 1;
+        bool         cached   = false;
+
+        {
+            std::lock_guard<std::mutex> lock(local_matrix_best_mutex);
+
+            std::map<local_matrix_best_key, std::pair<unsigned int, int>>::const_iterator it
+                = local_matrix_best_cache.find(key);
+
+            if(it != local_matrix_best_cache.end())
+            {
+                format   = it->second.first;
+                blockdim = it->second.second;
+                cached   = true;
+            }
+        }
+
+        if(cached == false)
+        {
+            MatrixStructureStats stats;
+
+            if(this->matrix_->StructureStats(&stats) == false)
+            {
+                // Compute the statistics on the host in CSR format
+                LocalMatrix<ValueType> mat_host;
+                mat_host.ConvertTo(this->GetFormat(), this->GetBlockDimension());
+                mat_host.CopyFrom(*this);
+
+                mat_host.ConvertToCSR();
+
+                if(mat_host.matrix_->StructureStats(&stats) == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::ConvertToBest() failed");
+                    mat_host.Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+            }
+
+            std::vector<local_matrix_format> candidates
+                = local_matrix_best_candidates(stats, this->is_host_(), benchmark);
+
+            // CSR is the first candidate
+            double csr_bytes = local_matrix_format_bytes(candidates[0], stats, sizeof(ValueType));
+            double max_bytes = memory_budget * csr_bytes;
+
+            if(benchmark == true)
+            {
+                LocalVector<ValueType> in;
+                LocalVector<ValueType> out;
+
+                in.CloneBackend(*this);
+                out.CloneBackend(*this);
+
+                in.Allocate("in", this->GetN());
+                out.Allocate("out", this->GetM());
+
+                in.Ones();
+
+                double best_time = 0.0;
+
+                for(size_t i = 0; i < candidates.size(); ++i)
+                {
+                    const local_matrix_format& fmt = candidates[i];
+
+                    if(local_matrix_format_bytes(fmt, stats, sizeof(ValueType)) > max_bytes)
+                    {
+                        continue;
+                    }
+
+                    LocalMatrix<ValueType> mat;
+                    mat.CloneFrom(*this);
+                    mat.ConvertTo(fmt.format, fmt.blockdim);
+
+                    // Skip formats the conversion has fallen back from, and formats whose
+                    // padding exceeds the budget
+                    if(mat.GetFormat() != fmt.format
+                       || _rocalution_profiler_spmv_bytes(fmt.format,
+                                                          mat.GetM(),
+                                                          mat.GetN(),
+                                                          mat.GetNnz(),
+                                                          fmt.blockdim,
+                                                          sizeof(ValueType))
+                                  - (mat.GetM() + mat.GetN()) * sizeof(ValueType)
+                              > max_bytes)
+                    {
+                        continue;
+                    }
+
+                    double time = local_matrix_time_spmv(mat, in, &out);
+
+                    LOG_VERBOSE_INFO(3,
+                                     "LocalMatrix::ConvertToBest() "
+                                         << _matrix_format_names[fmt.format] << " blockdim="
+                                         << fmt.blockdim << " SpMV time=" << time << " usec");
+
+                    // Keep CSR unless another format is at least 5% faster
+                    if(i == 0 || time < 0.95 * best_time)
+                    {
+                        format    = fmt.format;
+                        blockdim  = fmt.blockdim;
+                        best_time = time;
+                    }
+                }
+            }
+            else
+            {
+                // The product is memory bound, estimate its time by the memory traffic,
+                // weighted by the cost of the backend kernels, and keep CSR unless another
+                // format is estimated to be at least 10% faster
+                double best_cost = csr_bytes;
+
+                for(size_t i = 1; i < candidates.size(); ++i)
+                {
+                    const local_matrix_format& fmt = candidates[i];
+
+                    double bytes = local_matrix_format_bytes(fmt, stats, sizeof(ValueType));
+                    double cost  = bytes * local_matrix_format_cost(fmt.format, this->is_host_());
+
+                    if(bytes <= max_bytes && cost < 0.9 * best_cost)
+                    {
+                        format    = fmt.format;
+                        blockdim  = fmt.blockdim;
+                        best_cost = cost;
+                    }
+                }
+            }
+
+            LOG_VERBOSE_INFO(2,
+                             "LocalMatrix::ConvertToBest() selected "
+                                 << _matrix_format_names[format] << " blockdim=" << blockdim
+                                 << " (max row nnz=" << stats.max_row_nnz
+                                 << ", diagonals=" << stats.ndiag << ")");
+
+            std::lock_guard<std::mutex> lock(local_matrix_best_mutex);
+            local_matrix_best_cache[key] = std::make_pair(format, blockdim);
+        }
+
+        this->ConvertTo(format, blockdim);
+    }
+
     template <typename ValueType>
     void LocalMatrix<ValueType>::Apply(const LocalVector<ValueType>& in,
                                        LocalVector<ValueType>*       out) const
     {
         log_debug(this, "LocalMatrix::Apply()", (const void*&)in, out);
 
+        ProfilerRegion region("LocalMatrix::Apply",
+                              -1,
+                              local_matrix_spmv_bytes(*this, 0),
+                              2.0 * this->GetNnz());
+
         assert(out != NULL);
 
 #ifdef DEBUG_MODE
@@ -1864,6 +2260,11 @@ namespace rocalution
     {
         log_debug(this, "LocalMatrix::ApplyAdd()", (const void*&)in, scalar, out);
 
+        ProfilerRegion region("LocalMatrix::ApplyAdd",
+                              -1,
+                              local_matrix_spmv_bytes(*this, 1),
+                              2.0 * this->GetNnz() + this->GetM());
+
         assert(out != NULL);
 
 #ifdef DEBUG_MODE
@@ -1885,87 +2286,321 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::ExtractDiagonal(LocalVector<ValueType>* vec_diag) const
+    void LocalMatrix<ValueType>::ApplyTranspose(const LocalVector<ValueType>& in,
+                                                LocalVector<ValueType>*       out) const
     {
-        log_debug(this, "LocalMatrix::ExtractDiagonal()", vec_diag);
+        log_debug(this, "LocalMatrix::ApplyTranspose()", (const void*&)in, out);
 
-        assert(vec_diag != NULL);
+        ProfilerRegion region("LocalMatrix::ApplyTranspose",
+                              -1,
+                              local_matrix_spmv_bytes(*this, 0),
+                              2.0 * this->GetNnz());
 
-        assert(
-            ((this->matrix_ == this->matrix_host_) && (vec_diag->vector_ == vec_diag->vector_host_))
-            || ((this->matrix_ == this->matrix_accel_)
-                && (vec_diag->vector_ == vec_diag->vector_accel_)));
+        assert(out != NULL);
+        assert(&in != out);
+        assert(in.GetSize() == this->GetM());
+        assert(out->GetSize() == this->GetN());
+
+        assert(((this->matrix_ == this->matrix_host_) && (in.vector_ == in.vector_host_)
+                && (out->vector_ == out->vector_host_))
+               || ((this->matrix_ == this->matrix_accel_) && (in.vector_ == in.vector_accel_)
+                   && (out->vector_ == out->vector_accel_)));
 
 #ifdef DEBUG_MODE
         this->Check();
 #endif
 
-        if(this->GetNnz() > 0)
+        if(this->GetNnz() == 0)
         {
-            std::string vec_diag_name = "Diagonal elements of " + this->object_name_;
-            vec_diag->Allocate(vec_diag_name, std::min(this->GetLocalM(), this->GetLocalN()));
+            out->Zeros();
 
-            bool err = this->matrix_->ExtractDiagonal(vec_diag->vector_);
+            return;
+        }
 
-            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
-            {
-                LOG_INFO("Computation of LocalMatrix::ExtractDiagonal() failed");
-                this->Info();
-                FATAL_ERROR(__FILE__, __LINE__);
-            }
+        bool err = this->matrix_->ApplyTranspose(*in.vector_, out->vector_);
 
-            if(err == false)
-            {
-                LocalMatrix<ValueType> mat_host;
-                mat_host.ConvertTo(this->GetFormat(), this->GetBlockDimension());
-                mat_host.CopyFrom(*this);
+        if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+        {
+            LOG_INFO("Computation of LocalMatrix::ApplyTranspose() failed");
+            this->Info();
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
 
-                vec_diag->MoveToHost();
+        if(err == false)
+        {
+            // Move to host
+            LocalMatrix<ValueType> mat_host;
+            LocalVector<ValueType> vec_host;
 
-                mat_host.ConvertToCSR();
+            mat_host.ConvertTo(this->GetFormat(), this->GetBlockDimension());
+            mat_host.CopyFrom(*this);
+            vec_host.CopyFrom(in);
 
-                if(mat_host.matrix_->ExtractDiagonal(vec_diag->vector_) == false)
-                {
-                    LOG_INFO("Computation of LocalMatrix::ExtractDiagonal() failed");
-                    this->Info();
-                    FATAL_ERROR(__FILE__, __LINE__);
-                }
+            out->MoveToHost();
 
-                if(this->GetFormat() != CSR)
-                {
-                    LOG_VERBOSE_INFO(
-                        2,
-                        "*** warning: LocalMatrix::ExtractDiagonal() is performed in CSR format");
-                }
+            // Convert to CSR
+            mat_host.ConvertToCSR();
 
-                if(this->is_accel_() == true)
-                {
-                    LOG_VERBOSE_INFO(
-                        2, "*** warning: LocalMatrix::ExtractDiagonal() is performed on the host");
+            if(mat_host.matrix_->ApplyTranspose(*vec_host.vector_, out->vector_) == false)
+            {
+                LOG_INFO("Computation of LocalMatrix::ApplyTranspose() failed");
+                mat_host.Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
 
-                    vec_diag->MoveToAccelerator();
-                }
+            if(this->GetFormat() != CSR)
+            {
+                LOG_VERBOSE_INFO(
+                    2, "*** warning: LocalMatrix::ApplyTranspose() is performed in CSR format");
+            }
+
+            if(this->is_accel_() == true)
+            {
+                LOG_VERBOSE_INFO(
+                    2, "*** warning: LocalMatrix::ApplyTranspose() is performed on the host");
+
+                out->MoveToAccelerator();
             }
         }
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::ExtractInverseDiagonal(LocalVector<ValueType>* vec_inv_diag) const
+    bool LocalMatrix<ValueType>::ApplyRows_(const LocalVector<int>&       rows,
+                                            int                           start,
+                                            int                           end,
+                                            const LocalVector<ValueType>& in,
+                                            ValueType                     scalar,
+                                            bool                          add,
+                                            LocalVector<ValueType>*       out) const
     {
-        log_debug(this, "LocalMatrix::ExtractInverseDiagonal()", vec_inv_diag);
+        log_debug(
+            this, "LocalMatrix::ApplyRows_()", (const void*&)rows, start, end, scalar, add, out);
 
-        assert(vec_inv_diag != NULL);
+        assert(out != NULL);
+        assert(&in != out);
+        assert(in.GetSize() == this->GetN());
+        assert(out->GetSize() == this->GetM());
 
-        assert(((this->matrix_ == this->matrix_host_)
-                && (vec_inv_diag->vector_ == vec_inv_diag->vector_host_))
-               || ((this->matrix_ == this->matrix_accel_)
-                   && (vec_inv_diag->vector_ == vec_inv_diag->vector_accel_)));
+        if((this->is_host_() == false) || (rows.is_host_() == false) || (in.is_host_() == false)
+           || (out->is_host_() == false))
+        {
+            return false;
+        }
 
-#ifdef DEBUG_MODE
-        this->Check();
-#endif
+        return this->matrix_->ApplyRows(
+            *rows.vector_, start, end, *in.vector_, scalar, add, out->vector_);
+    }
 
-        if(this->GetNnz() > 0)
+    template <typename ValueType>
+    bool LocalMatrix<ValueType>::ApplyRowsGhost_(const LocalVector<int>&       rows,
+                                                 const LocalVector<int>&       ghost_offset,
+                                                 const LocalMatrix<ValueType>& ghost,
+                                                 const LocalVector<ValueType>& in,
+                                                 const LocalVector<ValueType>& ghost_in,
+                                                 ValueType                     scalar,
+                                                 bool                          add,
+                                                 LocalVector<ValueType>*       out) const
+    {
+        log_debug(this,
+                  "LocalMatrix::ApplyRowsGhost_()",
+                  (const void*&)rows,
+                  (const void*&)ghost_offset,
+                  (const void*&)ghost,
+                  scalar,
+                  add,
+                  out);
+
+        assert(out != NULL);
+        assert(&in != out);
+        assert(in.GetSize() == this->GetN());
+        assert(out->GetSize() == this->GetM());
+
+        if((this->is_host_() == false) || (ghost.is_host_() == false)
+           || (rows.is_host_() == false) || (ghost_offset.is_host_() == false)
+           || (in.is_host_() == false) || (ghost_in.is_host_() == false)
+           || (out->is_host_() == false))
+        {
+            return false;
+        }
+
+        return this->matrix_->ApplyRowsGhost(*rows.vector_,
+                                             *ghost_offset.vector_,
+                                             *ghost.matrix_,
+                                             *in.vector_,
+                                             *ghost_in.vector_,
+                                             scalar,
+                                             add,
+                                             out->vector_);
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::Residual(const LocalVector<ValueType>& rhs,
+                                          const LocalVector<ValueType>& in,
+                                          LocalVector<ValueType>*       res) const
+    {
+        log_debug(this, "LocalMatrix::Residual()", (const void*&)rhs, (const void*&)in, res);
+
+        ProfilerRegion region("LocalMatrix::Residual",
+                              -1,
+                              local_matrix_spmv_bytes(*this, 1),
+                              2.0 * this->GetNnz() + this->GetM());
+
+        assert(res != NULL);
+        assert(&in != res);
+        assert(in.GetSize() == this->GetN());
+        assert(rhs.GetSize() == this->GetM());
+        assert(res->GetSize() == this->GetM());
+
+        assert(((this->matrix_ == this->matrix_host_) && (rhs.vector_ == rhs.vector_host_)
+                && (in.vector_ == in.vector_host_) && (res->vector_ == res->vector_host_))
+               || ((this->matrix_ == this->matrix_accel_) && (rhs.vector_ == rhs.vector_accel_)
+                   && (in.vector_ == in.vector_accel_) && (res->vector_ == res->vector_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->matrix_->Residual(*rhs.vector_, *in.vector_, res->vector_) == false)
+        {
+            // Backend has no fused kernel, compute the residual in separate passes
+            this->Apply(in, res);
+            res->ScaleAdd(static_cast<ValueType>(-1), rhs);
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::JacobiSweep(const LocalVector<ValueType>& inv_diag,
+                                             const LocalVector<ValueType>& rhs,
+                                             ValueType                     omega,
+                                             const LocalVector<ValueType>& in,
+                                             LocalVector<ValueType>*       out) const
+    {
+        log_debug(this,
+                  "LocalMatrix::JacobiSweep()",
+                  (const void*&)inv_diag,
+                  (const void*&)rhs,
+                  omega,
+                  (const void*&)in,
+                  out);
+
+        ProfilerRegion region("LocalMatrix::JacobiSweep",
+                              -1,
+                              local_matrix_spmv_bytes(*this, 3),
+                              2.0 * this->GetNnz() + 3.0 * this->GetM());
+
+        assert(out != NULL);
+        assert(&in != out);
+        assert(this->GetM() == this->GetN());
+        assert(in.GetSize() == this->GetN());
+        assert(rhs.GetSize() == this->GetM());
+        assert(inv_diag.GetSize() == this->GetM());
+        assert(out->GetSize() == this->GetM());
+
+        assert(((this->matrix_ == this->matrix_host_) && (inv_diag.vector_ == inv_diag.vector_host_)
+                && (rhs.vector_ == rhs.vector_host_) && (in.vector_ == in.vector_host_)
+                && (out->vector_ == out->vector_host_))
+               || ((this->matrix_ == this->matrix_accel_)
+                   && (inv_diag.vector_ == inv_diag.vector_accel_)
+                   && (rhs.vector_ == rhs.vector_accel_) && (in.vector_ == in.vector_accel_)
+                   && (out->vector_ == out->vector_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->matrix_->JacobiSweep(
+               *inv_diag.vector_, *rhs.vector_, omega, *in.vector_, out->vector_)
+           == false)
+        {
+            // Backend has no fused kernel, perform the sweep in separate passes
+            this->Residual(rhs, in, out);
+            out->PointWiseMult(inv_diag);
+            out->ScaleAdd(omega, in);
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ExtractDiagonal(LocalVector<ValueType>* vec_diag) const
+    {
+        log_debug(this, "LocalMatrix::ExtractDiagonal()", vec_diag);
+
+        assert(vec_diag != NULL);
+
+        assert(
+            ((this->matrix_ == this->matrix_host_) && (vec_diag->vector_ == vec_diag->vector_host_))
+            || ((this->matrix_ == this->matrix_accel_)
+                && (vec_diag->vector_ == vec_diag->vector_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            std::string vec_diag_name = "Diagonal elements of " + this->object_name_;
+            vec_diag->Allocate(vec_diag_name, std::min(this->GetLocalM(), this->GetLocalN()));
+
+            bool err = this->matrix_->ExtractDiagonal(vec_diag->vector_);
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::ExtractDiagonal() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                LocalMatrix<ValueType> mat_host;
+                mat_host.ConvertTo(this->GetFormat(), this->GetBlockDimension());
+                mat_host.CopyFrom(*this);
+
+                vec_diag->MoveToHost();
+
+                mat_host.ConvertToCSR();
+
+                if(mat_host.matrix_->ExtractDiagonal(vec_diag->vector_) == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::ExtractDiagonal() failed");
+                    this->Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                if(this->GetFormat() != CSR)
+                {
+                    LOG_VERBOSE_INFO(
+                        2,
+                        "*** warning: LocalMatrix::ExtractDiagonal() is performed in CSR format");
+                }
+
+                if(this->is_accel_() == true)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::ExtractDiagonal() is performed on the host");
+
+                    vec_diag->MoveToAccelerator();
+                }
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ExtractInverseDiagonal(LocalVector<ValueType>* vec_inv_diag) const
+    {
+        log_debug(this, "LocalMatrix::ExtractInverseDiagonal()", vec_inv_diag);
+
+        assert(vec_inv_diag != NULL);
+
+        assert(((this->matrix_ == this->matrix_host_)
+                && (vec_inv_diag->vector_ == vec_inv_diag->vector_host_))
+               || ((this->matrix_ == this->matrix_accel_)
+                   && (vec_inv_diag->vector_ == vec_inv_diag->vector_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
         {
             std::string vec_inv_diag_name
                 = "Inverse of the diagonal elements of " + this->object_name_;
@@ -2374,6 +3009,103 @@ namespace rocalution
 #endif
     }
 
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ExtractL1BlockDiagonal(int                           block_size,
+                                                        LocalMatrix<ValueType>*       mat,
+                                                        const LocalMatrix<ValueType>* ghost) const
+    {
+        log_debug(this, "LocalMatrix::ExtractL1BlockDiagonal()", block_size, mat, ghost);
+
+        assert(block_size > 0);
+        assert(mat != NULL);
+        assert(mat != this);
+        assert(ghost != this);
+        assert(this->GetM() == this->GetN());
+
+        assert(((this->matrix_ == this->matrix_host_) && (mat->matrix_ == mat->matrix_host_))
+               || ((this->matrix_ == this->matrix_accel_) && (mat->matrix_ == mat->matrix_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            const BaseMatrix<ValueType>* ghost_mat = NULL;
+
+            if(ghost != NULL && ghost->GetNnz() > 0)
+            {
+                assert(ghost->GetM() == this->GetM());
+
+                ghost_mat = ghost->matrix_;
+            }
+
+            bool err = this->matrix_->ExtractL1BlockDiagonal(block_size, ghost_mat, mat->matrix_);
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR)
+               && (ghost_mat == NULL || (ghost->is_host_() == true && ghost->GetFormat() == CSR)))
+            {
+                LOG_INFO("Computation of LocalMatrix::ExtractL1BlockDiagonal() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                LocalMatrix<ValueType> mat_host;
+                mat_host.ConvertTo(this->GetFormat(), this->GetBlockDimension());
+                mat_host.CopyFrom(*this);
+
+                LocalMatrix<ValueType> ghost_host;
+
+                if(ghost_mat != NULL)
+                {
+                    ghost_host.ConvertTo(ghost->GetFormat(), ghost->GetBlockDimension());
+                    ghost_host.CopyFrom(*ghost);
+                    ghost_host.ConvertToCSR();
+
+                    ghost_mat = ghost_host.matrix_;
+                }
+
+                // Move to host
+                mat->MoveToHost();
+
+                // Convert to CSR
+                mat_host.ConvertToCSR();
+
+                if(mat_host.matrix_->ExtractL1BlockDiagonal(block_size, ghost_mat, mat->matrix_)
+                   == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::ExtractL1BlockDiagonal() failed");
+                    mat_host.Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                if(this->GetFormat() != CSR)
+                {
+                    LOG_VERBOSE_INFO(2,
+                                     "*** warning: LocalMatrix::ExtractL1BlockDiagonal() is "
+                                     "performed in CSR format");
+
+                    mat->ConvertTo(this->GetFormat(), this->GetBlockDimension());
+                }
+
+                if(this->is_accel_() == true)
+                {
+                    LOG_VERBOSE_INFO(2,
+                                     "*** warning: LocalMatrix::ExtractL1BlockDiagonal() is "
+                                     "performed on the host");
+
+                    mat->MoveToAccelerator();
+                }
+            }
+        }
+
+#ifdef DEBUG_MODE
+        mat->Check();
+#endif
+    }
+
     template <typename ValueType>
     void LocalMatrix<ValueType>::LUAnalyse(void)
     {
@@ -2402,6 +3134,11 @@ namespace rocalution
     {
         log_debug(this, "LocalMatrix::LUSolve()", (const void*&)in, out);
 
+        ProfilerRegion region("LocalMatrix::LUSolve",
+                              -1,
+                              local_matrix_spmv_bytes(*this, 0),
+                              2.0 * this->GetNnz());
+
         assert(out != NULL);
         assert(in.GetSize() == this->GetN());
         assert(out->GetSize() == this->GetM());
@@ -2497,6 +3234,11 @@ namespace rocalution
     {
         log_debug(this, "LocalMatrix::LLSolve()", (const void*&)in, out);
 
+        ProfilerRegion region("LocalMatrix::LLSolve",
+                              -1,
+                              2.0 * local_matrix_spmv_bytes(*this, 0),
+                              4.0 * this->GetNnz());
+
         assert(out != NULL);
         assert(in.GetSize() == this->GetN());
         assert(out->GetSize() == this->GetM());
@@ -2565,6 +3307,11 @@ namespace rocalution
     {
         log_debug(this, "LocalMatrix::LLSolve()", (const void*&)in, (const void*&)inv_diag, out);
 
+        ProfilerRegion region("LocalMatrix::LLSolve",
+                              -1,
+                              2.0 * local_matrix_spmv_bytes(*this, 1),
+                              4.0 * this->GetNnz());
+
         assert(out != NULL);
         assert(in.GetSize() == this->GetN());
         assert(out->GetSize() == this->GetM());
@@ -2661,6 +3408,11 @@ namespace rocalution
     {
         log_debug(this, "LocalMatrix::LSolve()", (const void*&)in, out);
 
+        ProfilerRegion region("LocalMatrix::LSolve",
+                              -1,
+                              local_matrix_spmv_bytes(*this, 0),
+                              static_cast<double>(this->GetNnz()));
+
         assert(out != NULL);
         assert(in.GetSize() == this->GetN());
         assert(out->GetSize() == this->GetM());
@@ -2750,6 +3502,11 @@ namespace rocalution
     {
         log_debug(this, "LocalMatrix::USolve()", (const void*&)in, out);
 
+        ProfilerRegion region("LocalMatrix::USolve",
+                              -1,
+                              local_matrix_spmv_bytes(*this, 0),
+                              static_cast<double>(this->GetNnz()));
+
         assert(out != NULL);
         assert(in.GetSize() == this->GetN());
         assert(out->GetSize() == this->GetM());
@@ -2816,6 +3573,8 @@ namespace rocalution
     {
         log_debug(this, "LocalMatrix::ILU0Factorize()");
 
+        ProfilerRegion region("LocalMatrix::ILU0Factorize");
+
 #ifdef DEBUG_MODE
         this->Check();
 #endif
@@ -2867,6 +3626,70 @@ namespace rocalution
             }
         }
 
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ItILU0Factorize(int sweeps)
+    {
+        log_debug(this, "LocalMatrix::ItILU0Factorize()", sweeps);
+
+        assert(sweeps > 0);
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            bool err = this->matrix_->ItILU0Factorize(sweeps);
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::ItILU0Factorize() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                // Move to host
+                bool is_accel = this->is_accel_();
+                this->MoveToHost();
+
+                // Convert to CSR
+                unsigned int format   = this->GetFormat();
+                int          blockdim = this->GetBlockDimension();
+                this->ConvertToCSR();
+
+                if(this->matrix_->ItILU0Factorize(sweeps) == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::ItILU0Factorize() failed");
+                    this->Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                if(format != CSR)
+                {
+                    LOG_VERBOSE_INFO(2,
+                                     "*** warning: LocalMatrix::ItILU0Factorize() is performed in "
+                                     "CSR format");
+
+                    this->ConvertTo(format, blockdim);
+                }
+
+                if(is_accel == true)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::ItILU0Factorize() is performed on the host");
+
+                    this->MoveToAccelerator();
+                }
+            }
+        }
+
 #ifdef DEBUG_MODE
         this->Check();
 #endif
@@ -3047,24 +3870,96 @@ namespace rocalution
                             FATAL_ERROR(__FILE__, __LINE__);
                         }
 
-                        if(format != CSR)
-                        {
-                            LOG_VERBOSE_INFO(2,
-                                             "*** warning: LocalMatrix::ILUpFactorize() is "
-                                             "performed in CSR format");
+                        if(format != CSR)
+                        {
+                            LOG_VERBOSE_INFO(2,
+                                             "*** warning: LocalMatrix::ILUpFactorize() is "
+                                             "performed in CSR format");
+
+                            this->ConvertTo(format, blockdim);
+                        }
+
+                        if(is_accel == true)
+                        {
+                            LOG_VERBOSE_INFO(2,
+                                             "*** warning: LocalMatrix::ILUpFactorize() is "
+                                             "performed on the host");
+
+                            this->MoveToAccelerator();
+                        }
+                    }
+                }
+            }
+        }
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ICFactorize(LocalVector<ValueType>* inv_diag)
+    {
+        log_debug(this, "LocalMatrix::ICFactorize()", inv_diag);
+
+        ProfilerRegion region("LocalMatrix::ICFactorize");
+
+        assert(inv_diag != NULL);
+
+        assert(
+            ((this->matrix_ == this->matrix_host_) && (inv_diag->vector_ == inv_diag->vector_host_))
+            || ((this->matrix_ == this->matrix_accel_)
+                && (inv_diag->vector_ == inv_diag->vector_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            bool err = this->matrix_->ICFactorize(inv_diag->vector_);
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::ICFactorize() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                // Move to host
+                bool is_accel = this->is_accel_();
+                this->MoveToHost();
+                inv_diag->MoveToHost();
+
+                // Convert to CSR
+                unsigned int format   = this->GetFormat();
+                int          blockdim = this->GetBlockDimension();
+                this->ConvertToCSR();
+
+                if(this->matrix_->ICFactorize(inv_diag->vector_) == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::ICFactorize() failed");
+                    this->Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                if(format != CSR)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::ICFactorize() is performed in CSR format");
 
-                            this->ConvertTo(format, blockdim);
-                        }
+                    this->ConvertTo(format, blockdim);
+                }
 
-                        if(is_accel == true)
-                        {
-                            LOG_VERBOSE_INFO(2,
-                                             "*** warning: LocalMatrix::ILUpFactorize() is "
-                                             "performed on the host");
+                if(is_accel == true)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::ICFactorize() is performed on the host");
 
-                            this->MoveToAccelerator();
-                        }
-                    }
+                    this->MoveToAccelerator();
+                    inv_diag->MoveToAccelerator();
                 }
             }
         }
@@ -3075,11 +3970,12 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::ICFactorize(LocalVector<ValueType>* inv_diag)
+    void LocalMatrix<ValueType>::ItICFactorize(LocalVector<ValueType>* inv_diag, int sweeps)
     {
-        log_debug(this, "LocalMatrix::ICFactorize()", inv_diag);
+        log_debug(this, "LocalMatrix::ItICFactorize()", inv_diag, sweeps);
 
         assert(inv_diag != NULL);
+        assert(sweeps > 0);
 
         assert(
             ((this->matrix_ == this->matrix_host_) && (inv_diag->vector_ == inv_diag->vector_host_))
@@ -3092,11 +3988,11 @@ namespace rocalution
 
         if(this->GetNnz() > 0)
         {
-            bool err = this->matrix_->ICFactorize(inv_diag->vector_);
+            bool err = this->matrix_->ItICFactorize(inv_diag->vector_, sweeps);
 
             if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
             {
-                LOG_INFO("Computation of LocalMatrix::ICFactorize() failed");
+                LOG_INFO("Computation of LocalMatrix::ItICFactorize() failed");
                 this->Info();
                 FATAL_ERROR(__FILE__, __LINE__);
             }
@@ -3113,9 +4009,9 @@ namespace rocalution
                 int          blockdim = this->GetBlockDimension();
                 this->ConvertToCSR();
 
-                if(this->matrix_->ICFactorize(inv_diag->vector_) == false)
+                if(this->matrix_->ItICFactorize(inv_diag->vector_, sweeps) == false)
                 {
-                    LOG_INFO("Computation of LocalMatrix::ICFactorize() failed");
+                    LOG_INFO("Computation of LocalMatrix::ItICFactorize() failed");
                     this->Info();
                     FATAL_ERROR(__FILE__, __LINE__);
                 }
@@ -3123,7 +4019,7 @@ namespace rocalution
                 if(format != CSR)
                 {
                     LOG_VERBOSE_INFO(
-                        2, "*** warning: LocalMatrix::ICFactorize() is performed in CSR format");
+                        2, "*** warning: LocalMatrix::ItICFactorize() is performed in CSR format");
 
                     this->ConvertTo(format, blockdim);
                 }
@@ -3131,7 +4027,7 @@ namespace rocalution
                 if(is_accel == true)
                 {
                     LOG_VERBOSE_INFO(
-                        2, "*** warning: LocalMatrix::ICFactorize() is performed on the host");
+                        2, "*** warning: LocalMatrix::ItICFactorize() is performed on the host");
 
                     this->MoveToAccelerator();
                     inv_diag->MoveToAccelerator();
@@ -3894,6 +4790,76 @@ namespace rocalution
         permutation->object_name_ = vec_name;
     }
 
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::MinimumDegree(LocalVector<int>* permutation) const
+    {
+        log_debug(this, "LocalMatrix::MinimumDegree()", permutation);
+
+        assert(permutation != NULL);
+
+        assert(((this->matrix_ == this->matrix_host_)
+                && (permutation->vector_ == permutation->vector_host_))
+               || ((this->matrix_ == this->matrix_accel_)
+                   && (permutation->vector_ == permutation->vector_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            bool err = this->matrix_->MinimumDegree(permutation->vector_);
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::MinimumDegree() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                LocalMatrix<ValueType> mat_host;
+                mat_host.ConvertTo(this->GetFormat(), this->GetBlockDimension());
+                mat_host.CopyFrom(*this);
+
+                // Move to host
+                permutation->MoveToHost();
+
+                // Convert to CSR
+                mat_host.ConvertToCSR();
+
+                if(mat_host.matrix_->MinimumDegree(permutation->vector_) == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::MinimumDegree() failed");
+                    mat_host.Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                if(this->GetFormat() != CSR)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::MinimumDegree() is performed in CSR format");
+                }
+
+                if(this->is_accel_() == true)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::MinimumDegree() is performed on the host");
+
+                    permutation->MoveToAccelerator();
+                }
+            }
+        }
+
+        std::string vec_name      = "MinimumDegree permutation of " + this->object_name_;
+        permutation->object_name_ = vec_name;
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+    }
+
     template <typename ValueType>
     void LocalMatrix<ValueType>::SymbolicPower(int p)
     {
@@ -3952,6 +4918,67 @@ namespace rocalution
             }
         }
 
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::SymbolicLU(void)
+    {
+        log_debug(this, "LocalMatrix::SymbolicLU()");
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            bool err = this->matrix_->SymbolicLU();
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::SymbolicLU() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                // Move to host
+                bool is_accel = this->is_accel_();
+                this->MoveToHost();
+
+                // Convert to CSR
+                unsigned int format   = this->GetFormat();
+                int          blockdim = this->GetBlockDimension();
+                this->ConvertToCSR();
+
+                if(this->matrix_->SymbolicLU() == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::SymbolicLU() failed");
+                    this->Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                if(format != CSR)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::SymbolicLU() is performed in CSR format");
+
+                    this->ConvertTo(format, blockdim);
+                }
+
+                if(is_accel == true)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::SymbolicLU() is performed on the host");
+
+                    this->MoveToAccelerator();
+                }
+            }
+        }
+
 #ifdef DEBUG_MODE
         this->Check();
 #endif
@@ -4412,35 +5439,204 @@ namespace rocalution
                 bool is_accel = this->is_accel_();
                 this->MoveToHost();
 
-                // Convert to CSR
-                unsigned int format   = this->GetFormat();
-                int          blockdim = this->GetBlockDimension();
-                this->ConvertToCSR();
+                // Convert to CSR
+                unsigned int format   = this->GetFormat();
+                int          blockdim = this->GetBlockDimension();
+                this->ConvertToCSR();
+
+                if(this->matrix_->AddScalarOffDiagonal(alpha) == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::AddScalarOffDiagonal() failed");
+                    this->Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                if(format != CSR)
+                {
+                    LOG_VERBOSE_INFO(2,
+                                     "*** warning: LocalMatrix::AddScalarOffDiagonal() is "
+                                     "performed in CSR format");
+
+                    this->ConvertTo(format, blockdim);
+                }
+
+                if(is_accel == true)
+                {
+                    LOG_VERBOSE_INFO(2,
+                                     "*** warning: LocalMatrix::AddScalarOffDiagonal() is "
+                                     "performed on the host");
+
+                    this->MoveToAccelerator();
+                }
+            }
+        }
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::TripleMatrixMult(const LocalMatrix<ValueType>& R,
+                                                  const LocalMatrix<ValueType>& A,
+                                                  const LocalMatrix<ValueType>& P)
+    {
+        log_debug(
+            this, "LocalMatrix::TripleMatrixMult()", (const void*&)R, (const void*&)A, (const void*&)P);
+
+        ProfilerRegion region("LocalMatrix::TripleMatrixMult");
+
+        assert(&R != this);
+        assert(&A != this);
+        assert(&P != this);
+        assert(R.GetN() == A.GetM());
+        assert(A.GetN() == P.GetM());
+
+        assert(((this->matrix_ == this->matrix_host_) && (R.matrix_ == R.matrix_host_)
+                && (A.matrix_ == A.matrix_host_) && (P.matrix_ == P.matrix_host_))
+               || ((this->matrix_ == this->matrix_accel_) && (R.matrix_ == R.matrix_accel_)
+                   && (A.matrix_ == A.matrix_accel_) && (P.matrix_ == P.matrix_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+        R.Check();
+        A.Check();
+        P.Check();
+#endif
+
+        this->Clear();
+
+        this->object_name_ = R.object_name_ + " x " + A.object_name_ + " x " + P.object_name_;
+        this->ConvertToCSR();
+
+        bool err = this->matrix_->TripleMatMult(*R.matrix_, *A.matrix_, *P.matrix_);
+
+        if((err == false) && (this->is_host_() == true) && (R.GetFormat() == CSR)
+           && (A.GetFormat() == CSR) && (P.GetFormat() == CSR))
+        {
+            LOG_INFO("Computation of LocalMatrix::TripleMatrixMult() failed");
+            this->Info();
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        if((err == false) && (this->is_accel_() == true))
+        {
+            // Two matrix products on the accelerator
+            LocalMatrix<ValueType> RA;
+            RA.CloneBackend(*this);
+
+            RA.MatrixMult(R, A);
+            this->MatrixMult(RA, P);
+        }
+        else if(err == false)
+        {
+            LocalMatrix<ValueType> R_csr;
+            LocalMatrix<ValueType> A_csr;
+            LocalMatrix<ValueType> P_csr;
+            R_csr.CloneFrom(R);
+            A_csr.CloneFrom(A);
+            P_csr.CloneFrom(P);
+
+            R_csr.ConvertToCSR();
+            A_csr.ConvertToCSR();
+            P_csr.ConvertToCSR();
+
+            LOG_VERBOSE_INFO(2,
+                             "*** warning: LocalMatrix::TripleMatrixMult() is performed in CSR "
+                             "format");
+
+            if(this->matrix_->TripleMatMult(*R_csr.matrix_, *A_csr.matrix_, *P_csr.matrix_)
+               == false)
+            {
+                LOG_INFO("Computation of LocalMatrix::TripleMatrixMult() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+        }
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::NumericTripleMatrixMult(const LocalMatrix<ValueType>& R,
+                                                         const LocalMatrix<ValueType>& A,
+                                                         const LocalMatrix<ValueType>& P)
+    {
+        log_debug(this,
+                  "LocalMatrix::NumericTripleMatrixMult()",
+                  (const void*&)R,
+                  (const void*&)A,
+                  (const void*&)P);
+
+        assert(&R != this);
+        assert(&A != this);
+        assert(&P != this);
+        assert(R.GetN() == A.GetM());
+        assert(A.GetN() == P.GetM());
+        assert(this->GetM() == R.GetM());
+        assert(this->GetN() == P.GetN());
+        assert(this->GetFormat() == CSR);
+
+        assert(((this->matrix_ == this->matrix_host_) && (R.matrix_ == R.matrix_host_)
+                && (A.matrix_ == A.matrix_host_) && (P.matrix_ == P.matrix_host_))
+               || ((this->matrix_ == this->matrix_accel_) && (R.matrix_ == R.matrix_accel_)
+                   && (A.matrix_ == A.matrix_accel_) && (P.matrix_ == P.matrix_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+        R.Check();
+        A.Check();
+        P.Check();
+#endif
+
+        bool err = this->matrix_->NumericTripleMatMult(*R.matrix_, *A.matrix_, *P.matrix_);
+
+        if((err == false) && (this->is_host_() == true) && (R.GetFormat() == CSR)
+           && (A.GetFormat() == CSR) && (P.GetFormat() == CSR))
+        {
+            LOG_INFO("Computation of LocalMatrix::NumericTripleMatrixMult() failed");
+            this->Info();
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        if(err == false)
+        {
+            LocalMatrix<ValueType> R_host;
+            LocalMatrix<ValueType> A_host;
+            LocalMatrix<ValueType> P_host;
+            R_host.ConvertTo(R.GetFormat(), R.GetBlockDimension());
+            A_host.ConvertTo(A.GetFormat(), A.GetBlockDimension());
+            P_host.ConvertTo(P.GetFormat(), P.GetBlockDimension());
+            R_host.CopyFrom(R);
+            A_host.CopyFrom(A);
+            P_host.CopyFrom(P);
+
+            R_host.ConvertToCSR();
+            A_host.ConvertToCSR();
+            P_host.ConvertToCSR();
 
-                if(this->matrix_->AddScalarOffDiagonal(alpha) == false)
-                {
-                    LOG_INFO("Computation of LocalMatrix::AddScalarOffDiagonal() failed");
-                    this->Info();
-                    FATAL_ERROR(__FILE__, __LINE__);
-                }
+            bool accel = this->is_accel_();
 
-                if(format != CSR)
-                {
-                    LOG_VERBOSE_INFO(2,
-                                     "*** warning: LocalMatrix::AddScalarOffDiagonal() is "
-                                     "performed in CSR format");
+            this->MoveToHost();
 
-                    this->ConvertTo(format, blockdim);
-                }
+            if(this->matrix_->NumericTripleMatMult(
+                   *R_host.matrix_, *A_host.matrix_, *P_host.matrix_)
+               == false)
+            {
+                LOG_INFO("Computation of LocalMatrix::NumericTripleMatrixMult() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
 
-                if(is_accel == true)
-                {
-                    LOG_VERBOSE_INFO(2,
-                                     "*** warning: LocalMatrix::AddScalarOffDiagonal() is "
-                                     "performed on the host");
+            if(accel == true)
+            {
+                LOG_VERBOSE_INFO(
+                    2,
+                    "*** warning: LocalMatrix::NumericTripleMatrixMult() is performed on the host");
 
-                    this->MoveToAccelerator();
-                }
+                this->MoveToAccelerator();
             }
         }
 
@@ -4455,6 +5651,8 @@ namespace rocalution
     {
         log_debug(this, "LocalMatrix::AddScalarDiagonal()", (const void*&)A, (const void*&)B);
 
+        ProfilerRegion region("LocalMatrix::MatrixMult");
+
         assert(&A != this);
         assert(&B != this);
         assert(A.GetN() == B.GetM());
@@ -5550,6 +6748,394 @@ namespace rocalution
         S->object_name_     = S_name;
     }
 
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::RSPMISStrongInfluences(float                         eps,
+                                                        LocalVector<bool>*            S,
+                                                        LocalVector<float>*           omega,
+                                                        unsigned long long            seed,
+                                                        const LocalMatrix<ValueType>& ghost) const
+    {
+        log_debug(this,
+                  "LocalMatrix::RSPMISStrongInfluences()",
+                  eps,
+                  S,
+                  omega,
+                  seed,
+                  (const void*&)ghost);
+
+        assert(eps < 1.0f);
+        assert(eps > 0.0f);
+        assert(S != NULL);
+        assert(omega != NULL);
+
+        assert(((this->matrix_ == this->matrix_host_) && (S->vector_ == S->vector_host_)
+                && (omega->vector_ == omega->vector_host_)
+                && (ghost.matrix_ == ghost.matrix_host_))
+               || ((this->matrix_ == this->matrix_accel_) && (S->vector_ == S->vector_accel_)
+                   && (omega->vector_ == omega->vector_accel_)
+                   && (ghost.matrix_ == ghost.matrix_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+        ghost.Check();
+#endif
+
+        bool err = this->matrix_->RSPMISStrongInfluences(
+            eps, S->vector_, omega->vector_, seed, *ghost.matrix_);
+
+        if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR)
+           && (ghost.GetFormat() == CSR))
+        {
+            LOG_INFO("Computation of LocalMatrix::RSPMISStrongInfluences() failed");
+            this->Info();
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        if(err == false)
+        {
+            LocalMatrix<ValueType> mat_host;
+            LocalMatrix<ValueType> gst_host;
+
+            mat_host.ConvertTo(this->GetFormat());
+            gst_host.ConvertTo(ghost.GetFormat());
+
+            mat_host.CopyFrom(*this);
+            gst_host.CopyFrom(ghost);
+
+            // Move to host
+            S->MoveToHost();
+            omega->MoveToHost();
+
+            // Convert to CSR
+            mat_host.ConvertToCSR();
+            gst_host.ConvertToCSR();
+
+            if(mat_host.matrix_->RSPMISStrongInfluences(
+                   eps, S->vector_, omega->vector_, seed, *gst_host.matrix_)
+               == false)
+            {
+                LOG_INFO("Computation of LocalMatrix::RSPMISStrongInfluences() failed");
+                mat_host.Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(this->GetFormat() != CSR)
+            {
+                LOG_VERBOSE_INFO(2,
+                                 "*** warning: LocalMatrix::RSPMISStrongInfluences() is performed "
+                                 "in CSR format");
+            }
+
+            if(this->is_accel_() == true)
+            {
+                LOG_VERBOSE_INFO(2,
+                                 "*** warning: LocalMatrix::RSPMISStrongInfluences() is performed "
+                                 "on the host");
+
+                S->MoveToAccelerator();
+                omega->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::RSPMISUnassignedToCoarse(LocalVector<int>*         CFmap,
+                                                          LocalVector<bool>*        marked,
+                                                          const LocalVector<float>& omega) const
+    {
+        log_debug(this,
+                  "LocalMatrix::RSPMISUnassignedToCoarse()",
+                  CFmap,
+                  marked,
+                  (const void*&)omega);
+
+        assert(CFmap != NULL);
+        assert(marked != NULL);
+
+        assert(((this->matrix_ == this->matrix_host_) && (CFmap->vector_ == CFmap->vector_host_)
+                && (marked->vector_ == marked->vector_host_)
+                && (omega.vector_ == omega.vector_host_))
+               || ((this->matrix_ == this->matrix_accel_)
+                   && (CFmap->vector_ == CFmap->vector_accel_)
+                   && (marked->vector_ == marked->vector_accel_)
+                   && (omega.vector_ == omega.vector_accel_)));
+
+        bool err = this->matrix_->RSPMISUnassignedToCoarse(
+            CFmap->vector_, marked->vector_, *omega.vector_);
+
+        if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+        {
+            LOG_INFO("Computation of LocalMatrix::RSPMISUnassignedToCoarse() failed");
+            this->Info();
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        if(err == false)
+        {
+            LocalMatrix<ValueType> mat_host;
+            LocalVector<float>     omega_host;
+
+            mat_host.ConvertTo(this->GetFormat());
+            mat_host.CopyFrom(*this);
+            omega_host.CopyFrom(omega);
+
+            // Move to host
+            CFmap->MoveToHost();
+            marked->MoveToHost();
+
+            // Convert to CSR
+            mat_host.ConvertToCSR();
+
+            if(mat_host.matrix_->RSPMISUnassignedToCoarse(
+                   CFmap->vector_, marked->vector_, *omega_host.vector_)
+               == false)
+            {
+                LOG_INFO("Computation of LocalMatrix::RSPMISUnassignedToCoarse() failed");
+                mat_host.Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(this->GetFormat() != CSR)
+            {
+                LOG_VERBOSE_INFO(2,
+                                 "*** warning: LocalMatrix::RSPMISUnassignedToCoarse() is "
+                                 "performed in CSR format");
+            }
+
+            if(this->is_accel_() == true)
+            {
+                LOG_VERBOSE_INFO(2,
+                                 "*** warning: LocalMatrix::RSPMISUnassignedToCoarse() is "
+                                 "performed on the host");
+
+                CFmap->MoveToAccelerator();
+                marked->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::RSPMISCorrectCoarse(LocalVector<int>*             CFmap,
+                                                     const LocalVector<bool>&      S,
+                                                     const LocalVector<bool>&      marked,
+                                                     const LocalVector<float>&     omega,
+                                                     const LocalMatrix<ValueType>& ghost) const
+    {
+        log_debug(this,
+                  "LocalMatrix::RSPMISCorrectCoarse()",
+                  CFmap,
+                  (const void*&)S,
+                  (const void*&)marked,
+                  (const void*&)omega,
+                  (const void*&)ghost);
+
+        assert(CFmap != NULL);
+
+        assert(((this->matrix_ == this->matrix_host_) && (CFmap->vector_ == CFmap->vector_host_)
+                && (S.vector_ == S.vector_host_) && (marked.vector_ == marked.vector_host_)
+                && (omega.vector_ == omega.vector_host_)
+                && (ghost.matrix_ == ghost.matrix_host_))
+               || ((this->matrix_ == this->matrix_accel_)
+                   && (CFmap->vector_ == CFmap->vector_accel_) && (S.vector_ == S.vector_accel_)
+                   && (marked.vector_ == marked.vector_accel_)
+                   && (omega.vector_ == omega.vector_accel_)
+                   && (ghost.matrix_ == ghost.matrix_accel_)));
+
+        bool err = this->matrix_->RSPMISCorrectCoarse(
+            CFmap->vector_, *S.vector_, *marked.vector_, *omega.vector_, *ghost.matrix_);
+
+        if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR)
+           && (ghost.GetFormat() == CSR))
+        {
+            LOG_INFO("Computation of LocalMatrix::RSPMISCorrectCoarse() failed");
+            this->Info();
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        if(err == false)
+        {
+            LocalMatrix<ValueType> mat_host;
+            LocalMatrix<ValueType> gst_host;
+            LocalVector<bool>      S_host;
+            LocalVector<bool>      marked_host;
+            LocalVector<float>     omega_host;
+
+            mat_host.ConvertTo(this->GetFormat());
+            gst_host.ConvertTo(ghost.GetFormat());
+
+            mat_host.CopyFrom(*this);
+            gst_host.CopyFrom(ghost);
+            S_host.CopyFrom(S);
+            marked_host.CopyFrom(marked);
+            omega_host.CopyFrom(omega);
+
+            // Move to host
+            CFmap->MoveToHost();
+
+            // Convert to CSR
+            mat_host.ConvertToCSR();
+            gst_host.ConvertToCSR();
+
+            if(mat_host.matrix_->RSPMISCorrectCoarse(CFmap->vector_,
+                                                     *S_host.vector_,
+                                                     *marked_host.vector_,
+                                                     *omega_host.vector_,
+                                                     *gst_host.matrix_)
+               == false)
+            {
+                LOG_INFO("Computation of LocalMatrix::RSPMISCorrectCoarse() failed");
+                mat_host.Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(this->GetFormat() != CSR)
+            {
+                LOG_VERBOSE_INFO(
+                    2,
+                    "*** warning: LocalMatrix::RSPMISCorrectCoarse() is performed in CSR format");
+            }
+
+            if(this->is_accel_() == true)
+            {
+                LOG_VERBOSE_INFO(
+                    2, "*** warning: LocalMatrix::RSPMISCorrectCoarse() is performed on the host");
+
+                CFmap->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::RSPMISCoarseEdgesToFine(LocalVector<int>*             CFmap,
+                                                         const LocalVector<bool>&      S,
+                                                         const LocalMatrix<ValueType>& ghost) const
+    {
+        log_debug(this,
+                  "LocalMatrix::RSPMISCoarseEdgesToFine()",
+                  CFmap,
+                  (const void*&)S,
+                  (const void*&)ghost);
+
+        assert(CFmap != NULL);
+
+        assert(((this->matrix_ == this->matrix_host_) && (CFmap->vector_ == CFmap->vector_host_)
+                && (S.vector_ == S.vector_host_) && (ghost.matrix_ == ghost.matrix_host_))
+               || ((this->matrix_ == this->matrix_accel_)
+                   && (CFmap->vector_ == CFmap->vector_accel_) && (S.vector_ == S.vector_accel_)
+                   && (ghost.matrix_ == ghost.matrix_accel_)));
+
+        bool err
+            = this->matrix_->RSPMISCoarseEdgesToFine(CFmap->vector_, *S.vector_, *ghost.matrix_);
+
+        if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR)
+           && (ghost.GetFormat() == CSR))
+        {
+            LOG_INFO("Computation of LocalMatrix::RSPMISCoarseEdgesToFine() failed");
+            this->Info();
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        if(err == false)
+        {
+            LocalMatrix<ValueType> mat_host;
+            LocalMatrix<ValueType> gst_host;
+            LocalVector<bool>      S_host;
+
+            mat_host.ConvertTo(this->GetFormat());
+            gst_host.ConvertTo(ghost.GetFormat());
+
+            mat_host.CopyFrom(*this);
+            gst_host.CopyFrom(ghost);
+            S_host.CopyFrom(S);
+
+            // Move to host
+            CFmap->MoveToHost();
+
+            // Convert to CSR
+            mat_host.ConvertToCSR();
+            gst_host.ConvertToCSR();
+
+            if(mat_host.matrix_->RSPMISCoarseEdgesToFine(
+                   CFmap->vector_, *S_host.vector_, *gst_host.matrix_)
+               == false)
+            {
+                LOG_INFO("Computation of LocalMatrix::RSPMISCoarseEdgesToFine() failed");
+                mat_host.Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(this->GetFormat() != CSR)
+            {
+                LOG_VERBOSE_INFO(2,
+                                 "*** warning: LocalMatrix::RSPMISCoarseEdgesToFine() is "
+                                 "performed in CSR format");
+            }
+
+            if(this->is_accel_() == true)
+            {
+                LOG_VERBOSE_INFO(2,
+                                 "*** warning: LocalMatrix::RSPMISCoarseEdgesToFine() is "
+                                 "performed on the host");
+
+                CFmap->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::RSPMISCheckUndecided(bool&                   undecided,
+                                                      const LocalVector<int>& CFmap) const
+    {
+        log_debug(this, "LocalMatrix::RSPMISCheckUndecided()", undecided, (const void*&)CFmap);
+
+        assert(((this->matrix_ == this->matrix_host_) && (CFmap.vector_ == CFmap.vector_host_))
+               || ((this->matrix_ == this->matrix_accel_)
+                   && (CFmap.vector_ == CFmap.vector_accel_)));
+
+        bool err = this->matrix_->RSPMISCheckUndecided(undecided, *CFmap.vector_);
+
+        if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+        {
+            LOG_INFO("Computation of LocalMatrix::RSPMISCheckUndecided() failed");
+            this->Info();
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        if(err == false)
+        {
+            LocalMatrix<ValueType> mat_host;
+            LocalVector<int>       CFmap_host;
+
+            mat_host.ConvertTo(this->GetFormat());
+            mat_host.CopyFrom(*this);
+            CFmap_host.CopyFrom(CFmap);
+
+            // Convert to CSR
+            mat_host.ConvertToCSR();
+
+            if(mat_host.matrix_->RSPMISCheckUndecided(undecided, *CFmap_host.vector_) == false)
+            {
+                LOG_INFO("Computation of LocalMatrix::RSPMISCheckUndecided() failed");
+                mat_host.Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(this->GetFormat() != CSR)
+            {
+                LOG_VERBOSE_INFO(2,
+                                 "*** warning: LocalMatrix::RSPMISCheckUndecided() is performed "
+                                 "in CSR format");
+            }
+
+            if(this->is_accel_() == true)
+            {
+                LOG_VERBOSE_INFO(2,
+                                 "*** warning: LocalMatrix::RSPMISCheckUndecided() is performed "
+                                 "on the host");
+            }
+        }
+    }
+
     template <typename ValueType>
     void LocalMatrix<ValueType>::RSDirectInterpolation(const LocalVector<int>&  CFmap,
                                                        const LocalVector<bool>& S,
@@ -55,7 +55,8 @@ namespace rocalution
   * \tparam ValueType - can be int, float, double, std::complex<float> and
   *                     std::complex<double>
   *
-  * A number of matrix formats are supported. These are CSR, BCSR, MCSR, COO, DIA, ELL, HYB, and DENSE.
+  * A number of matrix formats are supported. These are CSR, BCSR, MCSR, COO, DIA, ELL, HYB, SELL
+  * and DENSE.
   * \note For CSR type matrices, the column indices must be sorted in increasing order. For COO matrices, the row
   * indices must be sorted in increasing order. The function \p Check can be used to check whether a matrix
   * contains valid data. For CSR and COO matrices, the function \p Sort can be used to sort the row or column
@@ -119,13 +120,13 @@ namespace rocalution
       */
         /**@{*/
         ROCALUTION_EXPORT
-        void AllocateCSR(const std::string& name, int nnz, int nrow, int ncol);
+        void AllocateCSR(const std::string& name, PtrType nnz, int nrow, int ncol);
         ROCALUTION_EXPORT
         void AllocateBCSR(const std::string& name, int nnzb, int nrowb, int ncolb, int blockdim);
         ROCALUTION_EXPORT
         void AllocateMCSR(const std::string& name, int nnz, int nrow, int ncol);
         ROCALUTION_EXPORT
-        void AllocateCOO(const std::string& name, int nnz, int nrow, int ncol);
+        void AllocateCOO(const std::string& name, PtrType nnz, int nrow, int ncol);
         ROCALUTION_EXPORT
         void AllocateDIA(const std::string& name, int nnz, int nrow, int ncol, int ndiag);
         ROCALUTION_EXPORT
@@ -148,9 +149,9 @@ namespace rocalution
       * \par Example
       * \code{.cpp}
       *   // Allocate a CSR matrix
-      *   int* csr_row_ptr   = new int[100 + 1];
-      *   int* csr_col_ind   = new int[345];
-      *   ValueType* csr_val = new ValueType[345];
+      *   PtrType* csr_row_ptr = new PtrType[100 + 1];
+      *   int* csr_col_ind     = new int[345];
+      *   ValueType* csr_val   = new ValueType[345];
       *
       *   // Fill the CSR matrix
       *   // ...
@@ -165,14 +166,19 @@ namespace rocalution
       */
         /**@{*/
         ROCALUTION_EXPORT
-        void SetDataPtrCOO(
-            int** row, int** col, ValueType** val, std::string name, int nnz, int nrow, int ncol);
+        void SetDataPtrCOO(int**       row,
+                           int**       col,
+                           ValueType** val,
+                           std::string name,
+                           PtrType     nnz,
+                           int         nrow,
+                           int         ncol);
         ROCALUTION_EXPORT
-        void SetDataPtrCSR(int**       row_offset,
+        void SetDataPtrCSR(PtrType**   row_offset,
                            int**       col,
                            ValueType** val,
                            std::string name,
-                           int         nnz,
+                           PtrType     nnz,
                            int         nrow,
                            int         ncol);
         ROCALUTION_EXPORT
@@ -224,9 +230,9 @@ namespace rocalution
       *   // Fill CSR matrix
       *   // ...
       *
-      *   int* csr_row_ptr   = NULL;
-      *   int* csr_col_ind   = NULL;
-      *   ValueType* csr_val = NULL;
+      *   PtrType* csr_row_ptr = NULL;
+      *   int* csr_col_ind     = NULL;
+      *   ValueType* csr_val   = NULL;
       *
       *   // Get (steal) the data from the matrix, this will leave the local matrix
       *   // object empty
@@ -237,7 +243,7 @@ namespace rocalution
         ROCALUTION_EXPORT
         void LeaveDataPtrCOO(int** row, int** col, ValueType** val);
         ROCALUTION_EXPORT
-        void LeaveDataPtrCSR(int** row_offset, int** col, ValueType** val);
+        void LeaveDataPtrCSR(PtrType** row_offset, int** col, ValueType** val);
         ROCALUTION_EXPORT
         void LeaveDataPtrBCSR(int** row_offset, int** col, ValueType** val, int& blockdim);
         ROCALUTION_EXPORT
@@ -320,6 +326,27 @@ namespace rocalution
         ROCALUTION_EXPORT
         void ExtractL(LocalMatrix<ValueType>* L, bool diag) const;
 
+        /** \brief Extract the l1 block diagonal part of the matrix
+      * \details
+      * \p ExtractL1BlockDiagonal extracts all entries of the matrix that lie inside
+      * the diagonal blocks of size \p block_size, and adds the absolute values of all
+      * remaining off-block entries of each row to its diagonal entry. If \p ghost is
+      * given, the absolute row sums of the ghost matrix are added to the diagonal as
+      * well. The resulting matrix is the operator of l1-Jacobi (\p block_size = 1)
+      * and l1 hybrid Gauss-Seidel smoothers.
+      *
+      * @param[in]
+      * block_size  size of the diagonal blocks.
+      * @param[out]
+      * mat         l1 block diagonal matrix.
+      * @param[in]
+      * ghost       optional ghost (off-process) part of the rows.
+      */
+        ROCALUTION_EXPORT
+        void ExtractL1BlockDiagonal(int                           block_size,
+                                    LocalMatrix<ValueType>*       mat,
+                                    const LocalMatrix<ValueType>* ghost = NULL) const;
+
         /** \brief Perform (forward) permutation of the matrix */
         ROCALUTION_EXPORT
         void Permute(const LocalVector<int>& permutation);
@@ -384,6 +411,26 @@ namespace rocalution
         ROCALUTION_EXPORT
         void ConnectivityOrder(LocalVector<int>* permutation) const;
 
+        /** \brief Create permutation vector for minimum degree reordering of the matrix
+      * \details
+      * The Minimum Degree ordering reduces the fill-in of a (complete) LU or Cholesky
+      * factorization of a given sparse matrix. It is computed on the structure of
+      * \f$A + A^T\f$.
+      *
+      * @param[out]
+      * permutation permutation vector for minimum degree reordering
+      *
+      * \par Example
+      * \code{.cpp}
+      *   LocalVector<int> md;
+      *
+      *   mat.MinimumDegree(&md);
+      *   mat.Permute(md);
+      * \endcode
+      */
+        ROCALUTION_EXPORT
+        void MinimumDegree(LocalVector<int>* permutation) const;
+
         /** \brief Perform multi-coloring decomposition of the matrix
       * \details
       * The Multi-Coloring algorithm builds a permutation (coloring of the matrix) in a
@@ -458,6 +505,17 @@ namespace rocalution
         /** \brief Perform ILU(0) factorization */
         ROCALUTION_EXPORT
         void ILU0Factorize(void);
+        /** \brief Perform fine-grained iterative ILU(0) factorization
+      * \details
+      * The ILU(0) factors are approximated by a fixed number of fine-grained parallel
+      * sweeps over all entries of L and U \cite chow2015. In contrast to ILU0Factorize(),
+      * the factors are not exact, but each sweep is fully parallel.
+      *
+      * @param[in]
+      * sweeps  number of sweeps
+      */
+        ROCALUTION_EXPORT
+        void ItILU0Factorize(int sweeps);
         /** \brief Perform LU factorization */
         ROCALUTION_EXPORT
         void LUFactorize(void);
@@ -486,6 +544,18 @@ namespace rocalution
         /** \brief Perform IC(0) factorization */
         ROCALUTION_EXPORT
         void ICFactorize(LocalVector<ValueType>* inv_diag);
+        /** \brief Perform fine-grained iterative IC(0) factorization
+      * \details
+      * Symmetric counterpart of ItILU0Factorize(). The matrix has to contain the lower
+      * triangular part including the diagonal.
+      *
+      * @param[out]
+      * inv_diag    inverse diagonal entries of the factor
+      * @param[in]
+      * sweeps      number of sweeps
+      */
+        ROCALUTION_EXPORT
+        void ItICFactorize(LocalVector<ValueType>* inv_diag, int sweeps);
 
         /** \brief Analyse the structure (level-scheduling) */
         ROCALUTION_EXPORT
@@ -589,7 +659,9 @@ namespace rocalution
         /** \brief Read matrix from CSR (rocALUTION binary format) file
       * \details
       * Read a CSR matrix from binary file. For details on the format, see
-      * WriteFileCSR().
+      * WriteFileCSR(). Both layouts are detected automatically. Files in the mapped
+      * layout are memory mapped, and arrays that are stored in the precision of
+      * \p ValueType are used in place, without reading or copying them.
       *
       * @param[in]
       * filename    name of the file containing the data.
@@ -629,8 +701,18 @@ namespace rocalution
       * Vector values array is always stored in double precision (e.g. double or
       * std::complex<double>).
       *
+      * With \p format set to CSRFileMapped, the matrix is written in a layout that
+      * can be memory mapped instead. It consists of a 64 byte header, holding the
+      * magic string "#rocALUTION csr\n", the format version, the rocALUTION version,
+      * a byte order mark, the value type tag, the sizes of row offsets and column
+      * indices as well as m, n and nnz as 64 bit integers. The row offsets, column
+      * indices and values follow, each starting at a multiple of 64 bytes. Values are
+      * stored in the precision of \p ValueType.
+      *
       * @param[in]
       * filename    name of the file to write the data to.
+      * @param[in]
+      * format      file layout, CSRFileStream (default) or CSRFileMapped.
       *
       * \par Example
       * \code{.cpp}
@@ -643,7 +725,7 @@ namespace rocalution
       * \endcode
       */
         ROCALUTION_EXPORT
-        void WriteFileCSR(const std::string& filename) const;
+        void WriteFileCSR(const std::string& filename, unsigned int format = CSRFileStream) const;
 
         ROCALUTION_EXPORT
         virtual void MoveToAccelerator(void);
@@ -726,13 +808,13 @@ namespace rocalution
       * values). The object data has to be allocated (call AllocateCSR first)
       */
         ROCALUTION_EXPORT
-        void CopyFromCSR(const int* row_offsets, const int* col, const ValueType* val);
+        void CopyFromCSR(const PtrType* row_offsets, const int* col, const ValueType* val);
 
         /** \brief Copy (export) CSR matrix described in three arrays (offsets, columns,
       * values). The output arrays have to be allocated
       */
         ROCALUTION_EXPORT
-        void CopyToCSR(int* row_offsets, int* col, ValueType* val) const;
+        void CopyToCSR(PtrType* row_offsets, int* col, ValueType* val) const;
 
         /** \brief Copy (import) COO matrix described in three arrays (rows, columns,
       * values). The object data has to be allocated (call AllocateCOO first)
@@ -769,11 +851,11 @@ namespace rocalution
       * ncol        Number of columns.
       */
         ROCALUTION_EXPORT
-        void CopyFromHostCSR(const int*         row_offset,
+        void CopyFromHostCSR(const PtrType*     row_offset,
                              const int*         col,
                              const ValueType*   val,
                              const std::string& name,
-                             int                nnz,
+                             PtrType            nnz,
                              int                nrow,
                              int                ncol);
 
@@ -807,12 +889,52 @@ namespace rocalution
         /** \brief Convert the matrix to HYB structure */
         ROCALUTION_EXPORT
         void ConvertToHYB(void);
+        /** \brief Convert the matrix to SELL-C-sigma structure
+          * \details
+          * The slice size C is chosen to match the SIMD width of the host CPU. SELL is a
+          * host-only format, on the accelerator the matrix is kept in CSR format.
+          */
+        ROCALUTION_EXPORT
+        void ConvertToSELL(void);
         /** \brief Convert the matrix to DENSE structure */
         ROCALUTION_EXPORT
         void ConvertToDENSE(void);
         /** \brief Convert the matrix to specified matrix ID format */
         ROCALUTION_EXPORT
         void ConvertTo(unsigned int matrix_format, int blockdim = 1);
+        /** \brief Convert the matrix to the format with the fastest matrix-vector product
+          * \details
+          * \p ConvertToBest selects among CSR, MCSR, BCSR (block dimension 2, 3 and 4), DIA,
+          * ELL, HYB and, on the host, SELL. The selection is based on structure statistics
+          * of the matrix, such as the row length histogram, the number of populated
+          * diagonals and the number of non-zero blocks, from which the memory traffic of a
+          * matrix-vector product is estimated for each format. The traffic is weighted by
+          * the relative cost of the backend kernels, such that CSR and MCSR are preferred
+          * on the host, where the padded and blocked formats are slower, while on the
+          * accelerator e.g. DIA is selected for banded matrices. Optionally, a few
+          * matrix-vector products are timed for each candidate format instead. Formats that
+          * require more memory than \p memory_budget times the CSR format are not
+          * considered. The decision is cached by the structure part of Key(), such that
+          * matrices with the same sparsity pattern are converted without repeating the
+          * selection.
+          *
+          * @param[in]
+          * benchmark       time the matrix-vector product of each candidate format instead
+          *                 of estimating its memory traffic.
+          * @param[in]
+          * memory_budget   maximum memory of the selected format, relative to CSR.
+          *
+          * \par Example
+          * \code{.cpp}
+          *   mat.ReadFileMTX("my_matrix.mtx");
+          *   mat.MoveToAccelerator();
+          *
+          *   // Time the candidate formats, allowing 50% more memory than CSR
+          *   mat.ConvertToBest(true, 1.5);
+          * \endcode
+          */
+        ROCALUTION_EXPORT
+        void ConvertToBest(bool benchmark = false, double memory_budget = 2.0);
 
         ROCALUTION_EXPORT
         virtual void Apply(const LocalVector<ValueType>& in, LocalVector<ValueType>* out) const;
@@ -821,10 +943,72 @@ namespace rocalution
                               ValueType                     scalar,
                               LocalVector<ValueType>*       out) const;
 
+        /** \brief Apply the transposed matrix \f$out = this^T \cdot in\f$
+      * \details
+      * The transposed matrix is not formed. On the host, the entries of each row are
+      * scattered into thread private buffers, which are summed up in a fixed order.
+      * Backends that do not support it perform the computation on the host in CSR
+      * format.
+      */
+        ROCALUTION_EXPORT
+        void ApplyTranspose(const LocalVector<ValueType>& in, LocalVector<ValueType>* out) const;
+
+        /** \brief Compute the residual \f$res = rhs - this \cdot in\f$
+      * \details
+      * On backends that support it, the residual is computed in a single pass over the
+      * matrix and the vectors.
+      */
+        ROCALUTION_EXPORT
+        void Residual(const LocalVector<ValueType>& rhs,
+                      const LocalVector<ValueType>& in,
+                      LocalVector<ValueType>*       res) const;
+
+        /** \brief Perform a damped Jacobi sweep
+      * \details
+      * Computes \f$out = in + \omega D^{-1} (rhs - this \cdot in)\f$, where \f$D^{-1}\f$
+      * is given by the vector of inverse diagonal entries. On backends that support it,
+      * the sweep is performed in a single pass over the matrix and the vectors.
+      *
+      * @param[in]
+      * inv_diag    inverse diagonal entries of the matrix
+      * @param[in]
+      * rhs         right-hand-side vector
+      * @param[in]
+      * omega       relaxation parameter
+      * @param[in]
+      * in          current iterate
+      * @param[out]
+      * out         next iterate (has to be different from \p in)
+      */
+        ROCALUTION_EXPORT
+        void JacobiSweep(const LocalVector<ValueType>& inv_diag,
+                         const LocalVector<ValueType>& rhs,
+                         ValueType                     omega,
+                         const LocalVector<ValueType>& in,
+                         LocalVector<ValueType>*       out) const;
+
         /** \brief Perform symbolic computation (structure only) of \f$|this|^p\f$ */
         ROCALUTION_EXPORT
         void SymbolicPower(int p);
 
+        /** \brief Perform symbolic LU factorization
+      * \details
+      * The sparsity pattern is extended by the fill-in of the complete LU factorization
+      * of the matrix (based on the structure of \f$A + A^T\f$), the new entries are
+      * explicit zeros. A subsequent ILU0Factorize() computes the exact LU factors
+      * (without pivoting) in place.
+      *
+      * \par Example
+      * \code{.cpp}
+      *   mat.SymbolicLU();
+      *   mat.ILU0Factorize();
+      *   mat.LUAnalyse();
+      *   mat.LUSolve(rhs, &x);
+      * \endcode
+      */
+        ROCALUTION_EXPORT
+        void SymbolicLU(void);
+
         /** \brief Perform matrix addition, this = alpha*this + beta*mat;
       * - if structure==false the sparsity pattern of the matrix is not changed;
       * - if structure==true a new sparsity pattern is computed
@@ -839,6 +1023,46 @@ namespace rocalution
         ROCALUTION_EXPORT
         void MatrixMult(const LocalMatrix<ValueType>& A, const LocalMatrix<ValueType>& B);
 
+        /** \brief Multiply three matrices, this = R * A * P
+      * \details
+      * \p TripleMatrixMult computes the product of three matrices, e.g. the Galerkin
+      * product of a multigrid hierarchy, without storing the intermediate product
+      * R * A.
+      */
+        ROCALUTION_EXPORT
+        void TripleMatrixMult(const LocalMatrix<ValueType>& R,
+                              const LocalMatrix<ValueType>& A,
+                              const LocalMatrix<ValueType>& P);
+
+        /** \brief Recompute the values of a triple matrix product, this = R * A * P
+      * \details
+      * \p NumericTripleMatrixMult computes the values of R * A * P into the existing CSR
+      * structure of this matrix, without allocating new storage. The structure must
+      * contain all entries of the product, e.g. because this matrix has been computed
+      * as R * A * P before, and only the values of R, A or P have changed since.
+      *
+      * @param[in]
+      * R   left CSR matrix
+      * @param[in]
+      * A   middle CSR matrix
+      * @param[in]
+      * P   right CSR matrix
+      *
+      * \par Example
+      * \code{.cpp}
+      *   coarse.TripleMatrixMult(R, A, P);
+      *
+      *   // Update values of A
+      *   // ...
+      *
+      *   coarse.NumericTripleMatrixMult(R, A, P);
+      * \endcode
+      */
+        ROCALUTION_EXPORT
+        void NumericTripleMatrixMult(const LocalMatrix<ValueType>& R,
+                                     const LocalMatrix<ValueType>& A,
+                                     const LocalMatrix<ValueType>& P);
+
         /** \brief Multiply the matrix with diagonal matrix (stored in LocalVector), as
       * DiagonalMatrixMultR()
       */
@@ -953,6 +1177,38 @@ namespace rocalution
         ROCALUTION_EXPORT
         void RSPMISCoarsening(float eps, LocalVector<int>* CFmap, LocalVector<bool>* S) const;
 
+        // Building blocks of the distributed PMIS coarsening. The ghost part of the matrix
+        // contributes the strong influences to and from the ghost vertices, which are stored
+        // after the local entries in S, omega, CFmap and marked. All vectors have to be
+        // allocated by the caller.
+        /** \private */
+        ROCALUTION_EXPORT
+        void RSPMISStrongInfluences(float                         eps,
+                                    LocalVector<bool>*            S,
+                                    LocalVector<float>*           omega,
+                                    unsigned long long            seed,
+                                    const LocalMatrix<ValueType>& ghost) const;
+        /** \private */
+        ROCALUTION_EXPORT
+        void RSPMISUnassignedToCoarse(LocalVector<int>*         CFmap,
+                                      LocalVector<bool>*        marked,
+                                      const LocalVector<float>& omega) const;
+        /** \private */
+        ROCALUTION_EXPORT
+        void RSPMISCorrectCoarse(LocalVector<int>*             CFmap,
+                                 const LocalVector<bool>&      S,
+                                 const LocalVector<bool>&      marked,
+                                 const LocalVector<float>&     omega,
+                                 const LocalMatrix<ValueType>& ghost) const;
+        /** \private */
+        ROCALUTION_EXPORT
+        void RSPMISCoarseEdgesToFine(LocalVector<int>*             CFmap,
+                                     const LocalVector<bool>&      S,
+                                     const LocalMatrix<ValueType>& ghost) const;
+        /** \private */
+        ROCALUTION_EXPORT
+        void RSPMISCheckUndecided(bool& undecided, const LocalVector<int>& CFmap) const;
+
         /** \brief Ruge Stueben Direct Interpolation */
         ROCALUTION_EXPORT
         void RSDirectInterpolation(const LocalVector<int>&  CFmap,
@@ -1039,6 +1295,24 @@ namespace rocalution
         virtual bool is_accel_(void) const;
 
     private:
+        // Row subset products of the overlapped GlobalMatrix::Apply(), return false if not
+        // supported by the backend or the matrix format
+        bool ApplyRows_(const LocalVector<int>&       rows,
+                        int                           start,
+                        int                           end,
+                        const LocalVector<ValueType>& in,
+                        ValueType                     scalar,
+                        bool                          add,
+                        LocalVector<ValueType>*       out) const;
+        bool ApplyRowsGhost_(const LocalVector<int>&       rows,
+                             const LocalVector<int>&       ghost_offset,
+                             const LocalMatrix<ValueType>& ghost,
+                             const LocalVector<ValueType>& in,
+                             const LocalVector<ValueType>& ghost_in,
+                             ValueType                     scalar,
+                             bool                          add,
+                             LocalVector<ValueType>*       out) const;
+
         // Pointer from the base matrix class to the current
         // allocated matrix (host_ or accel_)
         BaseMatrix<ValueType>* matrix_;
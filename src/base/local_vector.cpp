@@ -26,6 +26,7 @@
 #include "../utils/def.hpp"
 #include "../utils/log.hpp"
 #include "../utils/math_functions.hpp"
+#include "../utils/profiler.hpp"
 #include "backend_manager.hpp"
 #include "base_vector.hpp"
 #include "host/host_vector.hpp"
@@ -34,6 +35,7 @@
 #include <complex>
 #include <sstream>
 #include <stdlib.h>
+#include <vector>
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -41,6 +43,13 @@
 namespace rocalution
 {
 
+    // Estimated bytes moved by a kernel that accesses nvec vectors of the given size
+    template <typename ValueType>
+    static double local_vector_bytes(int nvec, int64_t size)
+    {
+        return static_cast<double>(nvec) * static_cast<double>(size) * sizeof(ValueType);
+    }
+
     template <typename ValueType>
     LocalVector<ValueType>::LocalVector()
     {
@@ -602,6 +611,11 @@ namespace rocalution
     {
         log_debug(this, "LocalVector::AddScale()", (const void*&)x, alpha);
 
+        ProfilerRegion region("LocalVector::AddScale",
+                              -1,
+                              local_vector_bytes<ValueType>(3, this->GetSize()),
+                              2.0 * this->GetSize());
+
         assert(this->GetSize() == x.GetSize());
         assert(((this->vector_ == this->vector_host_) && (x.vector_ == x.vector_host_))
                || ((this->vector_ == this->vector_accel_) && (x.vector_ == x.vector_accel_)));
@@ -617,6 +631,11 @@ namespace rocalution
     {
         log_debug(this, "LocalVector::ScaleAdd()", alpha, (const void*&)x);
 
+        ProfilerRegion region("LocalVector::ScaleAdd",
+                              -1,
+                              local_vector_bytes<ValueType>(3, this->GetSize()),
+                              2.0 * this->GetSize());
+
         assert(this->GetSize() == x.GetSize());
         assert(((this->vector_ == this->vector_host_) && (x.vector_ == x.vector_host_))
                || ((this->vector_ == this->vector_accel_) && (x.vector_ == x.vector_accel_)));
@@ -634,6 +653,11 @@ namespace rocalution
     {
         log_debug(this, "LocalVector::ScaleAddScale()", alpha, (const void*&)x, beta);
 
+        ProfilerRegion region("LocalVector::ScaleAddScale",
+                              -1,
+                              local_vector_bytes<ValueType>(3, this->GetSize()),
+                              3.0 * this->GetSize());
+
         assert(this->GetSize() == x.GetSize());
         assert(((this->vector_ == this->vector_host_) && (x.vector_ == x.vector_host_))
                || ((this->vector_ == this->vector_accel_) && (x.vector_ == x.vector_accel_)));
@@ -682,6 +706,11 @@ namespace rocalution
         log_debug(
             this, "LocalVector::ScaleAdd2()", alpha, (const void*&)x, beta, (const void*&)y, gamma);
 
+        ProfilerRegion region("LocalVector::ScaleAdd2",
+                              -1,
+                              local_vector_bytes<ValueType>(4, this->GetSize()),
+                              5.0 * this->GetSize());
+
         assert(this->GetSize() == x.GetSize());
         assert(this->GetSize() == y.GetSize());
         assert(((this->vector_ == this->vector_host_) && (x.vector_ == x.vector_host_)
@@ -700,6 +729,11 @@ namespace rocalution
     {
         log_debug(this, "LocalVector::Scale()", alpha);
 
+        ProfilerRegion region("LocalVector::Scale",
+                              -1,
+                              local_vector_bytes<ValueType>(2, this->GetSize()),
+                              1.0 * this->GetSize());
+
         if(this->GetSize() > 0)
         {
             this->vector_->Scale(alpha);
@@ -711,6 +745,11 @@ namespace rocalution
     {
         log_debug(this, "LocalVector::Dot()", (const void*&)x);
 
+        ProfilerRegion region("LocalVector::Dot",
+                              -1,
+                              local_vector_bytes<ValueType>(2, this->GetSize()),
+                              2.0 * this->GetSize());
+
         assert(this->GetSize() == x.GetSize());
         assert(((this->vector_ == this->vector_host_) && (x.vector_ == x.vector_host_))
                || ((this->vector_ == this->vector_accel_) && (x.vector_ == x.vector_accel_)));
@@ -730,6 +769,11 @@ namespace rocalution
     {
         log_debug(this, "LocalVector::DotNonConj()", (const void*&)x);
 
+        ProfilerRegion region("LocalVector::DotNonConj",
+                              -1,
+                              local_vector_bytes<ValueType>(2, this->GetSize()),
+                              2.0 * this->GetSize());
+
         assert(this->GetSize() == x.GetSize());
         assert(((this->vector_ == this->vector_host_) && (x.vector_ == x.vector_host_))
                || ((this->vector_ == this->vector_accel_) && (x.vector_ == x.vector_accel_)));
@@ -744,11 +788,135 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    void LocalVector<ValueType>::MDot(int                                  count,
+                                      const LocalVector<ValueType>* const* x,
+                                      ValueType*                           result) const
+    {
+        log_debug(this, "LocalVector::MDot()", count, x, result);
+
+        ProfilerRegion region("LocalVector::MDot",
+                              -1,
+                              local_vector_bytes<ValueType>(count + 1, this->GetSize()),
+                              2.0 * count * this->GetSize());
+
+        assert(count >= 0);
+        assert(result != NULL);
+
+        if(count == 0)
+        {
+            return;
+        }
+
+        assert(x != NULL);
+
+        std::vector<const BaseVector<ValueType>*> xv(count);
+
+        for(int i = 0; i < count; ++i)
+        {
+            assert(x[i] != NULL);
+            assert(this->GetSize() == x[i]->GetSize());
+            assert(((this->vector_ == this->vector_host_) && (x[i]->vector_ == x[i]->vector_host_))
+                   || ((this->vector_ == this->vector_accel_)
+                       && (x[i]->vector_ == x[i]->vector_accel_)));
+
+            xv[i] = x[i]->vector_;
+        }
+
+        if(this->GetSize() > 0)
+        {
+            this->vector_->MDot(count, xv.data(), result);
+        }
+        else
+        {
+            for(int i = 0; i < count; ++i)
+            {
+                result[i] = static_cast<ValueType>(0);
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void LocalVector<ValueType>::MAXPY(int                                  count,
+                                       const LocalVector<ValueType>* const* x,
+                                       const ValueType*                     alpha)
+    {
+        log_debug(this, "LocalVector::MAXPY()", count, x, alpha);
+
+        ProfilerRegion region("LocalVector::MAXPY",
+                              -1,
+                              local_vector_bytes<ValueType>(count + 2, this->GetSize()),
+                              2.0 * count * this->GetSize());
+
+        assert(count >= 0);
+
+        if(count == 0)
+        {
+            return;
+        }
+
+        assert(x != NULL);
+        assert(alpha != NULL);
+
+        std::vector<const BaseVector<ValueType>*> xv(count);
+
+        for(int i = 0; i < count; ++i)
+        {
+            assert(x[i] != NULL);
+            assert(this->GetSize() == x[i]->GetSize());
+            assert(((this->vector_ == this->vector_host_) && (x[i]->vector_ == x[i]->vector_host_))
+                   || ((this->vector_ == this->vector_accel_)
+                       && (x[i]->vector_ == x[i]->vector_accel_)));
+
+            xv[i] = x[i]->vector_;
+        }
+
+        if(this->GetSize() > 0)
+        {
+            this->vector_->MAXPY(count, xv.data(), alpha);
+        }
+    }
+
+    template <typename ValueType>
+    void LocalVector<ValueType>::DotAsync(int                                  count,
+                                          const LocalVector<ValueType>* const* x,
+                                          const LocalVector<ValueType>* const* y,
+                                          ValueType*                           result)
+    {
+        log_debug(this, "LocalVector::DotAsync()", count, x, y, result);
+
+        assert(count >= 0);
+        assert(x != NULL);
+        assert(y != NULL);
+        assert(result != NULL);
+
+        for(int i = 0; i < count; ++i)
+        {
+            assert(x[i] != NULL);
+            assert(y[i] != NULL);
+
+            result[i] = x[i]->Dot(*y[i]);
+        }
+    }
+
+    template <typename ValueType>
+    void LocalVector<ValueType>::DotSync(void)
+    {
+        log_debug(this, "LocalVector::DotSync()");
+
+        // Nothing to wait for, local dot products are computed synchronously
+    }
+
     template <typename ValueType>
     ValueType LocalVector<ValueType>::Norm(void) const
     {
         log_debug(this, "LocalVector::Norm()");
 
+        ProfilerRegion region("LocalVector::Norm",
+                              -1,
+                              local_vector_bytes<ValueType>(1, this->GetSize()),
+                              2.0 * this->GetSize());
+
         if(this->GetSize() > 0)
         {
             return this->vector_->Norm();
@@ -764,6 +932,11 @@ namespace rocalution
     {
         log_debug(this, "LocalVector::Reduce()");
 
+        ProfilerRegion region("LocalVector::Reduce",
+                              -1,
+                              local_vector_bytes<ValueType>(1, this->GetSize()),
+                              1.0 * this->GetSize());
+
         if(this->GetSize() > 0)
         {
             return this->vector_->Reduce();
@@ -810,6 +983,11 @@ namespace rocalution
     {
         log_debug(this, "LocalVector::PointWiseMult()", (const void*&)x);
 
+        ProfilerRegion region("LocalVector::PointWiseMult",
+                              -1,
+                              local_vector_bytes<ValueType>(3, this->GetSize()),
+                              1.0 * this->GetSize());
+
         assert(this->GetSize() == x.GetSize());
         assert(((this->vector_ == this->vector_host_) && (x.vector_ == x.vector_host_))
                || ((this->vector_ == this->vector_accel_) && (x.vector_ == x.vector_accel_)));
@@ -826,6 +1004,11 @@ namespace rocalution
     {
         log_debug(this, "LocalVector::PointWiseMult()", (const void*&)x, (const void*&)y);
 
+        ProfilerRegion region("LocalVector::PointWiseMult",
+                              -1,
+                              local_vector_bytes<ValueType>(3, this->GetSize()),
+                              1.0 * this->GetSize());
+
         assert(this->GetSize() == x.GetSize());
         assert(this->GetSize() == y.GetSize());
         assert(((this->vector_ == this->vector_host_) && (x.vector_ == x.vector_host_)
@@ -317,6 +317,12 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual ValueType DotNonConj(const LocalVector<ValueType>& x) const;
         ROCALUTION_EXPORT
+        virtual void
+            MDot(int count, const LocalVector<ValueType>* const* x, ValueType* result) const;
+        ROCALUTION_EXPORT
+        virtual void
+            MAXPY(int count, const LocalVector<ValueType>* const* x, const ValueType* alpha);
+        ROCALUTION_EXPORT
         virtual ValueType Norm(void) const;
         ROCALUTION_EXPORT
         virtual ValueType Reduce(void) const;
@@ -332,6 +338,21 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual void Power(double power);
 
+        /** \brief Start a batch of dot products
+          * \details
+          * Computes \f$result_{i} = x_{i}^{H} y_{i}\f$, for \f$i = 0, \dots, count - 1\f$.
+          * The results are only valid after DotSync() has been called on this vector. For
+          * LocalVector, the dot products are computed immediately.
+          */
+        ROCALUTION_EXPORT
+        void DotAsync(int                                  count,
+                      const LocalVector<ValueType>* const* x,
+                      const LocalVector<ValueType>* const* y,
+                      ValueType*                           result);
+        /** \brief Wait for the dot products started by DotAsync() */
+        ROCALUTION_EXPORT
+        void DotSync(void);
+
         /** \brief Set index array */
         ROCALUTION_EXPORT
         void SetIndexArray(int size, const int* index);
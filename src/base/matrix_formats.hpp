@@ -30,8 +30,8 @@ namespace rocalution
 {
 
     // Matrix Names
-    const std::string _matrix_format_names[8]
-        = {"DENSE", "CSR", "MCSR", "BCSR", "COO", "DIA", "ELL", "HYB"};
+    const std::string _matrix_format_names[9]
+        = {"DENSE", "CSR", "MCSR", "BCSR", "COO", "DIA", "ELL", "HYB", "SELL"};
 
     // Matrix Enumeration
     enum _matrix_format
@@ -43,15 +43,23 @@ namespace rocalution
         COO   = 4,
         DIA   = 5,
         ELL   = 6,
-        HYB   = 7
+        HYB   = 7,
+        SELL  = 8
+    };
+
+    // Binary CSR file layouts
+    enum _csr_file_format
+    {
+        CSRFileStream = 0,
+        CSRFileMapped = 1
     };
 
     // Sparse Matrix - Sparse Compressed Row Format CSR
-    template <typename ValueType, typename IndexType>
+    template <typename ValueType, typename IndexType, typename PointerType = IndexType>
     struct MatrixCSR
     {
         // Row offsets (row ptr)
-        IndexType* row_offset;
+        PointerType* row_offset;
 
         // Column index
         IndexType* col;
@@ -147,6 +155,32 @@ namespace rocalution
         MatrixCOO<ValueType, IndexType>        COO;
     };
 
+    // Sparse Matrix - Sliced ELL Format SELL-C-sigma (see SELL_IND for indexing)
+    // Rows are sorted by length within windows of sigma rows and grouped into
+    // slices of C rows, each slice is stored in ELL format with its own width
+    template <typename ValueType, typename IndexType, typename Index = IndexType>
+    struct MatrixSELL
+    {
+        // Number of rows per slice (C)
+        Index slice_size;
+        // Sorting scope (sigma)
+        Index sigma;
+        // Number of slices
+        Index nslice;
+
+        // Slice offsets (slice ptr)
+        IndexType* slice_offset;
+
+        // Original row of each (sorted) row position
+        IndexType* perm;
+
+        // Column index
+        IndexType* col;
+
+        // Values
+        ValueType* val;
+    };
+
     // Dense Matrix (see DENSE_IND for indexing)
     template <typename ValueType>
     struct MatrixDENSE
@@ -39,6 +39,9 @@
 #define ELL_IND_EL(row, el, nrow, max_row) (el) + (max_row) * (row)
 #define ELL_IND(row, el, nrow, max_row) ELL_IND_ROW(row, el, nrow, max_row)
 
+// SELL indexing (slice local row, element, slice offset, slice size)
+#define SELL_IND(row, el, offset, slice_size) (offset) + (el) * (slice_size) + (row)
+
 // DIA indexing
 #define DIA_IND_ROW(row, el, nrow, ndiag) (el) * (nrow) + (row)
 #define DIA_IND_EL(row, el, nrow, ndiag) (el) + (ndiag) * (row)
@@ -28,6 +28,10 @@
 #include "../utils/allocate_free.hpp"
 #include "../utils/log.hpp"
 
+#ifdef SUPPORT_MULTINODE
+#include "../utils/communicator.hpp"
+#endif
+
 #include <algorithm>
 #include <fstream>
 #include <limits>
@@ -64,12 +68,41 @@ namespace rocalution
 
         this->boundary_index_ = NULL;
 
+        this->agg_comm_         = NULL;
+        this->agg_group_size_   = 0;
+        this->agg_leader_       = -1;
+        this->agg_local_size_   = 0;
+        this->agg_local_offset_ = 0;
+        this->agg_nmember_      = 0;
+        this->agg_offset_       = NULL;
+        this->agg_sub_comm_     = NULL;
+
         // if new values are added, also put check into status function
     }
 
     ParallelManager::~ParallelManager()
     {
         this->Clear();
+
+        if(this->agg_nmember_ > 0)
+        {
+            free_host(&this->agg_offset_);
+        }
+
+#ifdef SUPPORT_MULTINODE
+        if(this->agg_sub_comm_ != NULL)
+        {
+            int finalized;
+            MPI_Finalized(&finalized);
+
+            if(finalized == 0)
+            {
+                MPI_Comm_free((MPI_Comm*)this->agg_sub_comm_);
+            }
+
+            delete(MPI_Comm*)this->agg_sub_comm_;
+        }
+#endif
     }
 
     void ParallelManager::SetMPICommunicator(const void* comm)
@@ -104,17 +137,15 @@ namespace rocalution
             this->nsend_ = 0;
         }
 
-        if(this->recv_index_size_ > 0)
+        // The boundary index belongs to the senders, processes may receive without sending
+        if(this->send_index_size_ > 0)
         {
             free_host(&this->boundary_index_);
 
-            this->recv_index_size_ = 0;
-        }
-
-        if(this->send_index_size_ > 0)
-        {
             this->send_index_size_ = 0;
         }
+
+        this->recv_index_size_ = 0;
     }
 
     int ParallelManager::GetNumProcs(void) const
@@ -135,7 +166,8 @@ namespace rocalution
 
     void ParallelManager::SetLocalSize(int size)
     {
-        assert(size > 0);
+        // Processes may own no rows of a coarse level
+        assert(size >= 0);
         assert(size <= (IndexType2)this->global_size_);
 
         this->local_size_ = size;
@@ -257,12 +289,632 @@ namespace rocalution
     if(this->nsend_ > 0 && this->send_offset_index_ == NULL) return false;
     if(this->recv_index_size_ < 0) return false;
     if(this->send_index_size_ < 0) return false;
-    if(this->recv_index_size_ > 0 && this->boundary_index_ == NULL) return false;
+    if(this->send_index_size_ > 0 && this->boundary_index_ == NULL) return false;
         // clang-format on
 
         return true;
     }
 
+    template <typename DataType>
+    void ParallelManager::CommunicateGhostValues(const DataType* values,
+                                                 DataType*       ghost_values) const
+    {
+        log_debug(this, "ParallelManager::CommunicateGhostValues()", values, ghost_values);
+
+        assert(this->Status());
+
+#ifdef SUPPORT_MULTINODE
+        std::vector<MRequest> req(this->nrecv_ + this->nsend_);
+
+        int nreq = 0;
+
+        // Receive the boundary values of the neighbors
+        for(int n = 0; n < this->nrecv_; ++n)
+        {
+            int size = this->recv_offset_index_[n + 1] - this->recv_offset_index_[n];
+
+            if(size > 0)
+            {
+                communication_async_recv(ghost_values + this->recv_offset_index_[n],
+                                         size,
+                                         this->recvs_[n],
+                                         0,
+                                         &req[nreq++],
+                                         this->comm_);
+            }
+        }
+
+        // Gather the boundary values
+        DataType* send_buffer = NULL;
+        allocate_host(this->send_index_size_, &send_buffer);
+
+        for(int i = 0; i < this->send_index_size_; ++i)
+        {
+            send_buffer[i] = values[this->boundary_index_[i]];
+        }
+
+        // Send the boundary values to the neighbors
+        for(int n = 0; n < this->nsend_; ++n)
+        {
+            int size = this->send_offset_index_[n + 1] - this->send_offset_index_[n];
+
+            if(size > 0)
+            {
+                communication_async_send(send_buffer + this->send_offset_index_[n],
+                                         size,
+                                         this->sends_[n],
+                                         0,
+                                         &req[nreq++],
+                                         this->comm_);
+            }
+        }
+
+        if(nreq > 0)
+        {
+            communication_syncall(nreq, &req[0]);
+        }
+
+        if(send_buffer != NULL)
+        {
+            free_host(&send_buffer);
+        }
+#endif
+    }
+
+    template <typename DataType>
+    void ParallelManager::CommunicateBoundaryValues(const DataType* ghost_values,
+                                                    DataType*       boundary_values) const
+    {
+        log_debug(
+            this, "ParallelManager::CommunicateBoundaryValues()", ghost_values, boundary_values);
+
+        assert(this->Status());
+
+#ifdef SUPPORT_MULTINODE
+        std::vector<MRequest> req(this->nrecv_ + this->nsend_);
+
+        int nreq = 0;
+
+        // Receive the values of our boundary from the ranks holding it as ghost layer
+        for(int n = 0; n < this->nsend_; ++n)
+        {
+            int size = this->send_offset_index_[n + 1] - this->send_offset_index_[n];
+
+            if(size > 0)
+            {
+                communication_async_recv(boundary_values + this->send_offset_index_[n],
+                                         size,
+                                         this->sends_[n],
+                                         0,
+                                         &req[nreq++],
+                                         this->comm_);
+            }
+        }
+
+        DataType* send_buffer = NULL;
+        allocate_host(this->recv_index_size_, &send_buffer);
+
+        for(int i = 0; i < this->recv_index_size_; ++i)
+        {
+            send_buffer[i] = ghost_values[i];
+        }
+
+        // Send the ghost values back to their owners
+        for(int n = 0; n < this->nrecv_; ++n)
+        {
+            int size = this->recv_offset_index_[n + 1] - this->recv_offset_index_[n];
+
+            if(size > 0)
+            {
+                communication_async_send(send_buffer + this->recv_offset_index_[n],
+                                         size,
+                                         this->recvs_[n],
+                                         0,
+                                         &req[nreq++],
+                                         this->comm_);
+            }
+        }
+
+        if(nreq > 0)
+        {
+            communication_syncall(nreq, &req[0]);
+        }
+
+        if(send_buffer != NULL)
+        {
+            free_host(&send_buffer);
+        }
+#endif
+    }
+
+    template <typename DataType>
+    void ParallelManager::CommunicateGhostRows(const PtrType*  row_offset,
+                                               const DataType* data,
+                                               const PtrType*  ghost_row_offset,
+                                               DataType*       ghost_data) const
+    {
+        log_debug(this,
+                  "ParallelManager::CommunicateGhostRows()",
+                  row_offset,
+                  data,
+                  ghost_row_offset,
+                  ghost_data);
+
+        assert(this->Status());
+        assert(row_offset != NULL);
+        assert(ghost_row_offset != NULL);
+
+#ifdef SUPPORT_MULTINODE
+        std::vector<MRequest> req(this->nrecv_ + this->nsend_);
+
+        int nreq = 0;
+
+        // Receive the boundary rows of the neighbors
+        for(int n = 0; n < this->nrecv_; ++n)
+        {
+            PtrType begin = ghost_row_offset[this->recv_offset_index_[n]];
+            PtrType end   = ghost_row_offset[this->recv_offset_index_[n + 1]];
+
+            if(end > begin)
+            {
+                communication_async_recv(ghost_data + begin,
+                                         static_cast<int>(end - begin),
+                                         this->recvs_[n],
+                                         0,
+                                         &req[nreq++],
+                                         this->comm_);
+            }
+        }
+
+        // Gather the boundary rows
+        PtrType* send_row_offset = NULL;
+        allocate_host(this->send_index_size_ + 1, &send_row_offset);
+
+        send_row_offset[0] = 0;
+        for(int i = 0; i < this->send_index_size_; ++i)
+        {
+            int row = this->boundary_index_[i];
+
+            send_row_offset[i + 1] = send_row_offset[i] + row_offset[row + 1] - row_offset[row];
+        }
+
+        DataType* send_buffer = NULL;
+        allocate_host(send_row_offset[this->send_index_size_], &send_buffer);
+
+        for(int i = 0; i < this->send_index_size_; ++i)
+        {
+            int     row = this->boundary_index_[i];
+            PtrType idx = send_row_offset[i];
+
+            for(PtrType j = row_offset[row]; j < row_offset[row + 1]; ++j)
+            {
+                send_buffer[idx++] = data[j];
+            }
+        }
+
+        // Send the boundary rows to the neighbors
+        for(int n = 0; n < this->nsend_; ++n)
+        {
+            PtrType begin = send_row_offset[this->send_offset_index_[n]];
+            PtrType end   = send_row_offset[this->send_offset_index_[n + 1]];
+
+            if(end > begin)
+            {
+                communication_async_send(send_buffer + begin,
+                                         static_cast<int>(end - begin),
+                                         this->sends_[n],
+                                         0,
+                                         &req[nreq++],
+                                         this->comm_);
+            }
+        }
+
+        if(nreq > 0)
+        {
+            communication_syncall(nreq, &req[0]);
+        }
+
+        free_host(&send_row_offset);
+
+        if(send_buffer != NULL)
+        {
+            free_host(&send_buffer);
+        }
+#endif
+    }
+
+    template <typename DataType>
+    void ParallelManager::CommunicateBoundaryRows(const PtrType*  ghost_row_offset,
+                                                  const DataType* ghost_data,
+                                                  const PtrType*  boundary_row_offset,
+                                                  DataType*       boundary_data) const
+    {
+        log_debug(this,
+                  "ParallelManager::CommunicateBoundaryRows()",
+                  ghost_row_offset,
+                  ghost_data,
+                  boundary_row_offset,
+                  boundary_data);
+
+        assert(this->Status());
+        assert(ghost_row_offset != NULL);
+        assert(boundary_row_offset != NULL);
+
+#ifdef SUPPORT_MULTINODE
+        std::vector<MRequest> req(this->nrecv_ + this->nsend_);
+
+        int nreq = 0;
+
+        // Receive the rows of our boundary from the ranks holding it as ghost layer
+        for(int n = 0; n < this->nsend_; ++n)
+        {
+            PtrType begin = boundary_row_offset[this->send_offset_index_[n]];
+            PtrType end   = boundary_row_offset[this->send_offset_index_[n + 1]];
+
+            if(end > begin)
+            {
+                communication_async_recv(boundary_data + begin,
+                                         static_cast<int>(end - begin),
+                                         this->sends_[n],
+                                         0,
+                                         &req[nreq++],
+                                         this->comm_);
+            }
+        }
+
+        PtrType   ghost_nnz   = ghost_row_offset[this->recv_index_size_];
+        DataType* send_buffer = NULL;
+        allocate_host(ghost_nnz, &send_buffer);
+
+        for(PtrType i = 0; i < ghost_nnz; ++i)
+        {
+            send_buffer[i] = ghost_data[i];
+        }
+
+        // Send the ghost rows back to their owners
+        for(int n = 0; n < this->nrecv_; ++n)
+        {
+            PtrType begin = ghost_row_offset[this->recv_offset_index_[n]];
+            PtrType end   = ghost_row_offset[this->recv_offset_index_[n + 1]];
+
+            if(end > begin)
+            {
+                communication_async_send(send_buffer + begin,
+                                         static_cast<int>(end - begin),
+                                         this->recvs_[n],
+                                         0,
+                                         &req[nreq++],
+                                         this->comm_);
+            }
+        }
+
+        if(nreq > 0)
+        {
+            communication_syncall(nreq, &req[0]);
+        }
+
+        if(send_buffer != NULL)
+        {
+            free_host(&send_buffer);
+        }
+#endif
+    }
+
+    void ParallelManager::Agglomerate(const ParallelManager& parent, int group_size)
+    {
+        log_debug(this, "ParallelManager::Agglomerate()", (const void*&)parent, group_size);
+
+        assert(parent.Status());
+        assert(group_size > 0);
+        assert(this->comm_ == NULL);
+        assert(this->agg_comm_ == NULL);
+
+#ifdef SUPPORT_MULTINODE
+        this->agg_comm_       = parent.comm_;
+        this->agg_group_size_ = group_size;
+        this->agg_leader_     = parent.rank_ - parent.rank_ % group_size;
+        this->agg_local_size_ = parent.local_size_;
+
+        bool leader = (parent.rank_ == this->agg_leader_);
+
+        std::vector<MRequest> req(group_size);
+
+        int nreq = 0;
+
+        if(leader == true)
+        {
+            this->agg_nmember_ = std::min(group_size, parent.num_procs_ - parent.rank_);
+            allocate_host(this->agg_nmember_ + 1, &this->agg_offset_);
+
+            // Receive the local sizes of the group members
+            this->agg_offset_[0] = 0;
+            this->agg_offset_[1] = parent.local_size_;
+
+            for(int k = 1; k < this->agg_nmember_; ++k)
+            {
+                communication_async_recv(&this->agg_offset_[k + 1],
+                                         1,
+                                         this->agg_leader_ + k,
+                                         0,
+                                         &req[nreq++],
+                                         this->agg_comm_);
+            }
+
+            if(nreq > 0)
+            {
+                communication_syncall(nreq, &req[0]);
+            }
+
+            for(int k = 0; k < this->agg_nmember_; ++k)
+            {
+                this->agg_offset_[k + 1] += this->agg_offset_[k];
+            }
+
+            // Send the group members the offsets of their local parts
+            nreq = 0;
+
+            for(int k = 1; k < this->agg_nmember_; ++k)
+            {
+                communication_async_send(&this->agg_offset_[k],
+                                         1,
+                                         this->agg_leader_ + k,
+                                         0,
+                                         &req[nreq++],
+                                         this->agg_comm_);
+            }
+
+            if(nreq > 0)
+            {
+                communication_syncall(nreq, &req[0]);
+            }
+
+            this->agg_local_offset_ = 0;
+        }
+        else
+        {
+            communication_async_send(
+                &this->agg_local_size_, 1, this->agg_leader_, 0, &req[nreq++], this->agg_comm_);
+            communication_syncall(nreq, &req[0]);
+
+            nreq = 0;
+
+            communication_async_recv(
+                &this->agg_local_offset_, 1, this->agg_leader_, 0, &req[nreq++], this->agg_comm_);
+            communication_syncall(nreq, &req[0]);
+        }
+
+        // The group leaders form the communicator of the agglomerated level
+        MPI_Comm* sub_comm = new MPI_Comm;
+
+        MPI_Comm_split(*(MPI_Comm*)this->agg_comm_,
+                       (leader == true) ? 0 : MPI_UNDEFINED,
+                       parent.rank_,
+                       sub_comm);
+
+        this->global_size_ = parent.global_size_;
+
+        if(leader == true)
+        {
+            this->agg_sub_comm_ = sub_comm;
+
+            this->SetMPICommunicator(this->agg_sub_comm_);
+            this->local_size_ = this->agg_offset_[this->agg_nmember_];
+        }
+        else
+        {
+            delete sub_comm;
+        }
+#endif
+    }
+
+    template <typename DataType>
+    void ParallelManager::GatherAgglomerated(const DataType* values, DataType* agg_values) const
+    {
+        log_debug(this, "ParallelManager::GatherAgglomerated()", values, agg_values);
+
+        assert(this->IsAgglomerated() == true);
+
+#ifdef SUPPORT_MULTINODE
+        if(this->agg_nmember_ > 0)
+        {
+            std::vector<MRequest> req(this->agg_nmember_);
+
+            int nreq = 0;
+
+            // Receive the local parts of the group members
+            for(int k = 1; k < this->agg_nmember_; ++k)
+            {
+                int size = this->agg_offset_[k + 1] - this->agg_offset_[k];
+
+                if(size > 0)
+                {
+                    communication_async_recv(agg_values + this->agg_offset_[k],
+                                             size,
+                                             this->agg_leader_ + k,
+                                             0,
+                                             &req[nreq++],
+                                             this->agg_comm_);
+                }
+            }
+
+            for(int i = 0; i < this->agg_local_size_; ++i)
+            {
+                agg_values[i] = values[i];
+            }
+
+            if(nreq > 0)
+            {
+                communication_syncall(nreq, &req[0]);
+            }
+        }
+        else if(this->agg_local_size_ > 0)
+        {
+            DataType* send_buffer = NULL;
+            allocate_host(this->agg_local_size_, &send_buffer);
+
+            for(int i = 0; i < this->agg_local_size_; ++i)
+            {
+                send_buffer[i] = values[i];
+            }
+
+            MRequest req;
+
+            communication_async_send(
+                send_buffer, this->agg_local_size_, this->agg_leader_, 0, &req, this->agg_comm_);
+            communication_syncall(1, &req);
+
+            free_host(&send_buffer);
+        }
+#endif
+    }
+
+    template <typename DataType>
+    void ParallelManager::ScatterAgglomerated(const DataType* agg_values, DataType* values) const
+    {
+        log_debug(this, "ParallelManager::ScatterAgglomerated()", agg_values, values);
+
+        assert(this->IsAgglomerated() == true);
+
+#ifdef SUPPORT_MULTINODE
+        if(this->agg_nmember_ > 0)
+        {
+            int size = this->agg_offset_[this->agg_nmember_] - this->agg_local_size_;
+
+            DataType* send_buffer = NULL;
+            allocate_host(size, &send_buffer);
+
+            for(int i = 0; i < size; ++i)
+            {
+                send_buffer[i] = agg_values[this->agg_local_size_ + i];
+            }
+
+            std::vector<MRequest> req(this->agg_nmember_);
+
+            int nreq = 0;
+
+            // Send the group members their local parts
+            for(int k = 1; k < this->agg_nmember_; ++k)
+            {
+                int offset = this->agg_offset_[k] - this->agg_local_size_;
+
+                size = this->agg_offset_[k + 1] - this->agg_offset_[k];
+
+                if(size > 0)
+                {
+                    communication_async_send(send_buffer + offset,
+                                             size,
+                                             this->agg_leader_ + k,
+                                             0,
+                                             &req[nreq++],
+                                             this->agg_comm_);
+                }
+            }
+
+            for(int i = 0; i < this->agg_local_size_; ++i)
+            {
+                values[i] = agg_values[i];
+            }
+
+            if(nreq > 0)
+            {
+                communication_syncall(nreq, &req[0]);
+            }
+
+            if(send_buffer != NULL)
+            {
+                free_host(&send_buffer);
+            }
+        }
+        else if(this->agg_local_size_ > 0)
+        {
+            MRequest req;
+
+            communication_async_recv(
+                values, this->agg_local_size_, this->agg_leader_, 0, &req, this->agg_comm_);
+            communication_syncall(1, &req);
+        }
+#endif
+    }
+
+    template <typename DataType>
+    void ParallelManager::GatherAgglomeratedRows(const PtrType*  row_offset,
+                                                 const DataType* data,
+                                                 const PtrType*  agg_row_offset,
+                                                 DataType*       agg_data) const
+    {
+        log_debug(this,
+                  "ParallelManager::GatherAgglomeratedRows()",
+                  row_offset,
+                  data,
+                  agg_row_offset,
+                  agg_data);
+
+        assert(this->IsAgglomerated() == true);
+        assert(row_offset != NULL);
+
+#ifdef SUPPORT_MULTINODE
+        PtrType nnz = row_offset[this->agg_local_size_] - row_offset[0];
+
+        if(this->agg_nmember_ > 0)
+        {
+            assert(agg_row_offset != NULL);
+
+            std::vector<MRequest> req(this->agg_nmember_);
+
+            int nreq = 0;
+
+            // Receive the rows of the group members
+            for(int k = 1; k < this->agg_nmember_; ++k)
+            {
+                PtrType begin = agg_row_offset[this->agg_offset_[k]];
+                PtrType end   = agg_row_offset[this->agg_offset_[k + 1]];
+
+                if(end > begin)
+                {
+                    communication_async_recv(agg_data + begin,
+                                             static_cast<int>(end - begin),
+                                             this->agg_leader_ + k,
+                                             0,
+                                             &req[nreq++],
+                                             this->agg_comm_);
+                }
+            }
+
+            for(PtrType j = 0; j < nnz; ++j)
+            {
+                agg_data[j] = data[row_offset[0] + j];
+            }
+
+            if(nreq > 0)
+            {
+                communication_syncall(nreq, &req[0]);
+            }
+        }
+        else if(nnz > 0)
+        {
+            DataType* send_buffer = NULL;
+            allocate_host(nnz, &send_buffer);
+
+            for(PtrType j = 0; j < nnz; ++j)
+            {
+                send_buffer[j] = data[row_offset[0] + j];
+            }
+
+            MRequest req;
+
+            communication_async_send(send_buffer,
+                                     static_cast<int>(nnz),
+                                     this->agg_leader_,
+                                     0,
+                                     &req,
+                                     this->agg_comm_);
+            communication_syncall(1, &req);
+
+            free_host(&send_buffer);
+        }
+#endif
+    }
+
     void ParallelManager::WriteFileASCII(const std::string& filename) const
     {
         log_debug(this, "ParallelManager::WriteFileASCII()", filename);
@@ -500,4 +1152,138 @@ namespace rocalution
         LOG_INFO("ReadFileASCII: filename=" << filename << "; done");
     }
 
+    template void ParallelManager::CommunicateGhostValues<bool>(const bool* values,
+                                                               bool*       ghost_values) const;
+    template void ParallelManager::CommunicateGhostValues<int>(const int* values,
+                                                              int*       ghost_values) const;
+    template void ParallelManager::CommunicateGhostValues<float>(const float* values,
+                                                                float*       ghost_values) const;
+    template void ParallelManager::CommunicateGhostValues<double>(const double* values,
+                                                                 double* ghost_values) const;
+#ifdef SUPPORT_COMPLEX
+    template void ParallelManager::CommunicateGhostValues<std::complex<float>>(
+        const std::complex<float>* values, std::complex<float>* ghost_values) const;
+    template void ParallelManager::CommunicateGhostValues<std::complex<double>>(
+        const std::complex<double>* values, std::complex<double>* ghost_values) const;
+#endif
+
+    template void ParallelManager::CommunicateBoundaryValues<bool>(const bool* ghost_values,
+                                                                  bool* boundary_values) const;
+    template void ParallelManager::CommunicateBoundaryValues<int>(const int* ghost_values,
+                                                                 int* boundary_values) const;
+    template void ParallelManager::CommunicateBoundaryValues<float>(const float* ghost_values,
+                                                                   float* boundary_values) const;
+    template void ParallelManager::CommunicateBoundaryValues<double>(
+        const double* ghost_values, double* boundary_values) const;
+#ifdef SUPPORT_COMPLEX
+    template void ParallelManager::CommunicateBoundaryValues<std::complex<float>>(
+        const std::complex<float>* ghost_values, std::complex<float>* boundary_values) const;
+    template void ParallelManager::CommunicateBoundaryValues<std::complex<double>>(
+        const std::complex<double>* ghost_values, std::complex<double>* boundary_values) const;
+#endif
+
+    template void ParallelManager::CommunicateGhostRows<int>(const PtrType* row_offset,
+                                                            const int*     data,
+                                                            const PtrType* ghost_row_offset,
+                                                            int*           ghost_data) const;
+    template void ParallelManager::CommunicateGhostRows<float>(const PtrType* row_offset,
+                                                              const float*   data,
+                                                              const PtrType* ghost_row_offset,
+                                                              float*         ghost_data) const;
+    template void ParallelManager::CommunicateGhostRows<double>(const PtrType* row_offset,
+                                                               const double*  data,
+                                                               const PtrType* ghost_row_offset,
+                                                               double*        ghost_data) const;
+#ifdef SUPPORT_COMPLEX
+    template void ParallelManager::CommunicateGhostRows<std::complex<float>>(
+        const PtrType*             row_offset,
+        const std::complex<float>* data,
+        const PtrType*             ghost_row_offset,
+        std::complex<float>*       ghost_data) const;
+    template void ParallelManager::CommunicateGhostRows<std::complex<double>>(
+        const PtrType*              row_offset,
+        const std::complex<double>* data,
+        const PtrType*              ghost_row_offset,
+        std::complex<double>*       ghost_data) const;
+#endif
+
+    template void ParallelManager::CommunicateBoundaryRows<int>(
+        const PtrType* ghost_row_offset,
+        const int*     ghost_data,
+        const PtrType* boundary_row_offset,
+        int*           boundary_data) const;
+    template void ParallelManager::CommunicateBoundaryRows<float>(
+        const PtrType* ghost_row_offset,
+        const float*   ghost_data,
+        const PtrType* boundary_row_offset,
+        float*         boundary_data) const;
+    template void ParallelManager::CommunicateBoundaryRows<double>(
+        const PtrType* ghost_row_offset,
+        const double*  ghost_data,
+        const PtrType* boundary_row_offset,
+        double*        boundary_data) const;
+#ifdef SUPPORT_COMPLEX
+    template void ParallelManager::CommunicateBoundaryRows<std::complex<float>>(
+        const PtrType*             ghost_row_offset,
+        const std::complex<float>* ghost_data,
+        const PtrType*             boundary_row_offset,
+        std::complex<float>*       boundary_data) const;
+    template void ParallelManager::CommunicateBoundaryRows<std::complex<double>>(
+        const PtrType*              ghost_row_offset,
+        const std::complex<double>* ghost_data,
+        const PtrType*              boundary_row_offset,
+        std::complex<double>*       boundary_data) const;
+#endif
+
+    template void ParallelManager::GatherAgglomerated<int>(const int* values,
+                                                          int*       agg_values) const;
+    template void ParallelManager::GatherAgglomerated<float>(const float* values,
+                                                            float*       agg_values) const;
+    template void ParallelManager::GatherAgglomerated<double>(const double* values,
+                                                             double*       agg_values) const;
+#ifdef SUPPORT_COMPLEX
+    template void ParallelManager::GatherAgglomerated<std::complex<float>>(
+        const std::complex<float>* values, std::complex<float>* agg_values) const;
+    template void ParallelManager::GatherAgglomerated<std::complex<double>>(
+        const std::complex<double>* values, std::complex<double>* agg_values) const;
+#endif
+
+    template void ParallelManager::ScatterAgglomerated<int>(const int* agg_values,
+                                                           int*       values) const;
+    template void ParallelManager::ScatterAgglomerated<float>(const float* agg_values,
+                                                             float*       values) const;
+    template void ParallelManager::ScatterAgglomerated<double>(const double* agg_values,
+                                                              double*       values) const;
+#ifdef SUPPORT_COMPLEX
+    template void ParallelManager::ScatterAgglomerated<std::complex<float>>(
+        const std::complex<float>* agg_values, std::complex<float>* values) const;
+    template void ParallelManager::ScatterAgglomerated<std::complex<double>>(
+        const std::complex<double>* agg_values, std::complex<double>* values) const;
+#endif
+
+    template void ParallelManager::GatherAgglomeratedRows<int>(const PtrType* row_offset,
+                                                              const int*     data,
+                                                              const PtrType* agg_row_offset,
+                                                              int*           agg_data) const;
+    template void ParallelManager::GatherAgglomeratedRows<float>(const PtrType* row_offset,
+                                                                const float*   data,
+                                                                const PtrType* agg_row_offset,
+                                                                float*         agg_data) const;
+    template void ParallelManager::GatherAgglomeratedRows<double>(const PtrType* row_offset,
+                                                                 const double*  data,
+                                                                 const PtrType* agg_row_offset,
+                                                                 double*        agg_data) const;
+#ifdef SUPPORT_COMPLEX
+    template void ParallelManager::GatherAgglomeratedRows<std::complex<float>>(
+        const PtrType*             row_offset,
+        const std::complex<float>* data,
+        const PtrType*             agg_row_offset,
+        std::complex<float>*       agg_data) const;
+    template void ParallelManager::GatherAgglomeratedRows<std::complex<double>>(
+        const PtrType*              row_offset,
+        const std::complex<double>* data,
+        const PtrType*              agg_row_offset,
+        std::complex<double>*       agg_data) const;
+#endif
+
 } // namespace rocalution
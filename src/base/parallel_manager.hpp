@@ -130,6 +130,84 @@ namespace rocalution
         ROCALUTION_EXPORT
         void WriteFileASCII(const std::string& filename) const;
 
+        // Send the boundary entries of the local array values to the neighboring ranks and
+        // receive their boundary entries into ghost_values, in ghost column order
+        /** \private */
+        template <typename DataType>
+        void CommunicateGhostValues(const DataType* values, DataType* ghost_values) const;
+
+        // Send ghost_values back to the ranks that own them and receive the values of the
+        // neighbors into boundary_values, one entry per boundary index
+        /** \private */
+        template <typename DataType>
+        void CommunicateBoundaryValues(const DataType* ghost_values,
+                                       DataType*       boundary_values) const;
+
+        // Send the variable length rows of the boundary entries of a local CSR-like array to
+        // the neighboring ranks, ghost_row_offset has to be known on the receiving side
+        /** \private */
+        template <typename DataType>
+        void CommunicateGhostRows(const PtrType*  row_offset,
+                                  const DataType* data,
+                                  const PtrType*  ghost_row_offset,
+                                  DataType*       ghost_data) const;
+
+        // Send the variable length rows of the ghost entries back to the ranks that own them
+        // and receive the rows of the neighbors into boundary_data, one row per boundary
+        // index, boundary_row_offset has to be known on the receiving side
+        /** \private */
+        template <typename DataType>
+        void CommunicateBoundaryRows(const PtrType*  ghost_row_offset,
+                                     const DataType* ghost_data,
+                                     const PtrType*  boundary_row_offset,
+                                     DataType*       boundary_data) const;
+
+        // Agglomerate the local parts of groups of group_size consecutive ranks of parent onto
+        // the first rank of each group. The group leaders form a new communicator, all other
+        // ranks are idle on the agglomerated level
+        /** \private */
+        void Agglomerate(const ParallelManager& parent, int group_size);
+
+        /** \private */
+        bool IsAgglomerated(void) const
+        {
+            return this->agg_comm_ != NULL;
+        }
+
+        /** \private */
+        bool IsIdle(void) const
+        {
+            return this->agg_comm_ != NULL && this->comm_ == NULL;
+        }
+
+        // Local size of this process on the level before agglomeration
+        /** \private */
+        int GetParentLocalSize(void) const
+        {
+            return this->agg_local_size_;
+        }
+
+        // Gather the local part of values of all group members into the agglomerated local
+        // part agg_values of the group leader
+        /** \private */
+        template <typename DataType>
+        void GatherAgglomerated(const DataType* values, DataType* agg_values) const;
+
+        // Scatter the agglomerated local part agg_values of the group leader back to the
+        // local part values of all group members
+        /** \private */
+        template <typename DataType>
+        void ScatterAgglomerated(const DataType* agg_values, DataType* values) const;
+
+        // Gather the variable length rows of a local CSR-like array of all group members,
+        // agg_row_offset has to be known on the group leader
+        /** \private */
+        template <typename DataType>
+        void GatherAgglomeratedRows(const PtrType*  row_offset,
+                                    const DataType* data,
+                                    const PtrType*  agg_row_offset,
+                                    DataType*       agg_data) const;
+
     private:
         const void* comm_;
         int         rank_;
@@ -161,6 +239,20 @@ namespace rocalution
         // Boundary index ids
         int* boundary_index_;
 
+        // Communicator of the parallel manager, this manager has been agglomerated from
+        const void* agg_comm_;
+        // Number of consecutive ranks of agg_comm_ per group and rank of the group leader
+        int agg_group_size_;
+        int agg_leader_;
+        // Size and offset of the local part of the current process within its group
+        int agg_local_size_;
+        int agg_local_offset_;
+        // Number of group members and offsets of their local parts (group leader only)
+        int  agg_nmember_;
+        int* agg_offset_;
+        // Communicator of the group leaders, owned by this manager
+        void* agg_sub_comm_;
+
         friend class GlobalMatrix<double>;
         friend class GlobalMatrix<float>;
         friend class GlobalMatrix<std::complex<double>>;
@@ -264,6 +264,58 @@ namespace rocalution
         FATAL_ERROR(__FILE__, __LINE__);
     }
 
+    template <typename ValueType>
+    void Vector<ValueType>::MDot(int                                  count,
+                                 const LocalVector<ValueType>* const* x,
+                                 ValueType*                           result) const
+    {
+        LOG_INFO("Vector<ValueType>::MDot(int count,"
+                 "const LocalVector<ValueType>* const* x,"
+                 "ValueType* result) const");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::MDot(int                                   count,
+                                 const GlobalVector<ValueType>* const* x,
+                                 ValueType*                            result) const
+    {
+        LOG_INFO("Vector<ValueType>::MDot(int count,"
+                 "const GlobalVector<ValueType>* const* x,"
+                 "ValueType* result) const");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::MAXPY(int                                  count,
+                                  const LocalVector<ValueType>* const* x,
+                                  const ValueType*                     alpha)
+    {
+        LOG_INFO("Vector<ValueType>::MAXPY(int count,"
+                 "const LocalVector<ValueType>* const* x,"
+                 "const ValueType* alpha)");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::MAXPY(int                                   count,
+                                  const GlobalVector<ValueType>* const* x,
+                                  const ValueType*                      alpha)
+    {
+        LOG_INFO("Vector<ValueType>::MAXPY(int count,"
+                 "const GlobalVector<ValueType>* const* x,"
+                 "const ValueType* alpha)");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
     template <typename ValueType>
     void Vector<ValueType>::PointWiseMult(const LocalVector<ValueType>& x)
     {
@@ -356,6 +356,45 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual ValueType DotNonConj(const GlobalVector<ValueType>& x) const;
 
+        /** \brief Compute multiple dot (scalar) products, result[i] = x[i]^H this
+          * \details
+          * All dot products are computed while reading this vector only once. For
+          * GlobalVector, all results are reduced with a single collective operation.
+          *
+          * @param[in]
+          * count   number of vectors in \p x.
+          * @param[in]
+          * x       array of \p count vectors.
+          * @param[out]
+          * result  array of \p count dot products.
+          */
+        ROCALUTION_EXPORT
+        virtual void
+            MDot(int count, const LocalVector<ValueType>* const* x, ValueType* result) const;
+        /** \brief Compute multiple dot (scalar) products, result[i] = x[i]^H this */
+        ROCALUTION_EXPORT
+        virtual void
+            MDot(int count, const GlobalVector<ValueType>* const* x, ValueType* result) const;
+
+        /** \brief Perform vector update of type this = this + sum(alpha[i] * x[i])
+          * \details
+          * All updates are applied while reading and writing this vector only once.
+          *
+          * @param[in]
+          * count   number of vectors in \p x.
+          * @param[in]
+          * x       array of \p count vectors.
+          * @param[in]
+          * alpha   array of \p count scalars.
+          */
+        ROCALUTION_EXPORT
+        virtual void
+            MAXPY(int count, const LocalVector<ValueType>* const* x, const ValueType* alpha);
+        /** \brief Perform vector update of type this = this + sum(alpha[i] * x[i]) */
+        ROCALUTION_EXPORT
+        virtual void
+            MAXPY(int count, const GlobalVector<ValueType>* const* x, const ValueType* alpha);
+
         /** \brief Compute \f$L_2\f$ norm of the vector, return = srqt(this^T this) */
         virtual ValueType Norm(void) const = 0;
 
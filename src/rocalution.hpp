@@ -50,6 +50,7 @@
 #include "solvers/direct/inversion.hpp"
 #include "solvers/direct/lu.hpp"
 #include "solvers/direct/qr.hpp"
+#include "solvers/direct/sparse_lu.hpp"
 #include "solvers/iter_ctrl.hpp"
 #include "solvers/krylov/bicgstab.hpp"
 #include "solvers/krylov/bicgstabl.hpp"
@@ -59,6 +60,7 @@
 #include "solvers/krylov/fgmres.hpp"
 #include "solvers/krylov/gmres.hpp"
 #include "solvers/krylov/idr.hpp"
+#include "solvers/krylov/pipecg.hpp"
 #include "solvers/krylov/qmrcgstab.hpp"
 #include "solvers/mixed_precision.hpp"
 #include "solvers/multigrid/base_amg.hpp"
@@ -34,6 +34,7 @@
 
 #include "../utils/log.hpp"
 #include "../utils/math_functions.hpp"
+#include "../utils/profiler.hpp"
 
 #include <complex>
 #include <math.h>
@@ -115,6 +116,8 @@ namespace rocalution
     {
         log_debug(this, "Chebyshev::Build()");
 
+        ProfilerRegion region("Chebyshev::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -28,6 +28,7 @@
 #include "../../base/local_vector.hpp"
 
 #include "../../utils/log.hpp"
+#include "../../utils/profiler.hpp"
 
 #include <complex>
 #include <math.h>
@@ -72,6 +73,8 @@ namespace rocalution
     {
         log_debug(this, "LU::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("LU::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
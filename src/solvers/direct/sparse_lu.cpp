@@ -0,0 +1,227 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "sparse_lu.hpp"
+#include "../../utils/def.hpp"
+
+#include "../../base/local_matrix.hpp"
+#include "../../base/local_vector.hpp"
+
+#include "../../utils/log.hpp"
+#include "../../utils/profiler.hpp"
+
+#include <complex>
+
+namespace rocalution
+{
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    SparseLU<OperatorType, VectorType, ValueType>::SparseLU()
+    {
+        log_debug(this, "SparseLU::SparseLU()");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    SparseLU<OperatorType, VectorType, ValueType>::~SparseLU()
+    {
+        log_debug(this, "SparseLU::~SparseLU()");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SparseLU<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        LOG_INFO("Sparse LU solver");
+
+        if(this->build_ == true)
+        {
+            LOG_INFO("Sparse LU nnz(L+U) = " << this->lu_.GetNnz());
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SparseLU<OperatorType, VectorType, ValueType>::PrintStart_(void) const
+    {
+        LOG_INFO("Sparse LU direct solver starts");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SparseLU<OperatorType, VectorType, ValueType>::PrintEnd_(void) const
+    {
+        LOG_INFO("Sparse LU ends");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SparseLU<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "SparseLU::Build()", this->build_, " #*# begin");
+
+        ProfilerRegion region("SparseLU::Build");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+        this->build_ = true;
+
+        assert(this->op_ != NULL);
+        assert(this->op_->GetM() == this->op_->GetN());
+        assert(this->op_->GetM() > 0);
+
+        this->lu_.CloneFrom(*this->op_);
+        this->lu_.ConvertToCSR();
+
+        // Fill-reducing ordering
+        this->permutation_.CloneBackend(*this->op_);
+
+        this->lu_.MinimumDegree(&this->permutation_);
+        this->lu_.Permute(this->permutation_);
+
+        // Structure of the factors, kept for ReBuildNumeric()
+        this->lu_.SymbolicLU();
+
+        // ILU(0) on the complete structure yields the exact factors
+        this->lu_.ILU0Factorize();
+        this->lu_.LUAnalyse();
+
+        this->rhs_perm_.CloneBackend(*this->op_);
+        this->rhs_perm_.Allocate("Sparse LU permuted rhs", this->op_->GetM());
+
+        this->x_perm_.CloneBackend(*this->op_);
+        this->x_perm_.Allocate("Sparse LU permuted solution", this->op_->GetM());
+
+        log_debug(this, "SparseLU::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SparseLU<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "SparseLU::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            assert(this->op_ != NULL);
+            assert(this->op_->GetM() == this->lu_.GetM());
+
+            OperatorType op_perm;
+
+            op_perm.CloneFrom(*this->op_);
+            op_perm.ConvertToCSR();
+            op_perm.Permute(this->permutation_);
+
+            // The structure of the operator is a subset of the structure of the factors,
+            // only the values are replaced (fill-in entries become zero)
+            this->lu_.Zeros();
+            this->lu_.MatrixAdd(op_perm,
+                                static_cast<ValueType>(1),
+                                static_cast<ValueType>(1),
+                                false);
+
+            this->lu_.ILU0Factorize();
+        }
+        else
+        {
+            this->Build();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SparseLU<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "SparseLU::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->lu_.Clear();
+            this->lu_.LUAnalyseClear();
+
+            this->permutation_.Clear();
+            this->rhs_perm_.Clear();
+            this->x_perm_.Clear();
+
+            this->build_ = false;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SparseLU<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "SparseLU::MoveToHostLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->lu_.MoveToHost();
+            this->lu_.LUAnalyse();
+
+            this->rhs_perm_.MoveToHost();
+            this->x_perm_.MoveToHost();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SparseLU<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "SparseLU::MoveToAcceleratorLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->lu_.MoveToAccelerator();
+            this->lu_.LUAnalyse();
+
+            this->rhs_perm_.MoveToAccelerator();
+            this->x_perm_.MoveToAccelerator();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SparseLU<OperatorType, VectorType, ValueType>::Solve_(const VectorType& rhs, VectorType* x)
+    {
+        log_debug(this, "SparseLU::Solve_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->build_ == true);
+
+        this->rhs_perm_.CopyFromPermute(rhs, this->permutation_);
+        this->lu_.LUSolve(this->rhs_perm_, &this->x_perm_);
+        x->CopyFromPermuteBackward(this->x_perm_, this->permutation_);
+
+        log_debug(this, "SparseLU::Solve_()", " #*# end");
+    }
+
+    template class SparseLU<LocalMatrix<double>, LocalVector<double>, double>;
+    template class SparseLU<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class SparseLU<LocalMatrix<std::complex<double>>,
+                            LocalVector<std::complex<double>>,
+                            std::complex<double>>;
+    template class SparseLU<LocalMatrix<std::complex<float>>,
+                            LocalVector<std::complex<float>>,
+                            std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -0,0 +1,89 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#ifndef ROCALUTION_DIRECT_SPARSE_LU_HPP_
+#define ROCALUTION_DIRECT_SPARSE_LU_HPP_
+
+#include "../solver.hpp"
+#include "rocalution/export.hpp"
+
+namespace rocalution
+{
+
+    /** \ingroup solver_module
+  * \class SparseLU
+  * \brief Sparse LU Decomposition
+  * \details
+  * Sparse Lower-Upper Decomposition factors a given square matrix into lower and upper
+  * triangular matrix, such that \f$PAP^T = LU\f$, where \f$P\f$ is a fill-reducing
+  * (minimum degree) permutation. In contrast to LU, the factors are kept in sparse
+  * (CSR) format. The ordering and the symbolic factorization are computed on the host.
+  * The factorization is performed without pivoting, i.e. it is suited for matrices
+  * such as symmetric positive definite or diagonally dominant ones. The structure of
+  * the factors is computed once during Build(), ReBuildNumeric() only recomputes the
+  * numerical factorization for a matrix with the same sparsity pattern. This makes the
+  * solver well suited as coarse grid solver for multigrid methods, see BaseAMG.
+  *
+  * \tparam OperatorType - can be LocalMatrix
+  * \tparam VectorType - can be LocalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class SparseLU : public DirectLinearSolver<OperatorType, VectorType, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        SparseLU();
+        ROCALUTION_EXPORT
+        virtual ~SparseLU();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+        ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+    protected:
+        virtual void Solve_(const VectorType& rhs, VectorType* x);
+
+        virtual void PrintStart_(void) const;
+        virtual void PrintEnd_(void) const;
+
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+    private:
+        OperatorType lu_;
+
+        VectorType rhs_perm_;
+        VectorType x_perm_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_DIRECT_SPARSE_LU_HPP_
@@ -25,6 +25,8 @@
 #include "../utils/def.hpp"
 #include "../utils/log.hpp"
 #include "../utils/math_functions.hpp"
+#include "../utils/profiler.hpp"
+#include "../utils/time_functions.hpp"
 
 #include <complex>
 #include <cstdlib>
@@ -48,6 +50,7 @@ namespace rocalution
         this->initial_residual_ = 0.0;
         this->current_res_      = 0.0;
         this->current_index_    = -1;
+        this->iteration_time_   = 0.0;
 
         this->absolute_tol_   = 1e-15;
         this->relative_tol_   = 1e-6;
@@ -94,6 +97,10 @@ namespace rocalution
         this->reached_   = 0;
         this->iteration_ = 0;
 
+        // Each call to CheckResidual() closes an iteration in the profiler. The iteration
+        // is recorded after its kernels, as their sibling under the innermost open region.
+        this->iteration_time_ = _rocalution_profiler_active() ? rocalution_time() : 0.0;
+
         if(this->verb_ > 0)
         {
             LOG_INFO("IterationControl initial residual = " << res);
@@ -199,6 +206,15 @@ namespace rocalution
         this->iteration_++;
         this->current_res_ = res;
 
+        if(this->iteration_time_ > 0.0 && _rocalution_profiler_active() == true)
+        {
+            double now = rocalution_time();
+
+            _rocalution_profiler_record("iteration", this->iteration_time_, now);
+
+            this->iteration_time_ = now;
+        }
+
         if(this->verb_ > 1)
         {
             LOG_INFO("IterationControl iter=" << this->iteration_ << "; residual=" << res);
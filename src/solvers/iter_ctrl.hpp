@@ -154,6 +154,9 @@ namespace rocalution
 
         // Flag == true then the residual is recorded in the residual_history_ vector
         bool rec_;
+
+        // Start time of the current iteration, if the profiler is active
+        double iteration_time_;
     };
 
 } // namespace rocalution
@@ -34,6 +34,7 @@
 
 #include "../../utils/log.hpp"
 #include "../../utils/math_functions.hpp"
+#include "../../utils/profiler.hpp"
 
 #include <complex>
 #include <limits>
@@ -102,6 +103,8 @@ namespace rocalution
     {
         log_debug(this, "BiCGStab::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("BiCGStab::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
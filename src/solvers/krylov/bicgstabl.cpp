@@ -34,6 +34,7 @@
 
 #include "../../utils/log.hpp"
 #include "../../utils/math_functions.hpp"
+#include "../../utils/profiler.hpp"
 
 #include <complex>
 #include <math.h>
@@ -103,6 +104,8 @@ namespace rocalution
     {
         log_debug(this, "BiCGStabl::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("BiCGStabl::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
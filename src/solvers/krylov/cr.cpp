@@ -34,6 +34,7 @@
 
 #include "../../utils/log.hpp"
 #include "../../utils/math_functions.hpp"
+#include "../../utils/profiler.hpp"
 
 #include <complex>
 #include <math.h>
@@ -101,6 +102,8 @@ namespace rocalution
     {
         log_debug(this, "CRG::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("CR::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
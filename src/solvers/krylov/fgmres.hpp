@@ -25,6 +25,7 @@
 #define ROCALUTION_FGMRES_FGMRES_HPP_
 
 #include "../solver.hpp"
+#include "gmres.hpp"
 #include "rocalution/export.hpp"
 
 #include <vector>
@@ -45,7 +46,9 @@ namespace rocalution
   * \cite SAAD
   *
   * The Krylov subspace basis
-  * size can be set using SetBasisSize(). The default size is 30.
+  * size can be set using SetBasisSize(). The default size is 30. The Arnoldi basis is
+  * orthogonalized with modified Gram-Schmidt (MGS) by default, classical Gram-Schmidt
+  * with reorthogonalization (CGS2) can be selected using SetOrthogonalization().
   *
   * \tparam OperatorType - can be LocalMatrix, GlobalMatrix or LocalStencil
   * \tparam VectorType - can be LocalVector or GlobalVector
@@ -74,6 +77,17 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual void SetBasisSize(int size_basis);
 
+        /** \brief Set the orthogonalization scheme of the Arnoldi process
+          * \details
+          * With MGS, one dot product and one vector update is computed per basis vector.
+          * With CGS2, the projections onto all basis vectors are computed with a single
+          * MDot() and subtracted with a single MAXPY(), and this is repeated once for
+          * reorthogonalization. CGS2 reads the new basis vector only four times per
+          * iteration and requires two global reductions only, independent of the basis size.
+          */
+        ROCALUTION_EXPORT
+        virtual void SetOrthogonalization(Orthogonalization ortho);
+
     protected:
         virtual void SolveNonPrecond_(const VectorType& rhs, VectorType* x);
         virtual void SolvePrecond_(const VectorType& rhs, VectorType* x);
@@ -98,7 +112,12 @@ namespace rocalution
         ValueType* r_;
         ValueType* H_;
 
+        ValueType* h_;
+        ValueType* t_;
+
         int size_basis_;
+
+        Orthogonalization ortho_;
     };
 
 } // namespace rocalution
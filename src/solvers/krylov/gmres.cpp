@@ -24,6 +24,7 @@
 #include "gmres.hpp"
 #include "../../utils/def.hpp"
 #include "../iter_ctrl.hpp"
+#include "orthogonalization.hpp"
 
 #include "../../base/local_matrix.hpp"
 #include "../../base/local_stencil.hpp"
@@ -36,6 +37,7 @@
 #include "../../utils/allocate_free.hpp"
 #include "../../utils/log.hpp"
 #include "../../utils/math_functions.hpp"
+#include "../../utils/profiler.hpp"
 
 #include <complex>
 #include <math.h>
@@ -49,11 +51,14 @@ namespace rocalution
         log_debug(this, "GMRES::GMRES()", "default constructor");
 
         this->size_basis_ = 30;
+        this->ortho_      = Orthogonalization_MGS;
 
         this->c_ = NULL;
         this->s_ = NULL;
         this->r_ = NULL;
         this->H_ = NULL;
+        this->h_ = NULL;
+        this->t_ = NULL;
         this->v_ = NULL;
     }
 
@@ -111,6 +116,8 @@ namespace rocalution
     {
         log_debug(this, "GMRES::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("GMRES::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -133,6 +140,8 @@ namespace rocalution
         allocate_host(this->size_basis_, &this->s_);
         allocate_host(this->size_basis_ + 1, &this->r_);
         allocate_host((this->size_basis_ + 1) * this->size_basis_, &this->H_);
+        allocate_host(this->size_basis_ + 1, &this->h_);
+        allocate_host(this->size_basis_ + 1, &this->t_);
 
         this->v_ = new VectorType*[this->size_basis_ + 1];
 
@@ -175,6 +184,8 @@ namespace rocalution
             free_host(&this->s_);
             free_host(&this->r_);
             free_host(&this->H_);
+            free_host(&this->h_);
+            free_host(&this->t_);
 
             for(int i = 0; i < this->size_basis_ + 1; ++i)
             {
@@ -267,9 +278,16 @@ namespace rocalution
         this->size_basis_ = size_basis;
     }
 
-    // GMRES implementation is based on the algorithm described in the book
-    // 'Templates for the Solution of Linear Systems: Building Blocks for Iterative Methods'
-    // by SIAM on page 18 and modified to fit rocalution structures.
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GMRES<OperatorType, VectorType, ValueType>::SetOrthogonalization(Orthogonalization ortho)
+    {
+        log_debug(this, "GMRES::SetOrthogonalization()", ortho);
+
+        assert(ortho == Orthogonalization_MGS || ortho == Orthogonalization_CGS2);
+
+        this->ortho_ = ortho;
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void GMRES<OperatorType, VectorType, ValueType>::SolveNonPrecond_(const VectorType& rhs,
                                                                       VectorType*       x)
@@ -327,13 +345,26 @@ namespace rocalution
                 op->Apply(*v[i], v[i + 1]);
 
                 // Build Hessenberg matrix H
-                for(int k = 0; k <= i; ++k)
+                if(this->ortho_ == Orthogonalization_CGS2)
+                {
+                    // H_ki = <v_k,v_i+1> and v_i+1 -= H_ki * v_k, for all k at once
+                    orthogonalize_cgs2(i + 1, v, v[i + 1], this->h_, this->t_);
+
+                    for(int k = 0; k <= i; ++k)
+                    {
+                        H[DENSE_IND(k, i, size + 1, size)] = this->h_[k];
+                    }
+                }
+                else
                 {
-                    int idx = DENSE_IND(k, i, size + 1, size);
-                    // H_ki = <v_k,v_i+1>
-                    H[idx] = v[k]->Dot(*v[i + 1]);
-                    // v_i+1 -= H_ki * v_k
-                    v[i + 1]->AddScale(*v[k], -H[idx]);
+                    for(int k = 0; k <= i; ++k)
+                    {
+                        int idx = DENSE_IND(k, i, size + 1, size);
+                        // H_ki = <v_k,v_i+1>
+                        H[idx] = v[k]->Dot(*v[i + 1]);
+                        // v_i+1 -= H_ki * v_k
+                        v[i + 1]->AddScale(*v[k], -H[idx]);
+                    }
                 }
 
                 // Precompute some indices
@@ -381,13 +412,8 @@ namespace rocalution
                 }
             }
 
-            // Update solution
-            x->AddScale(*v[0], r[0]);
-
-            for(int j = 1; j < i; ++j)
-            {
-                x->AddScale(*v[j], r[j]);
-            }
+            // Update solution, x = x + sum(r_j * v_j)
+            x->MAXPY(i, v, r);
 
             // Compute residual v_0 = b - Ax
             op->Apply(*x, v[0]);
@@ -476,13 +502,26 @@ namespace rocalution
                 this->precond_->SolveZeroSol(*z, v[i + 1]);
 
                 // Build Hessenberg matrix H
-                for(int k = 0; k <= i; ++k)
+                if(this->ortho_ == Orthogonalization_CGS2)
                 {
-                    int idx = DENSE_IND(k, i, size + 1, size);
-                    // H_ki = <v_k,v_i+1>
-                    H[idx] = v[k]->Dot(*v[i + 1]);
-                    // v_i+1 -= H_ki * v_k
-                    v[i + 1]->AddScale(*v[k], -H[idx]);
+                    // H_ki = <v_k,v_i+1> and v_i+1 -= H_ki * v_k, for all k at once
+                    orthogonalize_cgs2(i + 1, v, v[i + 1], this->h_, this->t_);
+
+                    for(int k = 0; k <= i; ++k)
+                    {
+                        H[DENSE_IND(k, i, size + 1, size)] = this->h_[k];
+                    }
+                }
+                else
+                {
+                    for(int k = 0; k <= i; ++k)
+                    {
+                        int idx = DENSE_IND(k, i, size + 1, size);
+                        // H_ki = <v_k,v_i+1>
+                        H[idx] = v[k]->Dot(*v[i + 1]);
+                        // v_i+1 -= H_ki * v_k
+                        v[i + 1]->AddScale(*v[k], -H[idx]);
+                    }
                 }
 
                 // Precompute some indices
@@ -530,13 +569,8 @@ namespace rocalution
                 }
             }
 
-            // Update solution
-            x->AddScale(*v[0], r[0]);
-
-            for(int j = 1; j < i; ++j)
-            {
-                x->AddScale(*v[j], r[j]);
-            }
+            // Update solution, x = x + sum(r_j * v_j)
+            x->MAXPY(i, v, r);
 
             // Compute residual z = b - Ax
             op->Apply(*x, z);
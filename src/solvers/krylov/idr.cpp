@@ -38,6 +38,7 @@
 #include "../../utils/allocate_free.hpp"
 #include "../../utils/log.hpp"
 #include "../../utils/math_functions.hpp"
+#include "../../utils/profiler.hpp"
 
 #include <math.h>
 #include <time.h>
@@ -118,6 +119,8 @@ namespace rocalution
     {
         log_debug(this, "IDR::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("IDR::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
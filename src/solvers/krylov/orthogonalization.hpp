@@ -0,0 +1,61 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_KRYLOV_ORTHOGONALIZATION_HPP_
+#define ROCALUTION_KRYLOV_ORTHOGONALIZATION_HPP_
+
+namespace rocalution
+{
+    // Orthogonalize w against the first count basis vectors v by classical Gram-Schmidt
+    // with one reorthogonalization (CGS2). The projections V^H w are returned in h, t is a
+    // work array of size count.
+    template <class VectorType, typename ValueType>
+    void orthogonalize_cgs2(int count, VectorType** v, VectorType* w, ValueType* h, ValueType* t)
+    {
+        // h = V^H w
+        w->MDot(count, v, h);
+
+        // w = w - V h
+        for(int k = 0; k < count; ++k)
+        {
+            t[k] = -h[k];
+        }
+
+        w->MAXPY(count, v, t);
+
+        // Reorthogonalization, t = V^H w
+        w->MDot(count, v, t);
+
+        // h = h + t and w = w - V t
+        for(int k = 0; k < count; ++k)
+        {
+            h[k] += t[k];
+            t[k] = -t[k];
+        }
+
+        w->MAXPY(count, v, t);
+    }
+
+} // namespace rocalution
+
+#endif // ROCALUTION_KRYLOV_ORTHOGONALIZATION_HPP_
@@ -0,0 +1,627 @@
+/* ************************************************************************
+ * Copyright (c) 2018-2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "pipecg.hpp"
+#include "../../utils/def.hpp"
+#include "../iter_ctrl.hpp"
+
+#include "../../base/local_matrix.hpp"
+#include "../../base/local_stencil.hpp"
+#include "../../base/local_vector.hpp"
+
+#include "../../base/global_matrix.hpp"
+#include "../../base/global_vector.hpp"
+
+#include "../../utils/log.hpp"
+#include "../../utils/math_functions.hpp"
+#include "../../utils/profiler.hpp"
+
+#include <complex>
+#include <math.h>
+
+namespace rocalution
+{
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    PipeCG<OperatorType, VectorType, ValueType>::PipeCG()
+    {
+        log_debug(this, "PipeCG::PipeCG()", "default constructor");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    PipeCG<OperatorType, VectorType, ValueType>::~PipeCG()
+    {
+        log_debug(this, "PipeCG::~PipeCG()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("PipeCG solver");
+        }
+        else
+        {
+            LOG_INFO("PipePCG solver, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::PrintStart_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("PipeCG (non-precond) linear solver starts");
+        }
+        else
+        {
+            LOG_INFO("PipePCG solver starts, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::PrintEnd_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("PipeCG (non-precond) ends");
+        }
+        else
+        {
+            LOG_INFO("PipePCG ends");
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "PipeCG::Build()", this->build_, " #*# begin");
+
+        ProfilerRegion region("PipeCG::Build");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+
+        this->build_ = true;
+
+        assert(this->op_ != NULL);
+        assert(this->op_->GetM() == this->op_->GetN());
+        assert(this->op_->GetM() > 0);
+
+        if(this->precond_ != NULL)
+        {
+            this->precond_->SetOperator(*this->op_);
+
+            this->precond_->Build();
+
+            this->u_.CloneBackend(*this->op_);
+            this->u_.Allocate("u", this->op_->GetM());
+
+            this->m_.CloneBackend(*this->op_);
+            this->m_.Allocate("m", this->op_->GetM());
+
+            this->q_.CloneBackend(*this->op_);
+            this->q_.Allocate("q", this->op_->GetM());
+        }
+
+        this->r_.CloneBackend(*this->op_);
+        this->r_.Allocate("r", this->op_->GetM());
+
+        this->w_.CloneBackend(*this->op_);
+        this->w_.Allocate("w", this->op_->GetM());
+
+        this->n_.CloneBackend(*this->op_);
+        this->n_.Allocate("n", this->op_->GetM());
+
+        this->z_.CloneBackend(*this->op_);
+        this->z_.Allocate("z", this->op_->GetM());
+
+        this->s_.CloneBackend(*this->op_);
+        this->s_.Allocate("s", this->op_->GetM());
+
+        this->p_.CloneBackend(*this->op_);
+        this->p_.Allocate("p", this->op_->GetM());
+
+        log_debug(this, "PipeCG::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::BuildMoveToAcceleratorAsync(void)
+    {
+        log_debug(this, "PipeCG::BuildMoveToAcceleratorAsync()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+
+        this->build_ = true;
+
+        assert(this->op_ != NULL);
+        assert(this->op_->GetM() == this->op_->GetN());
+        assert(this->op_->GetM() > 0);
+
+        if(this->precond_ != NULL)
+        {
+            this->precond_->SetOperator(*this->op_);
+
+            this->precond_->BuildMoveToAcceleratorAsync();
+
+            this->u_.CloneBackend(*this->op_);
+            this->u_.Allocate("u", this->op_->GetM());
+            this->u_.MoveToAcceleratorAsync();
+
+            this->m_.CloneBackend(*this->op_);
+            this->m_.Allocate("m", this->op_->GetM());
+            this->m_.MoveToAcceleratorAsync();
+
+            this->q_.CloneBackend(*this->op_);
+            this->q_.Allocate("q", this->op_->GetM());
+            this->q_.MoveToAcceleratorAsync();
+        }
+
+        this->r_.CloneBackend(*this->op_);
+        this->r_.Allocate("r", this->op_->GetM());
+        this->r_.MoveToAcceleratorAsync();
+
+        this->w_.CloneBackend(*this->op_);
+        this->w_.Allocate("w", this->op_->GetM());
+        this->w_.MoveToAcceleratorAsync();
+
+        this->n_.CloneBackend(*this->op_);
+        this->n_.Allocate("n", this->op_->GetM());
+        this->n_.MoveToAcceleratorAsync();
+
+        this->z_.CloneBackend(*this->op_);
+        this->z_.Allocate("z", this->op_->GetM());
+        this->z_.MoveToAcceleratorAsync();
+
+        this->s_.CloneBackend(*this->op_);
+        this->s_.Allocate("s", this->op_->GetM());
+        this->s_.MoveToAcceleratorAsync();
+
+        this->p_.CloneBackend(*this->op_);
+        this->p_.Allocate("p", this->op_->GetM());
+        this->p_.MoveToAcceleratorAsync();
+
+        log_debug(this, "PipeCG::BuildMoveToAcceleratorAsync()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::Sync(void)
+    {
+        log_debug(this, "PipeCG::Sync()", this->build_, " #*# begin");
+
+        if(this->precond_ != NULL)
+        {
+            this->precond_->Sync();
+            this->u_.Sync();
+            this->m_.Sync();
+            this->q_.Sync();
+        }
+
+        this->r_.Sync();
+        this->w_.Sync();
+        this->n_.Sync();
+        this->z_.Sync();
+        this->s_.Sync();
+        this->p_.Sync();
+
+        log_debug(this, "PipeCG::Sync()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "PipeCG::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            if(this->precond_ != NULL)
+            {
+                this->precond_->Clear();
+                this->precond_ = NULL;
+            }
+
+            this->r_.Clear();
+            this->w_.Clear();
+            this->n_.Clear();
+            this->z_.Clear();
+            this->s_.Clear();
+            this->p_.Clear();
+            this->u_.Clear();
+            this->m_.Clear();
+            this->q_.Clear();
+
+            this->iter_ctrl_.Clear();
+
+            this->build_ = false;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "PipeCG::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.Zeros();
+            this->w_.Zeros();
+            this->n_.Zeros();
+            this->z_.Zeros();
+            this->s_.Zeros();
+            this->p_.Zeros();
+            this->u_.Zeros();
+            this->m_.Zeros();
+            this->q_.Zeros();
+
+            this->iter_ctrl_.Clear();
+
+            if(this->precond_ != NULL)
+            {
+                this->precond_->ReBuildNumeric();
+            }
+        }
+        else
+        {
+            this->Build();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "PipeCG::MoveToHostLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.MoveToHost();
+            this->w_.MoveToHost();
+            this->n_.MoveToHost();
+            this->z_.MoveToHost();
+            this->s_.MoveToHost();
+            this->p_.MoveToHost();
+
+            if(this->precond_ != NULL)
+            {
+                this->u_.MoveToHost();
+                this->m_.MoveToHost();
+                this->q_.MoveToHost();
+                this->precond_->MoveToHost();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "PipeCG::MoveToAcceleratorLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.MoveToAccelerator();
+            this->w_.MoveToAccelerator();
+            this->n_.MoveToAccelerator();
+            this->z_.MoveToAccelerator();
+            this->s_.MoveToAccelerator();
+            this->p_.MoveToAccelerator();
+
+            if(this->precond_ != NULL)
+            {
+                this->u_.MoveToAccelerator();
+                this->m_.MoveToAccelerator();
+                this->q_.MoveToAccelerator();
+                this->precond_->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::SolveNonPrecond_(const VectorType& rhs,
+                                                                       VectorType*       x)
+    {
+        log_debug(this, "PipeCG::SolveNonPrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->precond_ == NULL);
+        assert(this->build_ == true);
+
+        const OperatorType* op = this->op_;
+
+        VectorType* r = &this->r_;
+        VectorType* w = &this->w_;
+        VectorType* n = &this->n_;
+        VectorType* z = &this->z_;
+        VectorType* s = &this->s_;
+        VectorType* p = &this->p_;
+
+        ValueType alpha, alpha_old, beta;
+        ValueType gamma, gamma_old, delta;
+
+        // Inner products gamma = (r,r) and delta = (w,r), reduced together
+        ValueType         dot[2];
+        const VectorType* dot_x[2] = {r, w};
+        const VectorType* dot_y[2] = {r, r};
+
+        // Initial residual = b - Ax
+        op->Apply(*x, r);
+        r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+
+        // w = Ar
+        op->Apply(*r, w);
+
+        // Start reduction, n = Aw is computed while it is in flight
+        r->DotAsync(2, dot_x, dot_y, dot);
+        op->Apply(*w, n);
+        r->DotSync();
+
+        // Initial residual norm |b-Ax0|, gamma = (r,r) for the L2 norm
+        ValueType res_norm = (this->res_norm_type_ == 2)
+                                 ? static_cast<ValueType>(std::sqrt(std::abs(dot[0])))
+                                 : this->Norm_(*r);
+
+        if(this->iter_ctrl_.InitResidual(std::abs(res_norm)) == false)
+        {
+            log_debug(this, "PipeCG::SolveNonPrecond_()", " #*# end");
+            return;
+        }
+
+        gamma = dot[0];
+        delta = dot[1];
+
+        // alpha = gamma / delta
+        alpha = gamma / delta;
+
+        // z = n, s = w, p = r
+        z->CopyFrom(*n);
+        s->CopyFrom(*w);
+        p->CopyFrom(*r);
+
+        while(true)
+        {
+            // x = x + alpha*p
+            x->AddScale(*p, alpha);
+
+            // r = r - alpha*s
+            r->AddScale(*s, -alpha);
+
+            // w = w - alpha*z
+            w->AddScale(*z, -alpha);
+
+            // Start reduction, n = Aw is computed while it is in flight
+            r->DotAsync(2, dot_x, dot_y, dot);
+            op->Apply(*w, n);
+            r->DotSync();
+
+            // Check convergence
+            res_norm = (this->res_norm_type_ == 2)
+                           ? static_cast<ValueType>(std::sqrt(std::abs(dot[0])))
+                           : this->Norm_(*r);
+
+            if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
+            {
+                break;
+            }
+
+            gamma_old = gamma;
+            alpha_old = alpha;
+
+            gamma = dot[0];
+            delta = dot[1];
+
+            // beta = gamma / gamma_old
+            // alpha = gamma / (delta - beta * gamma / alpha_old)
+            beta  = gamma / gamma_old;
+            alpha = gamma / (delta - beta * gamma / alpha_old);
+
+            // z = n + beta*z
+            z->ScaleAdd(beta, *n);
+
+            // s = w + beta*s
+            s->ScaleAdd(beta, *w);
+
+            // p = r + beta*p
+            p->ScaleAdd(beta, *r);
+        }
+
+        log_debug(this, "PipeCG::SolveNonPrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipeCG<OperatorType, VectorType, ValueType>::SolvePrecond_(const VectorType& rhs,
+                                                                    VectorType*       x)
+    {
+        log_debug(this, "PipeCG::SolvePrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->precond_ != NULL);
+        assert(this->build_ == true);
+
+        const OperatorType* op = this->op_;
+
+        VectorType* r = &this->r_;
+        VectorType* u = &this->u_;
+        VectorType* w = &this->w_;
+        VectorType* m = &this->m_;
+        VectorType* n = &this->n_;
+        VectorType* z = &this->z_;
+        VectorType* q = &this->q_;
+        VectorType* s = &this->s_;
+        VectorType* p = &this->p_;
+
+        ValueType alpha, alpha_old, beta;
+        ValueType gamma, gamma_old, delta;
+
+        // Inner products gamma = (r,u), delta = (w,u) and, for the L2 norm, (r,r) are
+        // reduced together
+        int               ndot     = (this->res_norm_type_ == 2) ? 3 : 2;
+        ValueType         dot[3];
+        const VectorType* dot_x[3] = {r, w, r};
+        const VectorType* dot_y[3] = {u, u, r};
+
+        // Initial residual = b - Ax
+        op->Apply(*x, r);
+        r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+
+        // Solve Mu=r
+        this->precond_->SolveZeroSol(*r, u);
+
+        // w = Au
+        op->Apply(*u, w);
+
+        // Start reduction, m = M^-1 w and n = Am are computed while it is in flight
+        r->DotAsync(ndot, dot_x, dot_y, dot);
+        this->precond_->SolveZeroSol(*w, m);
+        op->Apply(*m, n);
+        r->DotSync();
+
+        // Initial residual norm |b-Ax0|
+        ValueType res_norm = (this->res_norm_type_ == 2)
+                                 ? static_cast<ValueType>(std::sqrt(std::abs(dot[2])))
+                                 : this->Norm_(*r);
+
+        if(this->iter_ctrl_.InitResidual(std::abs(res_norm)) == false)
+        {
+            log_debug(this, "PipeCG::SolvePrecond_()", " #*# end");
+            return;
+        }
+
+        gamma = dot[0];
+        delta = dot[1];
+
+        // alpha = gamma / delta
+        alpha = gamma / delta;
+
+        // z = n, q = m, s = w, p = u
+        z->CopyFrom(*n);
+        q->CopyFrom(*m);
+        s->CopyFrom(*w);
+        p->CopyFrom(*u);
+
+        while(true)
+        {
+            // x = x + alpha*p
+            x->AddScale(*p, alpha);
+
+            // r = r - alpha*s
+            r->AddScale(*s, -alpha);
+
+            // u = u - alpha*q
+            u->AddScale(*q, -alpha);
+
+            // w = w - alpha*z
+            w->AddScale(*z, -alpha);
+
+            // Start reduction, m = M^-1 w and n = Am are computed while it is in flight
+            r->DotAsync(ndot, dot_x, dot_y, dot);
+            this->precond_->SolveZeroSol(*w, m);
+            op->Apply(*m, n);
+            r->DotSync();
+
+            // Check convergence
+            res_norm = (this->res_norm_type_ == 2)
+                           ? static_cast<ValueType>(std::sqrt(std::abs(dot[2])))
+                           : this->Norm_(*r);
+
+            if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
+            {
+                break;
+            }
+
+            gamma_old = gamma;
+            alpha_old = alpha;
+
+            gamma = dot[0];
+            delta = dot[1];
+
+            // beta = gamma / gamma_old
+            // alpha = gamma / (delta - beta * gamma / alpha_old)
+            beta  = gamma / gamma_old;
+            alpha = gamma / (delta - beta * gamma / alpha_old);
+
+            // z = n + beta*z
+            z->ScaleAdd(beta, *n);
+
+            // q = m + beta*q
+            q->ScaleAdd(beta, *m);
+
+            // s = w + beta*s
+            s->ScaleAdd(beta, *w);
+
+            // p = u + beta*p
+            p->ScaleAdd(beta, *u);
+        }
+
+        log_debug(this, "PipeCG::SolvePrecond_()", " #*# end");
+    }
+
+    template class PipeCG<LocalMatrix<double>, LocalVector<double>, double>;
+    template class PipeCG<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class PipeCG<LocalMatrix<std::complex<double>>,
+                          LocalVector<std::complex<double>>,
+                          std::complex<double>>;
+    template class PipeCG<LocalMatrix<std::complex<float>>,
+                          LocalVector<std::complex<float>>,
+                          std::complex<float>>;
+#endif
+
+    template class PipeCG<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class PipeCG<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class PipeCG<GlobalMatrix<std::complex<double>>,
+                          GlobalVector<std::complex<double>>,
+                          std::complex<double>>;
+    template class PipeCG<GlobalMatrix<std::complex<float>>,
+                          GlobalVector<std::complex<float>>,
+                          std::complex<float>>;
+#endif
+
+    template class PipeCG<LocalStencil<double>, LocalVector<double>, double>;
+    template class PipeCG<LocalStencil<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class PipeCG<LocalStencil<std::complex<double>>,
+                          LocalVector<std::complex<double>>,
+                          std::complex<double>>;
+    template class PipeCG<LocalStencil<std::complex<float>>,
+                          LocalVector<std::complex<float>>,
+                          std::complex<float>>;
+#endif
+
+} // namespace rocalution
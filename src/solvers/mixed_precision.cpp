@@ -32,6 +32,7 @@
 
 #include "../utils/allocate_free.hpp"
 #include "../utils/log.hpp"
+#include "../utils/profiler.hpp"
 
 #include <math.h>
 
@@ -168,6 +169,8 @@ namespace rocalution
     {
         log_debug(this, "MixedPrecisionDC::Build()", " #*# begin");
 
+        ProfilerRegion region("MixedPrecisionDC::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -197,7 +200,7 @@ namespace rocalution
         // copy the matrix
 
         // CSR H
-        int*        row_offset = NULL;
+        PtrType*    row_offset = NULL;
         int*        col        = NULL;
         ValueTypeH* val_h      = NULL;
 
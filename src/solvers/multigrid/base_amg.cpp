@@ -30,17 +30,199 @@
 #include "../../base/local_matrix.hpp"
 #include "../../base/local_vector.hpp"
 #include "../iter_ctrl.hpp"
+#include "multigrid.hpp"
 
+#include "../direct/sparse_lu.hpp"
 #include "../krylov/cg.hpp"
 #include "../preconditioners/preconditioner.hpp"
 
+#include "../../utils/allocate_free.hpp"
 #include "../../utils/log.hpp"
+#include "../../utils/profiler.hpp"
 
+#include <algorithm>
 #include <list>
 
 namespace rocalution
 {
 
+    // Default coarse grid solver for local operators - the factorization is computed
+    // once and only refactorized numerically in ReBuildNumeric(). The operator type only
+    // selects the overload.
+    template <typename ValueType>
+    static Solver<LocalMatrix<ValueType>, LocalVector<ValueType>, ValueType>*
+        amg_default_coarse_solver(const LocalMatrix<ValueType>*)
+    {
+        return new SparseLU<LocalMatrix<ValueType>, LocalVector<ValueType>, ValueType>;
+    }
+
+    // Default coarse grid solver for distributed operators
+    template <typename ValueType>
+    static Solver<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>*
+        amg_default_coarse_solver(const GlobalMatrix<ValueType>*)
+    {
+        CG<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>* cgs
+            = new CG<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>;
+
+        // Set absolute tolerance to 0 to avoid issues with very small numbers
+        cgs->Init(0.0, 1e-6, 1e+8, 1000);
+
+        return cgs;
+    }
+
+    // Galerkin product of local operators - if numeric is set, the sparsity pattern of the
+    // coarse operator is kept and only its values are recomputed. Local operators have no
+    // parallel manager and no coarse map.
+    template <typename ValueType>
+    static void amg_coarse_operator(const LocalMatrix<ValueType>& op,
+                                    const LocalMatrix<ValueType>& restrict,
+                                    const LocalMatrix<ValueType>& prolong,
+                                    const LocalVector<int>&,
+                                    bool                          numeric,
+                                    ParallelManager*,
+                                    LocalMatrix<ValueType>* coarse)
+    {
+        if(numeric == false)
+        {
+            coarse->TripleMatrixMult(restrict, op, prolong);
+        }
+        else if(op.GetFormat() != CSR)
+        {
+            LocalMatrix<ValueType> op_csr;
+
+            op_csr.CloneFrom(op);
+            op_csr.ConvertToCSR();
+
+            coarse->NumericTripleMatrixMult(restrict, op_csr, prolong);
+        }
+        else
+        {
+            coarse->NumericTripleMatrixMult(restrict, op, prolong);
+        }
+    }
+
+    // Galerkin product of distributed operators - the ghost part of the coarse operator
+    // and its parallel manager are always rebuilt, thus numeric is not used
+    template <typename ValueType>
+    static void amg_coarse_operator(const GlobalMatrix<ValueType>& op,
+                                    const LocalMatrix<ValueType>&  restrict,
+                                    const LocalMatrix<ValueType>&  prolong,
+                                    const LocalVector<int>&        map,
+                                    bool,
+                                    ParallelManager*               pm,
+                                    GlobalMatrix<ValueType>*       coarse)
+    {
+        if(pm->IsAgglomerated() == false)
+        {
+            op.CoarsenOperator(coarse, pm, restrict, prolong, map);
+
+            return;
+        }
+
+        // Agglomerated coarse operators are computed on the processes of the fine level
+        // first and then gathered again
+        ParallelManager         pm_tmp;
+        GlobalMatrix<ValueType> tmp;
+
+        tmp.CloneBackend(op);
+
+        op.CoarsenOperator(&tmp, &pm_tmp, restrict, prolong, map);
+        tmp.Agglomerate(pm, coarse);
+    }
+
+    // Local operators are never agglomerated, the parameters only select the overload
+    template <typename ValueType>
+    static void amg_agglomerate(int, LocalMatrix<ValueType>**, ParallelManager**)
+    {
+    }
+
+    // Gather a distributed coarse operator with less than threshold rows per process onto
+    // as many processes as required to hold about threshold rows each
+    template <typename ValueType>
+    static void amg_agglomerate(int threshold, GlobalMatrix<ValueType>** op, ParallelManager** pm)
+    {
+        if(threshold <= 0 || (*pm)->GetNumProcs() == 1)
+        {
+            return;
+        }
+
+        IndexType2 nrow   = (*op)->GetM();
+        int        nprocs = (*pm)->GetNumProcs();
+
+        if(nrow >= static_cast<IndexType2>(threshold) * nprocs)
+        {
+            return;
+        }
+
+        int nactive    = std::max(1, static_cast<int>(nrow / threshold));
+        int group_size = (nprocs + nactive - 1) / nactive;
+
+        ParallelManager*         agg_pm = new ParallelManager;
+        GlobalMatrix<ValueType>* agg_op = new GlobalMatrix<ValueType>;
+
+        agg_pm->Agglomerate(**pm, group_size);
+        agg_op->CloneBackend(**op);
+
+        (*op)->Agglomerate(agg_pm, agg_op);
+
+        delete *op;
+        delete *pm;
+
+        *op = agg_op;
+        *pm = agg_pm;
+    }
+
+    // Mixed precision hierarchies are available for local operators in double precision
+    static bool amg_mixed_precision(const LocalMatrix<double>*)
+    {
+        return true;
+    }
+
+    template <class OperatorType>
+    static bool amg_mixed_precision(const OperatorType*)
+    {
+        return false;
+    }
+
+    // Single precision copy of a level of a mixed precision hierarchy
+    static void amg_single_precision(const LocalMatrix<double>& mat,
+                                     const std::string&         name,
+                                     LocalMatrix<float>*        mat_l)
+    {
+        PtrType* row_offset = NULL;
+        int*     col        = NULL;
+        double*  val        = NULL;
+        float*   val_l      = NULL;
+
+        int     nrow = mat.GetLocalM();
+        int     ncol = mat.GetLocalN();
+        PtrType nnz  = mat.GetLocalNnz();
+
+        allocate_host(nrow + 1, &row_offset);
+        allocate_host(nnz, &col);
+        allocate_host(nnz, &val);
+        allocate_host(nnz, &val_l);
+
+        mat.CopyToCSR(row_offset, col, val);
+
+        for(PtrType i = 0; i < nnz; ++i)
+        {
+            val_l[i] = static_cast<float>(val[i]);
+        }
+
+        free_host(&val);
+
+        mat_l->SetDataPtrCSR(&row_offset, &col, &val_l, name, nnz, nrow, ncol);
+        mat_l->CloneBackend(mat);
+    }
+
+    // Not reached, amg_mixed_precision() rejects all other operators
+    template <class OperatorType>
+    static void amg_single_precision(const OperatorType&, const std::string&, LocalMatrix<float>*)
+    {
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     BaseAMG<OperatorType, VectorType, ValueType>::BaseAMG()
     {
@@ -48,6 +230,21 @@ namespace rocalution
 
         this->coarse_size_ = 300;
 
+        // no agglomeration of coarse levels
+        this->agg_threshold_ = 0;
+
+        // stored restriction operators
+        this->implicit_restriction_ = false;
+
+        // coarse levels in working precision
+        this->mixed_precision_  = false;
+        this->op_level_l_       = NULL;
+        this->restrict_level_l_ = NULL;
+        this->prolong_level_l_  = NULL;
+        this->smoother_level_l_ = NULL;
+        this->sm_default_l_     = NULL;
+        this->solver_coarse_l_  = NULL;
+
         // manual smoothers and coarse solver
         this->set_sm_ = false;
         this->set_s_  = false;
@@ -85,6 +282,49 @@ namespace rocalution
         this->coarse_size_ = coarse_size;
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseAMG<OperatorType, VectorType, ValueType>::SetAgglomerationThreshold(
+        int rows_per_process)
+    {
+        log_debug(this, "BaseAMG::SetAgglomerationThreshold()", rows_per_process);
+
+        assert(this->build_ == false);
+        assert(this->hierarchy_ == false);
+        assert(rows_per_process >= 0);
+
+        this->agg_threshold_ = rows_per_process;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseAMG<OperatorType, VectorType, ValueType>::SetMixedPrecision(bool mixed)
+    {
+        log_debug(this, "BaseAMG::SetMixedPrecision()", mixed);
+
+        assert(this->build_ == false);
+        assert(this->hierarchy_ == false);
+
+        if(mixed == true && amg_mixed_precision(static_cast<const OperatorType*>(NULL)) == false)
+        {
+            LOG_VERBOSE_INFO(2,
+                             "*** warning: Mixed precision hierarchies are only supported for "
+                             "LocalMatrix in double precision");
+
+            return;
+        }
+
+        this->mixed_precision_ = mixed;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseAMG<OperatorType, VectorType, ValueType>::SetImplicitRestriction(bool implicit)
+    {
+        log_debug(this, "BaseAMG::SetImplicitRestriction()", implicit);
+
+        assert(this->build_ == false);
+
+        this->implicit_restriction_ = implicit;
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void BaseAMG<OperatorType, VectorType, ValueType>::SetManualSmoothers(bool sm_manual)
     {
@@ -148,6 +388,8 @@ namespace rocalution
     {
         log_debug(this, "BaseAMG::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("BaseAMG::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -158,6 +400,22 @@ namespace rocalution
         // Build hierarchy
         this->BuildHierarchy();
 
+        // Release the restriction operators, the transposed prolongations are applied
+        if(this->implicit_restriction_ == true)
+        {
+            for(int i = 0; i < this->levels_ - 1; ++i)
+            {
+                delete this->restrict_op_level_[i];
+                this->restrict_op_level_[i] = NULL;
+            }
+        }
+
+        // Move the coarse levels into single precision
+        if(this->mixed_precision_ == true && this->levels_ > 2)
+        {
+            this->BuildMixedPrecision_();
+        }
+
         // Build smoothers, if not passed by the user
         if(this->set_sm_ == false)
         {
@@ -168,16 +426,10 @@ namespace rocalution
         if(this->set_s_ == false)
         {
             // Coarse Grid Solver
-            CG<OperatorType, VectorType, ValueType>* cgs
-                = new CG<OperatorType, VectorType, ValueType>;
-
-            // Set absolute tolerance to 0 to avoid issues with very small numbers
-            cgs->Init(0.0, 1e-6, 1e+8, 1000);
+            this->solver_coarse_ = amg_default_coarse_solver(this->op_);
 
             // No verbose output
-            cgs->Verbose(0);
-
-            this->solver_coarse_ = cgs;
+            this->solver_coarse_->Verbose(0);
         }
 
         // Initialize multigrid structures
@@ -188,7 +440,14 @@ namespace rocalution
         {
             for(int i = 0; i < this->levels_ - 1; ++i)
             {
-                this->op_level_[i]->ConvertTo(this->op_format_, this->op_blockdim_);
+                if(this->mg_l_ != NULL)
+                {
+                    this->op_level_l_[i]->ConvertTo(this->op_format_, this->op_blockdim_);
+                }
+                else
+                {
+                    this->op_level_[i]->ConvertTo(this->op_format_, this->op_blockdim_);
+                }
             }
         }
 
@@ -246,9 +505,13 @@ namespace rocalution
                              pm_list_.back(),
                              trans_list_.back());
 
+            amg_agglomerate(this->agg_threshold_, &op_list_.back(), &pm_list_.back());
+
             ++this->levels_;
 
-            while(op_list_.back()->GetM() > (IndexType2)this->coarse_size_)
+            // Processes that are idle on an agglomerated level stop coarsening
+            while(pm_list_.back()->IsIdle() == false
+                  && op_list_.back()->GetM() > (IndexType2)this->coarse_size_)
             {
                 // Add new list elements
                 restrict_list_.push_back(new LocalMatrix<ValueType>);
@@ -270,6 +533,8 @@ namespace rocalution
                                  pm_list_.back(),
                                  trans_list_.back());
 
+                amg_agglomerate(this->agg_threshold_, &op_list_.back(), &pm_list_.back());
+
                 ++this->levels_;
 
                 if(this->levels_ > 19)
@@ -315,6 +580,208 @@ namespace rocalution
         log_debug(this, "BaseAMG::BuildHierarchy()", " #*# end");
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseAMG<OperatorType, VectorType, ValueType>::BuildMixedPrecision_(void)
+    {
+        log_debug(this, "BaseAMG::BuildMixedPrecision_()", " #*# begin");
+
+        assert(this->hierarchy_ == true);
+        assert(this->levels_ > 2);
+
+        // The single precision hierarchy starts on the first coarse level
+        int levels_l = this->levels_ - 1;
+
+        this->op_level_l_       = new LocalMatrix<float>*[levels_l];
+        this->restrict_level_l_ = new LocalMatrix<float>*[levels_l];
+        this->prolong_level_l_  = new LocalMatrix<float>*[levels_l];
+
+        for(int i = 0; i < levels_l; ++i)
+        {
+            LocalMatrix<ValueType>* cast_res
+                = dynamic_cast<LocalMatrix<ValueType>*>(this->restrict_op_level_[i]);
+            LocalMatrix<ValueType>* cast_pro
+                = dynamic_cast<LocalMatrix<ValueType>*>(this->prolong_op_level_[i]);
+            assert(cast_pro != NULL);
+
+            this->op_level_l_[i]       = new LocalMatrix<float>;
+            this->restrict_level_l_[i] = NULL;
+            this->prolong_level_l_[i]  = new LocalMatrix<float>;
+
+            amg_single_precision(*this->op_level_[i], "Coarse operator", this->op_level_l_[i]);
+            amg_single_precision(*cast_pro, "Prolongation", this->prolong_level_l_[i]);
+
+            if(cast_res != NULL)
+            {
+                this->restrict_level_l_[i] = new LocalMatrix<float>;
+
+                amg_single_precision(*cast_res, "Restriction", this->restrict_level_l_[i]);
+                cast_res->Clear();
+            }
+
+            // Release the working precision data, only the small coarsest operator is kept
+            // for the solver statistics
+            if(i < levels_l - 1)
+            {
+                this->op_level_[i]->Clear();
+            }
+
+            cast_pro->Clear();
+        }
+
+        // Default smoothers and coarse grid solver of the single precision levels
+        int nsmoother = levels_l - 1;
+
+        this->smoother_level_l_
+            = new IterativeLinearSolver<LocalMatrix<float>, LocalVector<float>, float>*[nsmoother];
+        this->sm_default_l_ = new Solver<LocalMatrix<float>, LocalVector<float>, float>*[nsmoother];
+
+        for(int i = 0; i < nsmoother; ++i)
+        {
+            FixedPoint<LocalMatrix<float>, LocalVector<float>, float>* sm
+                = new FixedPoint<LocalMatrix<float>, LocalVector<float>, float>;
+            Jacobi<LocalMatrix<float>, LocalVector<float>, float>* jac
+                = new Jacobi<LocalMatrix<float>, LocalVector<float>, float>;
+
+            sm->SetRelaxation(2.0f / 3.0f);
+            sm->SetPreconditioner(*jac);
+            sm->Verbose(0);
+            this->smoother_level_l_[i] = sm;
+            this->sm_default_l_[i]     = jac;
+        }
+
+        this->solver_coarse_l_ = new SparseLU<LocalMatrix<float>, LocalVector<float>, float>;
+        this->solver_coarse_l_->Verbose(0);
+
+        // Single precision cycle of the coarse levels
+        MultiGrid<LocalMatrix<float>, LocalVector<float>, float>* mg
+            = new MultiGrid<LocalMatrix<float>, LocalVector<float>, float>;
+
+        mg->InitLevels(levels_l);
+        mg->SetOperator(*this->op_level_l_[0]);
+        mg->SetOperatorHierarchy(this->op_level_l_ + 1);
+        mg->SetRestrictOperator(this->restrict_level_l_ + 1);
+        mg->SetProlongOperator(this->prolong_level_l_ + 1);
+        mg->SetSmoother(this->smoother_level_l_);
+        mg->SetSolver(*this->solver_coarse_l_);
+        mg->SetSmootherPreIter(this->iter_pre_smooth_);
+        mg->SetSmootherPostIter(this->iter_post_smooth_);
+        // The K-cycle of the first coarse level is applied by this hierarchy, coarser levels
+        // only use it if it is applied on all levels
+        if(this->cycle_ == Kcycle && this->kcycle_full_ == false)
+        {
+            mg->SetCycle(Vcycle);
+        }
+        else
+        {
+            mg->SetCycle(this->cycle_);
+        }
+
+        mg->SetKcycleFull(this->kcycle_full_);
+        mg->SetScaling(this->scaling_);
+        mg->FlagPrecond();
+        mg->Verbose(0);
+        mg->Build();
+
+        this->mg_l_       = mg;
+        this->op_l_       = this->op_level_l_[0];
+        this->restrict_l_ = this->restrict_level_l_[0];
+        this->prolong_l_  = this->prolong_level_l_[0];
+
+        log_debug(this, "BaseAMG::BuildMixedPrecision_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseAMG<OperatorType, VectorType, ValueType>::ReBuildMixedPrecision_(void)
+    {
+        log_debug(this, "BaseAMG::ReBuildMixedPrecision_()", " #*# begin");
+
+        assert(this->build_ == true);
+        assert(this->mg_l_ != NULL);
+
+        int levels_l = this->levels_ - 1;
+
+        // The sparsity patterns of the coarse operators do not change. If they are kept in
+        // CSR format, only their values are recomputed, in place.
+        bool numeric = (this->op_format_ == CSR);
+
+        // Temporary single precision copy of the finest operator
+        LocalMatrix<float> op_l;
+        amg_single_precision(*this->op_, "Operator", &op_l);
+
+        const LocalMatrix<float>* op = &op_l;
+
+        for(int i = 0; i < levels_l; ++i)
+        {
+            if(i > 0)
+            {
+                op = this->op_level_l_[i - 1];
+            }
+
+            if(i > 0 && i == this->levels_ - this->host_level_ - 1)
+            {
+                this->op_level_l_[i - 1]->MoveToHost();
+            }
+
+            // Restriction operators that are not stored are formed temporarily
+            const LocalMatrix<float>* res = this->restrict_level_l_[i];
+            LocalMatrix<float>        trans;
+
+            if(res == NULL)
+            {
+                trans.CloneBackend(*this->prolong_level_l_[i]);
+                this->prolong_level_l_[i]->Transpose(&trans);
+                res = &trans;
+            }
+
+            if(numeric == false)
+            {
+                this->op_level_l_[i]->CloneBackend(*this->prolong_level_l_[i]);
+            }
+
+            amg_coarse_operator(*op,
+                                *res,
+                                *this->prolong_level_l_[i],
+                                *this->trans_level_[i],
+                                numeric,
+                                NULL,
+                                this->op_level_l_[i]);
+
+            if(i > 0 && i == this->levels_ - this->host_level_ - 1)
+            {
+                this->op_level_l_[i - 1]->CloneBackend(*this->prolong_level_l_[i - 1]);
+            }
+        }
+
+        op_l.Clear();
+
+        // Only the finest level is smoothed in working precision
+        this->smoother_level_[0]->ResetOperator(*this->op_);
+        this->smoother_level_[0]->ReBuildNumeric();
+        this->smoother_level_[0]->Verbose(0);
+
+        for(int i = 0; i < levels_l - 1; ++i)
+        {
+            this->smoother_level_l_[i]->ResetOperator(*this->op_level_l_[i]);
+            this->smoother_level_l_[i]->ReBuildNumeric();
+            this->smoother_level_l_[i]->Verbose(0);
+        }
+
+        this->solver_coarse_l_->ResetOperator(*this->op_level_l_[levels_l - 1]);
+        this->solver_coarse_l_->ReBuildNumeric();
+        this->solver_coarse_l_->Verbose(0);
+
+        // Convert operator to op_format
+        if(this->op_format_ != CSR)
+        {
+            for(int i = 0; i < levels_l; ++i)
+            {
+                this->op_level_l_[i]->ConvertTo(this->op_format_, this->op_blockdim_);
+            }
+        }
+
+        log_debug(this, "BaseAMG::ReBuildMixedPrecision_()", " #*# end");
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void BaseAMG<OperatorType, VectorType, ValueType>::BuildSmoothers(void)
     {
@@ -387,6 +854,45 @@ namespace rocalution
                 delete this->solver_coarse_;
             }
 
+            // De-allocate single precision levels of a mixed precision hierarchy
+            if(this->mg_l_ != NULL)
+            {
+                delete this->mg_l_;
+
+                for(int i = 0; i < this->levels_ - 2; ++i)
+                {
+                    delete this->smoother_level_l_[i];
+                    delete this->sm_default_l_[i];
+                }
+
+                for(int i = 0; i < this->levels_ - 1; ++i)
+                {
+                    delete this->op_level_l_[i];
+                    delete this->restrict_level_l_[i];
+                    delete this->prolong_level_l_[i];
+                }
+
+                delete this->solver_coarse_l_;
+
+                delete[] this->smoother_level_l_;
+                delete[] this->sm_default_l_;
+                delete[] this->op_level_l_;
+                delete[] this->restrict_level_l_;
+                delete[] this->prolong_level_l_;
+
+                this->mg_l_       = NULL;
+                this->op_l_       = NULL;
+                this->restrict_l_ = NULL;
+                this->prolong_l_  = NULL;
+
+                this->op_level_l_       = NULL;
+                this->restrict_level_l_ = NULL;
+                this->prolong_level_l_  = NULL;
+                this->smoother_level_l_ = NULL;
+                this->sm_default_l_     = NULL;
+                this->solver_coarse_l_  = NULL;
+            }
+
             this->levels_    = -1;
             this->build_     = false;
             this->hierarchy_ = false;
@@ -399,6 +905,32 @@ namespace rocalution
     {
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseAMG<OperatorType, VectorType, ValueType>::BuildCoarseOperator_(
+        const OperatorType&           op,
+        const LocalMatrix<ValueType>& restrict,
+        const LocalMatrix<ValueType>& prolong,
+        const LocalVector<int>&       trans,
+        bool                          numeric,
+        ParallelManager*              pm,
+        OperatorType*                 coarse) const
+    {
+        log_debug(this,
+                  "BaseAMG::BuildCoarseOperator_()",
+                  (const void*&)op,
+                  (const void*&)restrict,
+                  (const void*&)prolong,
+                  (const void*&)trans,
+                  numeric,
+                  pm,
+                  coarse);
+
+        assert(pm != NULL);
+        assert(coarse != NULL);
+
+        amg_coarse_operator(op, restrict, prolong, trans, numeric, pm, coarse);
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void BaseAMG<OperatorType, VectorType, ValueType>::SetRestrictOperator(OperatorType** op)
     {
@@ -59,7 +59,8 @@ namespace rocalution
   * inside or outside of the class.
   *
   * All parameters in the Algebraic MultiGrid class can be set externally, including
-  * smoothers and coarse grid solver.
+  * smoothers and coarse grid solver. By default, the coarse grid system is solved
+  * by SparseLU for LocalMatrix and by CG for GlobalMatrix.
   *
   * \tparam OperatorType - can be LocalMatrix or GlobalMatrix
   * \tparam VectorType - can be LocalVector or GlobalVector
@@ -91,6 +92,44 @@ namespace rocalution
         ROCALUTION_EXPORT
         void SetCoarsestLevel(int coarse_size);
 
+        /** \brief Set the number of rows per process below which coarse levels are
+      * agglomerated onto fewer processes
+      * \details
+      * Distributed coarse levels with fewer than \p rows_per_process rows per process are
+      * gathered onto a subset of the processes, such that each remaining process holds
+      * about \p rows_per_process rows. All other processes are idle on those levels and
+      * the number of levels of the hierarchy can therefore differ between processes. A
+      * value of 0 (default) disables agglomeration. It has no effect for LocalMatrix.
+      */
+        ROCALUTION_EXPORT
+        void SetAgglomerationThreshold(int rows_per_process);
+
+        /** \brief Store the coarse levels of the hierarchy in single precision
+      * \details
+      * If enabled, the operators of all coarse levels and all restriction and
+      * prolongation operators are kept in single precision, while the finest level and
+      * an outer Krylov solver remain in double precision. The residual is converted when
+      * it is restricted from the finest level, and the correction when it is prolonged
+      * back. The coarse levels use the default smoothers and a single precision SparseLU
+      * coarse grid solver, manually set smoothers are only used on the finest level. This
+      * halves the memory traffic of the coarse levels and requires at least three levels.
+      * It is only available for LocalMatrix in double precision. ReBuildNumeric()
+      * recomputes the coarse operators in single precision.
+      */
+        ROCALUTION_EXPORT
+        void SetMixedPrecision(bool mixed);
+
+        /** \brief Restrict with the transposed prolongation operators
+      * \details
+      * If enabled, the restriction operators are released once the hierarchy is built
+      * and the residuals are restricted by applying the transposed prolongation
+      * operators instead. This saves the memory of the restriction operators, which
+      * hold as many entries as the prolongation operators. In ReBuildNumeric(), the
+      * restriction operators are formed temporarily for the Galerkin products.
+      */
+        ROCALUTION_EXPORT
+        void SetImplicitRestriction(bool implicit);
+
         /** \brief Set flag to pass smoothers manually for each level */
         ROCALUTION_EXPORT
         void SetManualSmoothers(bool sm_manual);
@@ -128,9 +167,52 @@ namespace rocalution
                                 LocalVector<int>*    trans)
             = 0;
 
+        /** \brief Constructs the coarse operator from the restriction and prolongation,
+      * only its values are recomputed if \p numeric is set. \p trans is the coarse map
+      * of the interpolation, if its prolongation has columns for the ghost layer.
+      */
+        void BuildCoarseOperator_(const OperatorType&           op,
+                                  const LocalMatrix<ValueType>& restrict,
+                                  const LocalMatrix<ValueType>& prolong,
+                                  const LocalVector<int>&       trans,
+                                  bool                          numeric,
+                                  ParallelManager*              pm,
+                                  OperatorType*                 coarse) const;
+
+        /** \brief Converts the coarse levels and the intergrid transfer operators into
+      * single precision and releases their working precision data
+      */
+        void BuildMixedPrecision_(void);
+        /** \brief Recomputes the single precision coarse operators of a mixed precision
+      * hierarchy and rebuilds its smoothers and coarse grid solver numerically
+      */
+        void ReBuildMixedPrecision_(void);
+
         /** \brief Maximal coarse grid size */
         int coarse_size_;
 
+        /** \brief Rows per process below which coarse levels are agglomerated */
+        int agg_threshold_;
+
+        /** \brief Restriction operators are not stored */
+        bool implicit_restriction_;
+
+        /** \brief Coarse levels are stored in single precision */
+        bool mixed_precision_;
+
+        /** \brief Single precision operator hierarchy of a mixed precision hierarchy */
+        LocalMatrix<float>** op_level_l_;
+        /** \brief Single precision restriction operator hierarchy */
+        LocalMatrix<float>** restrict_level_l_;
+        /** \brief Single precision prolongation operator hierarchy */
+        LocalMatrix<float>** prolong_level_l_;
+        /** \brief Single precision smoothers of the coarse levels */
+        IterativeLinearSolver<LocalMatrix<float>, LocalVector<float>, float>** smoother_level_l_;
+        /** \brief Single precision smoother preconditioners of the coarse levels */
+        Solver<LocalMatrix<float>, LocalVector<float>, float>** sm_default_l_;
+        /** \brief Single precision coarse grid solver */
+        Solver<LocalMatrix<float>, LocalVector<float>, float>* solver_coarse_l_;
+
         /** \brief Smoother is set manually or not */
         bool set_sm_;
         /** \brief Smoother hierarchy */
@@ -31,8 +31,10 @@
 #include "../../base/global_matrix.hpp"
 #include "../../base/global_vector.hpp"
 
+#include "../../utils/allocate_free.hpp"
 #include "../../utils/log.hpp"
 #include "../../utils/math_functions.hpp"
+#include "../../utils/profiler.hpp"
 
 #include <complex>
 #include <math.h>
@@ -40,6 +42,130 @@
 namespace rocalution
 {
 
+    // Conversion of the finest level residual of a mixed precision hierarchy into single
+    // precision
+    static void mg_single_precision(const LocalVector<double>& in, LocalVector<float>* out)
+    {
+        out->CloneBackend(in);
+        out->CopyFromDouble(in);
+    }
+
+    // Mixed precision hierarchies are only available in double precision
+    template <typename ValueType>
+    static void mg_single_precision(const LocalVector<ValueType>& in, LocalVector<float>* out)
+    {
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    // Conversion of the prolonged single precision correction into double precision
+    static void mg_working_precision(const LocalVector<float>& in, LocalVector<double>* out)
+    {
+        out->CopyFromFloat(in);
+    }
+
+    // Mixed precision hierarchies are only available in double precision
+    template <typename ValueType>
+    static void mg_working_precision(const LocalVector<float>& in, LocalVector<ValueType>* out)
+    {
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    // Restriction of a level, levels without a stored restriction operator restrict with
+    // the transposed prolongation
+    template <typename ValueType>
+    static void mg_restrict(const Operator<ValueType>*    restrict,
+                            const Operator<ValueType>*    prolong,
+                            const LocalVector<ValueType>& fine,
+                            LocalVector<ValueType>*       coarse)
+    {
+        if(restrict != NULL)
+        {
+            restrict->Apply(fine, coarse);
+
+            return;
+        }
+
+        const LocalMatrix<ValueType>* cast_pro
+            = dynamic_cast<const LocalMatrix<ValueType>*>(prolong);
+
+        assert(cast_pro != NULL);
+
+        cast_pro->ApplyTranspose(fine, coarse);
+    }
+
+    // Local operators have no ghost layer, the parameters only select the overload
+    template <typename ValueType>
+    static void mg_restrict(const Operator<ValueType>* restrict,
+                            const Operator<ValueType>* prolong,
+                            const LocalMatrix<ValueType>&,
+                            const LocalVector<int>*,
+                            const LocalVector<ValueType>& fine,
+                            LocalVector<ValueType>*       coarse)
+    {
+        mg_restrict(restrict, prolong, fine, coarse);
+    }
+
+    // Prolongations of distributed operators, that come with a coarse map, have further
+    // columns for the coarse points of the ghost layer. Their entries are sent to the owners.
+    template <typename ValueType>
+    static void mg_restrict(const Operator<ValueType>*     restrict,
+                            const Operator<ValueType>*     prolong,
+                            const GlobalMatrix<ValueType>& op,
+                            const LocalVector<int>*        map,
+                            const LocalVector<ValueType>&  fine,
+                            LocalVector<ValueType>*        coarse)
+    {
+        if(map == NULL || map->GetSize() == 0)
+        {
+            mg_restrict(restrict, prolong, fine, coarse);
+
+            return;
+        }
+
+        LocalVector<ValueType> ext;
+
+        ext.CloneBackend(fine);
+        ext.Allocate("restriction", prolong->GetN());
+
+        mg_restrict(restrict, prolong, fine, &ext);
+        op.RestrictCoarseGhost(*map, ext, coarse);
+    }
+
+    // Local operators have no ghost layer, the parameters only select the overload
+    template <typename ValueType>
+    static void mg_prolong(const Operator<ValueType>* prolong,
+                           const LocalMatrix<ValueType>&,
+                           const LocalVector<int>*,
+                           const LocalVector<ValueType>& coarse,
+                           LocalVector<ValueType>*       fine)
+    {
+        prolong->Apply(coarse, fine);
+    }
+
+    // The coarse points of the ghost layer are received from their owners first
+    template <typename ValueType>
+    static void mg_prolong(const Operator<ValueType>*     prolong,
+                           const GlobalMatrix<ValueType>& op,
+                           const LocalVector<int>*        map,
+                           const LocalVector<ValueType>&  coarse,
+                           LocalVector<ValueType>*        fine)
+    {
+        if(map == NULL || map->GetSize() == 0)
+        {
+            prolong->Apply(coarse, fine);
+
+            return;
+        }
+
+        LocalVector<ValueType> ext;
+
+        ext.CloneBackend(coarse);
+        ext.Allocate("prolongation", prolong->GetN());
+
+        op.ProlongCoarseGhost(*map, coarse, &ext);
+        prolong->Apply(ext, fine);
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     BaseMultiGrid<OperatorType, VectorType, ValueType>::BaseMultiGrid()
     {
@@ -72,7 +198,19 @@ namespace rocalution
 
         this->kcycle_full_ = true;
 
-        this->pm_level_ = NULL;
+        this->trans_level_ = NULL;
+        this->pm_level_    = NULL;
+        this->agg_level_   = NULL;
+
+        this->mg_l_       = NULL;
+        this->op_l_       = NULL;
+        this->restrict_l_ = NULL;
+        this->prolong_l_  = NULL;
+
+        this->r_l_  = NULL;
+        this->rc_l_ = NULL;
+        this->xc_l_ = NULL;
+        this->q_l_  = NULL;
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -234,8 +372,11 @@ namespace rocalution
         this->smoother_level_[0]->Build();
         this->smoother_level_[0]->FlagSmoother();
 
-        // Coarse levels
-        for(int i = 1; i < this->levels_ - 1; ++i)
+        // Coarse levels, unless they are smoothed and solved in single precision by a mixed
+        // precision hierarchy
+        bool mixed = (this->mg_l_ != NULL);
+
+        for(int i = 1; i < this->levels_ - 1 && mixed == false; ++i)
         {
             assert(this->smoother_level_[i] != NULL);
 
@@ -247,8 +388,32 @@ namespace rocalution
         // Initialize coarse grid solver
         assert(this->solver_coarse_ != NULL);
 
-        this->solver_coarse_->SetOperator(*op_level_[this->levels_ - 2]);
-        this->solver_coarse_->Build();
+        bool idle = this->IdleCoarsestLevel_();
+
+        if(idle == false && mixed == false)
+        {
+            this->solver_coarse_->SetOperator(*op_level_[this->levels_ - 2]);
+            this->solver_coarse_->Build();
+        }
+
+        // Restricted vectors of agglomerated levels
+        if(this->pm_level_ != NULL)
+        {
+            this->agg_level_ = new LocalVector<ValueType>*[this->levels_ - 1];
+
+            for(int i = 0; i < this->levels_ - 1; ++i)
+            {
+                this->agg_level_[i] = NULL;
+
+                if(this->pm_level_[i] != NULL && this->pm_level_[i]->IsAgglomerated() == true)
+                {
+                    this->agg_level_[i] = new LocalVector<ValueType>;
+                    this->agg_level_[i]->CloneBackend(*this->prolong_op_level_[i]);
+                    this->agg_level_[i]->Allocate("agglomeration",
+                                                  this->pm_level_[i]->GetParentLocalSize());
+                }
+            }
+        }
 
         // Setup all temporary vectors for the cycles - needed on all levels
         this->d_level_ = new VectorType*[this->levels_];
@@ -268,7 +433,11 @@ namespace rocalution
             {
                 this->s_level_[i] = new VectorType;
                 this->s_level_[i]->CloneBackend(*this->op_level_[i - 1]);
-                this->s_level_[i]->Allocate("temporary", this->op_level_[i - 1]->GetM());
+
+                if((i < this->levels_ - 1 || idle == false) && mixed == false)
+                {
+                    this->s_level_[i]->Allocate("temporary", this->op_level_[i - 1]->GetM());
+                }
             }
         }
 
@@ -281,7 +450,11 @@ namespace rocalution
             {
                 this->q_level_[i] = new VectorType;
                 this->q_level_[i]->CloneBackend(*this->op_level_[i]);
-                this->q_level_[i]->Allocate("q", this->op_level_[i]->GetM());
+
+                if(mixed == false)
+                {
+                    this->q_level_[i]->Allocate("q", this->op_level_[i]->GetM());
+                }
             }
         }
 
@@ -290,14 +463,22 @@ namespace rocalution
             // On finest level, we need to get the size from this->op_ instead
             this->d_level_[i] = new VectorType;
             this->d_level_[i]->CloneBackend(*this->op_level_[i - 1]);
-            this->d_level_[i]->Allocate("defect correction", this->op_level_[i - 1]->GetM());
 
             this->r_level_[i] = new VectorType;
             this->r_level_[i]->CloneBackend(*this->op_level_[i - 1]);
-            this->r_level_[i]->Allocate("residual", this->op_level_[i - 1]->GetM());
 
             this->t_level_[i] = new VectorType;
             this->t_level_[i]->CloneBackend(*this->op_level_[i - 1]);
+
+            // An idle coarsest level holds no data on this process, neither do the coarse
+            // levels of a mixed precision hierarchy
+            if((i == this->levels_ - 1 && idle == true) || mixed == true)
+            {
+                continue;
+            }
+
+            this->d_level_[i]->Allocate("defect correction", this->op_level_[i - 1]->GetM());
+            this->r_level_[i]->Allocate("residual", this->op_level_[i - 1]->GetM());
             this->t_level_[i]->Allocate("temporary", this->op_level_[i - 1]->GetM());
         }
 
@@ -309,6 +490,30 @@ namespace rocalution
         this->t_level_[0]->CloneBackend(*this->op_);
         this->t_level_[0]->Allocate("temporary", this->op_->GetM());
 
+        // Single precision vectors of the intergrid transfers of a mixed precision hierarchy
+        if(mixed == true)
+        {
+            this->r_l_  = new LocalVector<float>;
+            this->rc_l_ = new LocalVector<float>;
+            this->xc_l_ = new LocalVector<float>;
+
+            this->r_l_->CloneBackend(*this->prolong_l_);
+            this->rc_l_->CloneBackend(*this->prolong_l_);
+            this->xc_l_->CloneBackend(*this->prolong_l_);
+
+            this->r_l_->Allocate("residual", this->prolong_l_->GetM());
+            this->rc_l_->Allocate("residual", this->prolong_l_->GetN());
+            this->xc_l_->Allocate("defect correction", this->prolong_l_->GetN());
+
+            // Extra vector for K-cycle
+            if(this->cycle_ == Kcycle)
+            {
+                this->q_l_ = new LocalVector<float>;
+                this->q_l_->CloneBackend(*this->prolong_l_);
+                this->q_l_->Allocate("q", this->prolong_l_->GetN());
+            }
+        }
+
         log_debug(this, "BaseMultiGrid::Initialize()", " #*# end");
     }
 
@@ -317,6 +522,8 @@ namespace rocalution
     {
         log_debug(this, "BaseMultiGrid::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("BaseMultiGrid::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -329,7 +536,6 @@ namespace rocalution
         {
             assert(this->op_level_[i] != NULL);
             assert(this->smoother_level_[i] != NULL);
-            assert(this->restrict_op_level_[i] != NULL);
             assert(this->prolong_op_level_[i] != NULL);
         }
 
@@ -366,20 +572,40 @@ namespace rocalution
         if(this->build_ == true)
         {
             // Clear transfer mapping
-            for(int i = 0; i < this->levels_ - 1; ++i)
+            if(this->trans_level_ != NULL)
             {
-                delete this->trans_level_[i];
-            }
+                for(int i = 0; i < this->levels_ - 1; ++i)
+                {
+                    delete this->trans_level_[i];
+                }
 
-            delete[] this->trans_level_;
+                delete[] this->trans_level_;
+                this->trans_level_ = NULL;
+            }
 
             // Clear parallel manager
-            for(int i = 0; i < this->levels_ - 1; ++i)
+            if(this->pm_level_ != NULL)
             {
-                delete this->pm_level_[i];
+                for(int i = 0; i < this->levels_ - 1; ++i)
+                {
+                    delete this->pm_level_[i];
+                }
+
+                delete[] this->pm_level_;
+                this->pm_level_ = NULL;
             }
 
-            delete[] this->pm_level_;
+            // Clear restricted vectors of agglomerated levels
+            if(this->agg_level_ != NULL)
+            {
+                for(int i = 0; i < this->levels_ - 1; ++i)
+                {
+                    delete this->agg_level_[i];
+                }
+
+                delete[] this->agg_level_;
+                this->agg_level_ = NULL;
+            }
 
             // Clear temporary VectorTypes
             for(int i = 0; i < this->levels_; ++i)
@@ -396,6 +622,17 @@ namespace rocalution
             delete[] this->r_level_;
             delete[] this->t_level_;
 
+            // Clear single precision vectors of a mixed precision hierarchy
+            delete this->r_l_;
+            delete this->rc_l_;
+            delete this->xc_l_;
+            delete this->q_l_;
+
+            this->r_l_  = NULL;
+            this->rc_l_ = NULL;
+            this->xc_l_ = NULL;
+            this->q_l_  = NULL;
+
             // Clear structure for scaling
             if(this->scaling_)
             {
@@ -457,7 +694,10 @@ namespace rocalution
                 }
                 this->t_level_[i]->MoveToHost();
 
-                this->restrict_op_level_[i]->MoveToHost();
+                if(this->restrict_op_level_[i] != NULL)
+                {
+                    this->restrict_op_level_[i]->MoveToHost();
+                }
                 this->prolong_op_level_[i]->MoveToHost();
             }
 
@@ -481,6 +721,26 @@ namespace rocalution
                 }
             }
 
+            // Coarse levels of a mixed precision hierarchy
+            if(this->mg_l_ != NULL)
+            {
+                this->op_l_->MoveToHost();
+                if(this->restrict_l_ != NULL)
+                {
+                    this->restrict_l_->MoveToHost();
+                }
+                this->prolong_l_->MoveToHost();
+                this->r_l_->MoveToHost();
+                this->rc_l_->MoveToHost();
+                this->xc_l_->MoveToHost();
+                this->mg_l_->MoveToHost();
+
+                if(this->q_l_ != NULL)
+                {
+                    this->q_l_->MoveToHost();
+                }
+            }
+
             if(this->precond_ != NULL)
             {
                 this->precond_->MoveToHost();
@@ -507,7 +767,10 @@ namespace rocalution
                 if(i < this->levels_ - this->host_level_ - 1)
                 {
                     this->op_level_[i]->MoveToAccelerator();
-                    this->restrict_op_level_[i]->MoveToAccelerator();
+                    if(this->restrict_op_level_[i] != NULL)
+                    {
+                        this->restrict_op_level_[i]->MoveToAccelerator();
+                    }
                     this->prolong_op_level_[i]->MoveToAccelerator();
                 }
             }
@@ -559,6 +822,30 @@ namespace rocalution
                 }
             }
 
+            // Coarse levels of a mixed precision hierarchy
+            if(this->mg_l_ != NULL)
+            {
+                this->r_l_->MoveToAccelerator();
+
+                if(this->host_level_ < this->levels_ - 1)
+                {
+                    this->op_l_->MoveToAccelerator();
+                    if(this->restrict_l_ != NULL)
+                    {
+                        this->restrict_l_->MoveToAccelerator();
+                    }
+                    this->prolong_l_->MoveToAccelerator();
+                    this->rc_l_->MoveToAccelerator();
+                    this->xc_l_->MoveToAccelerator();
+                    this->mg_l_->MoveToAccelerator();
+
+                    if(this->q_l_ != NULL)
+                    {
+                        this->q_l_->MoveToAccelerator();
+                    }
+                }
+            }
+
             if(this->precond_ != NULL)
             {
                 this->precond_->MoveToAccelerator();
@@ -583,7 +870,10 @@ namespace rocalution
             int level = this->levels_ - i;
 
             this->op_level_[level - 2]->MoveToHost();
-            this->restrict_op_level_[level - 2]->MoveToHost();
+            if(this->restrict_op_level_[level - 2] != NULL)
+            {
+                this->restrict_op_level_[level - 2]->MoveToHost();
+            }
             this->prolong_op_level_[level - 2]->MoveToHost();
 
             // Move temporary vectors
@@ -609,6 +899,33 @@ namespace rocalution
                 }
             }
         }
+
+        // Move coarse levels of a mixed precision hierarchy, its first level is the first
+        // coarse level of this hierarchy
+        if(this->mg_l_ != NULL)
+        {
+            if(this->host_level_ < this->levels_ - 1)
+            {
+                this->mg_l_->SetHostLevels(this->host_level_);
+            }
+            else
+            {
+                this->op_l_->MoveToHost();
+                if(this->restrict_l_ != NULL)
+                {
+                    this->restrict_l_->MoveToHost();
+                }
+                this->prolong_l_->MoveToHost();
+                this->rc_l_->MoveToHost();
+                this->xc_l_->MoveToHost();
+                this->mg_l_->MoveToHost();
+
+                if(this->q_l_ != NULL)
+                {
+                    this->q_l_->MoveToHost();
+                }
+            }
+        }
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -617,6 +934,8 @@ namespace rocalution
     {
         log_debug(this, "BaseMultiGrid::Solve()", " #*# begin", (const void*&)rhs, x);
 
+        ProfilerRegion region("BaseMultiGrid::Solve");
+
         assert(this->levels_ > 1);
         assert(x != NULL);
         assert(x != &rhs);
@@ -656,7 +975,6 @@ namespace rocalution
             }
             assert(this->smoother_level_[i] != NULL);
 
-            assert(this->restrict_op_level_[i] != NULL);
             assert(this->prolong_op_level_[i] != NULL);
         }
 
@@ -714,8 +1032,78 @@ namespace rocalution
     {
         log_debug(this, "BaseMultiGrid::Restrict_()", (const void*&)fine, coarse);
 
-        this->restrict_op_level_[this->current_level_]->Apply(fine.GetInterior(),
-                                                              &(coarse->GetInterior()));
+        ProfilerRegion region("restriction");
+
+        // The coarse levels of a mixed precision hierarchy are stored in single precision,
+        // thus the residual is converted before it is restricted
+        if(this->mg_l_ != NULL)
+        {
+            assert(this->current_level_ == 0);
+
+            mg_single_precision(fine.GetInterior(), this->r_l_);
+            mg_restrict<float>(this->restrict_l_, this->prolong_l_, *this->r_l_, this->rc_l_);
+
+            return;
+        }
+
+        ParallelManager* pm
+            = (this->pm_level_ != NULL) ? this->pm_level_[this->current_level_] : NULL;
+
+        // Operator and coarse map of the fine level
+        const OperatorType* op = (this->current_level_ == 0)
+                                     ? this->op_
+                                     : this->op_level_[this->current_level_ - 1];
+        const LocalVector<int>* map = this->CoarseMap_(this->current_level_);
+
+        if(pm == NULL || pm->IsAgglomerated() == false)
+        {
+            mg_restrict(this->restrict_op_level_[this->current_level_],
+                        this->prolong_op_level_[this->current_level_],
+                        *op,
+                        map,
+                        fine.GetInterior(),
+                        &(coarse->GetInterior()));
+
+            return;
+        }
+
+        // Restrict to the local part of this process and gather it on the group leader
+        LocalVector<ValueType>* agg = this->agg_level_[this->current_level_];
+
+        agg->CloneBackend(fine.GetInterior());
+        mg_restrict(this->restrict_op_level_[this->current_level_],
+                    this->prolong_op_level_[this->current_level_],
+                    *op,
+                    map,
+                    fine.GetInterior(),
+                    agg);
+
+        int nrow     = pm->GetParentLocalSize();
+        int agg_nrow = (pm->IsIdle() == false) ? pm->GetLocalSize() : 0;
+
+        ValueType* values     = NULL;
+        ValueType* agg_values = NULL;
+
+        allocate_host(nrow, &values);
+        allocate_host(agg_nrow, &agg_values);
+
+        if(nrow > 0)
+        {
+            agg->CopyToData(values);
+        }
+
+        pm->GatherAgglomerated(values, agg_values);
+
+        if(agg_nrow > 0)
+        {
+            coarse->GetInterior().CopyFromData(agg_values);
+            free_host(&agg_values);
+        }
+
+        if(nrow > 0)
+        {
+            free_host(&values);
+        }
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -724,8 +1112,88 @@ namespace rocalution
     {
         log_debug(this, "BaseMultiGrid::Prolong_()", (const void*&)coarse, fine);
 
-        this->prolong_op_level_[this->current_level_]->Apply(coarse.GetInterior(),
-                                                             &(fine->GetInterior()));
+        ProfilerRegion region("prolongation");
+
+        // Prolong the single precision correction of a mixed precision hierarchy and convert
+        // it back into working precision
+        if(this->mg_l_ != NULL)
+        {
+            assert(this->current_level_ == 0);
+
+            this->prolong_l_->Apply(*this->xc_l_, this->r_l_);
+            mg_working_precision(*this->r_l_, &(fine->GetInterior()));
+
+            return;
+        }
+
+        ParallelManager* pm
+            = (this->pm_level_ != NULL) ? this->pm_level_[this->current_level_] : NULL;
+
+        // Operator and coarse map of the fine level
+        const OperatorType* op = (this->current_level_ == 0)
+                                     ? this->op_
+                                     : this->op_level_[this->current_level_ - 1];
+        const LocalVector<int>* map = this->CoarseMap_(this->current_level_);
+
+        if(pm == NULL || pm->IsAgglomerated() == false)
+        {
+            mg_prolong(this->prolong_op_level_[this->current_level_],
+                       *op,
+                       map,
+                       coarse.GetInterior(),
+                       &(fine->GetInterior()));
+
+            return;
+        }
+
+        // Scatter the local part of this process from the group leader and prolong it
+        LocalVector<ValueType>* agg = this->agg_level_[this->current_level_];
+
+        int nrow     = pm->GetParentLocalSize();
+        int agg_nrow = (pm->IsIdle() == false) ? pm->GetLocalSize() : 0;
+
+        ValueType* values     = NULL;
+        ValueType* agg_values = NULL;
+
+        allocate_host(nrow, &values);
+        allocate_host(agg_nrow, &agg_values);
+
+        if(agg_nrow > 0)
+        {
+            coarse.GetInterior().CopyToData(agg_values);
+        }
+
+        pm->ScatterAgglomerated(agg_values, values);
+
+        agg->CloneBackend(fine->GetInterior());
+
+        if(nrow > 0)
+        {
+            agg->CopyFromData(values);
+            free_host(&values);
+        }
+
+        if(agg_nrow > 0)
+        {
+            free_host(&agg_values);
+        }
+
+        mg_prolong(
+            this->prolong_op_level_[this->current_level_], *op, map, *agg, &(fine->GetInterior()));
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    bool BaseMultiGrid<OperatorType, VectorType, ValueType>::IdleCoarsestLevel_(void) const
+    {
+        return this->pm_level_ != NULL && this->pm_level_[this->levels_ - 2] != NULL
+               && this->pm_level_[this->levels_ - 2]->IsIdle() == true;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    const LocalVector<int>*
+        BaseMultiGrid<OperatorType, VectorType, ValueType>::CoarseMap_(int) const
+    {
+        return NULL;
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -734,10 +1202,27 @@ namespace rocalution
     {
         log_debug(this, "BaseMultiGrid::Vcycle_()", " #*# begin", (const void*&)rhs, x);
 
-        // Run coarse grid solver, if coarsest grid has been reached
+        ProfilerRegion region("level", this->current_level_);
+
+        // Run coarse grid solver, if coarsest grid has been reached - processes that are
+        // idle on the coarsest level only take part in the intergrid transfers
         if(this->current_level_ == this->levels_ - 1)
         {
-            this->solver_coarse_->SolveZeroSol(rhs, x);
+            if(this->IdleCoarsestLevel_() == false)
+            {
+                ProfilerRegion coarse("coarse solver");
+
+                this->solver_coarse_->SolveZeroSol(rhs, x);
+            }
+
+            return;
+        }
+
+        // The coarse levels of a mixed precision hierarchy are cycled in single precision
+        if(this->mg_l_ != NULL && this->current_level_ == 1)
+        {
+            this->mg_l_->SolveZeroSol(*this->rc_l_, this->xc_l_);
+
             return;
         }
 
@@ -760,49 +1245,71 @@ namespace rocalution
         ValueType factor;
         ValueType divisor;
 
+        // Scaling of the smoothed solution changes the residual, thus smoothing and
+        // residual computation can only be fused without it
+        bool scale_pre_smooth = this->scaling_ == true && this->current_level_ > 0
+                                && this->current_level_ < this->levels_ - 2
+                                && this->iter_pre_smooth_ > 0;
+
         // Pre-smoothing
-        smoother->InitMaxIter(this->iter_pre_smooth_);
-        if(this->is_precond_ || this->current_level_ != 0)
-        {
-            // When this AMG is a preconditioner or if we are not on the finest level,
-            // we have to use a zero initial guess
-            smoother->SolveZeroSol(rhs, x);
-        }
-        else
         {
-            // For AMG as a solver, x cannot be zero
-            smoother->Solve(rhs, x);
-        }
+            ProfilerRegion smoothing("pre-smoothing");
 
-        // Scaling
-        if(this->scaling_ == true)
-        {
-            if(this->current_level_ > 0 && this->current_level_ < this->levels_ - 2
-               && this->iter_pre_smooth_ > 0)
+            smoother->InitMaxIter(this->iter_pre_smooth_);
+            if(this->is_precond_ || this->current_level_ != 0)
             {
-                s->PointWiseMult(rhs, *x);
-                factor = s->Reduce();
-                op->Apply(*x, s);
-                s->PointWiseMult(*x);
-
-                divisor = s->Reduce();
-
-                if(divisor == static_cast<ValueType>(0))
+                // When this AMG is a preconditioner or if we are not on the finest level,
+                // we have to use a zero initial guess
+                if(scale_pre_smooth == true)
                 {
-                    factor = static_cast<ValueType>(1);
+                    smoother->SolveZeroSol(rhs, x);
                 }
                 else
                 {
-                    factor /= divisor;
+                    // Smoothing and residual update r = b - Ax
+                    smoother->SolveZeroSolResidual(rhs, x, r);
+                }
+            }
+            else
+            {
+                // For AMG as a solver, x cannot be zero
+                if(scale_pre_smooth == true)
+                {
+                    smoother->Solve(rhs, x);
+                }
+                else
+                {
+                    // Smoothing and residual update r = b - Ax
+                    smoother->SolveResidual(rhs, x, r);
                 }
-
-                x->Scale(factor);
             }
         }
 
-        // Update residual r = b - Ax
-        op->Apply(*x, r);
-        r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+        // Scaling
+        if(scale_pre_smooth == true)
+        {
+            s->PointWiseMult(rhs, *x);
+            factor = s->Reduce();
+            op->Apply(*x, s);
+            s->PointWiseMult(*x);
+
+            divisor = s->Reduce();
+
+            if(divisor == static_cast<ValueType>(0))
+            {
+                factor = static_cast<ValueType>(1);
+            }
+            else
+            {
+                factor /= divisor;
+            }
+
+            x->Scale(factor);
+
+            // Update residual r = b - Ax
+            op->Apply(*x, r);
+            r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+        }
 
         // Copy s when scaling is enabled
         if(this->scaling_ && this->current_level_ == 0)
@@ -911,18 +1418,22 @@ namespace rocalution
         }
 
         // Post-smoothing on finest level
+        ProfilerRegion smoothing("post-smoothing");
+
         smoother->InitMaxIter(this->iter_post_smooth_);
-        smoother->Solve(rhs, x);
 
         // Only update the residual, if this is not a preconditioner
         if(this->current_level_ == 0 && this->is_precond_ == false)
         {
-            // Update residual
-            op->Apply(*x, r);
-            r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+            // Smoothing and residual update r = b - Ax
+            smoother->SolveResidual(rhs, x, r);
 
             this->res_norm_ = std::abs(this->Norm_(*r));
         }
+        else
+        {
+            smoother->Solve(rhs, x);
+        }
 
         log_debug(this, "BaseMultiGrid::Vcycle_()", " #*# end");
     }
@@ -954,6 +1465,11 @@ namespace rocalution
         {
             this->Vcycle_(rhs, x);
         }
+        else if(this->mg_l_ != NULL)
+        {
+            // The coarse levels of a mixed precision hierarchy are cycled in single precision
+            this->KcycleMixedPrecision_();
+        }
         else if(this->current_level_ < this->levels_ - 1)
         {
             VectorType* q = this->q_level_[this->current_level_ - 1];
@@ -1015,12 +1531,74 @@ namespace rocalution
             // x = x + alpha * r
             x->AddScale(*r, alpha);
         }
-        else
+        else if(this->IdleCoarsestLevel_() == false)
         {
+            ProfilerRegion coarse("coarse solver");
+
             this->solver_coarse_->SolveZeroSol(rhs, x);
         }
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseMultiGrid<OperatorType, VectorType, ValueType>::KcycleMixedPrecision_(void)
+    {
+        assert(this->mg_l_ != NULL);
+        assert(this->current_level_ == 1);
+
+        // The restricted residual is not required anymore and is used as temporary
+        LocalVector<float>* r = this->rc_l_;
+        LocalVector<float>* x = this->xc_l_;
+        LocalVector<float>* q = this->q_l_;
+
+        // Start 2 CG iterations
+
+        float rho;
+        float rho_old;
+        float alpha;
+
+        // Cycle
+        this->mg_l_->SolveZeroSol(*r, x);
+
+        // rho = (r,x)
+        rho = r->DotNonConj(*x);
+
+        // q = Ax
+        this->op_l_->Apply(*x, q);
+
+        // alpha = rho / (x,q)
+        alpha = rho / x->DotNonConj(*q);
+
+        // r = r - alpha * q
+        r->AddScale(*q, -alpha);
+
+        // Cycle
+        this->mg_l_->SolveZeroSol(*r, q);
+
+        // rho_old = rho
+        rho_old = rho;
+
+        // rho = (r,q)
+        rho = r->DotNonConj(*q);
+
+        // r = x
+        r->CopyFrom(*x);
+
+        // r = r * rho / rho_old + q
+        r->ScaleAdd(rho / rho_old, *q);
+
+        // q = Ar
+        this->op_l_->Apply(*r, q);
+
+        // x = x * alpha
+        x->Scale(alpha);
+
+        // alpha = rho / (r,q)
+        alpha = rho / r->DotNonConj(*q);
+
+        // x = x + alpha * r
+        x->AddScale(*r, alpha);
+    }
+
     // do nothing
     template <class OperatorType, class VectorType, typename ValueType>
     void BaseMultiGrid<OperatorType, VectorType, ValueType>::SolveNonPrecond_(const VectorType& rhs,
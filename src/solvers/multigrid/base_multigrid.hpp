@@ -78,7 +78,11 @@ namespace rocalution
         ROCALUTION_EXPORT
         void SetSmootherPostIter(int iter);
 
-        /** \brief Set the restriction operator for each level */
+        /** \brief Set the restriction operator for each level
+      * \details
+      * Levels without a restriction operator (NULL) restrict with the transpose of their
+      * prolongation operator, which has to be a LocalMatrix.
+      */
         virtual void SetRestrictOperator(OperatorType** op) = 0;
 
         /** \brief Set the prolongation operator for each level */
@@ -130,6 +134,8 @@ namespace rocalution
         void Fcycle_(const VectorType& rhs, VectorType* x);
         /** \brief K-cycle */
         void Kcycle_(const VectorType& rhs, VectorType* x);
+        /** \brief K-cycle of the first coarse level of a mixed precision hierarchy */
+        void KcycleMixedPrecision_(void);
 
         /** \private */
         virtual void SolveNonPrecond_(const VectorType& rhs, VectorType* x);
@@ -146,6 +152,16 @@ namespace rocalution
         /** \brief Move all level data to the host */
         void MoveHostLevels_(void);
 
+        /** \brief Returns true, if this process holds no part of the coarsest level, due to
+      * agglomeration of the coarse levels onto fewer processes
+      */
+        bool IdleCoarsestLevel_(void) const;
+
+        /** \brief Returns the coarse map of a level, if its prolongation has further columns
+      * for the coarse points of the ghost layer, NULL otherwise
+      */
+        virtual const LocalVector<int>* CoarseMap_(int level) const;
+
         /** \brief Number of levels in the hierarchy */
         int levels_;
         /** \brief Host levels */
@@ -169,7 +185,9 @@ namespace rocalution
         /** \brief Operator hierarchy */
         OperatorType** op_level_;
 
-        /** \brief Restriction operator hierarchy */
+        /** \brief Restriction operator hierarchy, NULL entries restrict with the transposed
+      * prolongation
+      */
         Operator<ValueType>** restrict_op_level_;
         /** \brief Prolongation operator hierarchy */
         Operator<ValueType>** prolong_op_level_;
@@ -191,6 +209,25 @@ namespace rocalution
 
         /** \brief Parallel Manager for coarser levels */
         ParallelManager** pm_level_;
+
+        /** \brief Restricted vectors of agglomerated levels, before they are gathered */
+        LocalVector<ValueType>** agg_level_;
+
+        /** \brief Single precision cycle of the coarse levels of a mixed precision
+      * hierarchy
+      */
+        BaseMultiGrid<LocalMatrix<float>, LocalVector<float>, float>* mg_l_;
+        /** \brief Single precision operator of the first coarse level */
+        LocalMatrix<float>* op_l_;
+        /** \brief Single precision restriction operator of the finest level */
+        LocalMatrix<float>* restrict_l_;
+        /** \brief Single precision prolongation operator of the finest level */
+        LocalMatrix<float>* prolong_l_;
+
+        LocalVector<float>* r_l_; /**< \private */
+        LocalVector<float>* rc_l_; /**< \private */
+        LocalVector<float>* xc_l_; /**< \private */
+        LocalVector<float>* q_l_; /**< \private */
     };
 
 } // namespace rocalution
@@ -42,6 +42,48 @@
 namespace rocalution
 {
 
+    // Coarse operator of local operators from the pairwise aggregates
+    template <typename ValueType>
+    static void pairwise_coarse_operator(const LocalMatrix<ValueType>& op,
+                                         int                           nc,
+                                         const LocalVector<int>&       trans,
+                                         int                           Gsize,
+                                         const int*                    rG,
+                                         int                           rGsize,
+                                         ParallelManager*              pm,
+                                         LocalMatrix<ValueType>*       coarse)
+    {
+        op.CoarsenOperator(coarse, pm, nc, nc, trans, Gsize, rG, rGsize);
+    }
+
+    // Coarse operator of distributed operators from the pairwise aggregates - agglomerated
+    // coarse operators are computed on the processes of the fine level first
+    template <typename ValueType>
+    static void pairwise_coarse_operator(const GlobalMatrix<ValueType>& op,
+                                         int                            nc,
+                                         const LocalVector<int>&        trans,
+                                         int                            Gsize,
+                                         const int*                     rG,
+                                         int                            rGsize,
+                                         ParallelManager*               pm,
+                                         GlobalMatrix<ValueType>*       coarse)
+    {
+        if(pm->IsAgglomerated() == false)
+        {
+            op.CoarsenOperator(coarse, pm, nc, nc, trans, Gsize, rG, rGsize);
+
+            return;
+        }
+
+        ParallelManager         pm_tmp;
+        GlobalMatrix<ValueType> tmp;
+
+        tmp.CloneBackend(op);
+
+        op.CoarsenOperator(&tmp, &pm_tmp, nc, nc, trans, Gsize, rG, rGsize);
+        tmp.Agglomerate(pm, coarse);
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     PairwiseAMG<OperatorType, VectorType, ValueType>::PairwiseAMG()
     {
@@ -150,20 +192,31 @@ namespace rocalution
         assert(this->build_ == true);
         assert(this->op_ != NULL);
 
+        // The coarse levels of a mixed precision hierarchy are only kept in single
+        // precision
+        if(this->mg_l_ != NULL)
+        {
+            this->ReBuildMixedPrecision_();
+
+            log_debug(this, "PairwiseAMG::ReBuildNumeric()", " #*# end");
+
+            return;
+        }
+
         this->op_level_[0]->Clear();
         this->op_level_[0]->CloneBackend(*this->op_);
         this->op_level_[0]->ConvertToCSR();
 
         this->trans_level_[0]->CloneBackend(*this->op_);
 
-        this->op_->CoarsenOperator(this->op_level_[0],
-                                   this->pm_level_[0],
-                                   this->dim_level_[0],
-                                   this->dim_level_[0],
-                                   *this->trans_level_[0],
-                                   this->Gsize_level_[0],
-                                   this->rG_level_[0],
-                                   this->rGsize_level_[0]);
+        pairwise_coarse_operator(*this->op_,
+                                 this->dim_level_[0],
+                                 *this->trans_level_[0],
+                                 this->Gsize_level_[0],
+                                 this->rG_level_[0],
+                                 this->rGsize_level_[0],
+                                 this->pm_level_[0],
+                                 this->op_level_[0]);
 
         for(int i = 1; i < this->levels_ - 1; ++i)
         {
@@ -177,18 +230,18 @@ namespace rocalution
                 this->op_level_[i - 1]->MoveToHost();
             }
 
-            this->op_level_[i - 1]->CoarsenOperator(this->op_level_[i],
-                                                    this->pm_level_[i],
-                                                    this->dim_level_[i],
-                                                    this->dim_level_[i],
-                                                    *this->trans_level_[i],
-                                                    this->Gsize_level_[i],
-                                                    this->rG_level_[i],
-                                                    this->rGsize_level_[i]);
+            pairwise_coarse_operator(*this->op_level_[i - 1],
+                                     this->dim_level_[i],
+                                     *this->trans_level_[i],
+                                     this->Gsize_level_[i],
+                                     this->rG_level_[i],
+                                     this->rGsize_level_[i],
+                                     this->pm_level_[i],
+                                     this->op_level_[i]);
 
             if(i == this->levels_ - this->host_level_ - 1)
             {
-                this->op_level_[i - 1]->CloneBackend(*this->restrict_op_level_[i - 1]);
+                this->op_level_[i - 1]->CloneBackend(*this->prolong_op_level_[i - 1]);
             }
         }
 
@@ -203,9 +256,12 @@ namespace rocalution
             this->smoother_level_[i]->Verbose(0);
         }
 
-        this->solver_coarse_->ResetOperator(*this->op_level_[this->levels_ - 2]);
-        this->solver_coarse_->ReBuildNumeric();
-        this->solver_coarse_->Verbose(0);
+        if(this->IdleCoarsestLevel_() == false)
+        {
+            this->solver_coarse_->ResetOperator(*this->op_level_[this->levels_ - 2]);
+            this->solver_coarse_->ReBuildNumeric();
+            this->solver_coarse_->Verbose(0);
+        }
 
         // Convert operator to op_format
         if(this->op_format_ != CSR)
@@ -24,6 +24,8 @@
 #include "ruge_stueben_amg.hpp"
 #include "../../utils/def.hpp"
 
+#include "../../base/global_matrix.hpp"
+#include "../../base/global_vector.hpp"
 #include "../../base/local_matrix.hpp"
 #include "../../base/local_vector.hpp"
 
@@ -35,6 +37,56 @@
 namespace rocalution
 {
 
+    // Local interpolations have no ghost layer, the coarse map is not used
+    template <typename ValueType>
+    static void rs_direct_interpolation(const LocalMatrix<ValueType>& op,
+                                        const LocalVector<int>&       CFmap,
+                                        const LocalVector<bool>&      S,
+                                        LocalMatrix<ValueType>*       prolong,
+                                        LocalMatrix<ValueType>*       restrict,
+                                        LocalVector<int>*)
+    {
+        op.RSDirectInterpolation(CFmap, S, prolong, restrict);
+    }
+
+    // Distributed interpolations return the coarse map of the local and ghost points
+    template <typename ValueType>
+    static void rs_direct_interpolation(const GlobalMatrix<ValueType>& op,
+                                        const LocalVector<int>&        CFmap,
+                                        const LocalVector<bool>&       S,
+                                        LocalMatrix<ValueType>*        prolong,
+                                        LocalMatrix<ValueType>*        restrict,
+                                        LocalVector<int>*              map)
+    {
+        op.RSDirectInterpolation(CFmap, S, prolong, restrict, map);
+    }
+
+    template <typename ValueType>
+    static void rs_extpi_interpolation(const LocalMatrix<ValueType>& op,
+                                       const LocalVector<int>&       CFmap,
+                                       const LocalVector<bool>&      S,
+                                       bool                          FF1,
+                                       float                         trunc,
+                                       LocalMatrix<ValueType>*       prolong,
+                                       LocalMatrix<ValueType>*       restrict,
+                                       LocalVector<int>*)
+    {
+        op.RSExtPIInterpolation(CFmap, S, FF1, trunc, prolong, restrict);
+    }
+
+    template <typename ValueType>
+    static void rs_extpi_interpolation(const GlobalMatrix<ValueType>& op,
+                                       const LocalVector<int>&        CFmap,
+                                       const LocalVector<bool>&       S,
+                                       bool                           FF1,
+                                       float                          trunc,
+                                       LocalMatrix<ValueType>*        prolong,
+                                       LocalMatrix<ValueType>*        restrict,
+                                       LocalVector<int>*              map)
+    {
+        op.RSExtPIInterpolation(CFmap, S, FF1, trunc, prolong, restrict, map);
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     RugeStuebenAMG<OperatorType, VectorType, ValueType>::RugeStuebenAMG()
     {
@@ -150,6 +202,15 @@ namespace rocalution
         LOG_INFO("AMG ends");
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    const LocalVector<int>*
+        RugeStuebenAMG<OperatorType, VectorType, ValueType>::CoarseMap_(int level) const
+    {
+        assert(this->trans_level_ != NULL);
+
+        return this->trans_level_[level];
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void RugeStuebenAMG<OperatorType, VectorType, ValueType>::SetCouplingStrength(ValueType eps)
     {
@@ -215,70 +276,68 @@ namespace rocalution
         assert(this->build_);
         assert(this->op_ != NULL);
 
-        this->op_level_[0]->Clear();
-        this->op_level_[0]->ConvertToCSR();
-
-        if(this->op_->GetFormat() != CSR)
+        // The coarse levels of a mixed precision hierarchy are only kept in single
+        // precision
+        if(this->mg_l_ != NULL)
         {
-            OperatorType op_csr;
-            op_csr.CloneFrom(*this->op_);
-            op_csr.ConvertToCSR();
-
-            // Create coarse operator
-            OperatorType tmp;
-            tmp.CloneBackend(*this->op_);
-            this->op_level_[0]->CloneBackend(*this->op_);
-
-            OperatorType* cast_res = dynamic_cast<OperatorType*>(this->restrict_op_level_[0]);
-            OperatorType* cast_pro = dynamic_cast<OperatorType*>(this->prolong_op_level_[0]);
-            assert(cast_res != NULL);
-            assert(cast_pro != NULL);
+            this->ReBuildMixedPrecision_();
 
-            tmp.MatrixMult(*cast_res, op_csr);
-            this->op_level_[0]->MatrixMult(tmp, *cast_pro);
-        }
-        else
-        {
-            // Create coarse operator
-            OperatorType tmp;
-            tmp.CloneBackend(*this->op_);
-            this->op_level_[0]->CloneBackend(*this->op_);
-
-            OperatorType* cast_res = dynamic_cast<OperatorType*>(this->restrict_op_level_[0]);
-            OperatorType* cast_pro = dynamic_cast<OperatorType*>(this->prolong_op_level_[0]);
-            assert(cast_res != NULL);
-            assert(cast_pro != NULL);
+            log_debug(this, "RugeStuebenAMG::ReBuildNumeric()", " #*# end");
 
-            tmp.MatrixMult(*cast_res, *this->op_);
-            this->op_level_[0]->MatrixMult(tmp, *cast_pro);
+            return;
         }
 
-        for(int i = 1; i < this->levels_ - 1; ++i)
-        {
-            this->op_level_[i]->Clear();
-            this->op_level_[i]->ConvertToCSR();
+        // The sparsity patterns of the coarse operators do not change. If they are kept in
+        // CSR format, only their values are recomputed, in place.
+        bool numeric = (this->op_format_ == CSR);
 
-            // Create coarse operator
-            OperatorType tmp;
-            tmp.CloneBackend(*this->op_);
-            this->op_level_[i]->CloneBackend(*this->op_);
+        const OperatorType* op = this->op_;
 
-            OperatorType* cast_res = dynamic_cast<OperatorType*>(this->restrict_op_level_[i]);
-            OperatorType* cast_pro = dynamic_cast<OperatorType*>(this->prolong_op_level_[i]);
-            assert(cast_res != NULL);
+        for(int i = 0; i < this->levels_ - 1; ++i)
+        {
+            LocalMatrix<ValueType>* cast_res
+                = dynamic_cast<LocalMatrix<ValueType>*>(this->restrict_op_level_[i]);
+            LocalMatrix<ValueType>* cast_pro
+                = dynamic_cast<LocalMatrix<ValueType>*>(this->prolong_op_level_[i]);
             assert(cast_pro != NULL);
 
-            if(i == this->levels_ - this->host_level_ - 1)
+            // Restriction operators that are not stored are formed temporarily
+            LocalMatrix<ValueType> trans;
+
+            if(cast_res == NULL)
+            {
+                trans.CloneBackend(*cast_pro);
+                cast_pro->Transpose(&trans);
+                cast_res = &trans;
+            }
+
+            if(i > 0)
+            {
+                op = this->op_level_[i - 1];
+            }
+
+            if(i > 0 && i == this->levels_ - this->host_level_ - 1)
             {
                 this->op_level_[i - 1]->MoveToHost();
             }
 
-            tmp.MatrixMult(*cast_res, *this->op_level_[i - 1]);
-            this->op_level_[i]->MatrixMult(tmp, *cast_pro);
+            if(numeric == false)
+            {
+                // Create coarse operator
+                this->op_level_[i]->CloneBackend(*cast_pro);
+            }
+
+            this->BuildCoarseOperator_(*op,
+                                       *cast_res,
+                                       *cast_pro,
+                                       *this->trans_level_[i],
+                                       numeric,
+                                       this->pm_level_[i],
+                                       this->op_level_[i]);
 
-            if(i == this->levels_ - this->host_level_ - 1)
+            if(i > 0 && i == this->levels_ - this->host_level_ - 1)
             {
-                this->op_level_[i - 1]->CloneBackend(*this->restrict_op_level_[i - 1]);
+                this->op_level_[i - 1]->CloneBackend(*this->prolong_op_level_[i - 1]);
             }
         }
 
@@ -297,9 +356,12 @@ namespace rocalution
             this->smoother_level_[i]->Verbose(0);
         }
 
-        this->solver_coarse_->ResetOperator(*this->op_level_[this->levels_ - 2]);
-        this->solver_coarse_->ReBuildNumeric();
-        this->solver_coarse_->Verbose(0);
+        if(this->IdleCoarsestLevel_() == false)
+        {
+            this->solver_coarse_->ResetOperator(*this->op_level_[this->levels_ - 2]);
+            this->solver_coarse_->ReBuildNumeric();
+            this->solver_coarse_->Verbose(0);
+        }
 
         // Convert operator to op_format
         if(this->op_format_ != CSR)
@@ -327,8 +389,8 @@ namespace rocalution
         assert(res != NULL);
         assert(coarse != NULL);
 
-        OperatorType* cast_res = dynamic_cast<OperatorType*>(res);
-        OperatorType* cast_pro = dynamic_cast<OperatorType*>(pro);
+        LocalMatrix<ValueType>* cast_res = dynamic_cast<LocalMatrix<ValueType>*>(res);
+        LocalMatrix<ValueType>* cast_pro = dynamic_cast<LocalMatrix<ValueType>*>(pro);
 
         assert(cast_res != NULL);
         assert(cast_pro != NULL);
@@ -354,10 +416,11 @@ namespace rocalution
         switch(this->interpolation_)
         {
         case Direct:
-            op.RSDirectInterpolation(CFmap, S, cast_pro, cast_res);
+            rs_direct_interpolation(op, CFmap, S, cast_pro, cast_res, trans);
             break;
         case ExtPI:
-            op.RSExtPIInterpolation(CFmap, S, this->FF1_, this->trunc_, cast_pro, cast_res);
+            rs_extpi_interpolation(
+                op, CFmap, S, this->FF1_, this->trunc_, cast_pro, cast_res, trans);
             break;
         }
 
@@ -366,12 +429,8 @@ namespace rocalution
         S.Clear();
 
         // Create coarse operator
-        OperatorType tmp;
-        tmp.CloneBackend(op);
         coarse->CloneBackend(op);
-
-        tmp.MatrixMult(*cast_res, op);
-        coarse->MatrixMult(tmp, *cast_pro);
+        this->BuildCoarseOperator_(op, *cast_res, *cast_pro, *trans, false, pm, coarse);
     }
 
     template class RugeStuebenAMG<LocalMatrix<double>, LocalVector<double>, double>;
@@ -385,4 +444,15 @@ namespace rocalution
                                   std::complex<float>>;
 #endif
 
+    template class RugeStuebenAMG<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class RugeStuebenAMG<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class RugeStuebenAMG<GlobalMatrix<std::complex<double>>,
+                                  GlobalVector<std::complex<double>>,
+                                  std::complex<double>>;
+    template class RugeStuebenAMG<GlobalMatrix<std::complex<float>>,
+                                  GlobalVector<std::complex<float>>,
+                                  std::complex<float>>;
+#endif
+
 } // namespace rocalution
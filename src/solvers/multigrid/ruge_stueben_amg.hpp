@@ -42,8 +42,8 @@ namespace rocalution
   * has a higher building step and requires higher memory usage.
   * \cite stueben
   *
-  * \tparam OperatorType - can be LocalMatrix
-  * \tparam VectorType - can be LocalVector
+  * \tparam OperatorType - can be LocalMatrix or GlobalMatrix
+  * \tparam VectorType - can be LocalVector or GlobalVector
   * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
   */
     template <class OperatorType, class VectorType, typename ValueType>
@@ -101,6 +101,8 @@ namespace rocalution
         virtual void PrintStart_(void) const;
         virtual void PrintEnd_(void) const;
 
+        virtual const LocalVector<int>* CoarseMap_(int level) const;
+
     private:
         /** \brief Coupling strength */
         float eps_;
@@ -31,12 +31,78 @@
 #include "../../base/local_vector.hpp"
 
 #include "../../utils/log.hpp"
+#include "../../utils/profiler.hpp"
 
+#include <algorithm>
 #include <complex>
 #include <math.h>
 
 namespace rocalution
 {
+    // Process local part and ghost part of local and global operators and vectors
+    template <typename ValueType>
+    static const LocalMatrix<ValueType>& precond_interior(const LocalMatrix<ValueType>& op)
+    {
+        return op;
+    }
+
+    template <typename ValueType>
+    static const LocalMatrix<ValueType>& precond_interior(const GlobalMatrix<ValueType>& op)
+    {
+        return op.GetInterior();
+    }
+
+    template <typename ValueType>
+    static const LocalMatrix<ValueType>* precond_ghost(const LocalMatrix<ValueType>& op)
+    {
+        return NULL;
+    }
+
+    template <typename ValueType>
+    static const LocalMatrix<ValueType>* precond_ghost(const GlobalMatrix<ValueType>& op)
+    {
+        return &op.GetGhost();
+    }
+
+    template <typename ValueType>
+    static const LocalVector<ValueType>& precond_interior(const LocalVector<ValueType>& vec)
+    {
+        return vec;
+    }
+
+    template <typename ValueType>
+    static const LocalVector<ValueType>& precond_interior(const GlobalVector<ValueType>& vec)
+    {
+        return vec.GetInterior();
+    }
+
+    template <typename ValueType>
+    static LocalVector<ValueType>& precond_interior(LocalVector<ValueType>& vec)
+    {
+        return vec;
+    }
+
+    template <typename ValueType>
+    static LocalVector<ValueType>& precond_interior(GlobalVector<ValueType>& vec)
+    {
+        return vec.GetInterior();
+    }
+
+    // Extract the l1 block diagonal part of the process local operator, where the
+    // couplings between the blocks and to other processes are lumped onto the diagonal
+    template <class OperatorType, typename ValueType>
+    static void precond_l1_block_diagonal(const OperatorType&     op,
+                                          int                     nblocks,
+                                          LocalMatrix<ValueType>* mat)
+    {
+        const LocalMatrix<ValueType>& interior = precond_interior(op);
+
+        int nrow       = interior.GetM();
+        int block_size = std::max((nrow + nblocks - 1) / nblocks, 1);
+
+        mat->CloneBackend(interior);
+        interior.ExtractL1BlockDiagonal(block_size, mat, precond_ghost(op));
+    }
 
     template <class OperatorType, class VectorType, typename ValueType>
     Preconditioner<OperatorType, VectorType, ValueType>::Preconditioner()
@@ -96,6 +162,8 @@ namespace rocalution
     {
         log_debug(this, "Jacobi::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("Jacobi::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -181,6 +249,71 @@ namespace rocalution
         this->inv_diag_entries_.MoveToAccelerator();
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    L1Jacobi<OperatorType, VectorType, ValueType>::L1Jacobi()
+    {
+        log_debug(this, "L1Jacobi::L1Jacobi()", "default constructor");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    L1Jacobi<OperatorType, VectorType, ValueType>::~L1Jacobi()
+    {
+        log_debug(this, "L1Jacobi::~L1Jacobi()", "destructor");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void L1Jacobi<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        LOG_INFO("l1-Jacobi preconditioner");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void L1Jacobi<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "L1Jacobi::Build()", this->build_, " #*# begin");
+
+        ProfilerRegion region("L1Jacobi::Build");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+        this->build_ = true;
+
+        assert(this->op_ != NULL);
+
+        this->ExtractInverseL1Diagonal_();
+
+        log_debug(this, "L1Jacobi::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void L1Jacobi<OperatorType, VectorType, ValueType>::ResetOperator(const OperatorType& op)
+    {
+        log_debug(this, "L1Jacobi::ResetOperator()", this->build_, (const void*&)op);
+
+        assert(this->op_ != NULL);
+
+        this->inv_diag_entries_.Clear();
+        this->ExtractInverseL1Diagonal_();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void L1Jacobi<OperatorType, VectorType, ValueType>::ExtractInverseL1Diagonal_(void)
+    {
+        log_debug(this, "L1Jacobi::ExtractInverseL1Diagonal_()");
+
+        this->inv_diag_entries_.CloneBackend(*this->op_);
+
+        // One block per row lumps all off-diagonal couplings, including the ghost part
+        LocalMatrix<ValueType> l1_diag;
+        precond_l1_block_diagonal(*this->op_, std::max(this->op_->GetLocalM(), 1), &l1_diag);
+
+        l1_diag.ExtractInverseDiagonal(&precond_interior(this->inv_diag_entries_));
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     GS<OperatorType, VectorType, ValueType>::GS()
     {
@@ -206,6 +339,8 @@ namespace rocalution
     {
         log_debug(this, "GS::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("GS::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -301,6 +436,8 @@ namespace rocalution
     {
         log_debug(this, "SGS::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("SGS::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -402,13 +539,267 @@ namespace rocalution
         this->v_.MoveToAccelerator();
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    HybridGS<OperatorType, VectorType, ValueType>::HybridGS()
+    {
+        log_debug(this, "HybridGS::HybridGS()", "default constructor");
+
+        this->nblocks_ = 1;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    HybridGS<OperatorType, VectorType, ValueType>::~HybridGS()
+    {
+        log_debug(this, "HybridGS::~HybridGS()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void HybridGS<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        LOG_INFO("Hybrid l1 Gauss-Seidel (HybridGS) preconditioner");
+        LOG_INFO("HybridGS number of blocks = " << this->nblocks_);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void HybridGS<OperatorType, VectorType, ValueType>::SetNumberOfBlocks(int nblocks)
+    {
+        log_debug(this, "HybridGS::SetNumberOfBlocks()", nblocks);
+
+        assert(nblocks > 0);
+        assert(this->build_ == false);
+
+        this->nblocks_ = nblocks;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void HybridGS<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "HybridGS::Build()", this->build_, " #*# begin");
+
+        ProfilerRegion region("HybridGS::Build");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+        this->build_ = true;
+
+        assert(this->op_ != NULL);
+
+        precond_l1_block_diagonal(*this->op_, this->nblocks_, &this->GS_);
+        this->GS_.LAnalyse(false);
+
+        log_debug(this, "HybridGS::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void HybridGS<OperatorType, VectorType, ValueType>::ResetOperator(const OperatorType& op)
+    {
+        log_debug(this, "HybridGS::ResetOperator()", this->build_, (const void*&)op);
+
+        assert(this->op_ != NULL);
+
+        this->GS_.Clear();
+        precond_l1_block_diagonal(*this->op_, this->nblocks_, &this->GS_);
+        this->GS_.LAnalyse(false);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void HybridGS<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "HybridGS::Clear()", this->build_);
+
+        this->GS_.Clear();
+        this->GS_.LAnalyseClear();
+
+        this->build_ = false;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void HybridGS<OperatorType, VectorType, ValueType>::Solve(const VectorType& rhs, VectorType* x)
+    {
+        log_debug(this, "HybridGS::Solve()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->build_ == true);
+        assert(x != NULL);
+
+        this->GS_.LSolve(precond_interior(rhs), &precond_interior(*x));
+
+        log_debug(this, "HybridGS::Solve()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void HybridGS<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "HybridGS::MoveToHostLocalData_()", this->build_);
+
+        this->GS_.MoveToHost();
+        this->GS_.LAnalyse(false);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void HybridGS<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "HybridGS::MoveToAcceleratorLocalData_()", this->build_);
+
+        this->GS_.MoveToAccelerator();
+        this->GS_.LAnalyse(false);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    HybridSGS<OperatorType, VectorType, ValueType>::HybridSGS()
+    {
+        log_debug(this, "HybridSGS::HybridSGS()", "default constructor");
+
+        this->nblocks_ = 1;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    HybridSGS<OperatorType, VectorType, ValueType>::~HybridSGS()
+    {
+        log_debug(this, "HybridSGS::~HybridSGS()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void HybridSGS<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        LOG_INFO("Hybrid l1 Symmetric Gauss-Seidel (HybridSGS) preconditioner");
+        LOG_INFO("HybridSGS number of blocks = " << this->nblocks_);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void HybridSGS<OperatorType, VectorType, ValueType>::SetNumberOfBlocks(int nblocks)
+    {
+        log_debug(this, "HybridSGS::SetNumberOfBlocks()", nblocks);
+
+        assert(nblocks > 0);
+        assert(this->build_ == false);
+
+        this->nblocks_ = nblocks;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void HybridSGS<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "HybridSGS::Build()", this->build_, " #*# begin");
+
+        ProfilerRegion region("HybridSGS::Build");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+        this->build_ = true;
+
+        assert(this->op_ != NULL);
+
+        precond_l1_block_diagonal(*this->op_, this->nblocks_, &this->SGS_);
+        this->SGS_.LAnalyse(false);
+        this->SGS_.UAnalyse(false);
+
+        this->diag_entries_.CloneBackend(this->SGS_);
+        this->SGS_.ExtractDiagonal(&this->diag_entries_);
+
+        this->v_.CloneBackend(this->SGS_);
+        this->v_.Allocate("v", this->SGS_.GetM());
+
+        log_debug(this, "HybridSGS::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void HybridSGS<OperatorType, VectorType, ValueType>::ResetOperator(const OperatorType& op)
+    {
+        log_debug(this, "HybridSGS::ResetOperator()", this->build_, (const void*&)op);
+
+        assert(this->op_ != NULL);
+
+        this->SGS_.Clear();
+        precond_l1_block_diagonal(*this->op_, this->nblocks_, &this->SGS_);
+
+        this->diag_entries_.Clear();
+        this->diag_entries_.CloneBackend(this->SGS_);
+        this->SGS_.ExtractDiagonal(&this->diag_entries_);
+
+        this->SGS_.LAnalyse(false);
+        this->SGS_.UAnalyse(false);
+
+        this->v_.Clear();
+        this->v_.CloneBackend(this->SGS_);
+        this->v_.Allocate("v", this->SGS_.GetM());
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void HybridSGS<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "HybridSGS::Clear()", this->build_);
+
+        this->SGS_.Clear();
+        this->SGS_.LAnalyseClear();
+        this->SGS_.UAnalyseClear();
+
+        this->diag_entries_.Clear();
+        this->v_.Clear();
+
+        this->build_ = false;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void HybridSGS<OperatorType, VectorType, ValueType>::Solve(const VectorType& rhs, VectorType* x)
+    {
+        log_debug(this, "HybridSGS::Solve()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->build_ == true);
+        assert(x != NULL);
+
+        this->SGS_.LSolve(precond_interior(rhs), &this->v_);
+        this->v_.PointWiseMult(this->diag_entries_);
+        this->SGS_.USolve(this->v_, &precond_interior(*x));
+
+        log_debug(this, "HybridSGS::Solve()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void HybridSGS<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "HybridSGS::MoveToHostLocalData_()", this->build_);
+
+        this->SGS_.MoveToHost();
+        this->SGS_.LAnalyse(false);
+        this->SGS_.UAnalyse(false);
+
+        this->diag_entries_.MoveToHost();
+        this->v_.MoveToHost();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void HybridSGS<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "HybridSGS::MoveToAcceleratorLocalData_()", this->build_);
+
+        this->SGS_.MoveToAccelerator();
+        this->SGS_.LAnalyse(false);
+        this->SGS_.UAnalyse(false);
+
+        this->diag_entries_.MoveToAccelerator();
+        this->v_.MoveToAccelerator();
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     ILU<OperatorType, VectorType, ValueType>::ILU()
     {
         log_debug(this, "ILU::ILU()", "default constructor");
 
-        this->p_     = 0;
-        this->level_ = true;
+        this->p_      = 0;
+        this->level_  = true;
+        this->sweeps_ = 0;
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -424,6 +815,11 @@ namespace rocalution
     {
         LOG_INFO("ILU(" << this->p_ << ") preconditioner");
 
+        if(this->p_ == 0 && this->sweeps_ > 0)
+        {
+            LOG_INFO("ILU iterative factorization with " << this->sweeps_ << " sweeps");
+        }
+
         if(this->build_ == true)
         {
             LOG_INFO("ILU nnz = " << this->ILU_.GetNnz());
@@ -442,11 +838,24 @@ namespace rocalution
         this->level_ = level;
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ILU<OperatorType, VectorType, ValueType>::SetIterative(int sweeps)
+    {
+        log_debug(this, "ILU::SetIterative()", sweeps);
+
+        assert(sweeps >= 0);
+        assert(this->build_ == false);
+
+        this->sweeps_ = sweeps;
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void ILU<OperatorType, VectorType, ValueType>::Build(void)
     {
         log_debug(this, "ILU::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("ILU::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -459,7 +868,14 @@ namespace rocalution
 
         this->ILU_.CloneFrom(*this->op_);
 
-        this->ILU_.ILUpFactorize(this->p_, this->level_);
+        if(this->p_ == 0 && this->sweeps_ > 0)
+        {
+            this->ILU_.ItILU0Factorize(this->sweeps_);
+        }
+        else
+        {
+            this->ILU_.ILUpFactorize(this->p_, this->level_);
+        }
 
         this->ILU_.LUAnalyse();
 
@@ -564,6 +980,8 @@ namespace rocalution
     {
         log_debug(this, "ILUT::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("ILUT::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -597,6 +1015,7 @@ namespace rocalution
         log_debug(this, "ILUT::MoveToHostLocalData_()", this->build_);
 
         this->ILUT_.MoveToHost();
+        this->ILUT_.LUAnalyse();
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -605,6 +1024,7 @@ namespace rocalution
         log_debug(this, "ILUT::MoveToAcceleratorLocalData_()", this->build_);
 
         this->ILUT_.MoveToAccelerator();
+        this->ILUT_.LUAnalyse();
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -625,6 +1045,8 @@ namespace rocalution
     IC<OperatorType, VectorType, ValueType>::IC()
     {
         log_debug(this, "IC::IC()", "default constructor");
+
+        this->sweeps_ = 0;
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -640,17 +1062,35 @@ namespace rocalution
     {
         LOG_INFO("IC preconditioner");
 
+        if(this->sweeps_ > 0)
+        {
+            LOG_INFO("IC iterative factorization with " << this->sweeps_ << " sweeps");
+        }
+
         if(this->build_ == true)
         {
             LOG_INFO("IC nnz = " << this->IC_.GetNnz());
         }
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void IC<OperatorType, VectorType, ValueType>::SetIterative(int sweeps)
+    {
+        log_debug(this, "IC::SetIterative()", sweeps);
+
+        assert(sweeps >= 0);
+        assert(this->build_ == false);
+
+        this->sweeps_ = sweeps;
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void IC<OperatorType, VectorType, ValueType>::Build(void)
     {
         log_debug(this, "IC::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("IC::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -665,7 +1105,16 @@ namespace rocalution
         this->inv_diag_entries_.CloneBackend(*this->op_);
 
         this->op_->ExtractL(&this->IC_, true);
-        this->IC_.ICFactorize(&this->inv_diag_entries_);
+
+        if(this->sweeps_ > 0)
+        {
+            this->IC_.ItICFactorize(&this->inv_diag_entries_, this->sweeps_);
+        }
+        else
+        {
+            this->IC_.ICFactorize(&this->inv_diag_entries_);
+        }
+
         this->IC_.LLAnalyse();
 
         log_debug(this, "IC::Build()", this->build_, " #*# end");
@@ -689,6 +1138,7 @@ namespace rocalution
 
         // this->inv_diag_entries_ is NOT needed on accelerator!
         this->IC_.MoveToHost();
+        this->IC_.LLAnalyse();
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -698,6 +1148,7 @@ namespace rocalution
 
         // this->inv_diag_entries_ is NOT needed on accelerator!
         this->IC_.MoveToAccelerator();
+        this->IC_.LLAnalyse();
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -771,6 +1222,8 @@ namespace rocalution
     {
         log_debug(this, "VariablePreconditioner::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("VariablePreconditioner::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -916,6 +1369,28 @@ namespace rocalution
                           std::complex<float>>;
 #endif
 
+    template class L1Jacobi<LocalMatrix<double>, LocalVector<double>, double>;
+    template class L1Jacobi<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class L1Jacobi<LocalMatrix<std::complex<double>>,
+                            LocalVector<std::complex<double>>,
+                            std::complex<double>>;
+    template class L1Jacobi<LocalMatrix<std::complex<float>>,
+                            LocalVector<std::complex<float>>,
+                            std::complex<float>>;
+#endif
+
+    template class L1Jacobi<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class L1Jacobi<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class L1Jacobi<GlobalMatrix<std::complex<double>>,
+                            GlobalVector<std::complex<double>>,
+                            std::complex<double>>;
+    template class L1Jacobi<GlobalMatrix<std::complex<float>>,
+                            GlobalVector<std::complex<float>>,
+                            std::complex<float>>;
+#endif
+
     template class GS<LocalMatrix<double>, LocalVector<double>, double>;
     template class GS<LocalMatrix<float>, LocalVector<float>, float>;
 #ifdef SUPPORT_COMPLEX
@@ -938,6 +1413,50 @@ namespace rocalution
                        std::complex<float>>;
 #endif
 
+    template class HybridGS<LocalMatrix<double>, LocalVector<double>, double>;
+    template class HybridGS<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class HybridGS<LocalMatrix<std::complex<double>>,
+                            LocalVector<std::complex<double>>,
+                            std::complex<double>>;
+    template class HybridGS<LocalMatrix<std::complex<float>>,
+                            LocalVector<std::complex<float>>,
+                            std::complex<float>>;
+#endif
+
+    template class HybridGS<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class HybridGS<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class HybridGS<GlobalMatrix<std::complex<double>>,
+                            GlobalVector<std::complex<double>>,
+                            std::complex<double>>;
+    template class HybridGS<GlobalMatrix<std::complex<float>>,
+                            GlobalVector<std::complex<float>>,
+                            std::complex<float>>;
+#endif
+
+    template class HybridSGS<LocalMatrix<double>, LocalVector<double>, double>;
+    template class HybridSGS<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class HybridSGS<LocalMatrix<std::complex<double>>,
+                             LocalVector<std::complex<double>>,
+                             std::complex<double>>;
+    template class HybridSGS<LocalMatrix<std::complex<float>>,
+                             LocalVector<std::complex<float>>,
+                             std::complex<float>>;
+#endif
+
+    template class HybridSGS<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class HybridSGS<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class HybridSGS<GlobalMatrix<std::complex<double>>,
+                             GlobalVector<std::complex<double>>,
+                             std::complex<double>>;
+    template class HybridSGS<GlobalMatrix<std::complex<float>>,
+                             GlobalVector<std::complex<float>>,
+                             std::complex<float>>;
+#endif
+
     template class ILU<LocalMatrix<double>, LocalVector<double>, double>;
     template class ILU<LocalMatrix<float>, LocalVector<float>, float>;
 #ifdef SUPPORT_COMPLEX
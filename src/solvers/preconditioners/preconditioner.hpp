@@ -24,6 +24,8 @@
 #ifndef ROCALUTION_PRECONDITIONER_HPP_
 #define ROCALUTION_PRECONDITIONER_HPP_
 
+#include "../../base/local_matrix.hpp"
+#include "../../base/local_vector.hpp"
 #include "../solver.hpp"
 #include "rocalution/export.hpp"
 
@@ -99,8 +101,51 @@ namespace rocalution
         virtual void MoveToHostLocalData_(void);
         virtual void MoveToAcceleratorLocalData_(void);
 
-    private:
         VectorType inv_diag_entries_;
+
+    private:
+        // FixedPoint smoothers use the inverse diagonal for fused Jacobi sweeps
+        template <class, class, typename>
+        friend class FixedPoint;
+    };
+
+    /** \ingroup precond_module
+  * \class L1Jacobi
+  * \brief l1-Jacobi Method
+  * \details
+  * The l1-Jacobi method scales the residual with the inverse of the l1 diagonal
+  * \f[
+  *   d_{ii} = a_{ii} + \sum\limits_{j \neq i}{|a_{ij}|},
+  * \f]
+  * where the sum runs over all off-diagonal entries of row \f$i\f$, including the
+  * couplings through the ghost (off-process) part of the operator. For a positive
+  * diagonal, \f$d_{ii}\f$ is the absolute row sum. Used as smoother, l1-Jacobi is
+  * convergent for symmetric positive definite matrices without damping, independently
+  * of the number of processes \cite baker2011.
+  *
+  * \tparam OperatorType - can be LocalMatrix or GlobalMatrix
+  * \tparam VectorType - can be LocalVector or GlobalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class L1Jacobi : public Jacobi<OperatorType, VectorType, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        L1Jacobi();
+        ROCALUTION_EXPORT
+        virtual ~L1Jacobi();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+
+        ROCALUTION_EXPORT
+        virtual void ResetOperator(const OperatorType& op);
+
+    private:
+        void ExtractInverseL1Diagonal_(void);
     };
 
     /** \ingroup precond_module
@@ -194,6 +239,108 @@ namespace rocalution
         VectorType v_;
     };
 
+    /** \ingroup precond_module
+  * \class HybridGS
+  * \brief Hybrid l1 Gauss-Seidel Method
+  * \details
+  * The hybrid Gauss-Seidel method performs a Gauss-Seidel sweep inside of each of
+  * the diagonal blocks of the process local part of the operator, while all
+  * couplings between blocks and to other processes are treated Jacobi-style. To keep
+  * the smoother convergent, the absolute values of the neglected couplings are added
+  * to the diagonal (l1 scaling) \cite baker2011. The rows of different blocks are
+  * independent, such that the triangular solves scale with the number of blocks.
+  * With a single block on a LocalMatrix, the method is equivalent to GS.
+  *
+  * \tparam OperatorType - can be LocalMatrix or GlobalMatrix
+  * \tparam VectorType - can be LocalVector or GlobalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class HybridGS : public Preconditioner<OperatorType, VectorType, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        HybridGS();
+        ROCALUTION_EXPORT
+        virtual ~HybridGS();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+        ROCALUTION_EXPORT
+        virtual void Solve(const VectorType& rhs, VectorType* x);
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+        ROCALUTION_EXPORT
+        virtual void ResetOperator(const OperatorType& op);
+
+        /** \brief Set the number of diagonal blocks of the process local part (default 1) */
+        ROCALUTION_EXPORT
+        virtual void SetNumberOfBlocks(int nblocks);
+
+    protected:
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+    private:
+        LocalMatrix<ValueType> GS_;
+
+        int nblocks_;
+    };
+
+    /** \ingroup precond_module
+  * \class HybridSGS
+  * \brief Hybrid l1 Symmetric Gauss-Seidel Method
+  * \details
+  * The hybrid symmetric Gauss-Seidel method performs a forward and a backward
+  * Gauss-Seidel sweep inside of each of the diagonal blocks of the process local part
+  * of the operator. Couplings between blocks and to other processes are treated as in
+  * HybridGS. The preconditioner is symmetric and can be used with CG.
+  *
+  * \tparam OperatorType - can be LocalMatrix or GlobalMatrix
+  * \tparam VectorType - can be LocalVector or GlobalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class HybridSGS : public Preconditioner<OperatorType, VectorType, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        HybridSGS();
+        ROCALUTION_EXPORT
+        virtual ~HybridSGS();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+        ROCALUTION_EXPORT
+        virtual void Solve(const VectorType& rhs, VectorType* x);
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+        ROCALUTION_EXPORT
+        virtual void ResetOperator(const OperatorType& op);
+
+        /** \brief Set the number of diagonal blocks of the process local part (default 1) */
+        ROCALUTION_EXPORT
+        virtual void SetNumberOfBlocks(int nblocks);
+
+    protected:
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+    private:
+        LocalMatrix<ValueType> SGS_;
+
+        LocalVector<ValueType> diag_entries_;
+        LocalVector<ValueType> v_;
+
+        int nblocks_;
+    };
+
     /** \ingroup precond_module
   * \class ILU
   * \brief Incomplete LU Factorization based on levels
@@ -228,6 +375,16 @@ namespace rocalution
       */
         ROCALUTION_EXPORT
         virtual void Set(int p, bool level = true);
+        /** \brief Select the ILU(0) factorization algorithm
+      * \details
+      * By default, ILU(0) is computed exactly and level scheduled, which gives the
+      * same factors for any number of threads. If \p sweeps is positive, the factors
+      * are approximated by \p sweeps fine-grained parallel sweeps instead
+      * \cite chow2015. A value of zero switches back to the exact factorization.
+      * Only used for ILU(0).
+      */
+        ROCALUTION_EXPORT
+        virtual void SetIterative(int sweeps);
         ROCALUTION_EXPORT
         virtual void Build(void);
         ROCALUTION_EXPORT
@@ -241,6 +398,7 @@ namespace rocalution
         OperatorType ILU_;
         int          p_;
         bool         level_;
+        int          sweeps_;
     };
 
     /** \ingroup precond_module
@@ -318,6 +476,15 @@ namespace rocalution
         virtual void Print(void) const;
         ROCALUTION_EXPORT
         virtual void Solve(const VectorType& rhs, VectorType* x);
+        /** \brief Select the IC(0) factorization algorithm
+      * \details
+      * By default, IC(0) is computed exactly and level scheduled, which gives the
+      * same factors for any number of threads. If \p sweeps is positive, the factors
+      * are approximated by \p sweeps fine-grained parallel sweeps instead
+      * \cite chow2015. A value of zero switches back to the exact factorization.
+      */
+        ROCALUTION_EXPORT
+        virtual void SetIterative(int sweeps);
         ROCALUTION_EXPORT
         virtual void Build(void);
         ROCALUTION_EXPORT
@@ -330,6 +497,7 @@ namespace rocalution
     private:
         OperatorType IC_;
         VectorType   inv_diag_entries_;
+        int          sweeps_;
     };
 
     /** \ingroup precond_module
@@ -30,6 +30,7 @@
 #include "../../base/local_vector.hpp"
 
 #include "../../utils/log.hpp"
+#include "../../utils/profiler.hpp"
 
 #include <complex>
 #include <math.h>
@@ -88,6 +89,8 @@ namespace rocalution
     {
         log_debug(this, "AIChebyshev::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("AIChebyshev::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -264,6 +267,8 @@ namespace rocalution
     {
         log_debug(this, "FSAI::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("FSAI::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -394,6 +399,8 @@ namespace rocalution
     {
         log_debug(this, "SPAI::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("SPAI::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -524,6 +531,8 @@ namespace rocalution
     {
         log_debug(this, "TNS::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("TNS::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -28,6 +28,7 @@
 #include "../solver.hpp"
 
 #include "../../utils/log.hpp"
+#include "../../utils/profiler.hpp"
 
 #include "preconditioner.hpp"
 
@@ -107,6 +108,8 @@ namespace rocalution
     {
         log_debug(this, "AS::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("AS::Build");
+
         assert(this->op_ != NULL);
         assert(this->num_blocks_ > 0);
         assert(this->overlap_ >= 0);
@@ -31,6 +31,7 @@
 #include "../../base/local_vector.hpp"
 
 #include "../../utils/log.hpp"
+#include "../../utils/profiler.hpp"
 
 #include "preconditioner.hpp"
 
@@ -81,6 +82,8 @@ namespace rocalution
     {
         log_debug(this, "BlockJacobi::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("BlockJacobi::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -32,6 +32,7 @@
 
 #include "../../utils/allocate_free.hpp"
 #include "../../utils/log.hpp"
+#include "../../utils/profiler.hpp"
 
 #include <complex>
 
@@ -193,6 +194,8 @@ namespace rocalution
     {
         log_debug(this, "BlockPreconditioner::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("BlockPreconditioner::Build");
+
         assert(this->build_ == false);
         this->build_ = true;
 
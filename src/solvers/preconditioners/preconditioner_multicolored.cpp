@@ -32,6 +32,7 @@
 
 #include "../../utils/allocate_free.hpp"
 #include "../../utils/log.hpp"
+#include "../../utils/profiler.hpp"
 
 #include <complex>
 
@@ -304,6 +305,8 @@ namespace rocalution
     {
         log_debug(this, "MultiColored::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("MultiColored::Build");
+
         assert(this->build_ == false);
 
         assert(this->op_ != NULL);
@@ -32,6 +32,7 @@
 
 #include "../../utils/log.hpp"
 #include "../../utils/math_functions.hpp"
+#include "../../utils/profiler.hpp"
 
 #include <complex>
 
@@ -175,6 +176,8 @@ namespace rocalution
     {
         log_debug(this, "MultiElimination::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("MultiElimination::Build");
+
         assert(this->build_ == false);
         this->build_ = true;
 
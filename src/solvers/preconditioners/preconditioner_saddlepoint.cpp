@@ -31,6 +31,7 @@
 #include "../../base/local_vector.hpp"
 
 #include "../../utils/log.hpp"
+#include "../../utils/profiler.hpp"
 
 #include <complex>
 
@@ -149,6 +150,8 @@ namespace rocalution
     {
         log_debug(this, "DiagJacobiSaddlePointPrecond::Build()", this->build_, " #*# begin");
 
+        ProfilerRegion region("DiagJacobiSaddlePointPrecond::Build");
+
         assert(this->build_ == false);
         this->build_ = true;
 
@@ -27,18 +27,68 @@
 #include "../base/local_matrix.hpp"
 #include "../base/local_stencil.hpp"
 #include "../base/local_vector.hpp"
+#include "preconditioners/preconditioner.hpp"
 
 #include "../base/global_matrix.hpp"
 #include "../base/global_vector.hpp"
 
 #include "../utils/log.hpp"
 #include "../utils/math_functions.hpp"
+#include "../utils/profiler.hpp"
 
+#include <algorithm>
 #include <complex>
 
 namespace rocalution
 {
 
+    // res = rhs - op * x
+    template <class OperatorType, template <typename> class VectorType, typename ValueType>
+    static void solver_residual(const OperatorType&          op,
+                                const VectorType<ValueType>& rhs,
+                                const VectorType<ValueType>& x,
+                                VectorType<ValueType>*       res)
+    {
+        op.Apply(x, res);
+        res->ScaleAdd(static_cast<ValueType>(-1), rhs);
+    }
+
+    // Local matrices compute the residual in a single pass
+    template <typename ValueType>
+    static void solver_residual(const LocalMatrix<ValueType>& op,
+                                const LocalVector<ValueType>& rhs,
+                                const LocalVector<ValueType>& x,
+                                LocalVector<ValueType>*       res)
+    {
+        op.Residual(rhs, x, res);
+    }
+
+    // out = in + omega * inv_diag * (rhs - op * in)
+    template <class OperatorType, template <typename> class VectorType, typename ValueType>
+    static void solver_jacobi_sweep(const OperatorType&          op,
+                                    const VectorType<ValueType>& inv_diag,
+                                    const VectorType<ValueType>& rhs,
+                                    ValueType                    omega,
+                                    const VectorType<ValueType>& in,
+                                    VectorType<ValueType>*       out)
+    {
+        solver_residual(op, rhs, in, out);
+        out->PointWiseMult(inv_diag);
+        out->ScaleAdd(omega, in);
+    }
+
+    // Local matrices perform the Jacobi sweep in a single pass
+    template <typename ValueType>
+    static void solver_jacobi_sweep(const LocalMatrix<ValueType>& op,
+                                    const LocalVector<ValueType>& inv_diag,
+                                    const LocalVector<ValueType>& rhs,
+                                    ValueType                     omega,
+                                    const LocalVector<ValueType>& in,
+                                    LocalVector<ValueType>*       out)
+    {
+        op.JacobiSweep(inv_diag, rhs, omega, in, out);
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     Solver<OperatorType, VectorType, ValueType>::Solver()
     {
@@ -100,6 +150,8 @@ namespace rocalution
     {
         log_debug(this, "Solver::Build()");
 
+        ProfilerRegion region("Solver::Build");
+
         // by default - nothing to build
 
         if(this->build_ == true)
@@ -373,6 +425,8 @@ namespace rocalution
     {
         log_debug(this, "IterativeLinearSolver::Solve()", (const void*&)rhs, x);
 
+        ProfilerRegion region("IterativeLinearSolver::Solve");
+
         assert(x != NULL);
         assert(x != &rhs);
         assert(this->op_ != NULL);
@@ -400,6 +454,37 @@ namespace rocalution
         }
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void IterativeLinearSolver<OperatorType, VectorType, ValueType>::SolveResidual(
+        const VectorType& rhs, VectorType* x, VectorType* res)
+    {
+        log_debug(this, "IterativeLinearSolver::SolveResidual()", (const void*&)rhs, x, res);
+
+        assert(res != NULL);
+        assert(res != x);
+        assert(res != &rhs);
+
+        this->Solve(rhs, x);
+
+        solver_residual(*this->op_, rhs, *x, res);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void IterativeLinearSolver<OperatorType, VectorType, ValueType>::SolveZeroSolResidual(
+        const VectorType& rhs, VectorType* x, VectorType* res)
+    {
+        log_debug(
+            this, "IterativeLinearSolver::SolveZeroSolResidual()", (const void*&)rhs, x, res);
+
+        assert(res != NULL);
+        assert(res != x);
+        assert(res != &rhs);
+
+        this->SolveZeroSol(rhs, x);
+
+        solver_residual(*this->op_, rhs, *x, res);
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void IterativeLinearSolver<OperatorType, VectorType, ValueType>::SetPreconditioner(
         Solver<OperatorType, VectorType, ValueType>& precond)
@@ -514,6 +599,8 @@ namespace rocalution
     {
         log_debug(this, "FixedPoint::Build()", "#*# begin");
 
+        ProfilerRegion region("FixedPoint::Build");
+
         if(this->build_ == true)
         {
             this->Clear();
@@ -601,6 +688,13 @@ namespace rocalution
             // Feed some dummy residual to initialize IterationControl class
             this->iter_ctrl_.InitResidual(1.0);
 
+            // Jacobi smoothing is performed with fused sweeps
+            if(this->JacobiSmooth_(rhs, x, false) == true)
+            {
+                log_debug(this, "FixedPoint::SolvePrecond_()", " #*# end");
+                return;
+            }
+
             // Modified Richardson Iteration
             // x^(k+1) = x^k + omega * (b - Ax^k)
 
@@ -682,6 +776,55 @@ namespace rocalution
         log_debug(this, "FixedPoint::SolvePrecond_()", " #*# end");
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    bool FixedPoint<OperatorType, VectorType, ValueType>::JacobiSmooth_(const VectorType& rhs,
+                                                                        VectorType*       x,
+                                                                        bool              zero_sol)
+    {
+        const Jacobi<OperatorType, VectorType, ValueType>* jacobi
+            = dynamic_cast<const Jacobi<OperatorType, VectorType, ValueType>*>(this->precond_);
+
+        if(jacobi == NULL || jacobi->inv_diag_entries_.GetSize() == 0)
+        {
+            return false;
+        }
+
+        log_debug(this, "FixedPoint::JacobiSmooth_()", (const void*&)rhs, x, zero_sol);
+
+        const VectorType& inv_diag = jacobi->inv_diag_entries_;
+
+        int steps = this->iter_ctrl_.GetMaximumIterations();
+        int iter  = 0;
+
+        // With zero initial guess, the first sweep does not require the matrix
+        // x = omega * D^-1 * rhs
+        if(zero_sol == true)
+        {
+            x->PointWiseMult(inv_diag, rhs);
+            x->Scale(this->omega_);
+
+            ++iter;
+        }
+
+        // x^(k+1) = x^k + omega * D^-1 * (rhs - Ax^k), alternating between x and x_old
+        VectorType* x_in  = x;
+        VectorType* x_out = &this->x_old_;
+
+        for(; iter < steps; ++iter)
+        {
+            solver_jacobi_sweep(*this->op_, inv_diag, rhs, this->omega_, *x_in, x_out);
+
+            std::swap(x_in, x_out);
+        }
+
+        if(x_in != x)
+        {
+            x->CopyFrom(*x_in);
+        }
+
+        return true;
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void FixedPoint<OperatorType, VectorType, ValueType>::SolveZeroSol_(const VectorType& rhs,
                                                                         VectorType*       x)
@@ -709,6 +852,13 @@ namespace rocalution
             // Feed some dummy residual to initialize IterationControl class
             this->iter_ctrl_.InitResidual(1.0);
 
+            // Jacobi smoothing is performed with fused sweeps
+            if(this->JacobiSmooth_(rhs, x, true) == true)
+            {
+                log_debug(this, "FixedPoint::SolveZeroSol_()", " #*# end");
+                return;
+            }
+
             // Modified Richardson Iteration
             // x^(k+1) = x^k + omega * (b - Ax^k)
 
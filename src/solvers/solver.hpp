@@ -278,6 +278,20 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual void Solve(const VectorType& rhs, VectorType* x);
 
+        /** \brief Solve Operator x = rhs and compute the residual res = rhs - Operator x
+      * \details
+      * Used by the multigrid solvers to fuse smoothing and residual computation. If the
+      * operator supports it, the residual is computed in a single pass.
+      */
+        ROCALUTION_EXPORT
+        virtual void SolveResidual(const VectorType& rhs, VectorType* x, VectorType* res);
+
+        /** \brief Solve Operator x = rhs, setting initial x = 0, and compute the residual
+      * res = rhs - Operator x
+      */
+        ROCALUTION_EXPORT
+        virtual void SolveZeroSolResidual(const VectorType& rhs, VectorType* x, VectorType* res);
+
         /** \brief Set a preconditioner of the linear solver */
         ROCALUTION_EXPORT
         virtual void SetPreconditioner(Solver<OperatorType, VectorType, ValueType>& precond);
@@ -371,6 +385,11 @@ namespace rocalution
     protected:
         void SolveZeroSol_(const VectorType& rhs, VectorType* x);
 
+        /** \brief Perform the smoothing steps with fused Jacobi sweeps, if the
+      * preconditioner is Jacobi; returns false otherwise
+      */
+        bool JacobiSmooth_(const VectorType& rhs, VectorType* x, bool zero_sol);
+
         /** \brief Relaxation parameter */
         ValueType  omega_;
         VectorType x_old_; /**< \private */
@@ -390,11 +409,12 @@ namespace rocalution
   * \class DirectLinearSolver
   * \brief Base class for all direct linear solvers
   * \details
-  * The library provides three direct methods - LU, QR and Inversion (based on QR
+  * The library provides three dense direct methods - LU, QR and Inversion (based on QR
   * decomposition). The user can pass a sparse matrix, internally it will be converted to
   * dense and then the selected method will be applied. These methods are not very
   * optimal and due to the fact that the matrix is converted to a dense format, these
-  * methods should be used only for very small matrices.
+  * methods should be used only for very small matrices. For larger sparse matrices,
+  * SparseLU keeps the factors in sparse format.
   *
   * \tparam OperatorType - can be LocalMatrix
   * \tparam VectorType - can be LocalVector
@@ -25,62 +25,464 @@
 #include "def.hpp"
 #include "log.hpp"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <atomic>
 #include <complex>
 #include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(WIN32) || defined(_WIN32) || defined(__WIN32) \
+    || defined(__WIN64) && !defined(__CYGWIN__)
+// Windows, memory mapping is not supported
+#else
+// Linux
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ROCALUTION_HAVE_MMAP
+#endif
+
 namespace rocalution
 {
 
-    //#define MEM_ALIGNMENT 64
-    //#define LONG_PTR size_t
-    //#define LONG_PTR long
+    // Memory mapped files, referenced by the pointers that have been handed out
+    struct host_mapping
+    {
+        void*  addr;
+        size_t size;
+        int    refs;
+    };
 
-    template <typename DataType>
-    void allocate_host(int size, DataType** ptr)
+    static std::mutex                                           mapping_mutex;
+    static std::map<const void*, std::pair<host_mapping*, int>> mapping_ptrs;
+    static std::atomic<int>                                     mapping_count(0);
+
+    static void register_mapped_host(host_mapping* map, const void* ptr)
     {
-        log_debug(0, "allocate_host()", "* begin", size, ptr);
+        std::lock_guard<std::mutex> lock(mapping_mutex);
 
-        if(size > 0)
+        std::pair<host_mapping*, int>& entry = mapping_ptrs[ptr];
+
+        entry.first = map;
+        ++entry.second;
+        ++map->refs;
+    }
+
+    // Release a pointer into a mapped file, returns false if ptr does not belong to a mapping
+    static bool release_mapped_host(const void* ptr)
+    {
+        // Fast path, no file is mapped
+        if(mapping_count.load() == 0)
         {
-            assert(*ptr == NULL);
+            return false;
+        }
 
-            // *********************************************************
-            // C++ style
-            //    *ptr = new DataType[size];
-            // *********************************************************
+        std::lock_guard<std::mutex> lock(mapping_mutex);
 
-            // *********************************************************
-            // C style
-            // *ptr =  (DataType *) malloc(size*sizeof(DataType));
-            // *********************************************************
+        auto it = mapping_ptrs.find(ptr);
+
+        if(it == mapping_ptrs.end())
+        {
+            return false;
+        }
 
-            // *********************************************************
-            // C style (zero-set)
-            // *ptr = (DataType *) calloc(size, sizeof(DatatType));
-            // *********************************************************
+        host_mapping* map = it->second.first;
 
-            // *********************************************************
-            // Aligned allocation
-            // total size = (size*datatype) + (alignment-1) + (void ptr)
-            // void *non_aligned =  malloc(size*sizeof(DataType)+(MEM_ALIGNMENT-1)+sizeof(void*));
-            // assert(non_aligned != NULL);
+        if(--it->second.second == 0)
+        {
+            mapping_ptrs.erase(it);
+        }
 
-            // void *aligned = (void*)( ((LONG_PTR)(non_aligned)+MEM_ALIGNMENT+sizeof(void*) ) &
-            // ~(MEM_ALIGNMENT-1) );
-            // *((void**)aligned-1) = non_aligned;
+        if(--map->refs == 0)
+        {
+#ifdef ROCALUTION_HAVE_MMAP
+            munmap(map->addr, map->size);
+#endif
+            delete map;
 
-            // *ptr = (DataType*) aligned;
+            --mapping_count;
+        }
 
-            // LOG_INFO("A " << *ptr << " " <<  aligned << " " << non_aligned << " "<<  sizeof(DataType)
-            // << " " << size);
-            // *********************************************************
+        return true;
+    }
 
-            // *********************************************************
-            // C++ style and error handling
+    bool map_file_host(const char* filename, int64_t* size, char** ptr)
+    {
+        log_debug(0, "map_file_host()", filename, size, ptr);
+
+        assert(*ptr == NULL);
+
+#ifdef ROCALUTION_HAVE_MMAP
+        int fd = open(filename, O_RDONLY);
+
+        if(fd < 0)
+        {
+            return false;
+        }
+
+        struct stat st;
+
+        if(fstat(fd, &st) != 0 || st.st_size == 0)
+        {
+            close(fd);
+            return false;
+        }
+
+        // Private mapping, writes go to copies of the pages and never reach the file
+        void* addr = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+        close(fd);
+
+        if(addr == MAP_FAILED)
+        {
+            return false;
+        }
+
+        host_mapping* map = new host_mapping;
+
+        map->addr = addr;
+        map->size = st.st_size;
+        map->refs = 0;
+
+        ++mapping_count;
+
+        *size = st.st_size;
+        *ptr  = static_cast<char*>(addr);
+
+        register_mapped_host(map, addr);
+
+        return true;
+#else
+        return false;
+#endif
+    }
 
-            *ptr = new(std::nothrow) DataType[size];
+    void alias_mapped_host(const char* base, const void* ptr)
+    {
+        log_debug(0, "alias_mapped_host()", base, ptr);
+
+        host_mapping* map = NULL;
+
+        {
+            std::lock_guard<std::mutex> lock(mapping_mutex);
+
+            auto it = mapping_ptrs.find(base);
+
+            assert(it != mapping_ptrs.end());
+
+            map = it->second.first;
+        }
+
+        register_mapped_host(map, ptr);
+    }
+
+    // Host allocator state, buffers that have not been obtained with new[] are registered
+    // together with the way they have to be released
+    struct host_block
+    {
+        size_t size;
+        bool   pooled;
+        void (*deallocate)(void*);
+    };
+
+    static _host_allocator host_allocator            = HostAllocatorDefault;
+    static size_t          host_allocator_alignment  = 64;
+    static size_t          host_allocator_pool_limit = size_t(1) << 30;
+    static void* (*host_allocator_allocate)(size_t) = NULL;
+    static void (*host_allocator_deallocate)(void*) = NULL;
+
+    static std::mutex                            block_mutex;
+    static std::unordered_map<void*, host_block> block_ptrs;
+    static std::map<size_t, std::vector<void*>>  block_pool;
+    static std::atomic<int>                      block_count(0);
+    static size_t                                block_pool_size = 0;
+
+    static void* aligned_alloc_host(size_t size, size_t alignment)
+    {
+#if defined(WIN32) || defined(_WIN32) || defined(__WIN32) \
+    || defined(__WIN64) && !defined(__CYGWIN__)
+        return _aligned_malloc(size, alignment);
+#else
+        void* ptr = NULL;
+
+        if(posix_memalign(&ptr, alignment, size) != 0)
+        {
+            return NULL;
+        }
+
+        return ptr;
+#endif
+    }
+
+    static void aligned_free_host(void* ptr)
+    {
+#if defined(WIN32) || defined(_WIN32) || defined(__WIN32) \
+    || defined(__WIN64) && !defined(__CYGWIN__)
+        _aligned_free(ptr);
+#else
+        free(ptr);
+#endif
+    }
+
+    // Pool size classes, powers of two up to 4 KB and eighth steps of the next power of two
+    // above, such that a buffer wastes at most 25% of its size
+    static size_t pool_class_size(size_t size)
+    {
+        size_t pow2 = 64;
+
+        while(pow2 < size)
+        {
+            pow2 <<= 1;
+        }
+
+        if(pow2 <= 4096)
+        {
+            return pow2;
+        }
+
+        size_t step = pow2 / 8;
+
+        return (size + step - 1) / step * step;
+    }
+
+    // Obtain a buffer from the selected allocator, returns false if new[] should be used
+    static bool allocate_block(size_t size, void** ptr, bool* touch)
+    {
+        if(host_allocator == HostAllocatorDefault && host_allocator_allocate == NULL)
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(block_mutex);
+
+        host_block block;
+
+        *ptr   = NULL;
+        *touch = false;
+
+        if(host_allocator_allocate != NULL)
+        {
+            block.size       = size;
+            block.pooled     = false;
+            block.deallocate = host_allocator_deallocate;
+
+            *ptr = host_allocator_allocate(size);
+        }
+        else if(host_allocator == HostAllocatorPool)
+        {
+            block.size       = pool_class_size(size);
+            block.pooled     = true;
+            block.deallocate = aligned_free_host;
+
+            auto it = block_pool.find(block.size);
+
+            if(it != block_pool.end() && !it->second.empty())
+            {
+                *ptr = it->second.back();
+                it->second.pop_back();
+
+                block_pool_size -= block.size;
+            }
+            else
+            {
+                *ptr   = aligned_alloc_host(block.size, host_allocator_alignment);
+                *touch = true;
+            }
+        }
+        else
+        {
+            block.size       = size;
+            block.pooled     = false;
+            block.deallocate = aligned_free_host;
+
+            *ptr   = aligned_alloc_host(size, host_allocator_alignment);
+            *touch = true;
+        }
+
+        if(*ptr != NULL)
+        {
+            block_ptrs[*ptr] = block;
+            ++block_count;
+        }
+
+        return true;
+    }
+
+    // Release a registered buffer, returns false if ptr has been obtained with new[]
+    static bool release_block(void* ptr)
+    {
+        // Fast path, all buffers have been obtained with new[]
+        if(block_count.load() == 0)
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(block_mutex);
+
+        auto it = block_ptrs.find(ptr);
+
+        if(it == block_ptrs.end())
+        {
+            return false;
+        }
+
+        host_block block = it->second;
+
+        block_ptrs.erase(it);
+        --block_count;
+
+        // Keep pooled buffers for reuse as long as the pool is active and below its limit
+        if(block.pooled == true && host_allocator == HostAllocatorPool
+           && host_allocator_allocate == NULL
+           && block_pool_size + block.size <= host_allocator_pool_limit)
+        {
+            block_pool[block.size].push_back(ptr);
+            block_pool_size += block.size;
+        }
+        else
+        {
+            block.deallocate(ptr);
+        }
+
+        return true;
+    }
+
+    static void clear_pool(void)
+    {
+        for(auto& it : block_pool)
+        {
+            for(void* ptr : it.second)
+            {
+                aligned_free_host(ptr);
+            }
+        }
+
+        block_pool.clear();
+        block_pool_size = 0;
+    }
+
+    void set_host_allocator_rocalution(_host_allocator allocator,
+                                       size_t          alignment,
+                                       size_t          pool_limit)
+    {
+        log_debug(0, "set_host_allocator_rocalution()", allocator, alignment, pool_limit);
+
+        assert(allocator == HostAllocatorDefault || allocator == HostAllocatorAligned
+               || allocator == HostAllocatorPool);
+        assert(alignment >= sizeof(void*) && (alignment & (alignment - 1)) == 0);
+
+        std::lock_guard<std::mutex> lock(block_mutex);
+
+        clear_pool();
+
+        host_allocator            = allocator;
+        host_allocator_alignment  = alignment;
+        host_allocator_pool_limit = pool_limit;
+        host_allocator_allocate   = NULL;
+        host_allocator_deallocate = NULL;
+    }
+
+    void set_host_allocator_rocalution(void* (*allocate)(size_t size),
+                                       void (*deallocate)(void* ptr))
+    {
+        log_debug(0, "set_host_allocator_rocalution()", "user defined");
+
+        assert(allocate != NULL);
+        assert(deallocate != NULL);
+
+        std::lock_guard<std::mutex> lock(block_mutex);
+
+        clear_pool();
+
+        host_allocator            = HostAllocatorDefault;
+        host_allocator_allocate   = allocate;
+        host_allocator_deallocate = deallocate;
+    }
+
+    void _rocalution_clear_host_pool(void)
+    {
+        log_debug(0, "_rocalution_clear_host_pool()");
+
+        std::lock_guard<std::mutex> lock(block_mutex);
+
+        clear_pool();
+    }
+
+    void _rocalution_info_host_allocator(void)
+    {
+        std::lock_guard<std::mutex> lock(block_mutex);
+
+        if(host_allocator_allocate != NULL)
+        {
+            LOG_INFO("Host allocator: user defined");
+        }
+        else if(host_allocator == HostAllocatorAligned)
+        {
+            LOG_INFO("Host allocator: aligned (" << host_allocator_alignment
+                                                 << " bytes), first touch");
+        }
+        else if(host_allocator == HostAllocatorPool)
+        {
+            LOG_INFO("Host allocator: pool, aligned (" << host_allocator_alignment
+                                                       << " bytes), first touch; "
+                                                       << block_pool_size / 1e6
+                                                       << " MB cached");
+        }
+        else
+        {
+            LOG_INFO("Host allocator: default");
+        }
+    }
+
+    template <typename DataType>
+    void allocate_host(int64_t size, DataType** ptr)
+    {
+        log_debug(0, "allocate_host()", "* begin", size, ptr);
+
+        if(size > 0)
+        {
+            assert(*ptr == NULL);
+
+            void* block = NULL;
+            bool  touch = false;
+
+            if(allocate_block(size * sizeof(DataType), &block, &touch) == true)
+            {
+                *ptr = static_cast<DataType*>(block);
+
+                // First touch, using the thread distribution of the host backend kernels
+                if(*ptr != NULL && touch == true)
+                {
+                    char* data = reinterpret_cast<char*>(*ptr);
+
+                    if(_get_backend_descriptor()->init == true)
+                    {
+                        _set_omp_backend_threads(*_get_backend_descriptor(), size);
+                    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+                    for(int64_t i = 0; i < size; ++i)
+                    {
+                        memset(data + i * sizeof(DataType), 0, sizeof(DataType));
+                    }
+                }
+            }
+            else
+            {
+                *ptr = new(std::nothrow) DataType[size];
+            }
 
             if(!(*ptr))
             { // nullptr
@@ -88,7 +490,6 @@ namespace rocalution
                 LOG_VERBOSE_INFO(2, "Size of the requested buffer = " << size * sizeof(DataType));
                 FATAL_ERROR(__FILE__, __LINE__);
             }
-            // *********************************************************
 
             assert(*ptr != NULL);
         }
@@ -103,26 +504,27 @@ namespace rocalution
 
         assert(*ptr != NULL);
 
-        // *********************************************************
-        // C++ style
-        delete[] * ptr;
-        // *********************************************************
+        // Pointers into memory mapped files are released, not deallocated
+        if(release_mapped_host(*ptr))
+        {
+            *ptr = NULL;
+            return;
+        }
 
-        // *********************************************************
-        // C style
-        // free(*ptr);
-        // *********************************************************
+        // Buffers from the aligned, pool or user allocator go back to where they came from
+        if(release_block(*ptr))
+        {
+            *ptr = NULL;
+            return;
+        }
 
-        // *********************************************************
-        // Aligned allocation
-        //  free(*((void **)*ptr-1));
-        // *********************************************************
+        delete[] * ptr;
 
         *ptr = NULL;
     }
 
     template <typename DataType>
-    void set_to_zero_host(int size, DataType* ptr)
+    void set_to_zero_host(int64_t size, DataType* ptr)
     {
         log_debug(0, "set_to_zero_host()", size, ptr);
 
@@ -137,16 +539,17 @@ namespace rocalution
         }
     }
 
-    template void allocate_host<float>(int size, float** ptr);
-    template void allocate_host<double>(int size, double** ptr);
+    template void allocate_host<float>(int64_t size, float** ptr);
+    template void allocate_host<double>(int64_t size, double** ptr);
 #ifdef SUPPORT_COMPLEX
-    template void allocate_host<std::complex<float>>(int size, std::complex<float>** ptr);
-    template void allocate_host<std::complex<double>>(int size, std::complex<double>** ptr);
+    template void allocate_host<std::complex<float>>(int64_t size, std::complex<float>** ptr);
+    template void allocate_host<std::complex<double>>(int64_t size, std::complex<double>** ptr);
 #endif
-    template void allocate_host<bool>(int size, bool** ptr);
-    template void allocate_host<int>(int size, int** ptr);
-    template void allocate_host<unsigned int>(int size, unsigned int** ptr);
-    template void allocate_host<char>(int size, char** ptr);
+    template void allocate_host<bool>(int64_t size, bool** ptr);
+    template void allocate_host<int>(int64_t size, int** ptr);
+    template void allocate_host<unsigned int>(int64_t size, unsigned int** ptr);
+    template void allocate_host<int64_t>(int64_t size, int64_t** ptr);
+    template void allocate_host<char>(int64_t size, char** ptr);
 
     template void free_host<float>(float** ptr);
     template void free_host<double>(double** ptr);
@@ -157,17 +560,19 @@ namespace rocalution
     template void free_host<bool>(bool** ptr);
     template void free_host<int>(int** ptr);
     template void free_host<unsigned int>(unsigned int** ptr);
+    template void free_host<int64_t>(int64_t** ptr);
     template void free_host<char>(char** ptr);
 
-    template void set_to_zero_host<float>(int size, float* ptr);
-    template void set_to_zero_host<double>(int size, double* ptr);
+    template void set_to_zero_host<float>(int64_t size, float* ptr);
+    template void set_to_zero_host<double>(int64_t size, double* ptr);
 #ifdef SUPPORT_COMPLEX
-    template void set_to_zero_host<std::complex<float>>(int size, std::complex<float>* ptr);
-    template void set_to_zero_host<std::complex<double>>(int size, std::complex<double>* ptr);
+    template void set_to_zero_host<std::complex<float>>(int64_t size, std::complex<float>* ptr);
+    template void set_to_zero_host<std::complex<double>>(int64_t size, std::complex<double>* ptr);
 #endif
-    template void set_to_zero_host<bool>(int size, bool* ptr);
-    template void set_to_zero_host<int>(int size, int* ptr);
-    template void set_to_zero_host<unsigned int>(int size, unsigned int* ptr);
-    template void set_to_zero_host<char>(int size, char* ptr);
+    template void set_to_zero_host<bool>(int64_t size, bool* ptr);
+    template void set_to_zero_host<int>(int64_t size, int* ptr);
+    template void set_to_zero_host<unsigned int>(int64_t size, unsigned int* ptr);
+    template void set_to_zero_host<int64_t>(int64_t size, int64_t* ptr);
+    template void set_to_zero_host<char>(int64_t size, char* ptr);
 
 } // namespace rocalution
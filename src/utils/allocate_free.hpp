@@ -26,6 +26,8 @@
 
 #include "rocalution/export.hpp"
 
+#include <cstdint>
+
 namespace rocalution
 {
 
@@ -40,11 +42,11 @@ namespace rocalution
   * ptr     pointer to the position in memory where the buffer should be allocated,
   *         it is expected that \p *ptr == \p NULL
   *
-  * \tparam DataType can be char, int, unsigned int, float, double, std::complex<float>
-  *         or std::complex<double>.
+  * \tparam DataType can be char, int, unsigned int, int64_t, float, double,
+  *         std::complex<float> or std::complex<double>.
   */
     template <typename DataType>
-    ROCALUTION_EXPORT void allocate_host(int size, DataType** ptr);
+    ROCALUTION_EXPORT void allocate_host(int64_t size, DataType** ptr);
 
     /** \ingroup backend_module
   * \brief Free buffer on the host
@@ -56,8 +58,8 @@ namespace rocalution
   * ptr     pointer to the position in memory where the buffer should be deallocated,
   *         it is expected that \p *ptr != \p NULL
   *
-  * \tparam DataType can be char, int, unsigned int, float, double, std::complex<float>
-  *         or std::complex<double>.
+  * \tparam DataType can be char, int, unsigned int, int64_t, float, double,
+  *         std::complex<float> or std::complex<double>.
   */
     template <typename DataType>
     ROCALUTION_EXPORT void free_host(DataType** ptr);
@@ -72,11 +74,21 @@ namespace rocalution
   * @param[inout]
   * ptr     pointer to the host buffer
   *
-  * \tparam DataType can be char, int, unsigned int, float, double, std::complex<float>
-  *         or std::complex<double>.
+  * \tparam DataType can be char, int, unsigned int, int64_t, float, double,
+  *         std::complex<float> or std::complex<double>.
   */
     template <typename DataType>
-    ROCALUTION_EXPORT void set_to_zero_host(int size, DataType* ptr);
+    ROCALUTION_EXPORT void set_to_zero_host(int64_t size, DataType* ptr);
+
+    // Map a file copy-on-write into host memory, the file itself is never modified. Returns
+    // false, if the file cannot be mapped or memory mapping is not supported. The mapping is
+    // released, once the mapping and all pointers registered by alias_mapped_host() have
+    // been released by free_host().
+    bool map_file_host(const char* filename, int64_t* size, char** ptr);
+
+    // Register ptr, which points into the mapping starting at base, such that free_host()
+    // releases it instead of deallocating it
+    void alias_mapped_host(const char* base, const void* ptr);
 
 } // namespace rocalution
 
@@ -113,6 +113,54 @@ namespace rocalution
         CHECK_MPI_ERROR(status, __FILE__, __LINE__);
     }
 
+    template <>
+    void communication_async_allreduce_sum(const double* local,
+                                           double*       global,
+                                           int           count,
+                                           MRequest*     request,
+                                           const void*   comm)
+    {
+        int status = MPI_Iallreduce(
+            local, global, count, MPI_DOUBLE, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_async_allreduce_sum(const float* local,
+                                           float*       global,
+                                           int          count,
+                                           MRequest*    request,
+                                           const void*  comm)
+    {
+        int status = MPI_Iallreduce(
+            local, global, count, MPI_FLOAT, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_async_allreduce_sum(const std::complex<double>* local,
+                                           std::complex<double>*       global,
+                                           int                         count,
+                                           MRequest*                   request,
+                                           const void*                 comm)
+    {
+        int status = MPI_Iallreduce(
+            local, global, count, MPI_DOUBLE_COMPLEX, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_async_allreduce_sum(const std::complex<float>* local,
+                                           std::complex<float>*       global,
+                                           int                        count,
+                                           MRequest*                  request,
+                                           const void*                comm)
+    {
+        int status = MPI_Iallreduce(
+            local, global, count, MPI_COMPLEX, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
     template <>
     void communication_async_recv(
         double* buf, int count, int source, int tag, MRequest* request, const void* comm)
@@ -169,6 +217,16 @@ namespace rocalution
         CHECK_MPI_ERROR(status, __FILE__, __LINE__);
     }
 
+    template <>
+    void communication_async_recv(
+        bool* buf, int count, int source, int tag, MRequest* request, const void* comm)
+    {
+        int status
+            = MPI_Irecv(buf, count, MPI_CXX_BOOL, source, tag, *(MPI_Comm*)comm, &request->req);
+
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
     template <>
     void communication_async_send(
         double* buf, int count, int dest, int tag, MRequest* request, const void* comm)
@@ -219,6 +277,16 @@ namespace rocalution
         CHECK_MPI_ERROR(status, __FILE__, __LINE__);
     }
 
+    template <>
+    void communication_async_send(
+        bool* buf, int count, int dest, int tag, MRequest* request, const void* comm)
+    {
+        int status
+            = MPI_Isend(buf, count, MPI_CXX_BOOL, dest, tag, *(MPI_Comm*)comm, &request->req);
+
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
     void communication_syncall(int count, MRequest* requests)
     {
         int status = MPI_Waitall(count, &requests[0].req, MPI_STATUSES_IGNORE);
@@ -226,6 +294,20 @@ namespace rocalution
         CHECK_MPI_ERROR(status, __FILE__, __LINE__);
     }
 
+    bool communication_testall(int count, MRequest* requests)
+    {
+        int flag = 1;
+
+        if(count > 0)
+        {
+            int status = MPI_Testall(count, &requests[0].req, &flag, MPI_STATUSES_IGNORE);
+
+            CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+        }
+
+        return flag != 0;
+    }
+
     template void
         communication_allreduce_single_sum<double>(double local, double* global, const void* comm);
     template void
@@ -238,6 +320,26 @@ namespace rocalution
         std::complex<float> local, std::complex<float>* global, const void* comm);
 #endif
 
+    template void communication_async_allreduce_sum<double>(
+        const double* local, double* global, int count, MRequest* request, const void* comm);
+    template void communication_async_allreduce_sum<float>(
+        const float* local, float* global, int count, MRequest* request, const void* comm);
+
+#ifdef SUPPORT_COMPLEX
+    template void
+        communication_async_allreduce_sum<std::complex<double>>(const std::complex<double>* local,
+                                                                std::complex<double>*       global,
+                                                                int                         count,
+                                                                MRequest*                   request,
+                                                                const void*                 comm);
+    template void
+        communication_async_allreduce_sum<std::complex<float>>(const std::complex<float>* local,
+                                                               std::complex<float>*       global,
+                                                               int                        count,
+                                                               MRequest*                  request,
+                                                               const void*                comm);
+#endif
+
     template void communication_async_recv<double>(
         double* buf, int count, int source, int tag, MRequest* request, const void* comm);
     template void communication_async_recv<float>(
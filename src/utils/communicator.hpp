@@ -39,6 +39,10 @@ namespace rocalution
     template <typename ValueType>
     void communication_allreduce_single_sum(ValueType local, ValueType* global, const void* comm);
 
+    template <typename ValueType>
+    void communication_async_allreduce_sum(
+        const ValueType* local, ValueType* global, int count, MRequest* request, const void* comm);
+
     template <typename ValueType>
     void communication_async_recv(
         ValueType* buf, int count, int source, int tag, MRequest* request, const void* comm);
@@ -49,6 +53,8 @@ namespace rocalution
 
     void communication_syncall(int count, MRequest* requests);
 
+    bool communication_testall(int count, MRequest* requests);
+
 } // namespace rocalution
 
 #endif // ROCALUTION_UTILS_COMMUNICATOR_HPP_
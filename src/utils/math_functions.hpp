@@ -39,6 +39,16 @@ namespace rocalution
     /// Return double value
     double rocalution_double(const std::complex<double>& val);
 
+    /// Return conjugate complex
+    inline bool rocalution_conj(const bool& val)
+    {
+        return val;
+    }
+    /// Return conjugate complex
+    inline int rocalution_conj(const int& val)
+    {
+        return val;
+    }
     /// Return conjugate complex
     inline float rocalution_conj(const float& val)
     {
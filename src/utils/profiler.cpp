@@ -0,0 +1,525 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "profiler.hpp"
+#include "../base/backend_manager.hpp"
+#include "../base/matrix_formats.hpp"
+#include "def.hpp"
+#include "log.hpp"
+#include "time_functions.hpp"
+#include "types.hpp"
+
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+namespace rocalution
+{
+
+    // Region of the profiler tree. All calls of a region from the same parent region are
+    // accumulated in one node.
+    struct profiler_node
+    {
+        std::string                name;
+        int                        parent;
+        int                        depth;
+        std::vector<int>           children;
+        std::map<std::string, int> child_index;
+
+        int64_t calls;
+        double  time;
+        double  bytes;
+        double  flops;
+    };
+
+    // Single call of a region, for the timeline
+    struct profiler_event
+    {
+        int    node;
+        int    tid;
+        double begin;
+        double end;
+        double bytes;
+        double flops;
+    };
+
+    // Open region of a thread
+    struct profiler_frame
+    {
+        int    node;
+        int    generation;
+        double begin;
+        double bytes;
+        double flops;
+    };
+
+    // Maximum number of calls that are kept for the timeline
+    static const size_t profiler_max_events = 1 << 20;
+
+    static std::atomic<bool>           profiler_on(false);
+    static int                         profiler_env        = 0;
+    static int                         profiler_generation = 0;
+    static int                         profiler_nthreads   = 0;
+    static double                      profiler_start      = 0.0;
+    static size_t                      profiler_dropped    = 0;
+    static std::vector<profiler_node>  profiler_nodes;
+    static std::vector<profiler_event> profiler_events;
+    static std::mutex                  profiler_mutex;
+
+    // Open regions and timeline id of the calling thread
+    static thread_local std::vector<profiler_frame> profiler_stack;
+    static thread_local int                         profiler_tid = -1;
+
+    // Discard all records, regions that are still open are not recorded anymore.
+    // The profiler mutex has to be locked.
+    static void profiler_clear(void)
+    {
+        profiler_node root;
+
+        root.parent = -1;
+        root.depth  = -1;
+        root.calls  = 0;
+        root.time   = 0.0;
+        root.bytes  = 0.0;
+        root.flops  = 0.0;
+
+        profiler_nodes.clear();
+        profiler_nodes.push_back(root);
+
+        profiler_events.clear();
+
+        profiler_dropped = 0;
+        profiler_start   = rocalution_time();
+
+        ++profiler_generation;
+    }
+
+    // Return the child region of parent with the given name, create it if required.
+    // The profiler mutex has to be locked.
+    static int profiler_child(int parent, const std::string& name)
+    {
+        std::map<std::string, int>::const_iterator it
+            = profiler_nodes[parent].child_index.find(name);
+
+        if(it != profiler_nodes[parent].child_index.end())
+        {
+            return it->second;
+        }
+
+        profiler_node node;
+
+        node.name   = name;
+        node.parent = parent;
+        node.depth  = profiler_nodes[parent].depth + 1;
+        node.calls  = 0;
+        node.time   = 0.0;
+        node.bytes  = 0.0;
+        node.flops  = 0.0;
+
+        int index = static_cast<int>(profiler_nodes.size());
+
+        profiler_nodes.push_back(node);
+        profiler_nodes[parent].children.push_back(index);
+        profiler_nodes[parent].child_index[name] = index;
+
+        return index;
+    }
+
+    // Innermost region of the calling thread that is still recorded.
+    // The profiler mutex has to be locked.
+    static int profiler_parent(void)
+    {
+        if(profiler_stack.empty() == false
+           && profiler_stack.back().generation == profiler_generation)
+        {
+            return profiler_stack.back().node;
+        }
+
+        return 0;
+    }
+
+    // Add a finished call to the node and the timeline.
+    // The profiler mutex has to be locked.
+    static void profiler_add(int node, double begin, double end, double bytes, double flops)
+    {
+        profiler_nodes[node].calls += 1;
+        profiler_nodes[node].time += end - begin;
+        profiler_nodes[node].bytes += bytes;
+        profiler_nodes[node].flops += flops;
+
+        if(profiler_events.size() < profiler_max_events)
+        {
+            if(profiler_tid < 0)
+            {
+                profiler_tid = profiler_nthreads++;
+            }
+
+            profiler_event event;
+
+            event.node  = node;
+            event.tid   = profiler_tid;
+            event.begin = begin - profiler_start;
+            event.end   = end - profiler_start;
+            event.bytes = bytes;
+            event.flops = flops;
+
+            profiler_events.push_back(event);
+        }
+        else
+        {
+            ++profiler_dropped;
+        }
+    }
+
+    static std::string profiler_json_string(const std::string& str)
+    {
+        std::string res = "\"";
+
+        for(size_t i = 0; i < str.size(); ++i)
+        {
+            if(str[i] == '"' || str[i] == '\\')
+            {
+                res += '\\';
+            }
+
+            res += str[i];
+        }
+
+        return res + "\"";
+    }
+
+    static void profiler_print_node(int node, double total)
+    {
+        const profiler_node& n = profiler_nodes[node];
+
+        // Regions that are still open have not been called yet and have no average
+        double avg = (n.calls > 0) ? n.time / n.calls : 0.0;
+
+        std::ostringstream row;
+
+        row << std::left << std::setw(48) << (std::string(2 * n.depth, ' ') + n.name)
+            << std::right << std::fixed << std::setw(10) << n.calls << std::setprecision(3)
+            << std::setw(14) << n.time * 1e-3 << std::setw(14) << avg << std::setprecision(1)
+            << std::setw(8) << 100.0 * n.time / total;
+
+        // Throughput of the regions with an estimate of bytes and flops
+        if(n.time > 0.0 && n.bytes > 0.0)
+        {
+            row << std::setprecision(2) << std::setw(10) << n.bytes / n.time * 1e-3
+                << std::setw(10) << n.flops / n.time * 1e-3;
+        }
+
+        LOG_INFO(row.str());
+
+        for(size_t i = 0; i < n.children.size(); ++i)
+        {
+            profiler_print_node(n.children[i], total);
+        }
+    }
+
+    static void profiler_write_node(std::ofstream& file, int node, int indent)
+    {
+        const profiler_node& n = profiler_nodes[node];
+
+        std::string pad(indent, ' ');
+
+        file << pad << "{\"name\": " << profiler_json_string(n.name) << ", \"calls\": " << n.calls
+             << ", \"time_us\": " << n.time << ", \"bytes\": " << n.bytes
+             << ", \"flops\": " << n.flops << ", \"children\": [";
+
+        for(size_t i = 0; i < n.children.size(); ++i)
+        {
+            file << (i == 0 ? "\n" : ",\n");
+            profiler_write_node(file, n.children[i], indent + 2);
+        }
+
+        file << (n.children.empty() ? "" : "\n" + pad) << "]}";
+    }
+
+    bool _rocalution_profiler_active(void)
+    {
+        return profiler_on.load(std::memory_order_relaxed);
+    }
+
+    void _rocalution_profiler_begin(const char* name, int index, double bytes, double flops)
+    {
+        std::string key(name);
+
+        if(index >= 0)
+        {
+            key += " " + std::to_string(index);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(profiler_mutex);
+
+            profiler_frame frame;
+
+            frame.node       = profiler_child(profiler_parent(), key);
+            frame.generation = profiler_generation;
+            frame.bytes      = bytes;
+            frame.flops      = flops;
+
+            profiler_stack.push_back(frame);
+        }
+
+        profiler_stack.back().begin = rocalution_time();
+    }
+
+    void _rocalution_profiler_end(void)
+    {
+        double end = rocalution_time();
+
+        if(profiler_stack.empty() == true)
+        {
+            return;
+        }
+
+        profiler_frame frame = profiler_stack.back();
+        profiler_stack.pop_back();
+
+        std::lock_guard<std::mutex> lock(profiler_mutex);
+
+        if(frame.generation == profiler_generation)
+        {
+            profiler_add(frame.node, frame.begin, end, frame.bytes, frame.flops);
+        }
+    }
+
+    void _rocalution_profiler_record(const char* name, double begin, double end)
+    {
+        std::lock_guard<std::mutex> lock(profiler_mutex);
+
+        profiler_add(profiler_child(profiler_parent(), name), begin, end, 0.0, 0.0);
+    }
+
+    double _rocalution_profiler_spmv_bytes(unsigned int format,
+                                           int64_t      nrow,
+                                           int64_t      ncol,
+                                           int64_t      nnz,
+                                           int          blockdim,
+                                           size_t       value_size)
+    {
+        // Read x once and write y
+        double bytes = static_cast<double>((nrow + ncol) * value_size);
+
+        // Stored entries, nnz includes the padding of DIA, ELL and SELL and the full blocks
+        // of BCSR
+        switch(format)
+        {
+        case DENSE:
+            return bytes + static_cast<double>(nrow * ncol * value_size);
+        case CSR:
+            return bytes + static_cast<double>(nnz * (value_size + sizeof(int))
+                                               + (nrow + 1) * sizeof(PtrType));
+        case MCSR:
+            return bytes + static_cast<double>(nnz * (value_size + sizeof(int))
+                                               + (nrow + 1) * sizeof(int));
+        case BCSR:
+            blockdim = (blockdim > 0) ? blockdim : 1;
+            return bytes
+                   + static_cast<double>(nnz * value_size
+                                         + nnz / (blockdim * blockdim) * sizeof(int)
+                                         + (nrow / blockdim + 1) * sizeof(int));
+        case COO:
+            return bytes + static_cast<double>(nnz * (value_size + 2 * sizeof(int)));
+        case DIA:
+            return bytes + static_cast<double>(nnz * value_size);
+        default:
+            // ELL, SELL and HYB store a column index per entry
+            return bytes + static_cast<double>(nnz * (value_size + sizeof(int)));
+        }
+    }
+
+    void set_profiler_rocalution(bool enable)
+    {
+        log_debug(0, "set_profiler_rocalution()", enable);
+
+        std::lock_guard<std::mutex> lock(profiler_mutex);
+
+        if(enable == true && profiler_nodes.empty() == true)
+        {
+            profiler_clear();
+        }
+
+        profiler_on = enable;
+    }
+
+    void reset_profiler_rocalution(void)
+    {
+        log_debug(0, "reset_profiler_rocalution()");
+
+        std::lock_guard<std::mutex> lock(profiler_mutex);
+
+        profiler_clear();
+    }
+
+    void print_profiler_rocalution(void)
+    {
+        log_debug(0, "print_profiler_rocalution()");
+
+        std::lock_guard<std::mutex> lock(profiler_mutex);
+
+        if(profiler_nodes.empty() == true)
+        {
+            LOG_INFO("Profiler: no regions recorded");
+            return;
+        }
+
+        // Time of all top level regions
+        double total = 0.0;
+        for(size_t i = 0; i < profiler_nodes[0].children.size(); ++i)
+        {
+            total += profiler_nodes[profiler_nodes[0].children[i]].time;
+        }
+
+        total = (total > 0.0) ? total : 1.0;
+
+        std::ostringstream header;
+        header << std::left << std::setw(48) << "Region" << std::right << std::setw(10) << "calls"
+               << std::setw(14) << "time [ms]" << std::setw(14) << "avg [us]" << std::setw(8)
+               << "%" << std::setw(10) << "GB/s" << std::setw(10) << "GFLOP/s";
+
+        LOG_INFO("Profiler: " << total * 1e-3 << " ms recorded");
+        LOG_INFO(header.str());
+
+        for(size_t i = 0; i < profiler_nodes[0].children.size(); ++i)
+        {
+            profiler_print_node(profiler_nodes[0].children[i], total);
+        }
+
+        if(profiler_dropped > 0)
+        {
+            LOG_INFO("Profiler: " << profiler_dropped << " calls are missing in the timeline");
+        }
+    }
+
+    void write_profiler_rocalution(const std::string& filename)
+    {
+        log_debug(0, "write_profiler_rocalution()", filename);
+
+        std::lock_guard<std::mutex> lock(profiler_mutex);
+
+        std::ofstream file(filename.c_str(), std::ios::out | std::ios::trunc);
+
+        if(file.is_open() == false)
+        {
+            LOG_INFO("write_profiler_rocalution: cannot open file " << filename);
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        file.precision(15);
+
+        file << "{\"rank\": " << _get_backend_descriptor()->rank << ", \"regions\": [";
+
+        if(profiler_nodes.empty() == false)
+        {
+            for(size_t i = 0; i < profiler_nodes[0].children.size(); ++i)
+            {
+                file << (i == 0 ? "\n" : ",\n");
+                profiler_write_node(file, profiler_nodes[0].children[i], 2);
+            }
+        }
+
+        file << "\n]}\n";
+    }
+
+    void write_profiler_trace_rocalution(const std::string& filename)
+    {
+        log_debug(0, "write_profiler_trace_rocalution()", filename);
+
+        std::lock_guard<std::mutex> lock(profiler_mutex);
+
+        std::ofstream file(filename.c_str(), std::ios::out | std::ios::trunc);
+
+        if(file.is_open() == false)
+        {
+            LOG_INFO("write_profiler_trace_rocalution: cannot open file " << filename);
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        file.precision(15);
+
+        // Trace event format, one process per rank and one track per host thread
+        int pid = _get_backend_descriptor()->rank;
+
+        file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+        file << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << pid
+             << ", \"args\": {\"name\": \"rocALUTION rank " << pid << "\"}}";
+
+        for(size_t i = 0; i < profiler_events.size(); ++i)
+        {
+            const profiler_event& event = profiler_events[i];
+
+            file << ",\n{\"name\": " << profiler_json_string(profiler_nodes[event.node].name)
+                 << ", \"cat\": \"rocalution\", \"ph\": \"X\", \"pid\": " << pid
+                 << ", \"tid\": " << event.tid << ", \"ts\": " << event.begin
+                 << ", \"dur\": " << event.end - event.begin << ", \"args\": {\"bytes\": "
+                 << event.bytes << ", \"flops\": " << event.flops << "}}";
+        }
+
+        file << "\n]}\n";
+    }
+
+    void _rocalution_open_profiler(void)
+    {
+        char* str_profile_mode;
+        if((str_profile_mode = getenv("ROCALUTION_PROFILE")) != NULL)
+        {
+            profiler_env = atoi(str_profile_mode);
+
+            if(profiler_env > 0)
+            {
+                set_profiler_rocalution(true);
+            }
+        }
+    }
+
+    void _rocalution_close_profiler(void)
+    {
+        if(profiler_env > 0)
+        {
+            print_profiler_rocalution();
+
+            if(profiler_env > 1)
+            {
+                std::ostringstream rank;
+                rank << _get_backend_descriptor()->rank;
+
+                write_profiler_rocalution("rocalution-profile-rank-" + rank.str() + ".json");
+                write_profiler_trace_rocalution("rocalution-trace-rank-" + rank.str() + ".json");
+            }
+
+            set_profiler_rocalution(false);
+
+            profiler_env = 0;
+        }
+    }
+
+} // namespace rocalution
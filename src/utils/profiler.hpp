@@ -0,0 +1,94 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_UTILS_PROFILER_HPP_
+#define ROCALUTION_UTILS_PROFILER_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace rocalution
+{
+
+    // Return true, if the profiler records regions
+    bool _rocalution_profiler_active(void);
+
+    // Open a region as child of the innermost open region of the calling thread. If
+    // index is not negative, it is appended to the name (e.g. the multigrid level).
+    void _rocalution_profiler_begin(const char* name, int index, double bytes, double flops);
+
+    // Close the innermost open region of the calling thread
+    void _rocalution_profiler_end(void);
+
+    // Record a region that has already finished, as child of the innermost open region
+    void _rocalution_profiler_record(const char* name, double begin, double end);
+
+    // Open the profiler, if enabled by the environment, and report it when closed
+    void _rocalution_open_profiler(void);
+    void _rocalution_close_profiler(void);
+
+    // Estimated number of bytes that are moved by a matrix vector product with a matrix
+    // of the given format
+    double _rocalution_profiler_spmv_bytes(unsigned int format,
+                                           int64_t      nrow,
+                                           int64_t      ncol,
+                                           int64_t      nnz,
+                                           int          blockdim,
+                                           size_t       value_size);
+
+    // Scoped profiler region, which is closed when the object goes out of scope. Bytes
+    // and flops are the estimated memory traffic and floating point operations of the
+    // region.
+    class ProfilerRegion
+    {
+    public:
+        explicit ProfilerRegion(const char* name,
+                                int         index = -1,
+                                double      bytes = 0.0,
+                                double      flops = 0.0)
+            : active_(_rocalution_profiler_active())
+        {
+            if(this->active_ == true)
+            {
+                _rocalution_profiler_begin(name, index, bytes, flops);
+            }
+        }
+
+        ~ProfilerRegion()
+        {
+            if(this->active_ == true)
+            {
+                _rocalution_profiler_end();
+            }
+        }
+
+    private:
+        ProfilerRegion(const ProfilerRegion&);
+        ProfilerRegion& operator=(const ProfilerRegion&);
+
+        bool active_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_UTILS_PROFILER_HPP_
@@ -26,6 +26,7 @@
 
 #include "def.hpp"
 
+#include <cstdint>
 #include <limits>
 
 //#define IndexType2 int
@@ -34,6 +35,15 @@
 
 namespace rocalution
 {
+    // Type of the CSR row offsets and of the number of non-zero entries. Column
+    // indices are always int. With BUILD_64BIT_OFFSETS, matrices with more than
+    // 2^31 non-zero entries can be held on the host.
+#ifdef ROCALUTION_64BIT_OFFSETS
+    typedef int64_t PtrType;
+#else
+    typedef int PtrType;
+#endif
+
     struct mis_tuple
     {
         int          s;